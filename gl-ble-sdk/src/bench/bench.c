@@ -0,0 +1,114 @@
+/*****************************************************************************
+ * @file  bench.c
+ * @brief Benchmarks of the driver pipeline
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+
+uint64_t bench_now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a;
+	uint64_t y = *(const uint64_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+static void print_line(const char *name, uint64_t ops, uint64_t elapsed, double p50, double p99)
+{
+	double rate = elapsed ? (double)ops * 1000000000.0 / elapsed : 0;
+
+	printf("%-28s %10llu %14.0f %12.1f %12.1f\n", name, (unsigned long long)ops, rate, p50, p99);
+}
+
+void bench_report(const char *name, uint64_t ops, uint64_t elapsed, uint64_t *samples, size_t num)
+{
+	double p50 = 0, p99 = 0;
+
+	if (num)
+	{
+		qsort(samples, num, sizeof(uint64_t), cmp_u64);
+		p50 = samples[num / 2];
+		p99 = samples[(num * 99) / 100];
+	}
+
+	print_line(name, ops, elapsed, p50, p99);
+}
+
+void bench_report_hist(const char *name, uint64_t ops, uint64_t elapsed, uint32_t p50, uint32_t p99)
+{
+	print_line(name, ops, elapsed, p50 * 1000.0, p99 * 1000.0);
+}
+
+static void usage(const char *name)
+{
+	printf("Usage: %s [-n iterations] [driver|util]\n", name);
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t iterations = 100000;
+	const char *suite = NULL;
+	int i;
+
+	for (i = 1; i < argc; i++)
+	{
+		if ((0 == strcmp(argv[i], "-n")) && (i + 1 < argc))
+		{
+			iterations = strtoul(argv[++i], NULL, 0);
+		}
+		else if ((0 == strcmp(argv[i], "driver")) || (0 == strcmp(argv[i], "util")))
+		{
+			suite = argv[i];
+		}
+		else
+		{
+			usage(argv[0]);
+			return -1;
+		}
+	}
+
+	if (iterations < BENCH_BATCH)
+	{
+		iterations = BENCH_BATCH;
+	}
+
+	printf("%-28s %10s %14s %12s %12s\n", "benchmark", "ops", "ops/s", "p50 (ns)", "p99 (ns)");
+
+	if ((!suite) || (0 == strcmp(suite, "util")))
+	{
+		bench_util(iterations);
+	}
+
+	if ((!suite) || (0 == strcmp(suite, "driver")))
+	{
+		bench_driver(iterations);
+	}
+
+	return 0;
+}
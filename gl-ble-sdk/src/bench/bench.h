@@ -0,0 +1,64 @@
+/*****************************************************************************
+ * @file  bench.h
+ * @brief Benchmarks of the driver pipeline
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// the in-process NCP the driver is connected to
+#define BENCH_NCP_PATH "/tmp/gl_ble_bench.sock"
+
+// operations timed together by the micro benchmarks, a single one is shorter than the clock read
+#define BENCH_BATCH 100
+
+uint64_t bench_now(void);
+
+/*
+ * Print one result line. samples are the time of an operation (ns), they are sorted in place.
+ */
+void bench_report(const char *name, uint64_t ops, uint64_t elapsed, uint64_t *samples, size_t num);
+
+/*
+ * Print one result line with the percentiles of a SDK histogram (us).
+ */
+void bench_report_hist(const char *name, uint64_t ops, uint64_t elapsed, uint32_t p50, uint32_t p99);
+
+/*
+ * Listen on BENCH_NCP_PATH and answer the commands of the driver, a reset is answered by a boot event.
+ */
+int bench_ncp_start(void);
+
+void bench_ncp_stop(void);
+
+/*
+ * Write whole frames to the driver, they are not mixed with the responses.
+ */
+int bench_ncp_write(const uint8_t *buf, size_t len);
+
+/*
+ * Append an event to buf, return its length.
+ */
+size_t bench_ncp_event(uint8_t *buf, uint32_t id, const void *payload, size_t len);
+
+void bench_driver(uint32_t iterations);
+
+void bench_util(uint32_t iterations);
+
+#endif
@@ -0,0 +1,229 @@
+/*****************************************************************************
+ * @file  bench_driver.c
+ * @brief Parse, dispatch and command round trip of the driver against the in-process NCP
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "gl_bleapi.h"
+#include "gl_errno.h"
+#include "gl_type.h"
+#include "sli_bt_api.h"
+#include "bench.h"
+
+// frames of the canned stream, written again until enough were sent
+#define STREAM_FRAMES 256
+
+// scan reports in flight, the watcher queue holds a few dozen before it drops
+#define DISPATCH_WINDOW 16
+
+// ms to wait for the driver to catch up
+#define DRAIN_TIMEOUT 10000
+
+static volatile uint32_t scan_results = 0;
+
+static int32_t gap_cb(gl_ble_gap_event_t event, gl_ble_gap_data_t *data)
+{
+	if (event == GAP_BLE_SCAN_RESULT_EVT)
+	{
+		__atomic_add_fetch(&scan_results, 1, __ATOMIC_RELEASE);
+	}
+	return 0;
+}
+
+/* Wait until counter reaches target, or the drops make it unreachable. */
+static int wait_count(volatile uint32_t *counter, uint32_t target, uint64_t drops)
+{
+	uint64_t deadline = bench_now() + DRAIN_TIMEOUT * 1000000ULL;
+	gl_ble_stats_t stats;
+
+	while (bench_now() < deadline)
+	{
+		if (__atomic_load_n(counter, __ATOMIC_ACQUIRE) >= target)
+		{
+			return 0;
+		}
+
+		gl_ble_get_stats(&stats);
+		if (__atomic_load_n(counter, __ATOMIC_ACQUIRE) + stats.watcher_queue_drops - drops >= target)
+		{
+			return 0;
+		}
+		usleep(10);
+	}
+
+	return -1;
+}
+
+/* Events the driver parses and does not hand to the watcher, of every payload length. */
+static void bench_parse(uint32_t iterations)
+{
+	static uint8_t stream[STREAM_FRAMES * (SL_BGAPI_MSG_HEADER_LEN + SL_BGAPI_MAX_PAYLOAD_SIZE)];
+	uint8_t payload[SL_BGAPI_MAX_PAYLOAD_SIZE];
+	size_t len = 0;
+	gl_ble_stats_t stats;
+	gl_ble_latency_stats_t latency;
+	int i;
+
+	for (i = 0; i < STREAM_FRAMES; i++)
+	{
+		uint8_t data_len = (uint8_t)((i * 37) % 250);
+		payload[0] = data_len;
+		memset(payload + 1, i, data_len);
+		len += bench_ncp_event(stream + len, sl_bt_evt_user_message_to_host_id, payload, 1 + data_len);
+	}
+
+	gl_ble_get_stats(&stats);
+	uint64_t target = stats.rx_evt_frames + iterations;
+	gl_ble_clear_latency();
+
+	uint64_t start = bench_now();
+	uint32_t sent = 0;
+	while (sent < iterations)
+	{
+		bench_ncp_write(stream, len);
+		sent += STREAM_FRAMES;
+	}
+	target += sent - iterations;
+
+	uint64_t deadline = start + DRAIN_TIMEOUT * 1000000ULL;
+	do
+	{
+		gl_ble_get_stats(&stats);
+	} while ((stats.rx_evt_frames < target) && (bench_now() < deadline));
+	uint64_t elapsed = bench_now() - start;
+
+	gl_ble_get_latency(&latency);
+	bench_report_hist("parse", sent, elapsed, latency.stage[LATENCY_STAGE_UART].p50, latency.stage[LATENCY_STAGE_UART].p99);
+}
+
+/* Scan reports from the serial port to the return of the callback. */
+static void bench_dispatch(uint32_t iterations)
+{
+	uint8_t stream[DISPATCH_WINDOW * (SL_BGAPI_MSG_HEADER_LEN + SL_BGAPI_MAX_PAYLOAD_SIZE)];
+	uint8_t payload[SL_BGAPI_MAX_PAYLOAD_SIZE];
+	size_t len = 0;
+	gl_ble_stats_t stats;
+	gl_ble_latency_stats_t latency;
+	int i;
+
+	for (i = 0; i < DISPATCH_WINDOW; i++)
+	{
+		memset(payload, 0, sizeof(payload));
+		sl_bt_evt_scanner_scan_report_t *report = (sl_bt_evt_scanner_scan_report_t *)payload;
+		report->address.addr[0] = i;
+		report->bonding = 0xff;
+		report->rssi = -60;
+		report->data.len = 31;
+		memset(report->data.data, 0x5a, 31);
+		len += bench_ncp_event(stream + len, sl_bt_evt_scanner_scan_report_id, payload, sizeof(sl_bt_evt_scanner_scan_report_t) + 31);
+	}
+
+	gl_ble_get_stats(&stats);
+	uint64_t drops = stats.watcher_queue_drops;
+	uint32_t base = scan_results;
+	gl_ble_clear_latency();
+
+	uint64_t start = bench_now();
+	uint32_t sent = 0;
+	while (sent < iterations)
+	{
+		bench_ncp_write(stream, len);
+		sent += DISPATCH_WINDOW;
+		if (wait_count(&scan_results, base + sent, drops) != 0)
+		{
+			break;
+		}
+	}
+	uint64_t elapsed = bench_now() - start;
+
+	gl_ble_get_stats(&stats);
+	if (stats.watcher_queue_drops != drops)
+	{
+		printf("dispatch: %llu events dropped\n", (unsigned long long)(stats.watcher_queue_drops - drops));
+	}
+
+	gl_ble_get_latency(&latency);
+	bench_report_hist("dispatch", scan_results - base, elapsed, latency.stage[LATENCY_STAGE_TOTAL].p50, latency.stage[LATENCY_STAGE_TOTAL].p99);
+}
+
+/* A command and its response, the NCP answers at once. */
+static void bench_cmd(uint32_t iterations)
+{
+	BLE_MAC mac;
+	uint32_t i;
+
+	uint64_t *samples = (uint64_t *)malloc(iterations * sizeof(uint64_t));
+	if (!samples)
+	{
+		return;
+	}
+
+	uint64_t start = bench_now();
+	for (i = 0; i < iterations; i++)
+	{
+		uint64_t t = bench_now();
+		if (gl_ble_get_mac(mac) != GL_SUCCESS)
+		{
+			break;
+		}
+		samples[i] = bench_now() - t;
+	}
+	uint64_t elapsed = bench_now() - start;
+
+	bench_report("command round trip", i, elapsed, samples, i);
+	free(samples);
+}
+
+void bench_driver(uint32_t iterations)
+{
+	gl_ble_hw_cfg_t cfg;
+	gl_ble_cbs cbs;
+
+	if (bench_ncp_start() != 0)
+	{
+		return;
+	}
+
+	memset(&cfg, 0, sizeof(cfg));
+	strncpy(cfg.model, "bench", sizeof(cfg.model) - 1);
+	snprintf(cfg.port, sizeof(cfg.port), "unix:%s", BENCH_NCP_PATH);
+	cfg.flags = HW_CFG_NO_RST_IO;
+
+	memset(&cbs, 0, sizeof(cbs));
+	cbs.ble_gap_event = gap_cb;
+
+	// the module is reset by command and has booted when init returns
+	if ((gl_ble_set_hw_cfg(&cfg) != GL_SUCCESS) || (gl_ble_init() != GL_SUCCESS) || (gl_ble_subscribe(&cbs) != GL_SUCCESS))
+	{
+		printf("driver init failed\n");
+		gl_ble_destroy();
+		bench_ncp_stop();
+		return;
+	}
+
+	bench_parse(iterations);
+	bench_dispatch(iterations);
+	bench_cmd(iterations);
+
+	gl_ble_unsubscribe();
+	gl_ble_destroy();
+	bench_ncp_stop();
+}
@@ -0,0 +1,186 @@
+/*****************************************************************************
+ * @file  bench_ncp.c
+ * @brief A NCP in the benchmark process, reached by the driver through a unix socket
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "sli_bt_api.h"
+#include "bench.h"
+
+// bytes after the result of a response, they cover the fixed fields of any response
+#define RSP_PAD 32
+
+static int listen_fd = -1;
+static int conn_fd = -1;
+static pthread_t ncp_tid;
+static pthread_mutex_t write_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static int write_all(const uint8_t *buf, size_t len)
+{
+	while (len)
+	{
+		ssize_t ret = send(conn_fd, buf, len, MSG_NOSIGNAL);
+		if (ret < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return -1;
+		}
+		buf += ret;
+		len -= ret;
+	}
+
+	return 0;
+}
+
+int bench_ncp_write(const uint8_t *buf, size_t len)
+{
+	pthread_mutex_lock(&write_mutex);
+	int ret = write_all(buf, len);
+	pthread_mutex_unlock(&write_mutex);
+
+	return ret;
+}
+
+size_t bench_ncp_event(uint8_t *buf, uint32_t id, const void *payload, size_t len)
+{
+	uint32_t header = id | ((len & 0xff) << 8) | ((len & 0x700) >> 8);
+
+	memcpy(buf, &header, SL_BGAPI_MSG_HEADER_LEN);
+	memcpy(buf + SL_BGAPI_MSG_HEADER_LEN, payload, len);
+
+	return SL_BGAPI_MSG_HEADER_LEN + len;
+}
+
+static void answer(uint32_t header)
+{
+	uint8_t buf[SL_BGAPI_MSG_HEADER_LEN + SL_BGAPI_MAX_PAYLOAD_SIZE];
+	uint8_t payload[SL_BGAPI_MAX_PAYLOAD_SIZE];
+	uint32_t id = SL_BGAPI_MSG_ID(header);
+	size_t len;
+
+	memset(payload, 0, sizeof(payload));
+
+	if (id == sl_bt_cmd_system_reset_id)
+	{
+		sl_bt_evt_system_boot_t *boot = (sl_bt_evt_system_boot_t *)payload;
+		boot->major = 3;
+		boot->minor = 2;
+		boot->patch = 4;
+		len = bench_ncp_event(buf, sl_bt_evt_system_boot_id, payload, sizeof(sl_bt_evt_system_boot_t));
+	}
+	else
+	{
+		// success, and zero in every field
+		len = bench_ncp_event(buf, id, payload, sizeof(uint16_t) + RSP_PAD);
+	}
+
+	bench_ncp_write(buf, len);
+}
+
+static void *ncp_thread(void *arg)
+{
+	uint8_t buf[SL_BGAPI_MSG_HEADER_LEN + SL_BGAPI_MAX_PAYLOAD_SIZE];
+	size_t buf_len = 0;
+
+	conn_fd = accept(listen_fd, NULL, NULL);
+	if (conn_fd < 0)
+	{
+		return NULL;
+	}
+
+	while (1)
+	{
+		ssize_t ret = recv(conn_fd, buf + buf_len, sizeof(buf) - buf_len, 0);
+		if (ret <= 0)
+		{
+			break;
+		}
+		buf_len += ret;
+
+		// commands come one at a time, a partial one waits for the rest
+		while (buf_len >= SL_BGAPI_MSG_HEADER_LEN)
+		{
+			uint32_t header;
+			memcpy(&header, buf, SL_BGAPI_MSG_HEADER_LEN);
+			size_t len = SL_BGAPI_MSG_HEADER_LEN + SL_BGAPI_MSG_LEN(header);
+			if (buf_len < len)
+			{
+				break;
+			}
+
+			answer(header);
+			memmove(buf, buf + len, buf_len - len);
+			buf_len -= len;
+		}
+	}
+
+	return NULL;
+}
+
+int bench_ncp_start(void)
+{
+	struct sockaddr_un sun;
+
+	listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (listen_fd < 0)
+	{
+		return -1;
+	}
+
+	memset(&sun, 0, sizeof(sun));
+	sun.sun_family = AF_UNIX;
+	strncpy(sun.sun_path, BENCH_NCP_PATH, sizeof(sun.sun_path) - 1);
+	unlink(BENCH_NCP_PATH);
+
+	if ((bind(listen_fd, (struct sockaddr *)&sun, sizeof(sun)) != 0) || (listen(listen_fd, 1) != 0))
+	{
+		printf("listen on %s failed: %s\n", BENCH_NCP_PATH, strerror(errno));
+		close(listen_fd);
+		return -1;
+	}
+
+	if (pthread_create(&ncp_tid, NULL, ncp_thread, NULL) != 0)
+	{
+		close(listen_fd);
+		return -1;
+	}
+
+	return 0;
+}
+
+void bench_ncp_stop(void)
+{
+	// the thread leaves when the driver closed its end, or wakes up from accept if it never connected
+	shutdown(listen_fd, SHUT_RDWR);
+	pthread_join(ncp_tid, NULL);
+	if (conn_fd >= 0)
+	{
+		close(conn_fd);
+	}
+	close(listen_fd);
+	unlink(BENCH_NCP_PATH);
+}
@@ -0,0 +1,146 @@
+/*****************************************************************************
+ * @file  bench_util.c
+ * @brief Device table lookups and hex conversions
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gl_common.h"
+#include "gl_dev_mgr.h"
+#include "gl_radio.h"
+#include "bench.h"
+
+// the table of a radio the driver benchmarks do not use
+#define BENCH_RADIO (RADIO_MAX - 1)
+
+#define DEV_MAX 32
+
+static void bench_dev_mgr(uint32_t iterations, int dev_num)
+{
+	char addr[DEV_MAX][MAC_STR_LEN];
+	char mac[MAC_STR_LEN];
+	char name[32];
+	int i, j;
+
+	size_t num = iterations / BENCH_BATCH;
+	uint64_t *samples = (uint64_t *)malloc(num * sizeof(uint64_t));
+	if (!samples)
+	{
+		return;
+	}
+
+	radio_bind(BENCH_RADIO);
+	ble_dev_mgr_init();
+	for (i = 0; i < dev_num; i++)
+	{
+		snprintf(addr[i], MAC_STR_LEN, "80:e1:26:00:00:%02x", (uint8_t)i);
+		ble_dev_mgr_add(addr[i], i + 1);
+	}
+
+	// every device is looked up as often, by address as a command does and by connection as an event does
+	uint64_t start = bench_now();
+	for (i = 0; i < (int)num; i++)
+	{
+		uint64_t t = bench_now();
+		for (j = 0; j < BENCH_BATCH; j++)
+		{
+			int connection = 0;
+			int dev = (i * BENCH_BATCH + j) % dev_num;
+			if (j & 1)
+			{
+				ble_dev_mgr_get_address(dev + 1, mac);
+			}
+			else
+			{
+				ble_dev_mgr_get_connection(addr[dev], &connection);
+			}
+		}
+		samples[i] = (bench_now() - t) / BENCH_BATCH;
+	}
+	uint64_t elapsed = bench_now() - start;
+
+	ble_dev_mgr_destroy();
+	radio_bind(0);
+
+	snprintf(name, sizeof(name), "dev_mgr lookup %d conn", dev_num);
+	bench_report(name, num * BENCH_BATCH, elapsed, samples, num);
+	free(samples);
+}
+
+static void bench_hex(uint32_t iterations, int len)
+{
+	uint8_t data[128];
+	char str[256];
+	char name[32];
+	int i, j;
+
+	size_t num = iterations / BENCH_BATCH;
+	uint64_t *samples = (uint64_t *)malloc(num * sizeof(uint64_t));
+	if (!samples)
+	{
+		return;
+	}
+
+	for (i = 0; i < len; i++)
+	{
+		data[i] = (uint8_t)(i * 7);
+	}
+
+	uint64_t start = bench_now();
+	for (i = 0; i < (int)num; i++)
+	{
+		uint64_t t = bench_now();
+		for (j = 0; j < BENCH_BATCH; j++)
+		{
+			hex2str(data, len, str);
+		}
+		samples[i] = (bench_now() - t) / BENCH_BATCH;
+	}
+	snprintf(name, sizeof(name), "hex2str %d bytes", len);
+	bench_report(name, num * BENCH_BATCH, bench_now() - start, samples, num);
+
+	start = bench_now();
+	for (i = 0; i < (int)num; i++)
+	{
+		uint64_t t = bench_now();
+		for (j = 0; j < BENCH_BATCH; j++)
+		{
+			str2array(data, str, len);
+		}
+		samples[i] = (bench_now() - t) / BENCH_BATCH;
+	}
+	snprintf(name, sizeof(name), "str2array %d bytes", len);
+	bench_report(name, num * BENCH_BATCH, bench_now() - start, samples, num);
+
+	free(samples);
+}
+
+void bench_util(uint32_t iterations)
+{
+	int dev_num;
+
+	for (dev_num = 1; dev_num <= DEV_MAX; dev_num *= 2)
+	{
+		bench_dev_mgr(iterations, dev_num);
+	}
+
+	// advertising data, and the longest value hex2str converts
+	bench_hex(iterations, 31);
+	bench_hex(iterations, 127);
+}
@@ -20,98 +20,116 @@
 #include "gl_hal.h"
 
 /*
-    hw_cfg_t DEFAULT_BLE_HW_CFG = {                                          
-        "default",      // model name                                  
-        "/dev/ttyS0", // serial port name                              
-        115200,         // baud rate (bits/second)                     
-        0,              // true enables RTS/CTS flow control           
-        1,              // rst trigger: 1 means high, 0 means low      
-        1,              // RTS IO                                      
-    };
+    {
+        "default",              // model name
+        "/dev/ttyS0",           // serial port name
+        115200,                 // baud rate (bits/second)
+        0,                      // true enables RTS/CTS flow control
+        1,                      // rst trigger: 1 means high, 0 means low
+        1,                      // RTS IO
+        20,                     // reset pulse width (ms)
+        0,                      // HW_CFG_* flags
+    },
+
+    A board missing here is added with the options of the same names in the "hw" section of /etc/config/gl_ble:
+    model, port, baudrate, flowcontrol, rst_trigger, rst_gpio, rst_pulse, flags, max_conn. They also override the entry of a known model.
+    Extra modules, such as USB dongles, are described by the sections "hw1", "hw2" ...
+    The port of a NCP behind a pty or socket is "pty:<path>", "unix:<path>" or "tcp:<host>:<port>", see gl_transport.h.
 */
 
-
-hw_cfg_t X750_BLE_HW_CFG = {                                         
-    "x750",      // model name                                     
-    "/dev/ttyS0", // serial port name                              
-    115200,         // baud rate (bits/second)                     
-    0,              // true enables RTS/CTS flow control           
-    1,              // rst trigger: 1 means high, 0 means low      
-    1,              // RTS IO                                      
-};
-
-hw_cfg_t S1300_BLE_HW_CFG = {                                        
-    "s1300",      // model name                                    
-    "/dev/ttyMSM1", // serial port name                            
-    115200,         // baud rate (bits/second)                     
-    0,              // true enables RTS/CTS flow control           
-    1,              // rst trigger: 1 means high, 0 means low      
-    48,              // RTS IO                                      
-};
-
-hw_cfg_t XE300_BLE_HW_CFG = {                                      
-    "xe300",      // model name                                  
-    "/dev/ttyS0", // serial port name                            
-    115200,         // baud rate (bits/second)                     
-    0,              // true enables RTS/CTS flow control           
-    1,              // rst trigger: 1 means high, 0 means low      
-    14,              // RTS IO                                      
-};
-
-hw_cfg_t MT300N_V2_BLE_HW_CFG = {                                                                    
-    "mt300n-v2",      // model name                                  
-    "/dev/ttyS1", // serial port name 
-    //"/dev/ttyUSB0", // serial port name                                
-    115200,         // baud rate (bits/second)                     
-    0,              // true enables RTS/CTS flow control           
-    1,              // rst trigger: 1 means high, 0 means low      
-    5,              // RTS IO                                      
-};
-
-hw_cfg_t E750_BLE_HW_CFG = {                                        
-    "e750",      // model name                                    
-    "/dev/ttyUSB0", // serial port name                           
-    115200,         // baud rate (bits/second)                    
-    0,              // true enables RTS/CTS flow control          
-    1,              // rst trigger: 1 means high, 0 means low     
-    17,              // RTS IO                                    
-};
-
-hw_cfg_t X300B_BLE_HW_CFG = {                                                                    
-    "x300b",      // model name                                  
-    "/dev/ttyS0", // serial port name                            
-    115200,         // baud rate (bits/second)                     
-    0,              // true enables RTS/CTS flow control           
-    1,              // rst trigger: 1 means high, 0 means low      
-    13,              // RTS IO                                      
-};
-
-hw_cfg_t AP1300_BLE_HW_CFG = {                                                                    
-    "ap1300",      // model name                                  
-    "/dev/ttyUSB0", // serial port name                            
-    115200,         // baud rate (bits/second)                     
-    0,              // true enables RTS/CTS flow control           
-    1,              // rst trigger: 1 means high, 0 means low      
-    62,              // RTS IO                                      
-};
-
-hw_cfg_t B2200_BLE_HW_CFG = {                                                                    
-    "b2200",      // model name                                  
-    "/dev/ttyHS0", // serial port name                            
-    115200,         // baud rate (bits/second)                     
-    0,              // true enables RTS/CTS flow control           
-    1,              // rst trigger: 1 means high, 0 means low      
-    43,              // RTS IO                                      
-};
-
-hw_cfg_t S200_BLE_HW_CFG = {                                                                    
-    "s200",         // model name                                  
-    "/dev/ttyS0",   // serial port name                            
-    115200,         // baud rate (bits/second)                     
-    0,              // true enables RTS/CTS flow control           
-    1,              // rst trigger: 1 means high, 0 means low      
-    1,              // RTS IO                                      
+static const hw_cfg_t model_hw_cfg_list[] = {
+    {
+        "x750",                 // model name
+        "/dev/ttyS0",           // serial port name
+        115200,                 // baud rate (bits/second)
+        0,                      // true enables RTS/CTS flow control
+        1,                      // rst trigger: 1 means high, 0 means low
+        1,                      // RTS IO
+        20,                     // reset pulse width (ms)
+        HW_CFG_QUIET_PRINTK,    // HW_CFG_* flags
+    },
+    {
+        "s1300",                // model name
+        "/dev/ttyMSM1",         // serial port name
+        115200,                 // baud rate (bits/second)
+        0,                      // true enables RTS/CTS flow control
+        1,                      // rst trigger: 1 means high, 0 means low
+        48,                     // RTS IO
+        20,                     // reset pulse width (ms)
+        HW_CFG_QSDK_GPIO,       // HW_CFG_* flags
+    },
+    {
+        "xe300",                // model name
+        "/dev/ttyS0",           // serial port name
+        115200,                 // baud rate (bits/second)
+        0,                      // true enables RTS/CTS flow control
+        1,                      // rst trigger: 1 means high, 0 means low
+        14,                     // RTS IO
+        20,                     // reset pulse width (ms)
+        HW_CFG_QUIET_PRINTK,    // HW_CFG_* flags
+    },
+    {
+        "mt300n-v2",            // model name
+        "/dev/ttyS1",           // serial port name
+        115200,                 // baud rate (bits/second)
+        0,                      // true enables RTS/CTS flow control
+        1,                      // rst trigger: 1 means high, 0 means low
+        5,                      // RTS IO
+        20,                     // reset pulse width (ms)
+        0,                      // HW_CFG_* flags
+    },
+    {
+        "e750",                 // model name
+        "/dev/ttyUSB0",         // serial port name
+        115200,                 // baud rate (bits/second)
+        0,                      // true enables RTS/CTS flow control
+        1,                      // rst trigger: 1 means high, 0 means low
+        17,                     // RTS IO
+        20,                     // reset pulse width (ms)
+        0,                      // HW_CFG_* flags
+    },
+    {
+        "x300b",                // model name
+        "/dev/ttyS0",           // serial port name
+        115200,                 // baud rate (bits/second)
+        0,                      // true enables RTS/CTS flow control
+        1,                      // rst trigger: 1 means high, 0 means low
+        13,                     // RTS IO
+        20,                     // reset pulse width (ms)
+        HW_CFG_QUIET_PRINTK,    // HW_CFG_* flags
+    },
+    {
+        "ap1300",               // model name
+        "/dev/ttyUSB0",         // serial port name
+        115200,                 // baud rate (bits/second)
+        0,                      // true enables RTS/CTS flow control
+        1,                      // rst trigger: 1 means high, 0 means low
+        62,                     // RTS IO
+        20,                     // reset pulse width (ms)
+        HW_CFG_QSDK_GPIO,       // HW_CFG_* flags
+    },
+    {
+        "b2200",                // model name
+        "/dev/ttyHS0",          // serial port name
+        115200,                 // baud rate (bits/second)
+        0,                      // true enables RTS/CTS flow control
+        1,                      // rst trigger: 1 means high, 0 means low
+        43,                     // RTS IO
+        20,                     // reset pulse width (ms)
+        HW_CFG_QSDK_GPIO,       // HW_CFG_* flags
+    },
+    {
+        "s200",                 // model name
+        "/dev/ttyS0",           // serial port name
+        115200,                 // baud rate (bits/second)
+        0,                      // true enables RTS/CTS flow control
+        1,                      // rst trigger: 1 means high, 0 means low
+        1,                      // RTS IO
+        20,                     // reset pulse width (ms)
+        0,                      // HW_CFG_* flags
+    },
 };
 
+#define MODEL_HW_CFG_NUM (sizeof(model_hw_cfg_list) / sizeof(hw_cfg_t))
 
-#endif
\ No newline at end of file
+#endif
@@ -19,6 +19,9 @@
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sys/stat.h>
 
 #include "sl_bt_api.h"
 #include "gl_uart.h"
@@ -30,25 +33,40 @@
 #include "gl_common.h"
 #include "silabs_msg.h"
 #include "gl_dev_mgr.h"
-
-extern struct sl_bt_packet *evt;
-extern bool wait_reset_flag;
-extern bool appBooted;
+#include "silabs_proc.h"
+#include "silabs_dfu.h"
+#include "silabs_sampler.h"
+#include "silabs_state.h"
+#include "timestamp.h"
+#include "gl_radio.h"
+#include "gl_log.h"
+
+// data of one dfu_flash_upload command, the most of the BGAPI payload in words
+#define DFU_CHUNK_MAX 252
+#define DFU_RETRY_MAX 3
+#define DFU_BOOT_TIMEOUT 3000
+#define DFU_FINISH_TIMEOUT 5000
+// save the acknowledged offset about every 8KB
+#define DFU_SESSION_SAVE_CHUNKS 32
+
+#define RESET_RETRY_MAX 3
+#define RESET_OFF_TIMEOUT 3000
+#define RESET_BOOT_TIMEOUT 3000
+// a running module answers system_hello at once
+#define PROBE_TIMEOUT 100
 
 GL_RET silabs_ble_enable(int enable)
 {
     if (enable)
     {
-        system(rston);
+        hal_rst_set(1);
     }
     else
     {
         // wait sub thread recv end
-        wait_reset_flag = true;
-        // usleep(100*1000);
-        while (wait_reset_flag)
+        if (silabs_reset_wait(RESET_OFF_TIMEOUT) != 0)
         {
-            usleep(10 * 1000);
+            return GL_UNKNOW_ERR;
         }
     }
 
@@ -57,63 +75,87 @@ GL_RET silabs_ble_enable(int enable)
 
 GL_RET silabs_ble_hard_reset(void)
 {
-    int reset_time = 0;
-    int wait_s;
-    int wait_off;
+    int reset_time;
 
-    // max retry 3 times
-    while (reset_time < 3)
+    for (reset_time = 0; reset_time < RESET_RETRY_MAX; reset_time++)
     {
-        wait_s = 30;    // 3s = 30 * 100ms
-        wait_off = 300; // 3s = 300 * 10ms
+        uint64_t off_time = utils_get_time_ns();
 
-        wait_reset_flag = true;
-        // wait for turn off ble module
-        while ((wait_reset_flag) && (wait_off > 0))
+        // turn off ble module
+        if (silabs_reset_wait(RESET_OFF_TIMEOUT) != 0)
         {
-            wait_off--;
-            usleep(10 * 1000);
-        }
-
-        // check turn off end
-        if ((appBooted) || (wait_off <= 0))
-        {
-            // error
-            reset_time++;
+            log_err("ble module reset timeout\n");
             continue;
         }
 
-        // wait 300 ms
-        usleep(300 * 1000);
-
-        // turn on ble module
-        system(rston);
+        if (hal_rst_io())
+        {
+            // hold the reset IO for the pulse width of the model
+            uint64_t held = (utils_get_time_ns() - off_time) / 1000;
+            uint64_t pulse = (uint64_t)hal_rst_pulse() * 1000;
+            if (held < pulse)
+            {
+                usleep(pulse - held);
+            }
 
-        // wait for ble module start
-        while ((!appBooted) && (wait_s > 0))
+            // turn on ble module, the driver signals its boot event
+            hal_rst_set(1);
+        }
+        else
         {
-            wait_s--;
-            usleep(100 * 1000);
+            // a module without reset IO kept running, it is rebooted by command
+            sl_bt_system_reset(0);
         }
-
-        // if ble module start success, break loop
-        if (appBooted)
+        if (silabs_wait_booted(RESET_BOOT_TIMEOUT) == 0)
         {
-            break;
+            return GL_SUCCESS;
         }
 
-        // ble module start timeout
-        reset_time++;
+        log_err("ble module boot timeout\n");
     }
 
-    if (reset_time < 3)
+    return GL_UNKNOW_ERR;
+}
+
+GL_RET silabs_ble_wait_boot(uint32_t timeout)
+{
+    if (silabs_wait_booted(timeout) != 0)
     {
-        return GL_SUCCESS;
+        return GL_ERR_EVENT_MISSING;
     }
-    else
+
+    return GL_SUCCESS;
+}
+
+GL_RET silabs_ble_probe(void)
+{
+    if (silabs_probe(PROBE_TIMEOUT) != 0)
     {
-        return GL_UNKNOW_ERR;
+        return GL_ERR_RESP_MISSING;
+    }
+
+    return GL_SUCCESS;
+}
+
+GL_RET silabs_ble_attach(void)
+{
+    if (silabs_state_attach() != 0)
+    {
+        return GL_ERR_RESP_MISSING;
+    }
+
+    return GL_SUCCESS;
+}
+
+GL_RET silabs_ble_get_attach_info(gl_ble_attach_info_t *info)
+{
+    if (!info)
+    {
+        return GL_ERR_PARAM;
     }
+
+    silabs_state_get_info(info);
+    return GL_SUCCESS;
 }
 
 GL_RET silabs_ble_local_mac(BLE_MAC mac)
@@ -171,37 +213,61 @@ GL_RET silabs_ble_stop_discovery(void)
     return GL_SUCCESS;
 }
 
-uint8_t handle = 0xff;
+// the advertising set of each radio, 0xff if none
+uint8_t adv_handle[RADIO_MAX] = { [0 ... RADIO_MAX - 1] = 0xff };
 
-GL_RET silabs_ble_adv(int phys, int interval_min, int interval_max, int discover, int adv_conn)
+static sl_status_t adv_create_set(void)
 {
+    uint8_t *handle = &adv_handle[radio_cur()];
+    sl_status_t status = sl_bt_advertiser_create_set(handle);
+    if (status != SL_STATUS_OK)
+    {
+        *handle = 0xff;
+        return status;
+    }
 
+    silabs_state_save();
+    return SL_STATUS_OK;
+}
+
+GL_RET silabs_ble_adv(int phys, int interval_min, int interval_max, int discover, int adv_conn)
+{
+    uint8_t *handle = &adv_handle[radio_cur()];
     sl_status_t status = SL_STATUS_FAIL;
 
-    if (handle == 0xff)
+    if (*handle == 0xff)
     {
-        status = sl_bt_advertiser_create_set(&handle);
+        status = adv_create_set();
         if (status != SL_STATUS_OK)
         {
             return GL_UNKNOW_ERR;
         }
     }
 
-    status = sl_bt_advertiser_set_phy(handle, (uint8_t)phys, (uint8_t)phys);
+    status = sl_bt_advertiser_set_phy(*handle, (uint8_t)phys, (uint8_t)phys);
+    if (status == SL_STATUS_INVALID_HANDLE)
+    {
+        // the saved set of an attached module is gone
+        if (adv_create_set() != SL_STATUS_OK)
+        {
+            return GL_UNKNOW_ERR;
+        }
+        status = sl_bt_advertiser_set_phy(*handle, (uint8_t)phys, (uint8_t)phys);
+    }
     if (status != SL_STATUS_OK)
     {
         return GL_UNKNOW_ERR;
     }
 
     status = SL_STATUS_FAIL;
-    status = sl_bt_advertiser_set_timing(handle, (uint32_t)interval_min, (uint32_t)interval_max, 0, 0);
+    status = sl_bt_advertiser_set_timing(*handle, (uint32_t)interval_min, (uint32_t)interval_max, 0, 0);
     if (status != SL_STATUS_OK)
     {
         return GL_UNKNOW_ERR;
     }
 
     status = SL_STATUS_FAIL;
-    status = sl_bt_advertiser_start(handle, (uint8_t)discover, (uint8_t)adv_conn);
+    status = sl_bt_advertiser_start(*handle, (uint8_t)discover, (uint8_t)adv_conn);
     if (status != SL_STATUS_OK)
     {
         return GL_UNKNOW_ERR;
@@ -221,18 +287,30 @@ GL_RET silabs_ble_adv_data(int flag, char *data)
     uint8_t *adv_data = (uint8_t *)calloc(len, sizeof(uint8_t));
     str2array(adv_data, data, len);
 
+    uint8_t *handle = &adv_handle[radio_cur()];
     sl_status_t status = SL_STATUS_FAIL;
 
-    if (handle == 0xff)
+    if (*handle == 0xff)
     {
-        status = sl_bt_advertiser_create_set(&handle);
+        status = adv_create_set();
         if (status != SL_STATUS_OK)
         {
+            free(adv_data);
             return GL_UNKNOW_ERR;
         }
     }
 
-    status = sl_bt_advertiser_set_data(handle, (uint8_t)flag, (size_t)len, (uint8_t *)adv_data);
+    status = sl_bt_advertiser_set_data(*handle, (uint8_t)flag, (size_t)len, (uint8_t *)adv_data);
+    if (status == SL_STATUS_INVALID_HANDLE)
+    {
+        if (adv_create_set() != SL_STATUS_OK)
+        {
+            free(adv_data);
+            return GL_UNKNOW_ERR;
+        }
+        status = sl_bt_advertiser_set_data(*handle, (uint8_t)flag, (size_t)len, (uint8_t *)adv_data);
+    }
+    free(adv_data);
     if (status != SL_STATUS_OK)
     {
         return GL_UNKNOW_ERR;
@@ -243,16 +321,18 @@ GL_RET silabs_ble_adv_data(int flag, char *data)
 
 GL_RET silabs_ble_stop_adv(void)
 {
+    uint8_t *handle = &adv_handle[radio_cur()];
     sl_status_t status = SL_STATUS_FAIL;
 
-    if (handle != 0xff)
+    if (*handle != 0xff)
     {
-        status = sl_bt_advertiser_stop(handle);
+        status = sl_bt_advertiser_stop(*handle);
         if (status != SL_STATUS_OK)
         {
             return GL_UNKNOW_ERR;
         }
-        handle = 0xff;
+        *handle = 0xff;
+        silabs_state_save();
     }
 
     return GL_SUCCESS;
@@ -319,6 +399,7 @@ GL_RET silabs_ble_connect(BLE_MAC address, int address_type, int phy)
     char address_str[BLE_MAC_LEN] = {0};
     addr2str(address, address_str);
     ble_dev_mgr_add(address_str, (uint16_t)connection);
+    silabs_state_save();
 
     return GL_SUCCESS;
 }
@@ -345,6 +426,48 @@ GL_RET silabs_ble_disconnect(BLE_MAC address)
     return GL_SUCCESS;
 }
 
+/*
+ * procedure results below 0x0100 are generic status, module errors are returned as they are
+ */
+static GL_RET proc_result(uint16_t result)
+{
+    if (result == SL_STATUS_OK)
+    {
+        return GL_SUCCESS;
+    }
+    if (result < MANUFACTURER_ERR_BASE)
+    {
+        return GL_UNKNOW_ERR;
+    }
+    return (GL_RET)result;
+}
+
+/*
+ * concatenate the values of a read procedure, long values are read in several parts
+ */
+static void proc_value_to_str(silabs_proc_t *proc, char *value)
+{
+    size_t used = 0;
+    int i = 0;
+
+    value[0] = '\0';
+    while (i < proc->evt_num)
+    {
+        struct sl_bt_packet *e = &proc->evt[i];
+        if (SL_BT_MSG_ID(e->header) == sl_bt_evt_gatt_characteristic_value_id)
+        {
+            sl_bt_evt_gatt_characteristic_value_t *v = &e->data.evt_gatt_characteristic_value;
+            if (used + v->value.len * 2 >= CHAR_VALUE_MAX)
+            {
+                break;
+            }
+            hex2str(v->value.data, v->value.len, value + used);
+            used += v->value.len * 2;
+        }
+        i++;
+    }
+}
+
 GL_RET silabs_ble_get_rssi(BLE_MAC address, int32_t *rssi)
 {
     int connection = 0;
@@ -358,23 +481,33 @@ GL_RET silabs_ble_get_rssi(BLE_MAC address, int32_t *rssi)
 
     sl_status_t status = SL_STATUS_FAIL;
 
+    silabs_proc_t *proc = silabs_proc_start((uint8_t)connection, sl_bt_evt_connection_rssi_id);
+    if (!proc)
+    {
+        return GL_ERR_INVOKE;
+    }
+
     status = sl_bt_connection_get_rssi((uint8_t)connection);
     if (status != SL_STATUS_OK)
     {
+        silabs_proc_end(proc);
         return GL_UNKNOW_ERR;
     }
 
-    uint32_t evt_id = sl_bt_evt_connection_rssi_id;
-    if (wait_rsp_evt(evt_id, 300) == 0)
+    if (silabs_proc_wait(proc, 300) != 0)
     {
-        *rssi = evt->data.evt_connection_rssi.rssi;
+        silabs_proc_end(proc);
+        return GL_ERR_EVENT_MISSING;
     }
-    else
+
+    ret = proc_result(proc->result);
+    if ((ret == GL_SUCCESS) && (proc->evt_num > 0))
     {
-        return GL_ERR_EVENT_MISSING;
+        *rssi = proc->evt[0].data.evt_connection_rssi.rssi;
     }
 
-    return GL_SUCCESS;
+    silabs_proc_end(proc);
+    return ret;
 }
 
 GL_RET silabs_ble_get_service(gl_ble_service_list_t *service_list, BLE_MAC address)
@@ -390,48 +523,44 @@ GL_RET silabs_ble_get_service(gl_ble_service_list_t *service_list, BLE_MAC addre
 
     sl_status_t status = SL_STATUS_FAIL;
 
+    silabs_proc_t *proc = silabs_proc_start((uint8_t)connection, sl_bt_evt_gatt_procedure_completed_id);
+    if (!proc)
+    {
+        return GL_ERR_INVOKE;
+    }
+
     status = sl_bt_gatt_discover_primary_services((uint8_t)connection);
     if (status != SL_STATUS_OK)
     {
+        silabs_proc_end(proc);
         return GL_UNKNOW_ERR;
     }
 
-    int i = 0;
-    uint32_t evt_id = sl_bt_evt_gatt_procedure_completed_id;
-    if (wait_rsp_evt(evt_id, 600) == 0)
-    {
-        service_list->list_len = special_evt_num;
-        while (i < special_evt_num)
-        {
-            struct sl_bt_packet *e = &special_evt[i];
-            if (SL_BT_MSG_ID(e->header) == sl_bt_evt_gatt_service_id && e->data.evt_gatt_service.connection == connection)
-            {
-                service_list->list[i].handle = e->data.evt_gatt_service.service;
-                reverse_endian(e->data.evt_gatt_service.uuid.data, e->data.evt_gatt_service.uuid.len);
-                hex2str(e->data.evt_gatt_service.uuid.data, e->data.evt_gatt_service.uuid.len, service_list->list[i].uuid);
-            }
-            i++;
-        }
-    }
-    else
+    if (silabs_proc_wait(proc, 600) != 0)
     {
-        special_evt_num = 0;
-        // evt->header = 0;
+        silabs_proc_end(proc);
         return GL_ERR_EVENT_MISSING;
     }
 
-    // clean evt count
-    special_evt_num = 0;
-
-    if (SL_BT_MSG_ID(evt->header) == sl_bt_evt_gatt_procedure_completed_id)
-    {
-        evt->header = 0;
-        return GL_SUCCESS;
-    }
-    else
+    int i = 0;
+    service_list->list_len = 0;
+    while ((i < proc->evt_num) && (service_list->list_len < LIST_LENGTHE_MAX))
     {
-        return GL_ERR_EVENT_MISSING;
+        struct sl_bt_packet *e = &proc->evt[i];
+        if (SL_BT_MSG_ID(e->header) == sl_bt_evt_gatt_service_id)
+        {
+            ble_service_node_t *node = &service_list->list[service_list->list_len];
+            node->handle = e->data.evt_gatt_service.service;
+            reverse_endian(e->data.evt_gatt_service.uuid.data, e->data.evt_gatt_service.uuid.len);
+            hex2str(e->data.evt_gatt_service.uuid.data, e->data.evt_gatt_service.uuid.len, node->uuid);
+            service_list->list_len++;
+        }
+        i++;
     }
+
+    ret = proc_result(proc->result);
+    silabs_proc_end(proc);
+    return ret;
 }
 
 GL_RET silabs_ble_get_char(gl_ble_char_list_t *char_list, BLE_MAC address, int service_handle)
@@ -447,67 +576,184 @@ GL_RET silabs_ble_get_char(gl_ble_char_list_t *char_list, BLE_MAC address, int s
 
     sl_status_t status = SL_STATUS_FAIL;
 
+    silabs_proc_t *proc = silabs_proc_start((uint8_t)connection, sl_bt_evt_gatt_procedure_completed_id);
+    if (!proc)
+    {
+        return GL_ERR_INVOKE;
+    }
+
     status = sl_bt_gatt_discover_characteristics((uint8_t)connection, (uint32_t)service_handle);
     if (status != SL_STATUS_OK)
     {
+        silabs_proc_end(proc);
         return GL_UNKNOW_ERR;
     }
 
+    if (silabs_proc_wait(proc, 600) != 0)
+    {
+        silabs_proc_end(proc);
+        return GL_ERR_EVENT_MISSING;
+    }
+
     int i = 0;
-    uint32_t evt_id = sl_bt_evt_gatt_procedure_completed_id;
-    if (wait_rsp_evt(evt_id, 600) == 0)
+    char_list->list_len = 0;
+    while ((i < proc->evt_num) && (char_list->list_len < LIST_LENGTHE_MAX))
     {
-        char_list->list_len = special_evt_num;
-        while (i < special_evt_num)
+        struct sl_bt_packet *e = &proc->evt[i];
+        if (SL_BT_MSG_ID(e->header) == sl_bt_evt_gatt_characteristic_id)
         {
-            struct sl_bt_packet *e = &special_evt[i];
-            if (SL_BT_MSG_ID(e->header) == sl_bt_evt_gatt_characteristic_id && e->data.evt_gatt_characteristic.connection == connection)
-            {
-                char_list->list[i].handle = e->data.evt_gatt_characteristic.characteristic;
-                char_list->list[i].properties = e->data.evt_gatt_characteristic.properties;
-                reverse_endian(e->data.evt_gatt_characteristic.uuid.data, e->data.evt_gatt_characteristic.uuid.len);
-                hex2str(e->data.evt_gatt_characteristic.uuid.data, e->data.evt_gatt_characteristic.uuid.len, char_list->list[i].uuid);
-            }
-            i++;
+            ble_characteristic_node_t *node = &char_list->list[char_list->list_len];
+            node->handle = e->data.evt_gatt_characteristic.characteristic;
+            node->properties = e->data.evt_gatt_characteristic.properties;
+            reverse_endian(e->data.evt_gatt_characteristic.uuid.data, e->data.evt_gatt_characteristic.uuid.len);
+            hex2str(e->data.evt_gatt_characteristic.uuid.data, e->data.evt_gatt_characteristic.uuid.len, node->uuid);
+            char_list->list_len++;
         }
+        i++;
     }
-    else
+
+    ret = proc_result(proc->result);
+    silabs_proc_end(proc);
+    return ret;
+}
+
+GL_RET silabs_ble_set_power(int power, int *current_power)
+{
+    sl_status_t status = SL_STATUS_FAIL;
+    int16_t set_min = 0, set_max = 0;
+
+    status = sl_bt_system_set_tx_power(0, (int16_t)power, (int16_t *)&set_min, (int16_t *)&set_max);
+    if (status != SL_STATUS_OK)
     {
-        special_evt_num = 0;
-        // evt->header = 0;
-        return GL_ERR_EVENT_MISSING;
+        return GL_UNKNOW_ERR;
     }
 
-    // clean evt count
-    special_evt_num = 0;
+    *current_power = set_max;
+    return GL_SUCCESS;
+}
 
-    if (SL_BT_MSG_ID(evt->header) == sl_bt_evt_gatt_procedure_completed_id)
+GL_RET silabs_ble_read_char(BLE_MAC address, int char_handle)
+{
+    int connection = 0;
+    char address_str[BLE_MAC_LEN] = {0};
+    addr2str(address, address_str);
+    GL_RET ret = ble_dev_mgr_get_connection(address_str, &connection);
+    if (ret != GL_SUCCESS)
     {
-        evt->header = 0;
-        return GL_SUCCESS;
+        return GL_ERR_PARAM;
     }
-    else
+
+    sl_status_t status = SL_STATUS_FAIL;
+
+    status = sl_bt_gatt_read_characteristic_value((uint8_t)connection, (uint16_t)char_handle);
+    if (status != SL_STATUS_OK)
     {
-        return GL_ERR_EVENT_MISSING;
+        return GL_UNKNOW_ERR;
     }
+
+    return GL_SUCCESS;
 }
 
-GL_RET silabs_ble_set_power(int power, int *current_power)
+GL_RET silabs_ble_read_multiple_char(BLE_MAC address, int *char_handle, int *value_len, int num, gl_ble_char_value_list_t *value_list)
 {
+    int connection = 0;
+    char address_str[BLE_MAC_LEN] = {0};
+    addr2str(address, address_str);
+    GL_RET ret = ble_dev_mgr_get_connection(address_str, &connection);
+    if (ret != GL_SUCCESS)
+    {
+        return GL_ERR_PARAM;
+    }
+
+    if ((!char_handle) || (!value_list) || (num < 2) || (num > LIST_LENGTHE_MAX))
+    {
+        return GL_ERR_PARAM;
+    }
+
+    // characteristic handles are sent as little endian uint16
+    uint8_t handle_list[LIST_LENGTHE_MAX * 2];
+    int i = 0;
+    while (i < num)
+    {
+        handle_list[i * 2] = (uint8_t)(char_handle[i] & 0xff);
+        handle_list[i * 2 + 1] = (uint8_t)((char_handle[i] >> 8) & 0xff);
+        i++;
+    }
+
     sl_status_t status = SL_STATUS_FAIL;
-    int16_t set_min = 0, set_max = 0;
 
-    status = sl_bt_system_set_tx_power(0, (int16_t)power, (int16_t *)&set_min, (int16_t *)&set_max);
+    silabs_proc_t *proc = silabs_proc_start((uint8_t)connection, sl_bt_evt_gatt_procedure_completed_id);
+    if (!proc)
+    {
+        return GL_ERR_INVOKE;
+    }
+
+    status = sl_bt_gatt_read_multiple_characteristic_values((uint8_t)connection, (size_t)(num * 2), handle_list);
     if (status != SL_STATUS_OK)
     {
+        silabs_proc_end(proc);
         return GL_UNKNOW_ERR;
     }
 
-    *current_power = set_max;
+    if (silabs_proc_wait(proc, 1000) != 0)
+    {
+        silabs_proc_end(proc);
+        return GL_ERR_EVENT_MISSING;
+    }
+
+    if ((proc->result != SL_STATUS_OK) || (proc->evt_num == 0))
+    {
+        ret = (proc->result != SL_STATUS_OK) ? proc_result(proc->result) : GL_UNKNOW_ERR;
+        silabs_proc_end(proc);
+        return ret;
+    }
+
+    // the response is a concatenation of the values in the order they were requested
+    uint8_t *data = proc->evt[0].data.evt_gatt_characteristic_value.value.data;
+    int data_len = proc->evt[0].data.evt_gatt_characteristic_value.value.len;
+
+    memset(value_list, 0, sizeof(gl_ble_char_value_list_t));
+    if (!value_len)
+    {
+        // hex2str() does not write a value longer than the string holds
+        if (data_len * 2 >= CHAR_VALUE_MAX)
+        {
+            silabs_proc_end(proc);
+            return GL_ERR_MSG;
+        }
+        value_list->list[0].handle = char_handle[0];
+        hex2str(data, data_len, value_list->list[0].value);
+        value_list->list_len = 1;
+    }
+    else
+    {
+        int offset = 0;
+        i = 0;
+        while ((i < num) && (offset < data_len))
+        {
+            int len = (i == num - 1) ? (data_len - offset) : value_len[i];
+            if ((len < 0) || (offset + len > data_len))
+            {
+                len = data_len - offset;
+            }
+            if (len * 2 >= CHAR_VALUE_MAX)
+            {
+                silabs_proc_end(proc);
+                return GL_ERR_MSG;
+            }
+            value_list->list[i].handle = char_handle[i];
+            hex2str(data + offset, len, value_list->list[i].value);
+            offset += len;
+            i++;
+        }
+        value_list->list_len = i;
+    }
+
+    silabs_proc_end(proc);
     return GL_SUCCESS;
 }
 
-GL_RET silabs_ble_read_char(BLE_MAC address, int char_handle)
+GL_RET silabs_ble_read_char_by_uuid(BLE_MAC address, int service_handle, char *uuid, gl_ble_char_value_list_t *value_list)
 {
     int connection = 0;
     char address_str[BLE_MAC_LEN] = {0};
@@ -518,14 +764,79 @@ GL_RET silabs_ble_read_char(BLE_MAC address, int char_handle)
         return GL_ERR_PARAM;
     }
 
+    // only 16-bit and 128-bit UUID
+    if ((!uuid) || (!value_list) || ((strlen(uuid) != 4) && (strlen(uuid) != 32)))
+    {
+        return GL_ERR_PARAM;
+    }
+
+    size_t uuid_len = strlen(uuid) / 2;
+    uint8_t uuid_data[16];
+    str2array(uuid_data, uuid, uuid_len);
+    // little endian on air
+    reverse_endian(uuid_data, uuid_len);
+
     sl_status_t status = SL_STATUS_FAIL;
 
-    status = sl_bt_gatt_read_characteristic_value((uint8_t)connection, (uint16_t)char_handle);
+    silabs_proc_t *proc = silabs_proc_start((uint8_t)connection, sl_bt_evt_gatt_procedure_completed_id);
+    if (!proc)
+    {
+        return GL_ERR_INVOKE;
+    }
+
+    status = sl_bt_gatt_read_characteristic_value_by_uuid((uint8_t)connection, (uint32_t)service_handle, uuid_len, uuid_data);
     if (status != SL_STATUS_OK)
     {
+        silabs_proc_end(proc);
         return GL_UNKNOW_ERR;
     }
 
+    if (silabs_proc_wait(proc, 1000) != 0)
+    {
+        silabs_proc_end(proc);
+        return GL_ERR_EVENT_MISSING;
+    }
+
+    if (proc->result != SL_STATUS_OK)
+    {
+        ret = proc_result(proc->result);
+        silabs_proc_end(proc);
+        return ret;
+    }
+
+    memset(value_list, 0, sizeof(gl_ble_char_value_list_t));
+    int i = 0;
+    while (i < proc->evt_num)
+    {
+        sl_bt_evt_gatt_characteristic_value_t *v = &proc->evt[i].data.evt_gatt_characteristic_value;
+        int n = 0;
+
+        // a long value is continued by read blob responses with the same handle
+        while ((n < value_list->list_len) && (value_list->list[n].handle != v->characteristic))
+        {
+            n++;
+        }
+        if (n == value_list->list_len)
+        {
+            if (n >= LIST_LENGTHE_MAX)
+            {
+                break;
+            }
+            value_list->list[n].handle = v->characteristic;
+            value_list->list_len++;
+        }
+
+        size_t used = strlen(value_list->list[n].value);
+        if (used + v->value.len * 2 >= CHAR_VALUE_MAX)
+        {
+            silabs_proc_end(proc);
+            return GL_ERR_MSG;
+        }
+        hex2str(v->value.data, v->value.len, value_list->list[n].value + used);
+        i++;
+    }
+
+    silabs_proc_end(proc);
     return GL_SUCCESS;
 }
 
@@ -546,6 +857,10 @@ GL_RET silabs_ble_write_char(BLE_MAC address, int char_handle, char *value, int
     }
     size_t len = strlen(value) / 2;
     unsigned char data[256];
+    if (len > sizeof(data))
+    {
+        return GL_ERR_PARAM;
+    }
     str2array(data, value, len);
 
     sl_status_t status = SL_STATUS_FAIL;
@@ -571,6 +886,227 @@ GL_RET silabs_ble_write_char(BLE_MAC address, int char_handle, char *value, int
     return GL_SUCCESS;
 }
 
+GL_RET silabs_ble_read_char_sync(BLE_MAC address, int char_handle, char *value, int timeout)
+{
+    int connection = 0;
+    char address_str[BLE_MAC_LEN] = {0};
+    addr2str(address, address_str);
+    GL_RET ret = ble_dev_mgr_get_connection(address_str, &connection);
+    if (ret != GL_SUCCESS)
+    {
+        return GL_ERR_PARAM;
+    }
+
+    if ((!value) || (timeout <= 0))
+    {
+        return GL_ERR_PARAM;
+    }
+
+    sl_status_t status = SL_STATUS_FAIL;
+
+    silabs_proc_t *proc = silabs_proc_start((uint8_t)connection, sl_bt_evt_gatt_procedure_completed_id);
+    if (!proc)
+    {
+        return GL_ERR_INVOKE;
+    }
+
+    status = sl_bt_gatt_read_characteristic_value((uint8_t)connection, (uint16_t)char_handle);
+    if (status != SL_STATUS_OK)
+    {
+        silabs_proc_end(proc);
+        return GL_UNKNOW_ERR;
+    }
+
+    if (silabs_proc_wait(proc, (uint32_t)timeout) != 0)
+    {
+        silabs_proc_end(proc);
+        return GL_ERR_EVENT_MISSING;
+    }
+
+    ret = proc_result(proc->result);
+    if (ret == GL_SUCCESS)
+    {
+        proc_value_to_str(proc, value);
+    }
+
+    silabs_proc_end(proc);
+    return ret;
+}
+
+GL_RET silabs_ble_write_char_sync(BLE_MAC address, int char_handle, char *value, int timeout)
+{
+    int connection = 0;
+    char address_str[BLE_MAC_LEN] = {0};
+    addr2str(address, address_str);
+    GL_RET ret = ble_dev_mgr_get_connection(address_str, &connection);
+    if (ret != GL_SUCCESS)
+    {
+        return GL_ERR_PARAM;
+    }
+
+    if ((!value) || (strlen(value) % 2) || (timeout <= 0))
+    {
+        return GL_ERR_PARAM;
+    }
+    size_t len = strlen(value) / 2;
+    unsigned char data[256];
+    if (len > sizeof(data))
+    {
+        return GL_ERR_PARAM;
+    }
+    str2array(data, value, len);
+
+    sl_status_t status = SL_STATUS_FAIL;
+
+    silabs_proc_t *proc = silabs_proc_start((uint8_t)connection, sl_bt_evt_gatt_procedure_completed_id);
+    if (!proc)
+    {
+        return GL_ERR_INVOKE;
+    }
+
+    status = sl_bt_gatt_write_characteristic_value((uint8_t)connection, (uint16_t)char_handle, len, (uint8_t *)data);
+    if (status != SL_STATUS_OK)
+    {
+        silabs_proc_end(proc);
+        return GL_UNKNOW_ERR;
+    }
+
+    if (silabs_proc_wait(proc, (uint32_t)timeout) != 0)
+    {
+        silabs_proc_end(proc);
+        return GL_ERR_EVENT_MISSING;
+    }
+
+    ret = proc_result(proc->result);
+    silabs_proc_end(proc);
+    return ret;
+}
+
+typedef struct
+{
+    BLE_MAC address;
+    int char_handle;
+    gl_ble_gatt_rsp_cb_t cb;
+    void *arg;
+} gatt_async_req_t;
+
+static void gatt_async_complete(silabs_proc_t *proc)
+{
+    gatt_async_req_t *req = (gatt_async_req_t *)proc->arg;
+    gl_ble_gatt_rsp_t rsp;
+
+    memset(&rsp, 0, sizeof(gl_ble_gatt_rsp_t));
+    memcpy(rsp.address, req->address, DEVICE_MAC_LEN);
+    rsp.char_handle = req->char_handle;
+    rsp.result = proc_result(proc->result);
+    rsp.time_ns = proc->time_ns;
+    if (rsp.result == GL_SUCCESS)
+    {
+        proc_value_to_str(proc, rsp.value);
+    }
+
+    req->cb(&rsp, req->arg);
+    free(req);
+}
+
+GL_RET silabs_ble_read_char_async(BLE_MAC address, int char_handle, gl_ble_gatt_rsp_cb_t cb, void *arg)
+{
+    int connection = 0;
+    char address_str[BLE_MAC_LEN] = {0};
+    addr2str(address, address_str);
+    GL_RET ret = ble_dev_mgr_get_connection(address_str, &connection);
+    if ((ret != GL_SUCCESS) || (!cb))
+    {
+        return GL_ERR_PARAM;
+    }
+
+    sl_status_t status = SL_STATUS_FAIL;
+
+    gatt_async_req_t *req = (gatt_async_req_t *)malloc(sizeof(gatt_async_req_t));
+    if (!req)
+    {
+        return GL_UNKNOW_ERR;
+    }
+    memcpy(req->address, address, DEVICE_MAC_LEN);
+    req->char_handle = char_handle;
+    req->cb = cb;
+    req->arg = arg;
+
+    silabs_proc_t *proc = silabs_proc_start((uint8_t)connection, sl_bt_evt_gatt_procedure_completed_id);
+    if (!proc)
+    {
+        free(req);
+        return GL_ERR_INVOKE;
+    }
+
+    status = sl_bt_gatt_read_characteristic_value((uint8_t)connection, (uint16_t)char_handle);
+    if (status != SL_STATUS_OK)
+    {
+        silabs_proc_end(proc);
+        free(req);
+        return GL_UNKNOW_ERR;
+    }
+
+    // the response arrives in the driver thread
+    silabs_proc_detach(proc, gatt_async_complete, req);
+    return GL_SUCCESS;
+}
+
+GL_RET silabs_ble_write_char_async(BLE_MAC address, int char_handle, char *value, gl_ble_gatt_rsp_cb_t cb, void *arg)
+{
+    int connection = 0;
+    char address_str[BLE_MAC_LEN] = {0};
+    addr2str(address, address_str);
+    GL_RET ret = ble_dev_mgr_get_connection(address_str, &connection);
+    if ((ret != GL_SUCCESS) || (!cb))
+    {
+        return GL_ERR_PARAM;
+    }
+
+    if ((!value) || (strlen(value) % 2))
+    {
+        return GL_ERR_PARAM;
+    }
+    size_t len = strlen(value) / 2;
+    unsigned char data[256];
+    if (len > sizeof(data))
+    {
+        return GL_ERR_PARAM;
+    }
+    str2array(data, value, len);
+
+    sl_status_t status = SL_STATUS_FAIL;
+
+    gatt_async_req_t *req = (gatt_async_req_t *)malloc(sizeof(gatt_async_req_t));
+    if (!req)
+    {
+        return GL_UNKNOW_ERR;
+    }
+    memcpy(req->address, address, DEVICE_MAC_LEN);
+    req->char_handle = char_handle;
+    req->cb = cb;
+    req->arg = arg;
+
+    silabs_proc_t *proc = silabs_proc_start((uint8_t)connection, sl_bt_evt_gatt_procedure_completed_id);
+    if (!proc)
+    {
+        free(req);
+        return GL_ERR_INVOKE;
+    }
+
+    status = sl_bt_gatt_write_characteristic_value((uint8_t)connection, (uint16_t)char_handle, len, (uint8_t *)data);
+    if (status != SL_STATUS_OK)
+    {
+        silabs_proc_end(proc);
+        free(req);
+        return GL_UNKNOW_ERR;
+    }
+
+    // the response arrives in the driver thread
+    silabs_proc_detach(proc, gatt_async_complete, req);
+    return GL_SUCCESS;
+}
+
 GL_RET silabs_ble_set_notify(BLE_MAC address, int char_handle, int flag)
 {
     int connection = 0;
@@ -599,7 +1135,38 @@ GL_RET silabs_ble_sw_reset(uint8_t mode)
     return GL_SUCCESS;
 }
 
-GL_RET silabs_ble_dfu_uart_flash_upload(uint8_t *file_path)
+/*
+ * Throughput only counts what was sent since base, the start offset of a resumed upload.
+ */
+static void dfu_report(gl_ble_dfu_progress_t *progress, uint32_t base, uint64_t start, gl_ble_dfu_progress_cb_t cb, void *arg)
+{
+    if (!cb)
+    {
+        return;
+    }
+
+    uint32_t elapsed = (uint32_t)((utils_get_time_ns() - start) / 1000000);
+    progress->throughput = elapsed ? (uint32_t)((uint64_t)(progress->sent - base) * 1000 / elapsed) : 0;
+    cb(progress, arg);
+}
+
+/*
+ * Add the part of a chunk covered by the GBL CRC.
+ */
+static uint32_t dfu_crc_chunk(uint32_t crc, gbl_info_t *info, uint32_t offset, const uint8_t *chunk, size_t len)
+{
+    if (offset >= info->crc_len)
+    {
+        return crc;
+    }
+    if (offset + len > info->crc_len)
+    {
+        len = info->crc_len - offset;
+    }
+    return silabs_dfu_crc32(crc, chunk, len);
+}
+
+static GL_RET dfu_upload(uint8_t *file_path, gl_ble_dfu_progress_cb_t cb, void *arg)
 {
     if (file_path == NULL)
     {
@@ -611,66 +1178,155 @@ GL_RET silabs_ble_dfu_uart_flash_upload(uint8_t *file_path)
         return GL_UNKNOW_ERR;
     }
 
+    FILE *fp = fopen((char *)file_path, "rb");
+    if (fp == NULL)
+    {
+        log_err("not find file: %s\n", file_path);
+        return GL_UNKNOW_ERR;
+    }
+
+    struct stat st;
+    if ((fstat(fileno(fp), &st) != 0) || (st.st_size <= 0))
+    {
+        fclose(fp);
+        return GL_UNKNOW_ERR;
+    }
+
+    gl_ble_dfu_progress_t progress;
+    memset(&progress, 0, sizeof(gl_ble_dfu_progress_t));
+    progress.total = (uint32_t)st.st_size;
+
+    // a broken file would leave the module without a valid application
+    gbl_info_t info;
+    if (silabs_dfu_gbl_check(fp, progress.total, &info) != 0)
+    {
+        fclose(fp);
+        return GL_ERR_PARAM;
+    }
+
+    // the bootloader reports dfu_boot when it is ready
+    silabs_proc_t *proc = silabs_proc_start(PROC_NO_CONNECTION, sl_bt_evt_dfu_boot_id);
     sl_bt_system_reset(1);
+    if ((proc) && (silabs_proc_wait(proc, DFU_BOOT_TIMEOUT) != 0))
+    {
+        log_err("dfu boot event missing\n");
+    }
+    silabs_proc_end(proc);
 
-    sl_status_t status = SL_STATUS_FAIL;
+    // continue an interrupted upload of the same image
+    uint32_t base = silabs_dfu_session_load(progress.total, &info);
+    if (base)
+    {
+        log_info("dfu resume at offset: %u\n", base);
+    }
 
-    sleep(1);
-    status = sl_bt_dfu_flash_set_address(0);
+    sl_status_t status = sl_bt_dfu_flash_set_address(base);
+    if ((status != SL_STATUS_OK) && (base))
+    {
+        // start again if the bootloader cannot continue
+        base = 0;
+        status = sl_bt_dfu_flash_set_address(0);
+    }
     if (status != SL_STATUS_OK)
     {
-        printf("set_address status - %d \n", status);
+        log_err("set_address status - %d \n", status);
+        fclose(fp);
         return GL_UNKNOW_ERR;
     }
 
-    sleep(1);
-    FILE *fp = NULL;
+    uint8_t chunk[DFU_CHUNK_MAX];
+    size_t len = 0;
+    uint32_t crc = 0;
 
-    fp = fopen(file_path, "r");
-    if (fp == NULL)
+    // the CRC of the image also covers what was sent before
+    progress.sent = 0;
+    while (progress.sent < base)
     {
-        printf("not find file\r\n");
-        return GL_UNKNOW_ERR;
+        len = fread(chunk, 1, (base - progress.sent) < DFU_CHUNK_MAX ? (base - progress.sent) : DFU_CHUNK_MAX, fp);
+        if (len == 0)
+        {
+            fclose(fp);
+            return GL_UNKNOW_ERR;
+        }
+        crc = dfu_crc_chunk(crc, &info, progress.sent, chunk, len);
+        progress.sent += len;
     }
 
-    uint8_t buffer[1024 * 1024];
-    size_t read_size;
-    read_size = fread(buffer, 1, 1024 * 1024, fp); /* 每次读取1个字节，最多读取10个，这样返回得read_size才是读到的字节数 */
-    printf("file size:%d\n", read_size);
-#define MAX_PACKAGE_LEN (128)
+    uint64_t start = utils_get_time_ns();
 
-    size_t i = 0;
-    while (read_size != 0)
+    // every chunk is paced by its response, no need to wait in between
+    int chunks = 0;
+    GL_RET ret = GL_SUCCESS;
+    while ((len = fread(chunk, 1, DFU_CHUNK_MAX, fp)) > 0)
     {
-        status = SL_STATUS_FAIL;
-        if (read_size >= MAX_PACKAGE_LEN)
+        int retry = 0;
+        status = sl_bt_dfu_flash_upload(len, chunk);
+        while ((status != SL_STATUS_OK) && (retry < DFU_RETRY_MAX))
         {
-            status = sl_bt_dfu_flash_upload(128, buffer + i);
-            if (status != SL_STATUS_OK)
+            log_err("dfu_flash_upload status - %d, offset: %u\n", status, progress.sent);
+            retry++;
+            progress.retries++;
+
+            // the failed chunk may be partly written, write it again from its start
+            status = sl_bt_dfu_flash_set_address(progress.sent);
+            if (status == SL_STATUS_OK)
             {
-                printf("dfu_flash_upload status - %d \n", status);
+                status = sl_bt_dfu_flash_upload(len, chunk);
             }
-            read_size -= MAX_PACKAGE_LEN;
-            i += MAX_PACKAGE_LEN;
         }
-        else
+        if (status != SL_STATUS_OK)
         {
-            status = sl_bt_dfu_flash_upload(read_size, buffer + i);
-            if (status != SL_STATUS_OK)
-            {
-                printf("dfu_flash_upload status - %d \n", status);
-            }
-            i += read_size;
-            read_size = 0;
+            ret = GL_UNKNOW_ERR;
+            break;
+        }
+
+        crc = dfu_crc_chunk(crc, &info, progress.sent, chunk, len);
+        progress.sent += len;
+        dfu_report(&progress, base, start, cb, arg);
+
+        if (++chunks % DFU_SESSION_SAVE_CHUNKS == 0)
+        {
+            silabs_dfu_session_save(progress.total, &info, progress.sent);
         }
-        printf("remaining_size:%d,completed_size:%d\n", read_size, i);
-        usleep(1000 * 50);
     }
-    sleep(2);
+    fclose(fp);
+
+    if (ret != GL_SUCCESS)
+    {
+        silabs_dfu_session_save(progress.total, &info, progress.sent);
+        return ret;
+    }
+
+    // the module can only restart the whole image from here on
+    silabs_dfu_session_clear();
+
+    if ((progress.sent != progress.total) || (crc != info.crc))
+    {
+        log_err("dfu image check failed, sent: %u, crc: 0x%08x\n", progress.sent, crc);
+        return GL_UNKNOW_ERR;
+    }
+
+    // the bootloader checks the image before it responds
+    sl_bt_host_set_rsp_timeout(DFU_FINISH_TIMEOUT);
     status = sl_bt_dfu_flash_upload_finish();
-    printf("flash_upload_finish - %s \n", status == SL_STATUS_OK ? "Succeed" : "failure");
-    sleep(2);
+    sl_bt_host_set_rsp_timeout(0);
+    log_info("flash_upload_finish - %s \n", status == SL_STATUS_OK ? "Succeed" : "failure");
+    if (status != SL_STATUS_OK)
+    {
+        return GL_UNKNOW_ERR;
+    }
+
     sl_bt_system_reset(0);
 
     return GL_SUCCESS;
 }
+
+GL_RET silabs_ble_dfu_uart_flash_upload(uint8_t *file_path, gl_ble_dfu_progress_cb_t cb, void *arg)
+{
+    // the bootloader does not know the commands of the sampler
+    silabs_sampler_pause(true);
+    GL_RET ret = dfu_upload(file_path, cb, arg);
+    silabs_sampler_pause(false);
+
+    return ret;
+}
@@ -27,6 +27,14 @@ GL_RET silabs_ble_enable(int);
 
 GL_RET silabs_ble_hard_reset(void);
 
+GL_RET silabs_ble_wait_boot(uint32_t timeout);
+
+GL_RET silabs_ble_probe(void);
+
+GL_RET silabs_ble_attach(void);
+
+GL_RET silabs_ble_get_attach_info(gl_ble_attach_info_t *info);
+
 GL_RET silabs_ble_local_mac(BLE_MAC mac);
 
 GL_RET silabs_ble_discovery(int phys, int interval, int window, int type, int mode);
@@ -55,12 +63,34 @@ GL_RET silabs_ble_set_power(int power, int *current_power);
 
 GL_RET silabs_ble_read_char(BLE_MAC address, int char_handle);
 
+GL_RET silabs_ble_read_multiple_char(BLE_MAC address, int *char_handle, int *value_len, int num, gl_ble_char_value_list_t *value_list);
+
+GL_RET silabs_ble_read_char_by_uuid(BLE_MAC address, int service_handle, char *uuid, gl_ble_char_value_list_t *value_list);
+
 GL_RET silabs_ble_write_char(BLE_MAC address, int char_handle, char *value, int res);
 
+GL_RET silabs_ble_read_char_sync(BLE_MAC address, int char_handle, char *value, int timeout);
+
+GL_RET silabs_ble_write_char_sync(BLE_MAC address, int char_handle, char *value, int timeout);
+
+GL_RET silabs_ble_read_char_async(BLE_MAC address, int char_handle, gl_ble_gatt_rsp_cb_t cb, void *arg);
+
+GL_RET silabs_ble_write_char_async(BLE_MAC address, int char_handle, char *value, gl_ble_gatt_rsp_cb_t cb, void *arg);
+
 GL_RET silabs_ble_set_notify(BLE_MAC address, int char_handle, int flag);
 
+GL_RET silabs_ble_l2cap_listen(int le_psm, int mtu, int mps, int initial_credit, gl_ble_l2cap_cb_t cb, void *arg);
+
+GL_RET silabs_ble_l2cap_stop_listen(int le_psm);
+
+GL_RET silabs_ble_l2cap_connect(BLE_MAC address, int le_psm, int mtu, int mps, int initial_credit, gl_ble_l2cap_cb_t cb, void *arg, int *cid);
+
+GL_RET silabs_ble_l2cap_send(BLE_MAC address, int cid, const uint8_t *data, int len, int timeout);
+
+GL_RET silabs_ble_l2cap_disconnect(BLE_MAC address, int cid);
+
 GL_RET silabs_ble_sw_reset(uint8_t mode);
 
-GL_RET silabs_ble_dfu_uart_flash_upload(uint8_t *file_path);
+GL_RET silabs_ble_dfu_uart_flash_upload(uint8_t *file_path, gl_ble_dfu_progress_cb_t cb, void *arg);
 
 #endif
\ No newline at end of file
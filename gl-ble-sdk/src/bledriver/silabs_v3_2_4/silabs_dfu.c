@@ -0,0 +1,183 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "silabs_dfu.h"
+#include "gl_radio.h"
+#include "gl_log.h"
+
+static uint32_t get_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint32_t silabs_dfu_crc32(uint32_t crc, const uint8_t *data, size_t len)
+{
+    int i = 0;
+
+    crc = ~crc;
+    while (len--)
+    {
+        crc ^= *data++;
+        for (i = 0; i < 8; i++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+int silabs_dfu_gbl_check(FILE *fp, uint32_t size, gbl_info_t *info)
+{
+    uint8_t tag[12];
+    uint32_t pos = 0;
+
+    memset(info, 0, sizeof(gbl_info_t));
+
+    // every tag is id, length and data, the first is the header and the last is the end tag
+    while (1)
+    {
+        if ((pos + 8 > size) || (fseek(fp, pos, SEEK_SET) != 0) || (fread(tag, 1, 8, fp) != 8))
+        {
+            log_err("gbl end tag missing\n");
+            return -1;
+        }
+
+        uint32_t id = get_le32(tag);
+        uint32_t len = get_le32(tag + 4);
+        if ((pos == 0) && (id != GBL_TAG_ID_HEADER))
+        {
+            log_err("gbl header tag missing\n");
+            return -1;
+        }
+        if (id == GBL_TAG_ID_END)
+        {
+            if ((len != 4) || (fread(tag + 8, 1, 4, fp) != 4))
+            {
+                log_err("gbl end tag error\n");
+                return -1;
+            }
+            info->crc_len = pos + 8;
+            info->crc = get_le32(tag + 8);
+            pos += 12;
+            break;
+        }
+        if (len > size - pos - 8)
+        {
+            log_err("gbl tag 0x%08x length error: %u\n", id, len);
+            return -1;
+        }
+        pos += 8 + len;
+    }
+
+    if (pos != size)
+    {
+        log_err("gbl length error, end tag at %u, file size %u\n", pos, size);
+        return -1;
+    }
+
+    uint8_t buf[1024];
+    uint32_t crc = 0;
+    uint32_t left = info->crc_len;
+    rewind(fp);
+    while (left)
+    {
+        size_t len = fread(buf, 1, left < sizeof(buf) ? left : sizeof(buf), fp);
+        if (len == 0)
+        {
+            return -1;
+        }
+        crc = silabs_dfu_crc32(crc, buf, len);
+        left -= len;
+    }
+    rewind(fp);
+
+    if (crc != info->crc)
+    {
+        log_err("gbl crc error: 0x%08x, expected 0x%08x\n", crc, info->crc);
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * Each radio has its own session, like the state file. Radio 0 keeps the name of a single module.
+ */
+static void session_file(char *path, size_t size)
+{
+    int radio = radio_cur();
+
+    if (radio == 0)
+    {
+        snprintf(path, size, "%s", DFU_SESSION_FILE);
+    }
+    else
+    {
+        snprintf(path, size, "%s.%d", DFU_SESSION_FILE, radio);
+    }
+}
+
+uint32_t silabs_dfu_session_load(uint32_t size, gbl_info_t *info)
+{
+    char path[DFU_SESSION_PATH_LEN];
+    session_file(path, sizeof(path));
+
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+    {
+        return 0;
+    }
+
+    unsigned int s_size = 0, s_crc = 0, s_offset = 0;
+    int n = fscanf(fp, "%u %x %u", &s_size, &s_crc, &s_offset);
+    fclose(fp);
+
+    // the image is identified by its length and CRC
+    if ((n != 3) || (s_size != size) || (s_crc != info->crc) || (s_offset >= size))
+    {
+        return 0;
+    }
+
+    return s_offset;
+}
+
+void silabs_dfu_session_save(uint32_t size, gbl_info_t *info, uint32_t offset)
+{
+    char path[DFU_SESSION_PATH_LEN];
+    session_file(path, sizeof(path));
+
+    FILE *fp = fopen(path, "w");
+    if (!fp)
+    {
+        log_err("save dfu session failed\n");
+        return;
+    }
+
+    fprintf(fp, "%u %08x %u\n", size, info->crc, offset);
+    fclose(fp);
+}
+
+void silabs_dfu_session_clear(void)
+{
+    char path[DFU_SESSION_PATH_LEN];
+    session_file(path, sizeof(path));
+
+    unlink(path);
+}
@@ -0,0 +1,59 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#ifndef _SILABS_DFU_H_
+#define _SILABS_DFU_H_
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define GBL_TAG_ID_HEADER 0x03A617EB
+#define GBL_TAG_ID_END 0xFC0404FC
+
+// the last acknowledged offset of an interrupted upload is kept here, with ".N" for radio N
+#define DFU_SESSION_FILE "/tmp/gl_ble_dfu.session"
+#define DFU_SESSION_PATH_LEN 64
+
+/*
+ * What the GBL end tag says about the image.
+ */
+typedef struct
+{
+    uint32_t crc_len; // bytes covered by the CRC, up to the end tag header
+    uint32_t crc;     // CRC32 stored in the end tag
+} gbl_info_t;
+
+/*
+ * CRC32 (IEEE 802.3) as used by GBL files, crc is the result of the previous part, 0 at the beginning.
+ */
+uint32_t silabs_dfu_crc32(uint32_t crc, const uint8_t *data, size_t len);
+
+/*
+ * Walk the tags of a GBL file and check its length and CRC against the end tag.
+ * Return 0 if the image is complete.
+ */
+int silabs_dfu_gbl_check(FILE *fp, uint32_t size, gbl_info_t *info);
+
+/*
+ * Return the offset saved for the image, 0 if there is no session of it.
+ */
+uint32_t silabs_dfu_session_load(uint32_t size, gbl_info_t *info);
+
+void silabs_dfu_session_save(uint32_t size, gbl_info_t *info, uint32_t offset);
+
+void silabs_dfu_session_clear(void);
+
+#endif
@@ -32,16 +32,21 @@
 #include "gl_type.h"
 
 #include "silabs_evt.h"
+#include "silabs_state.h"
+#include "timestamp.h"
+#include "gl_stats.h"
 #include "sli_bt_api.h"
-
-static int evt_msgid;
+#include "gl_radio.h"
 
 void *silabs_watcher(void *arg)
 {
     watcher_param_t *sbs_param = (watcher_param_t *)arg;
-    evt_msgid = sbs_param->evt_msgid;
+    int evt_msgid = sbs_param->evt_msgid;
     gl_ble_cbs *ble_msg_cb = sbs_param->cbs;
 
+    // callbacks of the user run with the radio of their events
+    radio_bind(sbs_param->radio);
+
     silabs_msg_queue_t queue_data;
 
     while (1)
@@ -50,12 +55,16 @@ void *silabs_watcher(void *arg)
         pthread_testcancel();
 
         // recv evt from msg queue
-        if (-1 == msgrcv(evt_msgid, (void *)&queue_data, sizeof(struct sl_bt_msg), 0, 0))
+        if (-1 == msgrcv(evt_msgid, (void *)&queue_data, sizeof(silabs_msg_queue_t) - sizeof(long), 0, 0))
         {
             log_err("msgrcv error!!!\n");
             continue;
         }
 
+        silabs_watcher_taken();
+        uint64_t dequeue_time = utils_get_time_ns();
+        stats_record_stage(LATENCY_STAGE_QUEUE, dequeue_time - queue_data.send_ns);
+
         struct sl_bt_packet *p = &(queue_data.evt);
 
         switch (SL_BT_MSG_ID(p->header))
@@ -63,6 +72,7 @@ void *silabs_watcher(void *arg)
         case sl_bt_evt_system_boot_id:
         {
             gl_ble_module_data_t data;
+            data.system_boot_data.time_ns = queue_data.time_ns;
             data.system_boot_data.major = p->data.evt_system_boot.major;
             data.system_boot_data.minor = p->data.evt_system_boot.minor;
             data.system_boot_data.patch = p->data.evt_system_boot.patch;
@@ -81,18 +91,21 @@ void *silabs_watcher(void *arg)
         case sl_bt_evt_connection_closed_id:
         {
             gl_ble_gap_data_t data;
+            data.disconnect_data.time_ns = queue_data.time_ns;
             data.disconnect_data.reason = p->data.evt_connection_closed.reason;
             char tmp_address[MAC_STR_LEN] = {0};
             uint16_t ret = ble_dev_mgr_get_address(p->data.evt_connection_closed.connection, tmp_address);
             if (ret != 0)
             {
+                // skip the event instead of ending the watcher, connections opened before a warm attach may be unknown
                 log_err("get dev mac from dev-list failed!\n");
-                return NULL;
+                break;
             }
             str2addr(tmp_address, data.disconnect_data.address);
 
             // delete from dev-list
             ble_dev_mgr_del(p->data.evt_connection_closed.connection);
+            silabs_state_save();
 
             if (ble_msg_cb->ble_gap_event)
             {
@@ -104,6 +117,7 @@ void *silabs_watcher(void *arg)
         case sl_bt_evt_gatt_characteristic_value_id:
         {
             gl_ble_gatt_data_t data;
+            data.remote_characteristic_value.time_ns = queue_data.time_ns;
             data.remote_characteristic_value.offset = p->data.evt_gatt_characteristic_value.offset;
             data.remote_characteristic_value.att_opcode = p->data.evt_gatt_characteristic_value.att_opcode;
             data.remote_characteristic_value.characteristic = p->data.evt_gatt_characteristic_value.characteristic;
@@ -114,7 +128,7 @@ void *silabs_watcher(void *arg)
             if (ret != 0)
             {
                 log_err("get dev mac from dev-list failed!\n");
-                return NULL;
+                break;
             }
             str2addr(tmp_address, data.remote_characteristic_value.address);
 
@@ -128,6 +142,7 @@ void *silabs_watcher(void *arg)
         case sl_bt_evt_gatt_server_attribute_value_id:
         {
             gl_ble_gatt_data_t data;
+            data.local_gatt_attribute.time_ns = queue_data.time_ns;
             data.local_gatt_attribute.offset = p->data.evt_gatt_server_attribute_value.offset;
             data.local_gatt_attribute.attribute = p->data.evt_gatt_server_attribute_value.attribute;
             data.local_gatt_attribute.att_opcode = p->data.evt_gatt_server_attribute_value.att_opcode;
@@ -138,7 +153,7 @@ void *silabs_watcher(void *arg)
             if (ret != 0)
             {
                 log_err("get dev mac from dev-list failed!\n");
-                return NULL;
+                break;
             }
             str2addr(tmp_address, data.local_gatt_attribute.address);
 
@@ -152,6 +167,7 @@ void *silabs_watcher(void *arg)
         case sl_bt_evt_gatt_server_characteristic_status_id:
         {
             gl_ble_gatt_data_t data;
+            data.local_characteristic_status.time_ns = queue_data.time_ns;
             data.local_characteristic_status.status_flags = p->data.evt_gatt_server_characteristic_status.status_flags;
             data.local_characteristic_status.characteristic = p->data.evt_gatt_server_characteristic_status.characteristic;
             data.local_characteristic_status.client_config_flags = p->data.evt_gatt_server_characteristic_status.client_config_flags;
@@ -161,7 +177,7 @@ void *silabs_watcher(void *arg)
             if (ret != 0)
             {
                 log_err("get dev mac from dev-list failed!\n");
-                return NULL;
+                break;
             }
             str2addr(tmp_address, data.local_characteristic_status.address);
 
@@ -175,6 +191,7 @@ void *silabs_watcher(void *arg)
         case sl_bt_evt_scanner_scan_report_id:
         {
             gl_ble_gap_data_t data;
+            data.scan_rst.time_ns = queue_data.time_ns;
             data.scan_rst.rssi = p->data.evt_scanner_scan_report.rssi;
             data.scan_rst.bonding = p->data.evt_scanner_scan_report.bonding;
             data.scan_rst.packet_type = p->data.evt_scanner_scan_report.packet_type;
@@ -191,18 +208,22 @@ void *silabs_watcher(void *arg)
         case sl_bt_evt_connection_parameters_id:
         {
             gl_ble_gap_data_t data;
+            data.update_conn_data.time_ns = queue_data.time_ns;
             data.update_conn_data.txsize = p->data.evt_connection_parameters.txsize;
             data.update_conn_data.latency = p->data.evt_connection_parameters.latency;
             data.update_conn_data.timeout = p->data.evt_connection_parameters.timeout;
             data.update_conn_data.interval = p->data.evt_connection_parameters.interval;
             data.update_conn_data.security_mode = p->data.evt_connection_parameters.security_mode;
 
+            // the connection balancer counts the connection events of every radio
+            ble_dev_mgr_set_interval(p->data.evt_connection_parameters.connection, p->data.evt_connection_parameters.interval);
+
             char tmp_address[MAC_STR_LEN] = {0};
             uint16_t ret = ble_dev_mgr_get_address(p->data.evt_connection_parameters.connection, tmp_address);
             if (ret != 0)
             {
                 log_err("get dev mac from dev-list failed!\n");
-                return NULL;
+                break;
             }
             str2addr(tmp_address, data.update_conn_data.address);
 
@@ -218,8 +239,10 @@ void *silabs_watcher(void *arg)
             char addr[MAC_STR_LEN] = {0};
             addr2str(p->data.evt_connection_opened.address.addr, addr);
             ble_dev_mgr_add(addr, p->data.evt_connection_opened.connection);
+            silabs_state_save();
 
             gl_ble_gap_data_t data;
+            data.connect_open_data.time_ns = queue_data.time_ns;
             data.connect_open_data.bonding = p->data.evt_connection_opened.bonding;
             data.connect_open_data.conn_role = p->data.evt_connection_opened.master;
             data.connect_open_data.advertiser = p->data.evt_connection_opened.advertiser;
@@ -236,6 +259,10 @@ void *silabs_watcher(void *arg)
         default:
             break;
         }
+
+        uint64_t done_time = utils_get_time_ns();
+        stats_record_stage(LATENCY_STAGE_CALLBACK, done_time - dequeue_time);
+        stats_record_stage(LATENCY_STAGE_TOTAL, done_time - queue_data.time_ns);
     }
 
     return NULL;
@@ -21,11 +21,15 @@
 
 typedef struct{
     long msgtype;   
+    uint64_t time_ns;   // receive time
+    uint64_t frame_ns;  // time the payload was read
+    uint64_t send_ns;   // time it was queued for the watcher
     struct sl_bt_packet evt;
 }silabs_msg_queue_t;
 
 typedef struct{
     int evt_msgid;
+    int radio;
     gl_ble_cbs* cbs;
 }watcher_param_t;
 
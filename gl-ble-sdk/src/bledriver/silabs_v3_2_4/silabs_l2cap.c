@@ -0,0 +1,718 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+#include <libubox/list.h>
+
+#include "sl_bt_api.h"
+#include "gl_errno.h"
+#include "gl_type.h"
+#include "gl_common.h"
+#include "gl_log.h"
+#include "gl_dev_mgr.h"
+#include "silabs_bleapi.h"
+#include "silabs_l2cap.h"
+#include "silabs_msg.h"
+#include "timestamp.h"
+#include "gl_radio.h"
+
+#define L2CAP_STATE_CONNECTING 0
+#define L2CAP_STATE_OPEN 1
+#define L2CAP_STATE_CLOSED 2
+
+// LE PSM range of the LE credit based connection
+#define L2CAP_LE_PSM_MAX 0xff
+#define L2CAP_MTU_MIN 23
+#define L2CAP_MPS_MAX 65533
+
+typedef struct
+{
+    struct list_head linked_list;
+    int radio;
+    uint16_t le_psm;
+    uint16_t mtu;
+    uint16_t mps;
+    uint16_t initial_credit;
+    gl_ble_l2cap_cb_t cb;
+    void *arg;
+} l2cap_listener_t;
+
+typedef struct
+{
+    struct list_head linked_list;
+    int radio;
+    uint8_t connection;
+    uint16_t cid; // channel endpoint of the remote device
+    uint16_t le_psm;
+    BLE_MAC address;
+    int state;
+    uint16_t result;
+    // local receiving side
+    uint16_t mtu;
+    uint16_t mps;
+    uint16_t initial_credit;
+    uint16_t rx_credit;
+    // remote receiving side
+    uint16_t peer_mtu;
+    uint16_t peer_mps;
+    uint32_t tx_credit;
+    gl_ble_l2cap_cb_t cb;
+    void *arg;
+} l2cap_chan_t;
+
+static pthread_mutex_t l2cap_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t l2cap_cond;
+static pthread_once_t l2cap_cond_once = PTHREAD_ONCE_INIT;
+static struct list_head listener_list = {&listener_list, &listener_list};
+static struct list_head chan_list = {&chan_list, &chan_list};
+
+static void l2cap_cond_init(void)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&l2cap_cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+/*
+ * number of PDUs, so credits, of a SDU. The first PDU carries the 2 bytes SDU length.
+ */
+static uint32_t pdu_num(int len, uint16_t mps)
+{
+    if (mps == 0)
+    {
+        return 1;
+    }
+    return (len + 2 + mps - 1) / mps;
+}
+
+static l2cap_listener_t *search_listener(uint16_t le_psm)
+{
+    l2cap_listener_t *listener = NULL;
+
+    list_for_each_entry(listener, &listener_list, linked_list)
+    {
+        if ((listener->radio == radio_cur()) && (listener->le_psm == le_psm))
+        {
+            return listener;
+        }
+    }
+    return NULL;
+}
+
+static l2cap_chan_t *search_chan(uint8_t connection, uint16_t cid)
+{
+    l2cap_chan_t *chan = NULL;
+
+    list_for_each_entry(chan, &chan_list, linked_list)
+    {
+        if ((chan->radio == radio_cur()) && (chan->connection == connection) && (chan->cid == cid) &&
+            (chan->state == L2CAP_STATE_OPEN))
+        {
+            return chan;
+        }
+    }
+    return NULL;
+}
+
+static l2cap_chan_t *search_connecting(uint8_t connection)
+{
+    l2cap_chan_t *chan = NULL;
+
+    list_for_each_entry(chan, &chan_list, linked_list)
+    {
+        if ((chan->radio == radio_cur()) && (chan->connection == connection) && (chan->state == L2CAP_STATE_CONNECTING))
+        {
+            return chan;
+        }
+    }
+    return NULL;
+}
+
+static void notify_open(l2cap_chan_t *chan)
+{
+    gl_ble_l2cap_data_t data;
+
+    memcpy(data.channel_open.address, chan->address, DEVICE_MAC_LEN);
+    data.channel_open.cid = chan->cid;
+    data.channel_open.le_psm = chan->le_psm;
+    data.channel_open.mtu = chan->peer_mtu;
+    data.channel_open.mps = chan->peer_mps;
+    data.channel_open.time_ns = silabs_evt_time();
+
+    if (chan->cb)
+    {
+        chan->cb(L2CAP_CHANNEL_OPEN_EVT, &data, chan->arg);
+    }
+}
+
+static void notify_closed(l2cap_chan_t *chan, uint16_t reason)
+{
+    gl_ble_l2cap_data_t data;
+
+    memcpy(data.channel_closed.address, chan->address, DEVICE_MAC_LEN);
+    data.channel_closed.cid = chan->cid;
+    data.channel_closed.reason = reason;
+    data.channel_closed.time_ns = silabs_evt_time();
+
+    if (chan->cb)
+    {
+        chan->cb(L2CAP_CHANNEL_CLOSED_EVT, &data, chan->arg);
+    }
+}
+
+/*
+ * Close channels of a connection of the current radio, or of all its connections if connection is -1.
+ * Open channels are freed here, the connecting one is freed by its waiter.
+ */
+static void close_chans(int connection, uint16_t reason)
+{
+    l2cap_chan_t *chan = NULL, *tmp = NULL;
+    struct list_head closed;
+
+    INIT_LIST_HEAD(&closed);
+
+    pthread_once(&l2cap_cond_once, l2cap_cond_init);
+    pthread_mutex_lock(&l2cap_mutex);
+    list_for_each_entry_safe(chan, tmp, &chan_list, linked_list)
+    {
+        if ((chan->radio != radio_cur()) || ((connection != -1) && (chan->connection != connection)))
+        {
+            continue;
+        }
+
+        if (chan->state == L2CAP_STATE_CONNECTING)
+        {
+            chan->state = L2CAP_STATE_CLOSED;
+            chan->result = reason;
+        }
+        else if (chan->state == L2CAP_STATE_OPEN)
+        {
+            list_del(&chan->linked_list);
+            list_add_tail(&chan->linked_list, &closed);
+        }
+    }
+    pthread_cond_broadcast(&l2cap_cond);
+    pthread_mutex_unlock(&l2cap_mutex);
+
+    list_for_each_entry_safe(chan, tmp, &closed, linked_list)
+    {
+        list_del(&chan->linked_list);
+        notify_closed(chan, reason);
+        free(chan);
+    }
+}
+
+static void get_address(uint8_t connection, BLE_MAC address)
+{
+    char address_str[BLE_MAC_LEN] = {0};
+
+    memset(address, 0, DEVICE_MAC_LEN);
+    if (ble_dev_mgr_get_address(connection, address_str) == GL_SUCCESS)
+    {
+        str2addr(address_str, address);
+    }
+}
+
+static void handle_connection_request(sl_bt_evt_l2cap_coc_connection_request_t *req)
+{
+    l2cap_listener_t *listener = NULL;
+    l2cap_chan_t *chan = NULL;
+
+    pthread_mutex_lock(&l2cap_mutex);
+    listener = search_listener(req->le_psm);
+    if (listener)
+    {
+        chan = (l2cap_chan_t *)calloc(1, sizeof(l2cap_chan_t));
+    }
+    if (chan)
+    {
+        chan->radio = radio_cur();
+        chan->connection = req->connection;
+        chan->cid = req->source_cid;
+        chan->le_psm = req->le_psm;
+        chan->state = L2CAP_STATE_OPEN;
+        chan->mtu = listener->mtu;
+        chan->mps = listener->mps;
+        chan->initial_credit = listener->initial_credit;
+        chan->rx_credit = listener->initial_credit;
+        chan->peer_mtu = req->mtu;
+        chan->peer_mps = req->mps;
+        chan->tx_credit = req->initial_credit;
+        chan->cb = listener->cb;
+        chan->arg = listener->arg;
+    }
+    pthread_mutex_unlock(&l2cap_mutex);
+
+    // the driver thread answers the remote device itself, it does not wait for the response
+    sl_bt_host_set_nowait(true);
+    if (!chan)
+    {
+        sl_bt_l2cap_coc_send_connection_response(req->connection, req->source_cid, 0, 0, 0,
+                                                 listener ? sl_bt_l2cap_no_resources_available : sl_bt_l2cap_le_psm_not_supported);
+        sl_bt_host_set_nowait(false);
+        return;
+    }
+
+    get_address(req->connection, chan->address);
+    sl_bt_l2cap_coc_send_connection_response(req->connection, req->source_cid, chan->mtu, chan->mps,
+                                             chan->initial_credit, sl_bt_l2cap_connection_successful);
+    sl_bt_host_set_nowait(false);
+
+    pthread_mutex_lock(&l2cap_mutex);
+    list_add_tail(&chan->linked_list, &chan_list);
+    pthread_mutex_unlock(&l2cap_mutex);
+
+    notify_open(chan);
+}
+
+static void handle_connection_response(sl_bt_evt_l2cap_coc_connection_response_t *rsp)
+{
+    l2cap_chan_t *chan = NULL;
+    bool opened = false;
+
+    pthread_mutex_lock(&l2cap_mutex);
+    chan = search_connecting(rsp->connection);
+    if (chan)
+    {
+        if (rsp->l2cap_errorcode == sl_bt_l2cap_connection_successful)
+        {
+            chan->cid = rsp->destination_cid;
+            chan->state = L2CAP_STATE_OPEN;
+            chan->rx_credit = chan->initial_credit;
+            chan->peer_mtu = rsp->mtu;
+            chan->peer_mps = rsp->mps;
+            chan->tx_credit = rsp->initial_credit;
+            opened = true;
+        }
+        else
+        {
+            chan->state = L2CAP_STATE_CLOSED;
+            chan->result = rsp->l2cap_errorcode;
+        }
+        pthread_cond_broadcast(&l2cap_cond);
+    }
+    pthread_mutex_unlock(&l2cap_mutex);
+
+    if (opened)
+    {
+        notify_open(chan);
+    }
+    else if ((!chan) && (rsp->l2cap_errorcode == sl_bt_l2cap_connection_successful))
+    {
+        // nobody waits for the channel any more
+        sl_bt_host_set_nowait(true);
+        sl_bt_l2cap_coc_send_disconnection_request(rsp->connection, rsp->destination_cid);
+        sl_bt_host_set_nowait(false);
+    }
+}
+
+static void handle_data(sl_bt_evt_l2cap_coc_data_t *evt_data)
+{
+    l2cap_chan_t *chan = NULL;
+    uint32_t used = 0;
+    uint16_t credits = 0;
+
+    // open channels are only freed in the driver thread, chan stays valid here
+    pthread_mutex_lock(&l2cap_mutex);
+    chan = search_chan(evt_data->connection, evt_data->cid);
+    if (chan)
+    {
+        used = pdu_num(evt_data->data.len, chan->mps);
+        chan->rx_credit = (used < chan->rx_credit) ? (chan->rx_credit - used) : 0;
+    }
+    pthread_mutex_unlock(&l2cap_mutex);
+
+    if (!chan)
+    {
+        return;
+    }
+
+    // the data is passed without copy
+    gl_ble_l2cap_data_t data;
+    memcpy(data.data.address, chan->address, DEVICE_MAC_LEN);
+    data.data.cid = chan->cid;
+    data.data.data = evt_data->data.data;
+    data.data.len = evt_data->data.len;
+    data.data.time_ns = silabs_evt_time();
+    if (chan->cb)
+    {
+        chan->cb(L2CAP_DATA_EVT, &data, chan->arg);
+    }
+
+    // credits are given back once the data is consumed, in batches of half of the initial credits
+    pthread_mutex_lock(&l2cap_mutex);
+    if (chan->rx_credit <= chan->initial_credit / 2)
+    {
+        credits = chan->initial_credit - chan->rx_credit;
+        chan->rx_credit = chan->initial_credit;
+    }
+    pthread_mutex_unlock(&l2cap_mutex);
+
+    if (credits)
+    {
+        sl_bt_host_set_nowait(true);
+        sl_bt_l2cap_coc_send_le_flow_control_credit(evt_data->connection, evt_data->cid, credits);
+        sl_bt_host_set_nowait(false);
+    }
+}
+
+bool silabs_l2cap_handle_evt(struct sl_bt_packet *p)
+{
+    pthread_once(&l2cap_cond_once, l2cap_cond_init);
+
+    switch (SL_BT_MSG_ID(p->header))
+    {
+    case sl_bt_evt_l2cap_coc_connection_request_id:
+    {
+        handle_connection_request(&p->data.evt_l2cap_coc_connection_request);
+        return true;
+    }
+    case sl_bt_evt_l2cap_coc_connection_response_id:
+    {
+        handle_connection_response(&p->data.evt_l2cap_coc_connection_response);
+        return true;
+    }
+    case sl_bt_evt_l2cap_coc_le_flow_control_credit_id:
+    {
+        l2cap_chan_t *chan = NULL;
+
+        pthread_mutex_lock(&l2cap_mutex);
+        chan = search_chan(p->data.evt_l2cap_coc_le_flow_control_credit.connection, p->data.evt_l2cap_coc_le_flow_control_credit.cid);
+        if (chan)
+        {
+            chan->tx_credit += p->data.evt_l2cap_coc_le_flow_control_credit.credits;
+            pthread_cond_broadcast(&l2cap_cond);
+        }
+        pthread_mutex_unlock(&l2cap_mutex);
+        return true;
+    }
+    case sl_bt_evt_l2cap_coc_channel_disconnected_id:
+    {
+        l2cap_chan_t *chan = NULL;
+
+        pthread_mutex_lock(&l2cap_mutex);
+        chan = search_chan(p->data.evt_l2cap_coc_channel_disconnected.connection, p->data.evt_l2cap_coc_channel_disconnected.cid);
+        if (chan)
+        {
+            list_del(&chan->linked_list);
+            pthread_cond_broadcast(&l2cap_cond);
+        }
+        pthread_mutex_unlock(&l2cap_mutex);
+
+        if (chan)
+        {
+            notify_closed(chan, p->data.evt_l2cap_coc_channel_disconnected.reason);
+            free(chan);
+        }
+        return true;
+    }
+    case sl_bt_evt_l2cap_coc_data_id:
+    {
+        handle_data(&p->data.evt_l2cap_coc_data);
+        return true;
+    }
+    case sl_bt_evt_l2cap_command_rejected_id:
+    {
+        if (p->data.evt_l2cap_command_rejected.code != sl_bt_l2cap_connection_request)
+        {
+            return true;
+        }
+
+        l2cap_chan_t *chan = NULL;
+
+        pthread_mutex_lock(&l2cap_mutex);
+        chan = search_connecting(p->data.evt_l2cap_command_rejected.connection);
+        if (chan)
+        {
+            chan->state = L2CAP_STATE_CLOSED;
+            chan->result = p->data.evt_l2cap_command_rejected.reason;
+            pthread_cond_broadcast(&l2cap_cond);
+        }
+        pthread_mutex_unlock(&l2cap_mutex);
+        return true;
+    }
+    case sl_bt_evt_connection_closed_id:
+    {
+        // the event still goes to the watcher
+        close_chans(p->data.evt_connection_closed.connection, p->data.evt_connection_closed.reason);
+        return false;
+    }
+    default:
+        break;
+    }
+
+    return false;
+}
+
+void silabs_l2cap_close_all(void)
+{
+    close_chans(-1, SL_STATUS_ABORT);
+}
+
+GL_RET silabs_ble_l2cap_listen(int le_psm, int mtu, int mps, int initial_credit, gl_ble_l2cap_cb_t cb, void *arg)
+{
+    if ((le_psm <= 0) || (le_psm > L2CAP_LE_PSM_MAX) || (mtu < L2CAP_MTU_MIN) || (mtu > L2CAP_SEND_DATA_MAX) ||
+        (mps < L2CAP_MTU_MIN) || (mps > L2CAP_MPS_MAX) || (initial_credit <= 0) || (initial_credit > 0xffff) || (!cb))
+    {
+        return GL_ERR_PARAM;
+    }
+
+    l2cap_listener_t *listener = (l2cap_listener_t *)calloc(1, sizeof(l2cap_listener_t));
+    if (!listener)
+    {
+        return GL_UNKNOW_ERR;
+    }
+    listener->radio = radio_cur();
+    listener->le_psm = (uint16_t)le_psm;
+    listener->mtu = (uint16_t)mtu;
+    listener->mps = (uint16_t)mps;
+    listener->initial_credit = (uint16_t)initial_credit;
+    listener->cb = cb;
+    listener->arg = arg;
+
+    pthread_mutex_lock(&l2cap_mutex);
+    if (search_listener((uint16_t)le_psm))
+    {
+        pthread_mutex_unlock(&l2cap_mutex);
+        free(listener);
+        return GL_ERR_INVOKE;
+    }
+    list_add_tail(&listener->linked_list, &listener_list);
+    pthread_mutex_unlock(&l2cap_mutex);
+
+    return GL_SUCCESS;
+}
+
+GL_RET silabs_ble_l2cap_stop_listen(int le_psm)
+{
+    l2cap_listener_t *listener = NULL;
+
+    pthread_mutex_lock(&l2cap_mutex);
+    listener = search_listener((uint16_t)le_psm);
+    if (listener)
+    {
+        list_del(&listener->linked_list);
+    }
+    pthread_mutex_unlock(&l2cap_mutex);
+
+    if (!listener)
+    {
+        return GL_ERR_PARAM;
+    }
+
+    free(listener);
+    return GL_SUCCESS;
+}
+
+GL_RET silabs_ble_l2cap_connect(BLE_MAC address, int le_psm, int mtu, int mps, int initial_credit, gl_ble_l2cap_cb_t cb, void *arg, int *cid)
+{
+    int connection = 0;
+    char address_str[BLE_MAC_LEN] = {0};
+    addr2str(address, address_str);
+    GL_RET ret = ble_dev_mgr_get_connection(address_str, &connection);
+    if (ret != GL_SUCCESS)
+    {
+        return GL_ERR_PARAM;
+    }
+
+    if ((le_psm <= 0) || (le_psm > L2CAP_LE_PSM_MAX) || (mtu < L2CAP_MTU_MIN) || (mtu > L2CAP_SEND_DATA_MAX) ||
+        (mps < L2CAP_MTU_MIN) || (mps > L2CAP_MPS_MAX) || (initial_credit <= 0) || (initial_credit > 0xffff) || (!cb) || (!cid))
+    {
+        return GL_ERR_PARAM;
+    }
+
+    l2cap_chan_t *chan = (l2cap_chan_t *)calloc(1, sizeof(l2cap_chan_t));
+    if (!chan)
+    {
+        return GL_UNKNOW_ERR;
+    }
+    chan->radio = radio_cur();
+    chan->connection = (uint8_t)connection;
+    chan->le_psm = (uint16_t)le_psm;
+    memcpy(chan->address, address, DEVICE_MAC_LEN);
+    chan->state = L2CAP_STATE_CONNECTING;
+    chan->mtu = (uint16_t)mtu;
+    chan->mps = (uint16_t)mps;
+    chan->initial_credit = (uint16_t)initial_credit;
+    chan->cb = cb;
+    chan->arg = arg;
+
+    pthread_once(&l2cap_cond_once, l2cap_cond_init);
+    pthread_mutex_lock(&l2cap_mutex);
+    // responses are matched by connection, one request at a time
+    if (search_connecting((uint8_t)connection))
+    {
+        pthread_mutex_unlock(&l2cap_mutex);
+        free(chan);
+        return GL_ERR_INVOKE;
+    }
+    list_add_tail(&chan->linked_list, &chan_list);
+    pthread_mutex_unlock(&l2cap_mutex);
+
+    sl_status_t status = sl_bt_l2cap_coc_send_connection_request((uint8_t)connection, (uint16_t)le_psm, (uint16_t)mtu, (uint16_t)mps, (uint16_t)initial_credit);
+
+    struct timespec ts;
+    utils_get_deadline(&ts, L2CAP_CONNECT_TIMEOUT);
+
+    pthread_mutex_lock(&l2cap_mutex);
+    if (status != SL_STATUS_OK)
+    {
+        ret = GL_UNKNOW_ERR;
+    }
+    else
+    {
+        while (chan->state == L2CAP_STATE_CONNECTING)
+        {
+            if (pthread_cond_timedwait(&l2cap_cond, &l2cap_mutex, &ts) == ETIMEDOUT)
+            {
+                break;
+            }
+        }
+
+        if (chan->state == L2CAP_STATE_OPEN)
+        {
+            *cid = chan->cid;
+            pthread_mutex_unlock(&l2cap_mutex);
+            return GL_SUCCESS;
+        }
+
+        if (chan->state == L2CAP_STATE_CLOSED)
+        {
+            log_err("l2cap connection refused: 0x%04x\n", chan->result);
+            ret = GL_UNKNOW_ERR;
+        }
+        else
+        {
+            ret = GL_ERR_EVENT_MISSING;
+        }
+    }
+    list_del(&chan->linked_list);
+    pthread_mutex_unlock(&l2cap_mutex);
+
+    free(chan);
+    return ret;
+}
+
+GL_RET silabs_ble_l2cap_send(BLE_MAC address, int cid, const uint8_t *data, int len, int timeout)
+{
+    int connection = 0;
+    char address_str[BLE_MAC_LEN] = {0};
+    addr2str(address, address_str);
+    GL_RET ret = ble_dev_mgr_get_connection(address_str, &connection);
+    if (ret != GL_SUCCESS)
+    {
+        return GL_ERR_PARAM;
+    }
+
+    if ((!data) || (len <= 0) || (len > L2CAP_SEND_DATA_MAX) || (timeout < 0))
+    {
+        return GL_ERR_PARAM;
+    }
+
+    l2cap_chan_t *chan = NULL;
+    uint32_t need = 0;
+    struct timespec ts;
+    utils_get_deadline(&ts, (uint32_t)timeout);
+
+    // wait until the remote device can receive all PDUs of the data
+    pthread_once(&l2cap_cond_once, l2cap_cond_init);
+    pthread_mutex_lock(&l2cap_mutex);
+    while (1)
+    {
+        chan = search_chan((uint8_t)connection, (uint16_t)cid);
+        if (!chan)
+        {
+            ret = GL_ERR_PARAM;
+            break;
+        }
+        if (len > chan->peer_mtu)
+        {
+            ret = GL_ERR_PARAM;
+            break;
+        }
+
+        need = pdu_num(len, chan->peer_mps);
+        if (chan->tx_credit >= need)
+        {
+            chan->tx_credit -= need;
+            ret = GL_SUCCESS;
+            break;
+        }
+
+        if (pthread_cond_timedwait(&l2cap_cond, &l2cap_mutex, &ts) == ETIMEDOUT)
+        {
+            ret = GL_ERR_EVENT_MISSING;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&l2cap_mutex);
+
+    if (ret != GL_SUCCESS)
+    {
+        return ret;
+    }
+
+    sl_status_t status = sl_bt_l2cap_coc_send_data((uint8_t)connection, (uint16_t)cid, (size_t)len, data);
+    if (status != SL_STATUS_OK)
+    {
+        // the data was not sent, give back the credits
+        pthread_mutex_lock(&l2cap_mutex);
+        chan = search_chan((uint8_t)connection, (uint16_t)cid);
+        if (chan)
+        {
+            chan->tx_credit += need;
+        }
+        pthread_mutex_unlock(&l2cap_mutex);
+        return GL_UNKNOW_ERR;
+    }
+
+    return GL_SUCCESS;
+}
+
+GL_RET silabs_ble_l2cap_disconnect(BLE_MAC address, int cid)
+{
+    int connection = 0;
+    char address_str[BLE_MAC_LEN] = {0};
+    addr2str(address, address_str);
+    GL_RET ret = ble_dev_mgr_get_connection(address_str, &connection);
+    if (ret != GL_SUCCESS)
+    {
+        return GL_ERR_PARAM;
+    }
+
+    pthread_mutex_lock(&l2cap_mutex);
+    l2cap_chan_t *chan = search_chan((uint8_t)connection, (uint16_t)cid);
+    pthread_mutex_unlock(&l2cap_mutex);
+    if (!chan)
+    {
+        return GL_ERR_PARAM;
+    }
+
+    // the channel is closed when the module reports it
+    sl_status_t status = sl_bt_l2cap_coc_send_disconnection_request((uint8_t)connection, (uint16_t)cid);
+    if (status != SL_STATUS_OK)
+    {
+        return GL_UNKNOW_ERR;
+    }
+
+    return GL_SUCCESS;
+}
@@ -0,0 +1,39 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#ifndef _SILABS_L2CAP_H_
+#define _SILABS_L2CAP_H_
+
+#include <stdbool.h>
+
+#include "sli_bt_api.h"
+
+#define L2CAP_CONNECT_TIMEOUT 5000
+
+// data length of one sl_bt_l2cap_coc_send_data command
+#define L2CAP_SEND_DATA_MAX (SL_BGAPI_MAX_PAYLOAD_SIZE - 4)
+
+/*
+ * Handle the L2CAP events in the driver thread. Return true if the event was consumed.
+ */
+bool silabs_l2cap_handle_evt(struct sl_bt_packet *p);
+
+/*
+ * Close all channels, used when the module is reset.
+ */
+void silabs_l2cap_close_all(void);
+
+#endif
@@ -22,6 +22,8 @@
 #include <unistd.h>
 #include <errno.h>
 #include <pthread.h>
+#include <time.h>
+#include <stddef.h>
 
 #include "silabs_msg.h"
 #include "gl_common.h"
@@ -30,6 +32,7 @@
 #include "gl_uart.h"
 #include "gl_thread.h"
 #include "timestamp.h"
+#include "gl_stats.h"
 #include "gl_log.h"
 #include "gl_dev_mgr.h"
 #include "silabs_bleapi.h"
@@ -37,31 +40,104 @@
 #include "gl_hal.h"
 #include "silabs_evt.h"
 #include "sli_bt_api.h"
+#include "silabs_proc.h"
+#include "silabs_l2cap.h"
+#include "silabs_state.h"
+#include "gl_radio.h"
+#include "gl_capture.h"
+#include "silabs_swap.h"
 
 BGLIB_DEFINE();
-bool appBooted = false; // App booted flag
 
-bool wait_reset_flag = false;
+// commands sent and not answered yet
+#define RSP_PENDING_MAX 16
 
-struct sl_bt_packet *evt = NULL;
-
-// save resp data evt
-struct sl_bt_packet special_evt[SPE_EVT_MAX];
-int special_evt_num = 0;
+// the link to the module of one radio
+typedef struct
+{
+    bool appBooted; // App booted flag
+    bool wait_reset_flag;
+
+    // one command in flight, its response is handed over from the driver thread
+    pthread_mutex_t cmd_mutex;
+    pthread_mutex_t tx_mutex;
+    pthread_mutex_t rsp_mutex;
+    pthread_cond_t rsp_cond;
+    // a command waits for its response, responses are accepted before the module booted
+    volatile bool rsp_waiting;
+    // appBooted and wait_reset_flag changes are signalled on boot_cond
+    pthread_mutex_t boot_mutex;
+    pthread_cond_t boot_cond;
+    struct sl_bt_packet rsp_buf;
+    bool rsp_ready;
+    // the module answers in the order of the wire, a response is matched to its command here
+    // so that the responses of the commands of the driver thread are not handed to a waiting thread
+    struct
+    {
+        uint32_t id;
+        bool driver;
+    } rsp_pending[RSP_PENDING_MAX];
+    int rsp_pending_r;
+    int rsp_pending_n;
+
+    // filled and emptied by the driver thread
+    struct sl_bt_packet rsp_pck;
+    struct sl_bt_packet queue_buffer[SL_BT_API_QUEUE_LEN];
+    int queue_w;
+    int queue_r;
+    // receive and frame complete time of every queued event
+    struct
+    {
+        uint64_t rx;
+        uint64_t frame;
+    } queue_time[SL_BT_API_QUEUE_LEN];
+    silabs_msg_queue_t msg_data;
+    // events in the message queue of the watcher, added by the driver thread and taken by the watcher
+    uint32_t watcher_depth;
+} link_t;
+
+static link_t link_list[RADIO_MAX] = {
+    [0 ... RADIO_MAX - 1] = {
+        .cmd_mutex = PTHREAD_MUTEX_INITIALIZER,
+        .tx_mutex = PTHREAD_MUTEX_INITIALIZER,
+        .rsp_mutex = PTHREAD_MUTEX_INITIALIZER,
+        .boot_mutex = PTHREAD_MUTEX_INITIALIZER,
+    },
+};
+static pthread_once_t rsp_cond_once = PTHREAD_ONCE_INIT;
+
+static __thread bool in_driver_thread = false;
+static __thread int rsp_timeout = SL_BT_RSP_TIMEOUT;
+static __thread bool cmd_yield = false;
+static __thread bool cmd_nowait = false;
 
 struct sl_bt_packet *gecko_get_event(int block);
 struct sl_bt_packet *gecko_wait_event(void);
 struct sl_bt_packet *gecko_wait_message(void); // wait for event from system
 
 void silabs_event_handler(struct sl_bt_packet *p);
-static void reverse_rev_payload(struct sl_bt_packet *pck);
 
-static int evt_msqid;
+// every radio has its own driver thread
+static __thread int evt_msqid;
+
+// receive and frame complete time of the event being handled
+static __thread uint64_t evt_time;
+static __thread uint64_t evt_frame_time;
+
+static link_t *cur_link(void)
+{
+    return &link_list[radio_cur()];
+}
 
 void *silabs_driver(void *arg)
 {
     driver_param_t driver_param = *((driver_param_t *)arg);
     evt_msqid = driver_param.evt_msgid;
+    radio_bind(driver_param.radio);
+
+    struct sl_bt_packet *evt = NULL;
+
+    in_driver_thread = true;
 
     while (1)
     {
@@ -93,30 +169,40 @@ struct sl_bt_packet *gecko_wait_event(void)
 struct sl_bt_packet *gecko_get_event(int block)
 {
     struct sl_bt_packet *p;
+    link_t *link = cur_link();
 
     while (1)
     {
-        if (sl_bt_queue_w != sl_bt_queue_r)
+        if (link->queue_w != link->queue_r)
         {
-            p = &sl_bt_queue_buffer[sl_bt_queue_r];
-            sl_bt_queue_r = (sl_bt_queue_r + 1) % SL_BT_API_QUEUE_LEN;
+            p = &link->queue_buffer[link->queue_r];
+            evt_time = link->queue_time[link->queue_r].rx;
+            evt_frame_time = link->queue_time[link->queue_r].frame;
+            link->queue_r = (link->queue_r + 1) % SL_BT_API_QUEUE_LEN;
             return p;
         }
 
-        // reset
-        if (wait_reset_flag)
+        // reset, the module was turned off by silabs_reset_wait
+        if (link->wait_reset_flag)
         {
-            system(rstoff);
-
             // clean dev list
             ble_dev_mgr_del_all();
 
             // clean uart cache
-            usleep(100 * 1000);
+            usleep(RESET_DRAIN_TIME * 1000);
             uartCacheClean();
 
-            appBooted = false;
-            wait_reset_flag = false;
+            evt_time = utils_get_time_ns();
+
+            // nothing outstanding will complete after reset
+            silabs_proc_abort_all(SL_STATUS_ABORT);
+            silabs_l2cap_close_all();
+
+            pthread_mutex_lock(&link->boot_mutex);
+            link->appBooted = false;
+            link->wait_reset_flag = false;
+            pthread_cond_broadcast(&link->boot_cond);
+            pthread_mutex_unlock(&link->boot_mutex);
         }
 
         p = gecko_wait_message();
@@ -127,31 +213,175 @@ struct sl_bt_packet *gecko_get_event(int block)
     }
 }
 
+static void rsp_cond_init(void)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    for (int i = 0; i < RADIO_MAX; i++)
+    {
+        pthread_cond_init(&link_list[i].rsp_cond, &attr);
+        pthread_cond_init(&link_list[i].boot_cond, &attr);
+    }
+    pthread_condattr_destroy(&attr);
+}
+
+static void set_booted(void)
+{
+    link_t *link = cur_link();
+
+    pthread_once(&rsp_cond_once, rsp_cond_init);
+
+    pthread_mutex_lock(&link->boot_mutex);
+    link->appBooted = true;
+    pthread_cond_broadcast(&link->boot_cond);
+    pthread_mutex_unlock(&link->boot_mutex);
+}
+
+bool silabs_booted(void)
+{
+    return cur_link()->appBooted;
+}
+
+int silabs_wait_booted(uint32_t timeout)
+{
+    link_t *link = cur_link();
+    struct timespec ts;
+    utils_get_deadline(&ts, timeout);
+
+    pthread_once(&rsp_cond_once, rsp_cond_init);
+
+    pthread_mutex_lock(&link->boot_mutex);
+    while (!link->appBooted)
+    {
+        if (pthread_cond_timedwait(&link->boot_cond, &link->boot_mutex, &ts) == ETIMEDOUT)
+        {
+            break;
+        }
+    }
+    int ret = link->appBooted ? 0 : -1;
+    pthread_mutex_unlock(&link->boot_mutex);
+
+    return ret;
+}
+
+int silabs_reset_wait(uint32_t timeout)
+{
+    link_t *link = cur_link();
+    struct timespec ts;
+    utils_get_deadline(&ts, timeout);
+
+    pthread_once(&rsp_cond_once, rsp_cond_init);
+
+    hal_rst_set(0);
+
+    pthread_mutex_lock(&link->boot_mutex);
+    link->wait_reset_flag = true;
+    while (link->wait_reset_flag)
+    {
+        if (pthread_cond_timedwait(&link->boot_cond, &link->boot_mutex, &ts) == ETIMEDOUT)
+        {
+            break;
+        }
+    }
+    int ret = link->wait_reset_flag ? -1 : 0;
+    pthread_mutex_unlock(&link->boot_mutex);
+
+    return ret;
+}
+
+int silabs_probe(uint32_t timeout)
+{
+    link_t *link = cur_link();
+
+    sl_bt_host_set_rsp_timeout(timeout);
+    sl_status_t status = sl_bt_system_hello();
+    sl_bt_host_set_rsp_timeout(0);
+
+    if (status != SL_STATUS_OK)
+    {
+        return -1;
+    }
+
+    // the stack is running, its boot event was received by an earlier process
+    if (!link->appBooted)
+    {
+        set_booted();
+    }
+    return 0;
+}
+
+/*
+ * hand over a response to the thread waiting in sl_bt_host_handle_command
+ */
+static void deliver_rsp(struct sl_bt_packet *pck)
+{
+    link_t *link = cur_link();
+    uint32_t id = SL_BT_MSG_ID(pck->header);
+    bool driver = false;
+
+    pthread_once(&rsp_cond_once, rsp_cond_init);
+
+    pthread_mutex_lock(&link->rsp_mutex);
+    // the commands sent before it were not answered, they are forgotten
+    while (link->rsp_pending_n)
+    {
+        int r = link->rsp_pending_r;
+        link->rsp_pending_r = (r + 1) % RSP_PENDING_MAX;
+        link->rsp_pending_n--;
+        if (link->rsp_pending[r].id == id)
+        {
+            driver = link->rsp_pending[r].driver;
+            break;
+        }
+    }
+    // nobody waits for the response of a command of the driver thread
+    if (driver)
+    {
+        pthread_mutex_unlock(&link->rsp_mutex);
+        return;
+    }
+    link->rsp_buf.header = pck->header;
+    memcpy(link->rsp_buf.data.payload, pck->data.payload, SL_BT_MSG_LEN(pck->header));
+    link->rsp_ready = true;
+    pthread_cond_broadcast(&link->rsp_cond);
+    pthread_mutex_unlock(&link->rsp_mutex);
+}
+
 struct sl_bt_packet *gecko_wait_message(void) // wait for event from system
 {
+    link_t *link = cur_link();
     uint32_t msg_length;
     uint32_t header = 0;
     uint8_t *payload;
-    struct sl_bt_packet *pck, *retVal = NULL;
+    struct sl_bt_packet *pck;
+    bool is_rsp = false;
     int ret;
 
     int dataToRead = SL_BT_MSG_HEADER_LEN;
     uint8_t *header_p = (uint8_t *)&header;
 
-    if (!appBooted)
+    if (!link->appBooted)
     {
+        bool skipped = false;
         while (1)
         {
             ret = uartRxNonBlocking(1, header_p);
             if (ret == 1)
             {
-                if (*header_p == 0xa0)
+                // events, or the response of a probe
+                if ((*header_p == 0xa0) || ((*header_p == 0x20) && (link->rsp_waiting)))
                 {
+                    if (skipped)
+                    {
+                        stats_add(STATS_RESYNCS, 1);
+                    }
                     break;
                 }
+                skipped = true;
             }
 
-            if (wait_reset_flag)
+            if (link->wait_reset_flag)
             {
                 return 0;
             }
@@ -174,19 +404,24 @@ struct sl_bt_packet *gecko_wait_message(void) // wait for event from system
             return 0;
         }
 
-        if (wait_reset_flag)
+        if (link->wait_reset_flag)
         {
             return 0;
         }
     }
 
+    uint64_t rx_time = utils_get_time_ns();
+    // the capture holds the frame as on the wire
+    uint32_t wire_header = header;
+
     if (ENDIAN)
     {
-        reverse_endian((uint8_t *)&header, SL_BT_MSG_HEADER_LEN);
+        header = __builtin_bswap32(header);
     }
 
     if (ret < 0 || (header & 0x78) != sl_bgapi_dev_type_bt)
     {
+        stats_add(STATS_PARSE_ERRORS, 1);
         return 0;
     }
 
@@ -194,33 +429,41 @@ struct sl_bt_packet *gecko_wait_message(void) // wait for event from system
 
     if (msg_length > SL_BGAPI_MAX_PAYLOAD_SIZE)
     {
+        stats_add(STATS_PARSE_ERRORS, 1);
         return 0;
     }
 
     if ((header & 0xf8) == (sl_bgapi_dev_type_bt | sl_bgapi_msg_type_evt))
     {
         // received event
-        if ((sl_bt_queue_w + 1) % SL_BT_API_QUEUE_LEN == sl_bt_queue_r)
+        if ((link->queue_w + 1) % SL_BT_API_QUEUE_LEN == link->queue_r)
         {
             // drop packet
+            uint8_t tmp_payload[SL_BGAPI_MAX_PAYLOAD_SIZE];
             if (msg_length)
             {
-                uint8_t tmp_payload[SL_BGAPI_MAX_PAYLOAD_SIZE];
                 uartRx(msg_length, tmp_payload);
             }
+            capture_frame(radio_cur(), CAPTURE_RX, rx_time, &wire_header, tmp_payload, msg_length);
+            stats_add(STATS_EVT_QUEUE_DROPS, 1);
             return 0; // NO ROOM IN QUEUE
         }
-        pck = &sl_bt_queue_buffer[sl_bt_queue_w];
-        sl_bt_queue_w = (sl_bt_queue_w + 1) % SL_BT_API_QUEUE_LEN;
+        pck = &link->queue_buffer[link->queue_w];
+        link->queue_time[link->queue_w].rx = rx_time;
+        link->queue_time[link->queue_w].frame = rx_time;
+        link->queue_w = (link->queue_w + 1) % SL_BT_API_QUEUE_LEN;
+        stats_high(STATS_EVT_QUEUE_HIGH, (link->queue_w + SL_BT_API_QUEUE_LEN - link->queue_r) % SL_BT_API_QUEUE_LEN);
     }
     else if ((header & 0xf8) == sl_bgapi_dev_type_bt)
     {
         // response
-        retVal = pck = sl_bt_rsp_msg;
+        pck = &link->rsp_pck;
+        is_rsp = true;
     }
     else
     {
         // fail
+        stats_add(STATS_PARSE_ERRORS, 1);
         return 0;
     }
     pck->header = header;
@@ -234,911 +477,317 @@ struct sl_bt_packet *gecko_wait_message(void) // wait for event from system
         if (ret < 0)
         {
             // log_err("recv fail\n");
+            stats_add(STATS_PARSE_ERRORS, 1);
             return 0;
         }
     }
     // log_hexdump((uint8_t *)&header, 4);
     // log_hexdump(payload, msg_length);
+    capture_frame(radio_cur(), CAPTURE_RX, rx_time, &wire_header, payload, msg_length);
+
+    stats_add(is_rsp ? STATS_RX_RSP_FRAMES : STATS_RX_EVT_FRAMES, 1);
+    stats_add(is_rsp ? STATS_RX_RSP_BYTES : STATS_RX_EVT_BYTES, SL_BT_MSG_HEADER_LEN + msg_length);
+
+    if (!is_rsp)
+    {
+        uint64_t frame_time = utils_get_time_ns();
+        link->queue_time[pck - link->queue_buffer].frame = frame_time;
+        stats_record_stage(LATENCY_STAGE_UART, frame_time - rx_time);
+    }
     if (ENDIAN)
     {
-        reverse_rev_payload(pck);
+        silabs_swap_rx(pck);
     }
 
-    // Using retVal avoid double handling of event msg types in outer function
-    return retVal;
+    // responses are handed over here, only events go to the event handler
+    if (is_rsp)
+    {
+        deliver_rsp(pck);
+    }
+
+    return 0;
 }
 
-int rx_peek_timeout(int ms)
+/*
+ * wait for the response of cmd_id, stale responses of timed out commands are dropped
+ */
+static int rx_peek_timeout(uint32_t cmd_id, int ms)
 {
-    int timeout = ms * 10;
-    while (timeout)
+    link_t *link = cur_link();
+    struct timespec ts;
+    utils_get_deadline(&ts, ms);
+
+    int ret = -1;
+    pthread_mutex_lock(&link->rsp_mutex);
+    while (1)
     {
-        timeout--;
-        if (SL_BT_MSG_ID(sl_bt_cmd_msg->header) == SL_BT_MSG_ID(sl_bt_rsp_msg->header))
+        if (link->rsp_ready)
         {
-            return 0;
+            link->rsp_ready = false;
+            if (SL_BT_MSG_ID(link->rsp_buf.header) == cmd_id)
+            {
+                sl_bt_rsp_msg->header = link->rsp_buf.header;
+                memcpy(sl_bt_rsp_msg->data.payload, link->rsp_buf.data.payload, SL_BT_MSG_LEN(link->rsp_buf.header));
+                ret = 0;
+                break;
+            }
+            log_debug("drop stale response: 0x%08x\n", SL_BT_MSG_ID(link->rsp_buf.header));
+            stats_add(STATS_STALE_RSPS, 1);
+        }
+
+        if (pthread_cond_timedwait(&link->rsp_cond, &link->rsp_mutex, &ts) == ETIMEDOUT)
+        {
+            break;
         }
-        usleep(100);
     }
+    pthread_mutex_unlock(&link->rsp_mutex);
 
-    return -1;
+    return ret;
 }
 
-void sl_bt_host_handle_command()
+/*
+ * note that a response to cmd_id is expected, in the order the commands go on the wire
+ */
+static void rsp_expect(link_t *link, uint32_t cmd_id)
 {
-    uint32_t send_msg_length = SL_BT_MSG_HEADER_LEN + SL_BT_MSG_LEN(sl_bt_cmd_msg->header);
-    if (ENDIAN)
+    pthread_mutex_lock(&link->rsp_mutex);
+    if (link->rsp_pending_n == RSP_PENDING_MAX)
     {
-        reverse_endian((uint8_t *)&sl_bt_cmd_msg->header, SL_BT_MSG_HEADER_LEN);
+        // the oldest command is not answered any more
+        link->rsp_pending_r = (link->rsp_pending_r + 1) % RSP_PENDING_MAX;
+        link->rsp_pending_n--;
     }
-    sl_bt_rsp_msg->header = 0;
-    // log_hexdump((uint8_t *)sl_bt_cmd_msg, send_msg_length);
-    uartTx(send_msg_length, (uint8_t *)sl_bt_cmd_msg); // send cmd msg
-
-    rx_peek_timeout(300); // wait for response
+    int w = (link->rsp_pending_r + link->rsp_pending_n) % RSP_PENDING_MAX;
+    link->rsp_pending[w].id = cmd_id;
+    link->rsp_pending[w].driver = in_driver_thread;
+    link->rsp_pending_n++;
+    pthread_mutex_unlock(&link->rsp_mutex);
 }
 
-void sl_bt_host_handle_command_noresponse()
+/*
+ * send the fixed part of a command from its packet and its byte array from the memory of the caller,
+ * expect the response of cmd_id, or none if it is 0
+ */
+static void cmd_tx(uint32_t len, struct sl_bt_packet *cmd, const void *data, uint32_t data_len, uint32_t cmd_id)
 {
-    uint32_t send_msg_length = SL_BT_MSG_HEADER_LEN + SL_BT_MSG_LEN(sl_bt_cmd_msg->header);
-    if (ENDIAN)
+    link_t *link = cur_link();
+    struct iovec iov[2] = {
+        { .iov_base = cmd, .iov_len = len - data_len },
+        { .iov_base = (void *)data, .iov_len = data_len },
+    };
+    int iovcnt = data_len ? 2 : 1;
+
+    pthread_mutex_lock(&link->tx_mutex);
+    if (cmd_id)
     {
-        reverse_endian((uint8_t *)&sl_bt_cmd_msg->header, SL_BT_MSG_HEADER_LEN);
+        rsp_expect(link, cmd_id);
     }
-    // log_hexdump((uint8_t *)&sl_bt_cmd_msg, send_msg_length);
-    uartTx(send_msg_length, (uint8_t *)sl_bt_cmd_msg); // send cmd msg
+    // log_hexdump((uint8_t *)cmd, len);
+    capture_frame_iov(radio_cur(), CAPTURE_TX, utils_get_time_ns(), iov, iovcnt);
+    uartTxv(iov, iovcnt); // send cmd msg
+    pthread_mutex_unlock(&link->tx_mutex);
+
+    stats_add(STATS_TX_CMD_FRAMES, 1);
+    stats_add(STATS_TX_CMD_BYTES, len);
 }
 
-/*
- *	module events report
- */
-static silabs_msg_queue_t msg_data;
-static int msg_evt_len;
-void silabs_event_handler(struct sl_bt_packet *p)
+void sl_bt_host_handle_command()
 {
-    // printf("Event handler: 0x%04x\n", SL_BT_MSG_ID(evt->header));
+    sl_bt_host_send(sl_bt_cmd_msg, NULL, 0);
+}
 
-    // Do not handle any events until system is booted up properly.
-    if ((SL_BT_MSG_ID(evt->header) != sl_bt_evt_system_boot_id) && !appBooted)
+void sl_bt_host_send(struct sl_bt_packet *cmd, const void *data, uint32_t data_len)
+{
+    link_t *link = cur_link();
+    uint32_t send_msg_length = SL_BT_MSG_HEADER_LEN + SL_BT_MSG_LEN(cmd->header);
+    uint32_t cmd_id = SL_BT_MSG_ID(cmd->header);
+    if (ENDIAN)
     {
-        log_debug("Wait for system boot ... \n");
-        // usleep(50000);
-        return;
+        silabs_swap_cmd(cmd);
+        cmd->header = __builtin_bswap32(cmd->header);
     }
 
-    switch (SL_BT_MSG_ID(p->header))
-    {
-    case sl_bt_evt_system_boot_id:
+    // the driver thread can not wait for a response it has to receive itself: its own commands
+    // are sent and their responses dropped when they come, those of the callbacks it runs are refused
+    if (in_driver_thread)
     {
-        appBooted = true;
+        uint16_t result = SL_STATUS_INVALID_STATE;
+        if (cmd_nowait)
+        {
+            cmd_tx(send_msg_length, cmd, data, data_len, cmd_id);
+            result = SL_STATUS_OK;
+        }
+        else
+        {
+            log_err("command refused in the driver thread: 0x%08x\n", cmd_id);
+        }
+        memset(sl_bt_rsp_msg, 0, sizeof(struct sl_bt_packet));
+        memcpy(sl_bt_rsp_msg->data.payload, &result, sizeof(result));
+        return;
     }
-    case sl_bt_evt_connection_closed_id:
-    case sl_bt_evt_gatt_characteristic_value_id:
-    case sl_bt_evt_gatt_server_attribute_value_id:
-    case sl_bt_evt_gatt_server_characteristic_status_id:
-    case sl_bt_evt_scanner_scan_report_id:
-    case sl_bt_evt_connection_parameters_id:
-    case sl_bt_evt_connection_opened_id:
-    {
-        msg_data.msgtype = 1;
-        msg_evt_len = SL_BT_MSG_HEADER_LEN + SL_BT_MSG_LEN(p->header);
-        memcpy(&(msg_data.evt), p, msg_evt_len);
 
-        // send evt msg to msg queue
-        if (-1 == msgsnd(evt_msqid, (void *)&msg_data, msg_evt_len, IPC_NOWAIT))
+    pthread_once(&rsp_cond_once, rsp_cond_init);
+    if (cmd_yield)
+    {
+        if (pthread_mutex_trylock(&link->cmd_mutex) != 0)
         {
-            log_debug("silabs evt msgsnd error!  errno: %d\n", errno);
+            uint16_t result = SL_STATUS_BUSY;
+            memset(sl_bt_rsp_msg, 0, sizeof(struct sl_bt_packet));
+            memcpy(sl_bt_rsp_msg->data.payload, &result, sizeof(result));
+            return;
         }
-        break;
     }
+    else
+    {
+        pthread_mutex_lock(&link->cmd_mutex);
+    }
+
+    pthread_mutex_lock(&link->rsp_mutex);
+    link->rsp_ready = false;
+    pthread_mutex_unlock(&link->rsp_mutex);
 
-    case sl_bt_evt_gatt_service_id:
-    case sl_bt_evt_gatt_characteristic_id:
+    uint64_t tx_time = utils_get_time_ns();
+    link->rsp_waiting = true;
+    cmd_tx(send_msg_length, cmd, data, data_len, cmd_id);
+
+    // wait for response
+    int ret = rx_peek_timeout(cmd_id, rsp_timeout);
+    link->rsp_waiting = false;
+    if (ret == 0)
     {
-        special_evt[special_evt_num].header = p->header;
-        memcpy(&special_evt[special_evt_num].data.payload, p->data.payload, SL_BGAPI_MAX_PAYLOAD_SIZE);
-        special_evt_num++;
-        break;
+        stats_record_cmd((uint8_t)(cmd_id >> 16), utils_get_time_ns() - tx_time);
     }
-    default:
-        break;
+    else
+    {
+        // all responses start with the result
+        uint16_t result = SL_STATUS_TIMEOUT;
+        memset(sl_bt_rsp_msg, 0, sizeof(struct sl_bt_packet));
+        memcpy(sl_bt_rsp_msg->data.payload, &result, sizeof(result));
+        log_err("wait for response timeout: 0x%08x\n", cmd_id);
+        stats_add(STATS_CMD_TIMEOUTS, 1);
     }
 
-    return;
+    pthread_mutex_unlock(&link->cmd_mutex);
 }
 
-// int wait_rsp_evt(uint32_t evt_id, uint32_t timeout)
-// {
-//     uint32_t current_time_us = 0, start_time_us = 0;
-//     uint32_t spend = 0;
+void sl_bt_host_set_rsp_timeout(int timeout)
+{
+    rsp_timeout = (timeout > 0) ? timeout : SL_BT_RSP_TIMEOUT;
+}
 
-// 	uint32_t timeout_us = timeout * 1000;
+void sl_bt_host_set_yield(bool yield)
+{
+    cmd_yield = yield;
+}
 
-//     start_time_us = utils_get_timestamp();
+void sl_bt_host_set_nowait(bool nowait)
+{
+    cmd_nowait = nowait;
+}
 
-//     while (timeout_us > spend) {
-// 		if (evt_id == SL_BT_MSG_ID(evt->header)) {
-//             printf("evt->header = %d\n",evt->header);
-// 			return 0;
-// 		}
+void silabs_watcher_taken(void)
+{
+    __atomic_sub_fetch(&cur_link()->watcher_depth, 1, __ATOMIC_RELAXED);
+}
 
-//         current_time_us = utils_get_timestamp();
-//         spend = current_time_us - start_time_us;
-//     }
+bool silabs_in_driver_thread(void)
+{
+    return in_driver_thread;
+}
 
-//     return -1;
-// }
+uint64_t silabs_evt_time(void)
+{
+    return evt_time;
+}
 
-int wait_rsp_evt(uint32_t evt_id, uint32_t timeout)
+void sl_bt_host_handle_command_noresponse()
 {
-    uint32_t current_time_us = 0, start_time_us = 0;
-    uint32_t spend = 0;
+    sl_bt_host_send_noresponse(sl_bt_cmd_msg, NULL, 0);
+}
 
-    while (timeout > spend)
+void sl_bt_host_send_noresponse(struct sl_bt_packet *cmd, const void *data, uint32_t data_len)
+{
+    uint32_t send_msg_length = SL_BT_MSG_HEADER_LEN + SL_BT_MSG_LEN(cmd->header);
+    if (ENDIAN)
     {
-        if (evt_id == SL_BT_MSG_ID(evt->header))
-        {
-            return 0;
-        }
-        usleep(1000);
-        spend++;
+        silabs_swap_cmd(cmd);
+        cmd->header = __builtin_bswap32(cmd->header);
     }
-    return -1;
+
+    cmd_tx(send_msg_length, cmd, data, data_len, 0);
 }
 
-static void reverse_rev_payload(struct sl_bt_packet *pck)
+/*
+ *	module events report
+ */
+void silabs_event_handler(struct sl_bt_packet *p)
 {
-    uint32_t p = SL_BT_MSG_ID(pck->header);
-    //   log_debug("p: %04x %04x\n", p, SL_BT_MSG_ID(pck->header));
+    link_t *link = cur_link();
+
+    // printf("Event handler: 0x%04x\n", SL_BT_MSG_ID(p->header));
 
-    switch (p)
+    // Do not handle any events until system is booted up properly.
+    if ((SL_BT_MSG_ID(p->header) != sl_bt_evt_system_boot_id) && !link->appBooted)
     {
+        log_debug("Wait for system boot ... \n");
+        // usleep(50000);
+        return;
+    }
 
-    case sl_bt_rsp_dfu_flash_set_address_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_dfu_flash_set_address.result), 2);
-        break;
-    case sl_bt_rsp_dfu_flash_upload_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_dfu_flash_upload.result), 2);
-        break;
-    case sl_bt_rsp_dfu_flash_upload_finish_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_dfu_flash_upload_finish.result), 2);
-        break;
-    case sl_bt_rsp_system_hello_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_hello.result), 2);
-        break;
-    case sl_bt_rsp_system_start_bluetooth_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_start_bluetooth.result), 2);
-        break;
-    case sl_bt_rsp_system_stop_bluetooth_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_stop_bluetooth.result), 2);
-        break;
-    case sl_bt_rsp_system_get_version_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_get_version.result), 2);
-        break;
-    case sl_bt_rsp_system_halt_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_halt.result), 2);
-        break;
-    case sl_bt_rsp_system_linklayer_configure_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_linklayer_configure.result), 2);
-        break;
-    case sl_bt_rsp_system_set_max_tx_power_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_set_max_tx_power.result), 2);
-        break;
-    case sl_bt_rsp_system_set_tx_power_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_set_tx_power.result), 2);
-        break;
-    case sl_bt_rsp_system_get_tx_power_setting_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_get_tx_power_setting.result), 2);
-        break;
-    case sl_bt_rsp_system_set_identity_address_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_set_identity_address.result), 2);
-        break;
-    case sl_bt_rsp_system_get_identity_address_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_get_identity_address.result), 2);
-        break;
-    case sl_bt_rsp_system_get_random_data_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_get_random_data.result), 2);
-        break;
-    case sl_bt_rsp_system_data_buffer_write_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_data_buffer_write.result), 2);
-        break;
-    case sl_bt_rsp_system_data_buffer_clear_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_data_buffer_clear.result), 2);
-        break;
-    case sl_bt_rsp_system_get_counters_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_get_counters.result), 2);
-        break;
-    case sl_bt_rsp_system_set_soft_timer_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_set_soft_timer.result), 2);
-        break;
-    case sl_bt_rsp_system_set_lazy_soft_timer_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_system_set_lazy_soft_timer.result), 2);
-        break;
-    case sl_bt_rsp_gap_set_privacy_mode_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gap_set_privacy_mode.result), 2);
-        break;
-    case sl_bt_rsp_gap_set_data_channel_classification_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gap_set_data_channel_classification.result), 2);
-        break;
-    case sl_bt_rsp_gap_enable_whitelisting_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gap_enable_whitelisting.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_create_set_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_create_set.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_set_timing_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_set_timing.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_set_phy_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_set_phy.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_set_channel_map_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_set_channel_map.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_set_tx_power_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_set_tx_power.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_set_report_scan_request_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_set_report_scan_request.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_set_random_address_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_set_random_address.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_clear_random_address_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_clear_random_address.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_set_configuration_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_set_configuration.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_clear_configuration_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_clear_configuration.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_set_data_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_set_data.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_set_long_data_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_set_long_data.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_start_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_start.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_stop_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_stop.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_start_periodic_advertising_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_start_periodic_advertising.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_stop_periodic_advertising_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_stop_periodic_advertising.result), 2);
-        break;
-    case sl_bt_rsp_advertiser_delete_set_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_advertiser_delete_set.result), 2);
-        break;
-    case sl_bt_rsp_scanner_set_timing_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_scanner_set_timing.result), 2);
-        break;
-    case sl_bt_rsp_scanner_set_mode_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_scanner_set_mode.result), 2);
-        break;
-    case sl_bt_rsp_scanner_start_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_scanner_start.result), 2);
-        break;
-    case sl_bt_rsp_scanner_stop_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_scanner_stop.result), 2);
-        break;
-    case sl_bt_rsp_sync_set_parameters_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sync_set_parameters.result), 2);
-        break;
-    case sl_bt_rsp_sync_open_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sync_open.result), 2);
-        break;
-    case sl_bt_rsp_sync_close_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sync_close.result), 2);
-        break;
-    case sl_bt_rsp_connection_set_default_parameters_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_connection_set_default_parameters.result), 2);
-        break;
-    case sl_bt_rsp_connection_set_default_preferred_phy_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_connection_set_default_preferred_phy.result), 2);
-        break;
-    case sl_bt_rsp_connection_open_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_connection_open.result), 2);
-        break;
-    case sl_bt_rsp_connection_set_parameters_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_connection_set_parameters.result), 2);
-        break;
-    case sl_bt_rsp_connection_set_preferred_phy_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_connection_set_preferred_phy.result), 2);
-        break;
-    case sl_bt_rsp_connection_disable_slave_latency_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_connection_disable_slave_latency.result), 2);
-        break;
-    case sl_bt_rsp_connection_get_rssi_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_connection_get_rssi.result), 2);
-        break;
-    case sl_bt_rsp_connection_read_channel_map_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_connection_read_channel_map.result), 2);
-        break;
-    case sl_bt_rsp_connection_set_power_reporting_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_connection_set_power_reporting.result), 2);
-        break;
-    case sl_bt_rsp_connection_set_remote_power_reporting_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_connection_set_remote_power_reporting.result), 2);
-        break;
-    case sl_bt_rsp_connection_get_tx_power_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_connection_get_tx_power.result), 2);
-        break;
-    case sl_bt_rsp_connection_get_remote_tx_power_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_connection_get_remote_tx_power.result), 2);
-        break;
-    case sl_bt_rsp_connection_close_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_connection_close.result), 2);
-        break;
-    case sl_bt_rsp_connection_read_remote_used_features_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_connection_read_remote_used_features.result), 2);
-        break;
-    case sl_bt_rsp_gatt_set_max_mtu_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_set_max_mtu.result), 2);
-        break;
-    case sl_bt_rsp_gatt_discover_primary_services_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_discover_primary_services.result), 2);
-        break;
-    case sl_bt_rsp_gatt_find_included_services_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_find_included_services.result), 2);
-        break;
-    case sl_bt_rsp_gatt_discover_characteristics_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_discover_characteristics.result), 2);
-        break;
-    case sl_bt_rsp_gatt_discover_characteristics_by_uuid_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_discover_characteristics_by_uuid.result), 2);
-        break;
-    case sl_bt_rsp_gatt_discover_descriptors_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_discover_descriptors.result), 2);
-        break;
-    case sl_bt_rsp_gatt_set_characteristic_notification_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_set_characteristic_notification.result), 2);
-        break;
-    case sl_bt_rsp_gatt_send_characteristic_confirmation_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_send_characteristic_confirmation.result), 2);
-        break;
-    case sl_bt_rsp_gatt_read_characteristic_value_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_read_characteristic_value.result), 2);
-        break;
-    case sl_bt_rsp_gatt_read_characteristic_value_from_offset_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_read_characteristic_value_from_offset.result), 2);
-        break;
-    case sl_bt_rsp_gatt_read_multiple_characteristic_values_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_read_multiple_characteristic_values.result), 2);
-        break;
-    case sl_bt_rsp_gatt_read_characteristic_value_by_uuid_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_read_characteristic_value_by_uuid.result), 2);
-        break;
-    case sl_bt_rsp_gatt_write_characteristic_value_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_write_characteristic_value.result), 2);
-        break;
-    case sl_bt_rsp_gatt_write_characteristic_value_without_response_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_write_characteristic_value_without_response.result), 2);
-        break;
-    case sl_bt_rsp_gatt_prepare_characteristic_value_write_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_prepare_characteristic_value_write.result), 2);
-        break;
-    case sl_bt_rsp_gatt_prepare_characteristic_value_reliable_write_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_prepare_characteristic_value_reliable_write.result), 2);
-        break;
-    case sl_bt_rsp_gatt_execute_characteristic_value_write_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_execute_characteristic_value_write.result), 2);
-        break;
-    case sl_bt_rsp_gatt_read_descriptor_value_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_read_descriptor_value.result), 2);
-        break;
-    case sl_bt_rsp_gatt_write_descriptor_value_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_write_descriptor_value.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_new_session_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_new_session.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_add_service_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_add_service.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_remove_service_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_remove_service.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_add_included_service_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_add_included_service.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_remove_included_service_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_remove_included_service.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_add_uuid16_characteristic_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_add_uuid16_characteristic.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_add_uuid128_characteristic_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_add_uuid128_characteristic.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_remove_characteristic_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_remove_characteristic.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_add_uuid16_descriptor_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_add_uuid16_descriptor.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_add_uuid128_descriptor_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_add_uuid128_descriptor.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_remove_descriptor_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_remove_descriptor.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_start_service_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_start_service.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_stop_service_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_stop_service.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_start_characteristic_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_start_characteristic.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_stop_characteristic_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_stop_characteristic.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_commit_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_commit.result), 2);
-        break;
-    case sl_bt_rsp_gattdb_abort_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gattdb_abort.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_set_max_mtu_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_set_max_mtu.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_get_mtu_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_get_mtu.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_find_attribute_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_find_attribute.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_read_attribute_value_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_read_attribute_value.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_read_attribute_type_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_read_attribute_type.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_write_attribute_value_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_write_attribute_value.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_send_user_read_response_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_send_user_read_response.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_send_user_write_response_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_send_user_write_response.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_send_characteristic_notification_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_send_characteristic_notification.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_send_notification_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_send_notification.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_send_indication_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_send_indication.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_notify_all_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_notify_all.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_read_client_configuration_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_read_client_configuration.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_send_user_prepare_write_response_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_send_user_prepare_write_response.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_set_capabilities_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_set_capabilities.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_enable_capabilities_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_enable_capabilities.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_disable_capabilities_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_disable_capabilities.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_get_enabled_capabilities_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_get_enabled_capabilities.result), 2);
-        break;
-    case sl_bt_rsp_gatt_server_read_client_supported_features_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_gatt_server_read_client_supported_features.result), 2);
-        break;
-    case sl_bt_rsp_nvm_save_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_nvm_save.result), 2);
-        break;
-    case sl_bt_rsp_nvm_load_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_nvm_load.result), 2);
-        break;
-    case sl_bt_rsp_nvm_erase_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_nvm_erase.result), 2);
-        break;
-    case sl_bt_rsp_nvm_erase_all_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_nvm_erase_all.result), 2);
-        break;
-    case sl_bt_rsp_test_dtm_tx_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_test_dtm_tx.result), 2);
-        break;
-    case sl_bt_rsp_test_dtm_tx_v4_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_test_dtm_tx_v4.result), 2);
-        break;
-    case sl_bt_rsp_test_dtm_rx_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_test_dtm_rx.result), 2);
-        break;
-    case sl_bt_rsp_test_dtm_end_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_test_dtm_end.result), 2);
-        break;
-    case sl_bt_rsp_sm_configure_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_configure.result), 2);
-        break;
-    case sl_bt_rsp_sm_set_minimum_key_size_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_set_minimum_key_size.result), 2);
-        break;
-    case sl_bt_rsp_sm_set_debug_mode_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_set_debug_mode.result), 2);
-        break;
-    case sl_bt_rsp_sm_add_to_whitelist_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_add_to_whitelist.result), 2);
-        break;
-    case sl_bt_rsp_sm_store_bonding_configuration_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_store_bonding_configuration.result), 2);
-        break;
-    case sl_bt_rsp_sm_set_bondable_mode_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_set_bondable_mode.result), 2);
-        break;
-    case sl_bt_rsp_sm_set_passkey_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_set_passkey.result), 2);
-        break;
-    case sl_bt_rsp_sm_set_oob_data_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_set_oob_data.result), 2);
-        break;
-    case sl_bt_rsp_sm_use_sc_oob_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_use_sc_oob.result), 2);
-        break;
-    case sl_bt_rsp_sm_set_sc_remote_oob_data_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_set_sc_remote_oob_data.result), 2);
-        break;
-    case sl_bt_rsp_sm_increase_security_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_increase_security.result), 2);
-        break;
-    case sl_bt_rsp_sm_enter_passkey_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_enter_passkey.result), 2);
-        break;
-    case sl_bt_rsp_sm_passkey_confirm_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_passkey_confirm.result), 2);
-        break;
-    case sl_bt_rsp_sm_bonding_confirm_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_bonding_confirm.result), 2);
-        break;
-    case sl_bt_rsp_sm_list_all_bondings_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_list_all_bondings.result), 2);
-        break;
-    case sl_bt_rsp_sm_delete_bonding_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_delete_bonding.result), 2);
-        break;
-    case sl_bt_rsp_sm_delete_bondings_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_delete_bondings.result), 2);
-        break;
-    case sl_bt_rsp_sm_get_bonding_handles_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_get_bonding_handles.result), 2);
-        break;
-    case sl_bt_rsp_sm_get_bonding_details_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_get_bonding_details.result), 2);
-        break;
-    case sl_bt_rsp_sm_find_bonding_by_address_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_find_bonding_by_address.result), 2);
-        break;
-    case sl_bt_rsp_sm_set_bonding_key_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_set_bonding_key.result), 2);
-        break;
-    case sl_bt_rsp_sm_set_legacy_oob_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_set_legacy_oob.result), 2);
-        break;
-    case sl_bt_rsp_sm_set_oob_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_set_oob.result), 2);
-        break;
-    case sl_bt_rsp_sm_set_remote_oob_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_sm_set_remote_oob.result), 2);
-        break;
-    case sl_bt_rsp_ota_set_device_name_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_ota_set_device_name.result), 2);
-        break;
-    case sl_bt_rsp_ota_set_advertising_data_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_ota_set_advertising_data.result), 2);
-        break;
-    case sl_bt_rsp_ota_set_configuration_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_ota_set_configuration.result), 2);
-        break;
-    case sl_bt_rsp_ota_set_rf_path_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_ota_set_rf_path.result), 2);
-        break;
-    case sl_bt_rsp_coex_set_options_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_coex_set_options.result), 2);
-        break;
-    case sl_bt_rsp_coex_set_parameters_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_coex_set_parameters.result), 2);
-        break;
-    case sl_bt_rsp_coex_set_directional_priority_pulse_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_coex_set_directional_priority_pulse.result), 2);
-        break;
-    case sl_bt_rsp_coex_get_counters_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_coex_get_counters.result), 2);
-        break;
-    case sl_bt_rsp_l2cap_coc_send_connection_request_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_l2cap_coc_send_connection_request.result), 2);
-        break;
-    case sl_bt_rsp_l2cap_coc_send_connection_response_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_l2cap_coc_send_connection_response.result), 2);
-        break;
-    case sl_bt_rsp_l2cap_coc_send_le_flow_control_credit_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_l2cap_coc_send_le_flow_control_credit.result), 2);
-        break;
-    case sl_bt_rsp_l2cap_coc_send_disconnection_request_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_l2cap_coc_send_disconnection_request.result), 2);
-        break;
-    case sl_bt_rsp_l2cap_coc_send_data_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_l2cap_coc_send_data.result), 2);
-        break;
-    case sl_bt_rsp_cte_transmitter_set_dtm_parameters_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_transmitter_set_dtm_parameters.result), 2);
-        break;
-    case sl_bt_rsp_cte_transmitter_clear_dtm_parameters_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_transmitter_clear_dtm_parameters.result), 2);
-        break;
-    case sl_bt_rsp_cte_transmitter_enable_connection_cte_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_transmitter_enable_connection_cte.result), 2);
-        break;
-    case sl_bt_rsp_cte_transmitter_disable_connection_cte_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_transmitter_disable_connection_cte.result), 2);
-        break;
-    case sl_bt_rsp_cte_transmitter_enable_connectionless_cte_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_transmitter_enable_connectionless_cte.result), 2);
-        break;
-    case sl_bt_rsp_cte_transmitter_disable_connectionless_cte_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_transmitter_disable_connectionless_cte.result), 2);
-        break;
-    case sl_bt_rsp_cte_transmitter_enable_silabs_cte_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_transmitter_enable_silabs_cte.result), 2);
-        break;
-    case sl_bt_rsp_cte_transmitter_disable_silabs_cte_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_transmitter_disable_silabs_cte.result), 2);
-        break;
-    case sl_bt_rsp_cte_receiver_set_dtm_parameters_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_receiver_set_dtm_parameters.result), 2);
-        break;
-    case sl_bt_rsp_cte_receiver_clear_dtm_parameters_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_receiver_clear_dtm_parameters.result), 2);
-        break;
-    case sl_bt_rsp_cte_receiver_set_sync_cte_type_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_receiver_set_sync_cte_type.result), 2);
-        break;
-    case sl_bt_rsp_cte_receiver_configure_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_receiver_configure.result), 2);
-        break;
-    case sl_bt_rsp_cte_receiver_enable_connection_cte_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_receiver_enable_connection_cte.result), 2);
-        break;
-    case sl_bt_rsp_cte_receiver_disable_connection_cte_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_receiver_disable_connection_cte.result), 2);
-        break;
-    case sl_bt_rsp_cte_receiver_enable_connectionless_cte_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_receiver_enable_connectionless_cte.result), 2);
-        break;
-    case sl_bt_rsp_cte_receiver_disable_connectionless_cte_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_receiver_disable_connectionless_cte.result), 2);
-        break;
-    case sl_bt_rsp_cte_receiver_enable_silabs_cte_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_receiver_enable_silabs_cte.result), 2);
-        break;
-    case sl_bt_rsp_cte_receiver_disable_silabs_cte_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_cte_receiver_disable_silabs_cte.result), 2);
-        break;
-    case sl_bt_rsp_memory_profiler_get_status_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_memory_profiler_get_status.result), 2);
-        break;
-    case sl_bt_rsp_memory_profiler_reset_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_memory_profiler_reset.result), 2);
-        break;
-    case sl_bt_rsp_memory_profiler_list_ram_usage_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_memory_profiler_list_ram_usage.result), 2);
-        break;
-    case sl_bt_rsp_user_message_to_target_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_user_message_to_target.result), 2);
-        break;
-    case sl_bt_rsp_user_manage_event_filter_id:
-        reverse_endian((uint8_t *)&(pck->data.rsp_user_manage_event_filter.result), 2);
-        break;
+    // events of an outstanding request are returned to its caller, not to the watcher
+    if (silabs_proc_handle_evt(p))
+    {
+        return;
+    }
 
-    case sl_bt_evt_dfu_boot_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_dfu_boot.version), 4);
-        break;
-    case sl_bt_evt_dfu_boot_failure_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_dfu_boot_failure.reason), 2);
-        break;
+    // L2CAP channels are served in the driver thread, data is passed without copy
+    if (silabs_l2cap_handle_evt(p))
+    {
+        return;
+    }
+
+    switch (SL_BT_MSG_ID(p->header))
+    {
     case sl_bt_evt_system_boot_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_system_boot.major), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_system_boot.minor), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_system_boot.patch), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_system_boot.build), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_system_boot.bootloader), 4);
-        reverse_endian((uint8_t *)&(pck->data.evt_system_boot.hw), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_system_boot.hash), 4);
-        break;
-    case sl_bt_evt_system_error_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_system_error.reason), 2);
-        break;
-    case sl_bt_evt_system_hardware_error_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_system_hardware_error.status), 2);
-        break;
-    case sl_bt_evt_system_external_signal_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_system_external_signal.extsignals), 4);
-        break;
-    case sl_bt_evt_system_soft_timer_id:
-        break;
-    case sl_bt_evt_advertiser_timeout_id:
-        break;
-    case sl_bt_evt_advertiser_scan_request_id:
-        break;
-    case sl_bt_evt_advertiser_periodic_advertising_status_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_advertiser_periodic_advertising_status.status), 4);
-        break;
-    case sl_bt_evt_scanner_scan_report_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_scanner_scan_report.periodic_interval), 2);
-        break;
-    case sl_bt_evt_sync_opened_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_sync_opened.adv_interval), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_sync_opened.clock_accuracy), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_sync_opened.sync), 2);
-        break;
-    case sl_bt_evt_sync_data_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_sync_data.sync), 2);
-        break;
-    case sl_bt_evt_sync_closed_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_sync_closed.reason), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_sync_closed.sync), 2);
-        break;
-    case sl_bt_evt_connection_opened_id:
-        break;
-    case sl_bt_evt_connection_parameters_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_connection_parameters.interval), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_connection_parameters.latency), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_connection_parameters.timeout), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_connection_parameters.txsize), 2);
-        break;
-    case sl_bt_evt_connection_phy_status_id:
-        break;
-    case sl_bt_evt_connection_rssi_id:
-        break;
-    case sl_bt_evt_connection_get_remote_tx_power_completed_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_connection_get_remote_tx_power_completed.status), 2);
-        break;
-    case sl_bt_evt_connection_tx_power_id:
-        break;
-    case sl_bt_evt_connection_remote_tx_power_id:
-        break;
+    {
+        silabs_state_reset();
+        set_booted();
+    }
     case sl_bt_evt_connection_closed_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_connection_closed.reason), 2);
-        break;
-    case sl_bt_evt_connection_remote_used_features_id:
-        break;
-    case sl_bt_evt_gatt_mtu_exchanged_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_mtu_exchanged.mtu), 2);
-        break;
-    case sl_bt_evt_gatt_service_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_service.service), 4);
-        break;
-    case sl_bt_evt_gatt_characteristic_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_characteristic.characteristic), 2);
-        break;
-    case sl_bt_evt_gatt_descriptor_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_descriptor.descriptor), 2);
-        break;
     case sl_bt_evt_gatt_characteristic_value_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_characteristic_value.characteristic), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_characteristic_value.offset), 2);
-        break;
-    case sl_bt_evt_gatt_descriptor_value_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_descriptor_value.descriptor), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_descriptor_value.offset), 2);
-        break;
-    case sl_bt_evt_gatt_procedure_completed_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_procedure_completed.result), 2);
-        break;
     case sl_bt_evt_gatt_server_attribute_value_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_server_attribute_value.attribute), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_server_attribute_value.offset), 2);
-        break;
-    case sl_bt_evt_gatt_server_user_read_request_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_server_user_read_request.characteristic), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_server_user_read_request.offset), 2);
-        break;
-    case sl_bt_evt_gatt_server_user_write_request_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_server_user_write_request.characteristic), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_server_user_write_request.offset), 2);
-        break;
     case sl_bt_evt_gatt_server_characteristic_status_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_server_characteristic_status.characteristic), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_server_characteristic_status.client_config), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_server_characteristic_status.client_config_flags), 2);
-        break;
-    case sl_bt_evt_gatt_server_execute_write_completed_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_gatt_server_execute_write_completed.result), 2);
-        break;
-    case sl_bt_evt_gatt_server_indication_timeout_id:
-        break;
-    case sl_bt_evt_test_dtm_completed_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_test_dtm_completed.number_of_packets), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_test_dtm_completed.result), 2);
-        break;
-    case sl_bt_evt_sm_passkey_display_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_sm_passkey_display.passkey), 4);
-        break;
-    case sl_bt_evt_sm_passkey_request_id:
-        break;
-    case sl_bt_evt_sm_confirm_passkey_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_sm_confirm_passkey.passkey), 4);
-        break;
-    case sl_bt_evt_sm_bonded_id:
-        break;
-    case sl_bt_evt_sm_bonding_failed_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_sm_bonding_failed.reason), 2);
-        break;
-    case sl_bt_evt_sm_confirm_bonding_id:
-        break;
-    case sl_bt_evt_sm_list_bonding_entry_id:
-        break;
-    case sl_bt_evt_l2cap_coc_connection_request_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_coc_connection_request.initial_credit), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_coc_connection_request.le_psm), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_coc_connection_request.mps), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_coc_connection_request.mtu), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_coc_connection_request.source_cid), 2);
-        break;
-    case sl_bt_evt_l2cap_coc_connection_response_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_coc_connection_response.destination_cid), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_coc_connection_response.initial_credit), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_coc_connection_response.l2cap_errorcode), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_coc_connection_response.mps), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_coc_connection_response.mtu), 2);
-        break;
-    case sl_bt_evt_l2cap_coc_le_flow_control_credit_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_coc_le_flow_control_credit.cid), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_coc_le_flow_control_credit.credits), 2);
-        break;
-    case sl_bt_evt_l2cap_coc_channel_disconnected_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_coc_channel_disconnected.cid), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_coc_channel_disconnected.reason), 2);
-        break;
-    case sl_bt_evt_l2cap_coc_data_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_coc_data.cid), 2);
-        break;
-    case sl_bt_evt_l2cap_command_rejected_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_l2cap_command_rejected.reason), 2);
-        break;
-    case sl_bt_evt_cte_receiver_dtm_iq_report_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_cte_receiver_dtm_iq_report.event_counter), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_cte_receiver_dtm_iq_report.status), 2);
-        break;
-    case sl_bt_evt_cte_receiver_connection_iq_report_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_cte_receiver_connection_iq_report.event_counter), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_cte_receiver_connection_iq_report.status), 2);
-        break;
-    case sl_bt_evt_cte_receiver_connectionless_iq_report_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_cte_receiver_connectionless_iq_report.event_counter), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_cte_receiver_connectionless_iq_report.status), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_cte_receiver_connectionless_iq_report.sync), 2);
-        break;
-    case sl_bt_evt_cte_receiver_silabs_iq_report_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_cte_receiver_silabs_iq_report.packet_counter), 2);
-        reverse_endian((uint8_t *)&(pck->data.evt_cte_receiver_silabs_iq_report.status), 2);
-        break;
-    case sl_bt_evt_memory_profiler_ram_usage_entry_id:
-        reverse_endian((uint8_t *)&(pck->data.evt_memory_profiler_ram_usage_entry.bytes_allocated), 4);
-        reverse_endian((uint8_t *)&(pck->data.evt_memory_profiler_ram_usage_entry.depth), 4);
-        reverse_endian((uint8_t *)&(pck->data.evt_memory_profiler_ram_usage_entry.num_allocations), 4);
-        reverse_endian((uint8_t *)&(pck->data.evt_memory_profiler_ram_usage_entry.num_failed_allocations), 4);
-        reverse_endian((uint8_t *)&(pck->data.evt_memory_profiler_ram_usage_entry.peak_bytes_allocated), 4);
-        reverse_endian((uint8_t *)&(pck->data.evt_memory_profiler_ram_usage_entry.total_size), 4);
+    case sl_bt_evt_scanner_scan_report_id:
+    case sl_bt_evt_connection_parameters_id:
+    case sl_bt_evt_connection_opened_id:
+    {
+        link->msg_data.msgtype = 1;
+        link->msg_data.time_ns = evt_time;
+        link->msg_data.frame_ns = evt_frame_time;
+        link->msg_data.send_ns = utils_get_time_ns();
+        stats_record_stage(LATENCY_STAGE_DRIVER, link->msg_data.send_ns - evt_frame_time);
+        int msg_evt_len = SL_BT_MSG_HEADER_LEN + SL_BT_MSG_LEN(p->header);
+        memcpy(&(link->msg_data.evt), p, msg_evt_len);
+        // the message starts after msgtype
+        msg_evt_len += offsetof(silabs_msg_queue_t, evt) - sizeof(long);
+
+        // send evt msg to msg queue
+        if (-1 == msgsnd(evt_msqid, (void *)&link->msg_data, msg_evt_len, IPC_NOWAIT))
+        {
+            log_warning("silabs evt msgsnd error!  errno: %d\n", errno);
+            stats_add(STATS_WATCHER_QUEUE_DROPS, 1);
+        }
+        else
+        {
+            // the watcher may take the event before it is added, the depth after the add is right anyway
+            stats_high(STATS_WATCHER_QUEUE_HIGH, __atomic_add_fetch(&link->watcher_depth, 1, __ATOMIC_RELAXED));
+        }
         break;
-    case sl_bt_evt_user_message_to_host_id:
+    }
+
+    default:
         break;
     }
+
+    return;
 }
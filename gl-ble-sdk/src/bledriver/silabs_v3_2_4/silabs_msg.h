@@ -24,32 +24,95 @@
 #endif
 
 #define BGLIB_DEFINE()                                     \
-  struct sl_bt_packet _sl_bt_cmd_msg;                              \
-  struct sl_bt_packet _sl_bt_rsp_msg;                              \
-  struct sl_bt_packet *sl_bt_cmd_msg = &_sl_bt_cmd_msg;            \
-  struct sl_bt_packet *sl_bt_rsp_msg = &_sl_bt_rsp_msg;            \
-  struct sl_bt_packet sl_bt_queue_buffer[SL_BT_API_QUEUE_LEN];     \
-  int sl_bt_queue_w = 0;                                   \
-  int sl_bt_queue_r = 0;
+  __thread struct sl_bt_packet _sl_bt_cmd_msg;                     \
+  __thread struct sl_bt_packet _sl_bt_rsp_msg;
 
-extern struct sl_bt_packet sl_bt_queue_buffer[SL_BT_API_QUEUE_LEN];
-extern int sl_bt_queue_w;
-extern int sl_bt_queue_r;
-
-#define SPE_EVT_MAX 50
-extern struct sl_bt_packet special_evt[SPE_EVT_MAX];
-extern int special_evt_num;
-
-int wait_rsp_evt(uint32_t evt_id, uint32_t timeout);
+// every calling thread owns its command and response buffers
+extern __thread struct sl_bt_packet _sl_bt_cmd_msg;
+extern __thread struct sl_bt_packet _sl_bt_rsp_msg;
+#define sl_bt_cmd_msg (&_sl_bt_cmd_msg)
+#define sl_bt_rsp_msg (&_sl_bt_rsp_msg)
 
 typedef struct
 {
   int evt_msgid;
+  int radio;
 } driver_param_t;
 
 void *silabs_driver(void *arg);
 
+// time to wait for a command response (ms)
+#define SL_BT_RSP_TIMEOUT 300
+
+// time for the serial port to go quiet after the module was turned off (ms)
+#define RESET_DRAIN_TIME 10
+
+// build the header of a command from its id and the length of its payload
+#define SL_BT_CMD_HEADER(id, len) ((id) + (((len) & 0xff) << 8) + (((len) & 0x700) >> 8))
+
 void sl_bt_host_handle_command();
 void sl_bt_host_handle_command_noresponse();
 
+/*
+ * Send a command and wait for its response in sl_bt_rsp_msg. cmd holds the header and the fixed
+ * fields, encoded by sl_bt_ncp_encode.h into any buffer; the data of its byte array, whose length
+ * the header counts, is sent from data without being copied.
+ */
+void sl_bt_host_send(struct sl_bt_packet *cmd, const void *data, uint32_t data_len);
+void sl_bt_host_send_noresponse(struct sl_bt_packet *cmd, const void *data, uint32_t data_len);
+
+/*
+ * Set the response timeout of the commands sent by the calling thread, 0 to restore the default.
+ */
+void sl_bt_host_set_rsp_timeout(int timeout);
+
+/*
+ * Let the commands of the calling thread give way: when another command is in flight,
+ * they are not sent and return SL_STATUS_BUSY.
+ */
+void sl_bt_host_set_yield(bool yield);
+
+/*
+ * Let the driver thread send its own commands, such as the L2CAP credits, without waiting for
+ * their responses. Any other command sent in the driver thread fails with SL_STATUS_INVALID_STATE.
+ */
+void sl_bt_host_set_nowait(bool nowait);
+
+/*
+ * Return true in the driver thread, which also runs the L2CAP and async GATT callbacks.
+ */
+bool silabs_in_driver_thread(void);
+
+/*
+ * The watcher of the calling thread took an event from its message queue.
+ */
+void silabs_watcher_taken(void);
+
+/*
+ * Receive time of the event handled by the driver thread, taken when its header was read from the UART.
+ * Only valid in the driver thread.
+ */
+uint64_t silabs_evt_time(void);
+
+/*
+ * Return true if the module of the calling thread booted.
+ */
+bool silabs_booted(void);
+
+/*
+ * Block until the module booted. Return 0 if it booted, -1 on timeout.
+ */
+int silabs_wait_booted(uint32_t timeout);
+
+/*
+ * Turn the module off and wait until the driver dropped its state. Return 0 on success, -1 on timeout.
+ */
+int silabs_reset_wait(uint32_t timeout);
+
+/*
+ * Send system_hello, if the module answers it is marked as booted without a boot event.
+ * Return 0 if the module answered.
+ */
+int silabs_probe(uint32_t timeout);
+
 #endif
\ No newline at end of file
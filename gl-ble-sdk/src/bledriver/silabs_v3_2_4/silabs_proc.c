@@ -0,0 +1,300 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+
+#include "sl_bt_api.h"
+#include "silabs_proc.h"
+#include "silabs_msg.h"
+#include "timestamp.h"
+#include "gl_radio.h"
+#include "gl_log.h"
+
+static pthread_mutex_t proc_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct list_head proc_list = {&proc_list, &proc_list};
+
+static silabs_proc_t *search_proc(uint8_t connection, uint32_t complete_id)
+{
+    silabs_proc_t *proc = NULL;
+    int radio = radio_cur();
+
+    list_for_each_entry(proc, &proc_list, linked_list)
+    {
+        if ((proc->radio == radio) && (proc->connection == connection) && (proc->complete_id == complete_id))
+        {
+            return proc;
+        }
+    }
+    return NULL;
+}
+
+static void save_evt(silabs_proc_t *proc, struct sl_bt_packet *p)
+{
+    if (proc->evt_num >= PROC_EVT_MAX)
+    {
+        log_err("procedure event buffer full, connection: %d\n", proc->connection);
+        return;
+    }
+
+    proc->evt[proc->evt_num].header = p->header;
+    memcpy(proc->evt[proc->evt_num].data.payload, p->data.payload, SL_BT_MSG_LEN(p->header));
+    proc->evt_num++;
+}
+
+/*
+ * Must be called with proc_mutex locked, it will be unlocked when returned.
+ */
+static void complete_proc(silabs_proc_t *proc, uint16_t result)
+{
+    proc->result = result;
+    proc->done = true;
+    proc->time_ns = silabs_evt_time();
+
+    if (!proc->cb)
+    {
+        pthread_cond_signal(&proc->cond);
+        pthread_mutex_unlock(&proc_mutex);
+        return;
+    }
+
+    list_del(&proc->linked_list);
+    pthread_mutex_unlock(&proc_mutex);
+
+    proc->cb(proc);
+
+    pthread_cond_destroy(&proc->cond);
+    free(proc);
+}
+
+silabs_proc_t *silabs_proc_start(uint8_t connection, uint32_t complete_id)
+{
+    silabs_proc_t *proc = (silabs_proc_t *)calloc(1, sizeof(silabs_proc_t));
+    if (!proc)
+    {
+        return NULL;
+    }
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&proc->cond, &attr);
+    pthread_condattr_destroy(&attr);
+
+    proc->radio = radio_cur();
+    proc->connection = connection;
+    proc->complete_id = complete_id;
+    INIT_LIST_HEAD(&proc->linked_list);
+
+    pthread_mutex_lock(&proc_mutex);
+    // the stack runs one GATT procedure at a time on a connection
+    if (search_proc(connection, complete_id))
+    {
+        pthread_mutex_unlock(&proc_mutex);
+        pthread_cond_destroy(&proc->cond);
+        free(proc);
+        return NULL;
+    }
+    list_add_tail(&proc->linked_list, &proc_list);
+    pthread_mutex_unlock(&proc_mutex);
+
+    return proc;
+}
+
+void silabs_proc_detach(silabs_proc_t *proc, silabs_proc_cb_t cb, void *arg)
+{
+    pthread_mutex_lock(&proc_mutex);
+    proc->cb = cb;
+    proc->arg = arg;
+    if (!proc->done)
+    {
+        pthread_mutex_unlock(&proc_mutex);
+        return;
+    }
+
+    list_del(&proc->linked_list);
+    pthread_mutex_unlock(&proc_mutex);
+
+    proc->cb(proc);
+
+    pthread_cond_destroy(&proc->cond);
+    free(proc);
+}
+
+int silabs_proc_wait(silabs_proc_t *proc, uint32_t timeout)
+{
+    struct timespec ts;
+    utils_get_deadline(&ts, timeout);
+
+    int ret = 0;
+    pthread_mutex_lock(&proc_mutex);
+    while ((!proc->done) && (ret != ETIMEDOUT))
+    {
+        ret = pthread_cond_timedwait(&proc->cond, &proc_mutex, &ts);
+    }
+    ret = proc->done ? 0 : -1;
+    pthread_mutex_unlock(&proc_mutex);
+
+    return ret;
+}
+
+void silabs_proc_end(silabs_proc_t *proc)
+{
+    if (!proc)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&proc_mutex);
+    list_del(&proc->linked_list);
+    pthread_mutex_unlock(&proc_mutex);
+
+    pthread_cond_destroy(&proc->cond);
+    free(proc);
+}
+
+bool silabs_proc_handle_evt(struct sl_bt_packet *p)
+{
+    silabs_proc_t *proc = NULL;
+
+    switch (SL_BT_MSG_ID(p->header))
+    {
+    case sl_bt_evt_gatt_service_id:
+    case sl_bt_evt_gatt_characteristic_id:
+    case sl_bt_evt_gatt_descriptor_id:
+    {
+        // connection is the first field of these events
+        pthread_mutex_lock(&proc_mutex);
+        proc = search_proc(p->data.payload[0], sl_bt_evt_gatt_procedure_completed_id);
+        if (proc)
+        {
+            save_evt(proc, p);
+        }
+        pthread_mutex_unlock(&proc_mutex);
+        return true;
+    }
+    case sl_bt_evt_gatt_characteristic_value_id:
+    {
+        uint8_t att_opcode = p->data.evt_gatt_characteristic_value.att_opcode;
+        if ((att_opcode == sl_bt_gatt_handle_value_notification) || (att_opcode == sl_bt_gatt_handle_value_indication))
+        {
+            return false;
+        }
+
+        // read responses without a waiting request go to the watcher
+        pthread_mutex_lock(&proc_mutex);
+        proc = search_proc(p->data.evt_gatt_characteristic_value.connection, sl_bt_evt_gatt_procedure_completed_id);
+        if (proc)
+        {
+            save_evt(proc, p);
+        }
+        pthread_mutex_unlock(&proc_mutex);
+        return (proc != NULL);
+    }
+    case sl_bt_evt_gatt_procedure_completed_id:
+    {
+        pthread_mutex_lock(&proc_mutex);
+        proc = search_proc(p->data.evt_gatt_procedure_completed.connection, sl_bt_evt_gatt_procedure_completed_id);
+        if (!proc)
+        {
+            pthread_mutex_unlock(&proc_mutex);
+            return true;
+        }
+        complete_proc(proc, p->data.evt_gatt_procedure_completed.result);
+        return true;
+    }
+    case sl_bt_evt_connection_rssi_id:
+    {
+        pthread_mutex_lock(&proc_mutex);
+        proc = search_proc(p->data.evt_connection_rssi.connection, sl_bt_evt_connection_rssi_id);
+        if (!proc)
+        {
+            pthread_mutex_unlock(&proc_mutex);
+            return true;
+        }
+        save_evt(proc, p);
+        complete_proc(proc, p->data.evt_connection_rssi.status);
+        return true;
+    }
+    case sl_bt_evt_dfu_boot_id:
+    {
+        pthread_mutex_lock(&proc_mutex);
+        proc = search_proc(PROC_NO_CONNECTION, sl_bt_evt_dfu_boot_id);
+        if (!proc)
+        {
+            pthread_mutex_unlock(&proc_mutex);
+            return false;
+        }
+        save_evt(proc, p);
+        complete_proc(proc, SL_STATUS_OK);
+        return true;
+    }
+    case sl_bt_evt_connection_closed_id:
+    {
+        // fail all procedures of the closed connection, the event still goes to the watcher
+        uint8_t connection = p->data.evt_connection_closed.connection;
+        uint16_t reason = p->data.evt_connection_closed.reason;
+        while (1)
+        {
+            pthread_mutex_lock(&proc_mutex);
+            list_for_each_entry(proc, &proc_list, linked_list)
+            {
+                if ((proc->radio == radio_cur()) && (proc->connection == connection) && (!proc->done))
+                {
+                    break;
+                }
+            }
+            if (&proc->linked_list == &proc_list)
+            {
+                pthread_mutex_unlock(&proc_mutex);
+                break;
+            }
+            complete_proc(proc, reason ? reason : SL_STATUS_BT_CTRL_CONNECTION_TERMINATED_BY_LOCAL_HOST);
+        }
+        return false;
+    }
+    default:
+        break;
+    }
+
+    return false;
+}
+
+void silabs_proc_abort_all(uint16_t result)
+{
+    silabs_proc_t *proc = NULL;
+
+    while (1)
+    {
+        pthread_mutex_lock(&proc_mutex);
+        list_for_each_entry(proc, &proc_list, linked_list)
+        {
+            if ((proc->radio == radio_cur()) && (!proc->done))
+            {
+                break;
+            }
+        }
+        if (&proc->linked_list == &proc_list)
+        {
+            pthread_mutex_unlock(&proc_mutex);
+            break;
+        }
+        complete_proc(proc, result);
+    }
+}
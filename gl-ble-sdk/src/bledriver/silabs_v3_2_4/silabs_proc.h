@@ -0,0 +1,93 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#ifndef _SILABS_PROC_H_
+#define _SILABS_PROC_H_
+
+#include <stdbool.h>
+#include <pthread.h>
+#include <libubox/list.h>
+
+#include "sli_bt_api.h"
+
+#define PROC_EVT_MAX 50
+
+// procedures of the module itself, such as waiting for the DFU boot
+#define PROC_NO_CONNECTION 0xff
+
+typedef struct silabs_proc silabs_proc_t;
+
+/*
+ * Called in the driver thread when a detached procedure completed.
+ * The procedure is freed after the callback returns.
+ */
+typedef void (*silabs_proc_cb_t)(silabs_proc_t *proc);
+
+/*
+ * An outstanding GATT or connection procedure of one connection.
+ * Events of the procedure are collected in evt[] until the completion event arrives.
+ */
+struct silabs_proc
+{
+  struct list_head linked_list;
+  int radio; // connections of different modules share their numbers
+  uint8_t connection;
+  uint32_t complete_id;
+  bool done;
+  uint16_t result;
+  uint64_t time_ns; // receive time of the completion event
+  int evt_num;
+  struct sl_bt_packet evt[PROC_EVT_MAX];
+  silabs_proc_cb_t cb;
+  void *arg;
+  pthread_cond_t cond;
+};
+
+/*
+ * Register a procedure before sending its command.
+ * complete_id is the event which completes the procedure: sl_bt_evt_gatt_procedure_completed_id,
+ * sl_bt_evt_connection_rssi_id, or sl_bt_evt_dfu_boot_id with PROC_NO_CONNECTION.
+ * Return NULL if the connection has one in progress.
+ */
+silabs_proc_t *silabs_proc_start(uint8_t connection, uint32_t complete_id);
+
+/*
+ * Hand a procedure over to the driver instead of waiting for it, cb is called once it completed.
+ * If it already completed, cb is called at once in the calling thread.
+ */
+void silabs_proc_detach(silabs_proc_t *proc, silabs_proc_cb_t cb, void *arg);
+
+/*
+ * Block until the procedure completed. Return 0 on completion, -1 on timeout.
+ */
+int silabs_proc_wait(silabs_proc_t *proc, uint32_t timeout);
+
+/*
+ * Unregister and free a procedure. Detached procedures are freed by the driver.
+ */
+void silabs_proc_end(silabs_proc_t *proc);
+
+/*
+ * Route a module event to the procedure it belongs to. Return true if the event was consumed.
+ */
+bool silabs_proc_handle_evt(struct sl_bt_packet *p);
+
+/*
+ * Complete all procedures of the current radio with the given result, used when its module is reset.
+ */
+void silabs_proc_abort_all(uint16_t result);
+
+#endif
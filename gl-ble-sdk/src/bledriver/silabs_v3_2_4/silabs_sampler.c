@@ -0,0 +1,248 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#include <string.h>
+#include <errno.h>
+#include <endian.h>
+#include <pthread.h>
+
+#include "sl_bt_api.h"
+#include "silabs_msg.h"
+#include "silabs_sampler.h"
+#include "timestamp.h"
+#include "gl_radio.h"
+#include "gl_log.h"
+
+// groups of counters, a group is dropped when the module does not support its command
+#define SAMPLE_RADIO 0x01
+#define SAMPLE_COEX 0x02
+#define SAMPLE_MEMORY 0x04
+#define SAMPLE_ALL (SAMPLE_RADIO | SAMPLE_COEX | SAMPLE_MEMORY)
+
+typedef struct
+{
+    pthread_mutex_t set_mutex;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    pthread_t tid;
+    int radio;
+    bool running;
+    bool paused;
+    uint32_t period;
+    uint8_t groups;
+    gl_ble_ncp_stats_t stats;
+} sampler_t;
+
+static pthread_once_t sampler_once = PTHREAD_ONCE_INIT;
+static sampler_t sampler_list[RADIO_MAX] = {
+    [0 ... RADIO_MAX - 1] = {
+        .set_mutex = PTHREAD_MUTEX_INITIALIZER,
+        .mutex = PTHREAD_MUTEX_INITIALIZER,
+        .groups = SAMPLE_ALL,
+    },
+};
+
+static void sampler_cond_init(void)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    for (int i = 0; i < RADIO_MAX; i++)
+    {
+        sampler_list[i].radio = i;
+        pthread_cond_init(&sampler_list[i].cond, &attr);
+    }
+    pthread_condattr_destroy(&attr);
+}
+
+/*
+ * Busy and timed out commands are tried again in the next period, other errors mean the firmware lacks the command.
+ */
+static bool sample_failed(sampler_t *sampler, uint8_t group, sl_status_t status)
+{
+    if (status == SL_STATUS_OK)
+    {
+        return false;
+    }
+
+    if ((status != SL_STATUS_BUSY) && (status != SL_STATUS_TIMEOUT))
+    {
+        log_info("ncp counters 0x%02x not supported: 0x%04x\n", group, status);
+        pthread_mutex_lock(&sampler->mutex);
+        sampler->groups &= ~group;
+        pthread_mutex_unlock(&sampler->mutex);
+    }
+    return true;
+}
+
+static void sample(sampler_t *sampler, uint8_t groups)
+{
+    gl_ble_ncp_stats_t *ncp_stats = &sampler->stats;
+    sl_status_t status;
+
+    if (groups & SAMPLE_RADIO)
+    {
+        uint16_t tx_packets, rx_packets, crc_errors, failures;
+        status = sl_bt_system_get_counters(1, &tx_packets, &rx_packets, &crc_errors, &failures);
+        if (!sample_failed(sampler, SAMPLE_RADIO, status))
+        {
+            pthread_mutex_lock(&sampler->mutex);
+            ncp_stats->radio_valid = true;
+            ncp_stats->tx_packets += tx_packets;
+            ncp_stats->rx_packets += rx_packets;
+            ncp_stats->crc_errors += crc_errors;
+            ncp_stats->radio_failures += failures;
+            pthread_mutex_unlock(&sampler->mutex);
+        }
+    }
+
+    if (groups & SAMPLE_COEX)
+    {
+        uint32_t coex[SAMPLER_COEX_COUNTERS];
+        size_t coex_len = 0;
+        status = sl_bt_coex_get_counters(1, sizeof(coex), &coex_len, (uint8_t *)coex);
+        if ((!sample_failed(sampler, SAMPLE_COEX, status)) && (coex_len == sizeof(coex)))
+        {
+            pthread_mutex_lock(&sampler->mutex);
+            ncp_stats->coex_valid = true;
+            ncp_stats->coex_low_requested += le32toh(coex[0]);
+            ncp_stats->coex_high_requested += le32toh(coex[1]);
+            ncp_stats->coex_low_denied += le32toh(coex[2]);
+            ncp_stats->coex_high_denied += le32toh(coex[3]);
+            ncp_stats->coex_low_tx_aborted += le32toh(coex[4]);
+            ncp_stats->coex_high_tx_aborted += le32toh(coex[5]);
+            pthread_mutex_unlock(&sampler->mutex);
+        }
+    }
+
+    if (groups & SAMPLE_MEMORY)
+    {
+        uint32_t trackers, live, peak_live, heap, peak_heap, peak_stack, errors;
+        status = sl_bt_memory_profiler_get_status(&trackers, &live, &peak_live, &heap, &peak_heap, &peak_stack, &errors);
+        if (!sample_failed(sampler, SAMPLE_MEMORY, status))
+        {
+            pthread_mutex_lock(&sampler->mutex);
+            ncp_stats->memory_valid = true;
+            ncp_stats->heap_bytes_used = heap;
+            ncp_stats->peak_heap_bytes_used = peak_heap;
+            ncp_stats->peak_stack_bytes_used = peak_stack;
+            ncp_stats->live_allocations = live;
+            ncp_stats->peak_live_allocations = peak_live;
+            ncp_stats->memory_errors = errors;
+            pthread_mutex_unlock(&sampler->mutex);
+        }
+    }
+
+    pthread_mutex_lock(&sampler->mutex);
+    ncp_stats->samples++;
+    ncp_stats->time_ns = utils_get_time_ns();
+    pthread_mutex_unlock(&sampler->mutex);
+}
+
+static void *sampler_thread(void *arg)
+{
+    sampler_t *sampler = (sampler_t *)arg;
+    radio_bind(sampler->radio);
+
+    // a sample gives way to the commands of the user and does not wait long for the module
+    sl_bt_host_set_rsp_timeout(SAMPLER_RSP_TIMEOUT);
+    sl_bt_host_set_yield(true);
+
+    pthread_mutex_lock(&sampler->mutex);
+    while (sampler->period)
+    {
+        struct timespec ts;
+        utils_get_deadline(&ts, sampler->period);
+
+        // woken up early when the period changed
+        if (pthread_cond_timedwait(&sampler->cond, &sampler->mutex, &ts) != ETIMEDOUT)
+        {
+            continue;
+        }
+
+        uint8_t groups = sampler->groups;
+        if ((sampler->paused) || (!silabs_booted()) || (!groups))
+        {
+            continue;
+        }
+
+        pthread_mutex_unlock(&sampler->mutex);
+        sample(sampler, groups);
+        pthread_mutex_lock(&sampler->mutex);
+    }
+    pthread_mutex_unlock(&sampler->mutex);
+
+    return NULL;
+}
+
+GL_RET silabs_sampler_set(uint32_t period)
+{
+    if ((period) && ((period < SAMPLER_PERIOD_MIN) || (period > SAMPLER_PERIOD_MAX)))
+    {
+        return GL_ERR_PARAM;
+    }
+
+    pthread_once(&sampler_once, sampler_cond_init);
+
+    sampler_t *sampler = &sampler_list[radio_cur()];
+    pthread_mutex_lock(&sampler->set_mutex);
+
+    pthread_mutex_lock(&sampler->mutex);
+    sampler->period = period;
+    pthread_cond_signal(&sampler->cond);
+    pthread_mutex_unlock(&sampler->mutex);
+
+    if ((period) && (!sampler->running))
+    {
+        // give unsupported commands another chance, the firmware may have been updated
+        sampler->groups = SAMPLE_ALL;
+        if (pthread_create(&sampler->tid, NULL, sampler_thread, sampler) != 0)
+        {
+            log_err("pthread_create sampler failed!\n");
+            sampler->period = 0;
+            pthread_mutex_unlock(&sampler->set_mutex);
+            return GL_UNKNOW_ERR;
+        }
+        sampler->running = true;
+    }
+    else if ((!period) && (sampler->running))
+    {
+        pthread_join(sampler->tid, NULL);
+        sampler->running = false;
+    }
+
+    pthread_mutex_unlock(&sampler->set_mutex);
+
+    return GL_SUCCESS;
+}
+
+void silabs_sampler_get(gl_ble_ncp_stats_t *stats)
+{
+    sampler_t *sampler = &sampler_list[radio_cur()];
+
+    pthread_mutex_lock(&sampler->mutex);
+    memcpy(stats, &sampler->stats, sizeof(gl_ble_ncp_stats_t));
+    pthread_mutex_unlock(&sampler->mutex);
+}
+
+void silabs_sampler_pause(bool pause)
+{
+    sampler_t *sampler = &sampler_list[radio_cur()];
+
+    pthread_mutex_lock(&sampler->mutex);
+    sampler->paused = pause;
+    pthread_mutex_unlock(&sampler->mutex);
+}
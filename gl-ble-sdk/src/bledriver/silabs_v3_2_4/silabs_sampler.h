@@ -0,0 +1,50 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#ifndef _SILABS_SAMPLER_H_
+#define _SILABS_SAMPLER_H_
+
+#include <stdbool.h>
+
+#include "gl_errno.h"
+#include "gl_type.h"
+
+// the 16 bit packet counters of the module must be read before they wrap
+#define SAMPLER_PERIOD_MIN 100
+#define SAMPLER_PERIOD_MAX 60000
+
+// a sample must not hold up the commands of the user for long
+#define SAMPLER_RSP_TIMEOUT 200
+
+// the module reports 6 coexistence counters
+#define SAMPLER_COEX_COUNTERS 6
+
+/*
+ * Start the sampler thread or change its period (ms), 0 stops it.
+ */
+GL_RET silabs_sampler_set(uint32_t period);
+
+/*
+ * Copy the counters of the last sample.
+ */
+void silabs_sampler_get(gl_ble_ncp_stats_t *stats);
+
+/*
+ * Stop sending commands while the module is not running the stack, such as during a DFU.
+ */
+void silabs_sampler_pause(bool pause);
+
+#endif
@@ -0,0 +1,223 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "sl_bt_api.h"
+#include "silabs_msg.h"
+#include "silabs_state.h"
+#include "gl_dev_mgr.h"
+#include "gl_radio.h"
+#include "gl_log.h"
+
+// the advertising sets of silabs_bleapi.c
+extern uint8_t adv_handle[RADIO_MAX];
+
+static pthread_mutex_t state_mutex = PTHREAD_MUTEX_INITIALIZER;
+static gl_ble_attach_info_t attach_info[RADIO_MAX];
+
+/*
+ * Radio 0 keeps the file name of a single module, the others add their index.
+ */
+static void state_file(char *path, size_t size)
+{
+    int radio = radio_cur();
+
+    if (radio == 0)
+    {
+        snprintf(path, size, "%s", STATE_FILE);
+    }
+    else
+    {
+        snprintf(path, size, "%s.%d", STATE_FILE, radio);
+    }
+}
+
+/*
+ * One line per item:
+ *   adv <handle>
+ *   conn <connection> <address>
+ * The file is replaced by rename so that a crash never leaves half of it.
+ */
+void silabs_state_save(void)
+{
+    ble_dev_desc_t list[STATE_CONN_MAX];
+    int num = ble_dev_mgr_get_list(list, STATE_CONN_MAX);
+    uint8_t handle = adv_handle[radio_cur()];
+
+    char path[STATE_PATH_LEN], tmp[STATE_PATH_LEN + 4];
+    state_file(path, sizeof(path));
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+
+    pthread_mutex_lock(&state_mutex);
+
+    FILE *f = fopen(tmp, "w");
+    if (!f)
+    {
+        pthread_mutex_unlock(&state_mutex);
+        log_err("open %s failed\n", tmp);
+        return;
+    }
+
+    if (handle != 0xff)
+    {
+        fprintf(f, "adv %u\n", handle);
+    }
+    for (int i = 0; i < num; i++)
+    {
+        fprintf(f, "conn %u %s\n", list[i].connection, list[i].dev_addr);
+    }
+    fclose(f);
+
+    if (rename(tmp, path) != 0)
+    {
+        log_err("save %s failed\n", path);
+    }
+
+    pthread_mutex_unlock(&state_mutex);
+}
+
+void silabs_state_reset(void)
+{
+    // nothing the module held survives its boot
+    ble_dev_mgr_del_all();
+    adv_handle[radio_cur()] = 0xff;
+
+    pthread_mutex_lock(&state_mutex);
+    memset(&attach_info[radio_cur()], 0, sizeof(gl_ble_attach_info_t));
+    pthread_mutex_unlock(&state_mutex);
+
+    silabs_state_save();
+}
+
+/*
+ * A connection is open if the stack knows its handle, reading the channel map has no effect on the link.
+ */
+static bool conn_is_open(uint8_t connection)
+{
+    uint8_t channel_map[5];
+    size_t len = 0;
+
+    return sl_bt_connection_read_channel_map(connection, sizeof(channel_map), &len, channel_map) == SL_STATUS_OK;
+}
+
+static void state_load(gl_ble_attach_info_t *info, bool *known)
+{
+    char path[STATE_PATH_LEN];
+    state_file(path, sizeof(path));
+
+    FILE *f = fopen(path, "r");
+    if (!f)
+    {
+        return;
+    }
+
+    char line[64];
+    while (fgets(line, sizeof(line), f))
+    {
+        unsigned int value;
+        char addr[MAC_STR_LEN];
+
+        if (sscanf(line, "adv %u", &value) == 1)
+        {
+            // an invalid set is created again by the next advertising command
+            if (value < 0xff)
+            {
+                adv_handle[radio_cur()] = (uint8_t)value;
+                info->adv_set = true;
+            }
+        }
+        else if (sscanf(line, "conn %u %17s", &value, addr) == 2)
+        {
+            if ((value == 0) || (value > STATE_CONN_MAX) || (!conn_is_open((uint8_t)value)))
+            {
+                continue;
+            }
+
+            ble_dev_mgr_add(addr, (uint16_t)value);
+            known[value - 1] = true;
+            info->connections++;
+        }
+    }
+
+    fclose(f);
+}
+
+int silabs_state_attach(void)
+{
+    gl_ble_attach_info_t info;
+    memset(&info, 0, sizeof(gl_ble_attach_info_t));
+
+    if (silabs_probe(STATE_PROBE_TIMEOUT) != 0)
+    {
+        return -1;
+    }
+    info.warm = true;
+
+    uint32_t bootloader, hash;
+    sl_status_t status = sl_bt_system_get_version(&info.major, &info.minor, &info.patch, &info.build, &bootloader, &hash);
+    if (status != SL_STATUS_OK)
+    {
+        log_warning("get version of the running module failed: 0x%04x\n", status);
+    }
+
+    // the table of the last process is replaced by what the module still holds
+    ble_dev_mgr_del_all();
+    adv_handle[radio_cur()] = 0xff;
+
+    bool known[STATE_CONN_MAX] = {false};
+    state_load(&info, known);
+
+    // a connection opened after the last save has no address, it stays open but cannot be used by address
+    for (int i = 0; i < STATE_CONN_MAX; i++)
+    {
+        if ((!known[i]) && (conn_is_open((uint8_t)(i + 1))))
+        {
+            log_warning("connection %d of the running module is unknown\n", i + 1);
+            info.unknown_connections++;
+        }
+    }
+
+    // bondings are kept in the flash of the module, only their number is read
+    uint32_t bondings = 0;
+    size_t len = 0;
+    uint8_t bonding_handles[1];
+    status = sl_bt_sm_get_bonding_handles(0, &bondings, sizeof(bonding_handles), &len, bonding_handles);
+    if (status == SL_STATUS_OK)
+    {
+        info.bondings = bondings;
+    }
+
+    pthread_mutex_lock(&state_mutex);
+    memcpy(&attach_info[radio_cur()], &info, sizeof(gl_ble_attach_info_t));
+    pthread_mutex_unlock(&state_mutex);
+
+    silabs_state_save();
+
+    log_info("attached to ble module %u.%u.%u-%u, %u connections, %u unknown, %u bondings\n", info.major, info.minor,
+             info.patch, info.build, info.connections, info.unknown_connections, info.bondings);
+
+    return 0;
+}
+
+void silabs_state_get_info(gl_ble_attach_info_t *info)
+{
+    pthread_mutex_lock(&state_mutex);
+    memcpy(info, &attach_info[radio_cur()], sizeof(gl_ble_attach_info_t));
+    pthread_mutex_unlock(&state_mutex);
+}
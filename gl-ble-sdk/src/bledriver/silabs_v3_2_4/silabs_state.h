@@ -0,0 +1,50 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#ifndef _SILABS_STATE_H_
+#define _SILABS_STATE_H_
+
+#include "gl_type.h"
+
+// what the module holds for this host, kept for the next process to attach to a running module
+#define STATE_FILE "/tmp/gl_ble.state"
+#define STATE_PATH_LEN 64
+
+// connection handles checked on attach, the stack numbers connections from 1
+#define STATE_CONN_MAX 32
+
+// a running module answers system_hello at once
+#define STATE_PROBE_TIMEOUT 100
+
+/*
+ * Write the advertising set and the device table of the current radio to its STATE_FILE.
+ */
+void silabs_state_save(void);
+
+/*
+ * Forget the state after the module was reset.
+ */
+void silabs_state_reset(void);
+
+/*
+ * Take over a running module: probe it, then restore the advertising set and the connections
+ * of the saved state which are still open. Return 0 if the module answered.
+ */
+int silabs_state_attach(void);
+
+void silabs_state_get_info(gl_ble_attach_info_t *info);
+
+#endif
@@ -0,0 +1,121 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "sli_bt_api.h"
+#include "silabs_swap.h"
+
+typedef struct
+{
+    uint8_t offset;
+    uint8_t width;
+} swap_field_t;
+
+typedef struct
+{
+    uint32_t id;
+    uint16_t first;
+    uint16_t num;
+} swap_msg_t;
+
+#define SWAP_FIELD(type, field) { offsetof(type, field), sizeof(((type *)0)->field) }
+
+#include "silabs_swap_table.h"
+
+static const swap_msg_t *swap_find(const swap_msg_t *msgs, int num, uint32_t id)
+{
+    int low = 0;
+    int high = num - 1;
+
+    while (low <= high)
+    {
+        int mid = (low + high) / 2;
+        if (msgs[mid].id == id)
+        {
+            return &msgs[mid];
+        }
+        if (msgs[mid].id < id)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid - 1;
+        }
+    }
+
+    return NULL;
+}
+
+// fields are not aligned in the packed payload, memcpy lets the compiler use unaligned loads
+static void swap_payload(const swap_msg_t *msgs, int num, struct sl_bt_packet *pck)
+{
+    const swap_msg_t *msg = swap_find(msgs, num, SL_BT_MSG_ID(pck->header));
+    uint32_t len = SL_BT_MSG_LEN(pck->header);
+    int i;
+
+    if (!msg)
+    {
+        return;
+    }
+
+    for (i = msg->first; i < msg->first + msg->num; i++)
+    {
+        const swap_field_t *f = &swap_fields[i];
+        uint8_t *p = pck->data.payload + f->offset;
+
+        // a short frame is not read past its end
+        if (f->offset + f->width > len)
+        {
+            break;
+        }
+
+        if (f->width == 2)
+        {
+            uint16_t v;
+            memcpy(&v, p, 2);
+            v = __builtin_bswap16(v);
+            memcpy(p, &v, 2);
+        }
+        else if (f->width == 4)
+        {
+            uint32_t v;
+            memcpy(&v, p, 4);
+            v = __builtin_bswap32(v);
+            memcpy(p, &v, 4);
+        }
+        else if (f->width == 8)
+        {
+            uint64_t v;
+            memcpy(&v, p, 8);
+            v = __builtin_bswap64(v);
+            memcpy(p, &v, 8);
+        }
+    }
+}
+
+void silabs_swap_rx(struct sl_bt_packet *pck)
+{
+    swap_payload(swap_rx_msgs, sizeof(swap_rx_msgs) / sizeof(swap_rx_msgs[0]), pck);
+}
+
+void silabs_swap_cmd(struct sl_bt_packet *pck)
+{
+    swap_payload(swap_cmd_msgs, sizeof(swap_cmd_msgs) / sizeof(swap_cmd_msgs[0]), pck);
+}
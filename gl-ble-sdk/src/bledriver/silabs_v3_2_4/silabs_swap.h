@@ -0,0 +1,34 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#ifndef _SILABS_SWAP_H_
+#define _SILABS_SWAP_H_
+
+#include "sl_bt_api.h"
+
+/*
+ * Byte swap of the multi-byte fields of a BGAPI payload, between the little endian of the module and a
+ * big endian host. The fields of every message are in a table generated from the API headers by
+ * tools/swapgen, they are swapped in place.
+ */
+
+// a response or an event, after it was read
+void silabs_swap_rx(struct sl_bt_packet *pck);
+
+// a command, before it is written, the header is still in host order
+void silabs_swap_cmd(struct sl_bt_packet *pck);
+
+#endif
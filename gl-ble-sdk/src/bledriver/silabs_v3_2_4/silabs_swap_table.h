@@ -0,0 +1,777 @@
+/* Generated by tools/swapgen/swapgen.py from sl_bt_api.h and sli_bt_api.h, do not edit. */
+
+static const swap_field_t swap_fields[] = {
+    SWAP_FIELD(sl_bt_cmd_connection_set_default_parameters_t, min_interval),
+    SWAP_FIELD(sl_bt_cmd_connection_set_default_parameters_t, max_interval),
+    SWAP_FIELD(sl_bt_cmd_connection_set_default_parameters_t, latency),
+    SWAP_FIELD(sl_bt_cmd_connection_set_default_parameters_t, timeout),
+    SWAP_FIELD(sl_bt_cmd_connection_set_default_parameters_t, min_ce_length),
+    SWAP_FIELD(sl_bt_cmd_connection_set_default_parameters_t, max_ce_length),
+    SWAP_FIELD(sl_bt_cmd_gatt_set_max_mtu_t, max_mtu),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_read_attribute_value_t, attribute),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_read_attribute_value_t, offset),
+    SWAP_FIELD(sl_bt_cmd_coex_set_options_t, mask),
+    SWAP_FIELD(sl_bt_cmd_coex_set_options_t, options),
+    SWAP_FIELD(sl_bt_cmd_dfu_flash_set_address_t, address),
+    SWAP_FIELD(sl_bt_cmd_scanner_set_timing_t, scan_interval),
+    SWAP_FIELD(sl_bt_cmd_scanner_set_timing_t, scan_window),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_read_attribute_type_t, attribute),
+    SWAP_FIELD(sl_bt_cmd_sync_close_t, sync),
+    SWAP_FIELD(sl_bt_cmd_l2cap_coc_send_connection_request_t, le_psm),
+    SWAP_FIELD(sl_bt_cmd_l2cap_coc_send_connection_request_t, mtu),
+    SWAP_FIELD(sl_bt_cmd_l2cap_coc_send_connection_request_t, mps),
+    SWAP_FIELD(sl_bt_cmd_l2cap_coc_send_connection_request_t, initial_credit),
+    SWAP_FIELD(sl_bt_cmd_cte_receiver_enable_connection_cte_t, interval),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_service_t, session),
+    SWAP_FIELD(sl_bt_cmd_memory_profiler_reset_t, flags),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_write_attribute_value_t, attribute),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_write_attribute_value_t, offset),
+    SWAP_FIELD(sl_bt_cmd_nvm_save_t, key),
+    SWAP_FIELD(sl_bt_cmd_sync_set_parameters_t, skip),
+    SWAP_FIELD(sl_bt_cmd_sync_set_parameters_t, timeout),
+    SWAP_FIELD(sl_bt_cmd_sync_set_parameters_t, flags),
+    SWAP_FIELD(sl_bt_cmd_l2cap_coc_send_connection_response_t, cid),
+    SWAP_FIELD(sl_bt_cmd_l2cap_coc_send_connection_response_t, mtu),
+    SWAP_FIELD(sl_bt_cmd_l2cap_coc_send_connection_response_t, mps),
+    SWAP_FIELD(sl_bt_cmd_l2cap_coc_send_connection_response_t, initial_credit),
+    SWAP_FIELD(sl_bt_cmd_l2cap_coc_send_connection_response_t, l2cap_errorcode),
+    SWAP_FIELD(sl_bt_cmd_gattdb_remove_service_t, session),
+    SWAP_FIELD(sl_bt_cmd_gattdb_remove_service_t, service),
+    SWAP_FIELD(sl_bt_cmd_advertiser_set_timing_t, interval_min),
+    SWAP_FIELD(sl_bt_cmd_advertiser_set_timing_t, interval_max),
+    SWAP_FIELD(sl_bt_cmd_advertiser_set_timing_t, duration),
+    SWAP_FIELD(sl_bt_cmd_gatt_discover_characteristics_t, service),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_send_user_read_response_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_nvm_load_t, key),
+    SWAP_FIELD(sl_bt_cmd_ota_set_configuration_t, flags),
+    SWAP_FIELD(sl_bt_cmd_l2cap_coc_send_le_flow_control_credit_t, cid),
+    SWAP_FIELD(sl_bt_cmd_l2cap_coc_send_le_flow_control_credit_t, credits),
+    SWAP_FIELD(sl_bt_cmd_cte_receiver_enable_connectionless_cte_t, sync),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_included_service_t, session),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_included_service_t, service),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_included_service_t, included_service),
+    SWAP_FIELD(sl_bt_cmd_gatt_discover_characteristics_by_uuid_t, service),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_send_user_write_response_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_nvm_erase_t, key),
+    SWAP_FIELD(sl_bt_cmd_l2cap_coc_send_disconnection_request_t, cid),
+    SWAP_FIELD(sl_bt_cmd_cte_receiver_disable_connectionless_cte_t, sync),
+    SWAP_FIELD(sl_bt_cmd_gattdb_remove_included_service_t, session),
+    SWAP_FIELD(sl_bt_cmd_gattdb_remove_included_service_t, attribute),
+    SWAP_FIELD(sl_bt_cmd_gatt_set_characteristic_notification_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_send_characteristic_notification_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_l2cap_coc_send_data_t, cid),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid16_characteristic_t, session),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid16_characteristic_t, service),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid16_characteristic_t, property),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid16_characteristic_t, security),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid16_characteristic_t, maxlen),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid16_characteristic_t, value.len),
+    SWAP_FIELD(sl_bt_cmd_connection_set_parameters_t, min_interval),
+    SWAP_FIELD(sl_bt_cmd_connection_set_parameters_t, max_interval),
+    SWAP_FIELD(sl_bt_cmd_connection_set_parameters_t, latency),
+    SWAP_FIELD(sl_bt_cmd_connection_set_parameters_t, timeout),
+    SWAP_FIELD(sl_bt_cmd_connection_set_parameters_t, min_ce_length),
+    SWAP_FIELD(sl_bt_cmd_connection_set_parameters_t, max_ce_length),
+    SWAP_FIELD(sl_bt_cmd_gatt_discover_descriptors_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_find_attribute_t, start),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid128_characteristic_t, session),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid128_characteristic_t, service),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid128_characteristic_t, property),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid128_characteristic_t, security),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid128_characteristic_t, maxlen),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid128_characteristic_t, value.len),
+    SWAP_FIELD(sl_bt_cmd_advertiser_set_configuration_t, configurations),
+    SWAP_FIELD(sl_bt_cmd_gatt_read_characteristic_value_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gattdb_remove_characteristic_t, session),
+    SWAP_FIELD(sl_bt_cmd_gattdb_remove_characteristic_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_advertiser_clear_configuration_t, configurations),
+    SWAP_FIELD(sl_bt_cmd_gatt_read_characteristic_value_by_uuid_t, service),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_set_capabilities_t, caps),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_set_capabilities_t, reserved),
+    SWAP_FIELD(sl_bt_cmd_sm_enter_passkey_t, passkey),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid16_descriptor_t, session),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid16_descriptor_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid16_descriptor_t, property),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid16_descriptor_t, security),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid16_descriptor_t, maxlen),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid16_descriptor_t, value.len),
+    SWAP_FIELD(sl_bt_cmd_gatt_write_characteristic_value_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid128_descriptor_t, session),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid128_descriptor_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid128_descriptor_t, property),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid128_descriptor_t, security),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid128_descriptor_t, maxlen),
+    SWAP_FIELD(sl_bt_cmd_gattdb_add_uuid128_descriptor_t, value.len),
+    SWAP_FIELD(sl_bt_cmd_gatt_write_characteristic_value_without_response_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_set_max_mtu_t, max_mtu),
+    SWAP_FIELD(sl_bt_cmd_gattdb_remove_descriptor_t, session),
+    SWAP_FIELD(sl_bt_cmd_gattdb_remove_descriptor_t, descriptor),
+    SWAP_FIELD(sl_bt_cmd_advertiser_set_tx_power_t, power),
+    SWAP_FIELD(sl_bt_cmd_gatt_prepare_characteristic_value_write_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gatt_prepare_characteristic_value_write_t, offset),
+    SWAP_FIELD(sl_bt_cmd_gattdb_start_service_t, session),
+    SWAP_FIELD(sl_bt_cmd_gattdb_start_service_t, service),
+    SWAP_FIELD(sl_bt_cmd_advertiser_start_periodic_advertising_t, interval_min),
+    SWAP_FIELD(sl_bt_cmd_advertiser_start_periodic_advertising_t, interval_max),
+    SWAP_FIELD(sl_bt_cmd_advertiser_start_periodic_advertising_t, flags),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_enable_capabilities_t, caps),
+    SWAP_FIELD(sl_bt_cmd_gattdb_stop_service_t, session),
+    SWAP_FIELD(sl_bt_cmd_gattdb_stop_service_t, service),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_disable_capabilities_t, caps),
+    SWAP_FIELD(sl_bt_cmd_gattdb_start_characteristic_t, session),
+    SWAP_FIELD(sl_bt_cmd_gattdb_start_characteristic_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gatt_read_descriptor_value_t, descriptor),
+    SWAP_FIELD(sl_bt_cmd_gattdb_stop_characteristic_t, session),
+    SWAP_FIELD(sl_bt_cmd_gattdb_stop_characteristic_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gatt_write_descriptor_value_t, descriptor),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_send_notification_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gattdb_commit_t, session),
+    SWAP_FIELD(sl_bt_cmd_gatt_find_included_services_t, service),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_send_indication_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_sm_set_passkey_t, passkey),
+    SWAP_FIELD(sl_bt_cmd_gattdb_abort_t, session),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_notify_all_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gatt_read_characteristic_value_from_offset_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gatt_read_characteristic_value_from_offset_t, offset),
+    SWAP_FIELD(sl_bt_cmd_gatt_read_characteristic_value_from_offset_t, maxlen),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_read_client_configuration_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gatt_prepare_characteristic_value_reliable_write_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gatt_prepare_characteristic_value_reliable_write_t, offset),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_send_user_prepare_write_response_t, characteristic),
+    SWAP_FIELD(sl_bt_cmd_gatt_server_send_user_prepare_write_response_t, offset),
+    SWAP_FIELD(sl_bt_cmd_sm_get_bonding_handles_t, reserved),
+    SWAP_FIELD(sl_bt_cmd_system_set_max_tx_power_t, power),
+    SWAP_FIELD(sl_bt_cmd_sm_get_bonding_details_t, bonding),
+    SWAP_FIELD(sl_bt_cmd_system_set_tx_power_t, min_power),
+    SWAP_FIELD(sl_bt_cmd_system_set_tx_power_t, max_power),
+    SWAP_FIELD(sl_bt_cmd_sm_set_bonding_key_t, bonding),
+    SWAP_FIELD(sl_bt_cmd_system_set_soft_timer_t, time),
+    SWAP_FIELD(sl_bt_cmd_system_set_lazy_soft_timer_t, time),
+    SWAP_FIELD(sl_bt_cmd_system_set_lazy_soft_timer_t, slack),
+    SWAP_FIELD(sl_bt_evt_dfu_boot_t, version),
+    SWAP_FIELD(sl_bt_rsp_system_hello_t, result),
+    SWAP_FIELD(sl_bt_evt_system_boot_t, major),
+    SWAP_FIELD(sl_bt_evt_system_boot_t, minor),
+    SWAP_FIELD(sl_bt_evt_system_boot_t, patch),
+    SWAP_FIELD(sl_bt_evt_system_boot_t, build),
+    SWAP_FIELD(sl_bt_evt_system_boot_t, bootloader),
+    SWAP_FIELD(sl_bt_evt_system_boot_t, hw),
+    SWAP_FIELD(sl_bt_evt_system_boot_t, hash),
+    SWAP_FIELD(sl_bt_rsp_connection_set_default_parameters_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_set_max_mtu_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_set_max_mtu_t, max_mtu_out),
+    SWAP_FIELD(sl_bt_evt_gatt_mtu_exchanged_t, mtu),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_read_attribute_value_t, result),
+    SWAP_FIELD(sl_bt_evt_gatt_server_attribute_value_t, attribute),
+    SWAP_FIELD(sl_bt_evt_gatt_server_attribute_value_t, offset),
+    SWAP_FIELD(sl_bt_rsp_test_dtm_tx_t, result),
+    SWAP_FIELD(sl_bt_evt_test_dtm_completed_t, result),
+    SWAP_FIELD(sl_bt_evt_test_dtm_completed_t, number_of_packets),
+    SWAP_FIELD(sl_bt_rsp_sm_set_bondable_mode_t, result),
+    SWAP_FIELD(sl_bt_evt_sm_passkey_display_t, passkey),
+    SWAP_FIELD(sl_bt_rsp_coex_set_options_t, result),
+    SWAP_FIELD(sl_bt_rsp_sync_open_t, result),
+    SWAP_FIELD(sl_bt_rsp_sync_open_t, sync),
+    SWAP_FIELD(sl_bt_evt_sync_opened_t, sync),
+    SWAP_FIELD(sl_bt_evt_sync_opened_t, adv_interval),
+    SWAP_FIELD(sl_bt_evt_sync_opened_t, clock_accuracy),
+    SWAP_FIELD(sl_bt_rsp_cte_transmitter_enable_connection_cte_t, result),
+    SWAP_FIELD(sl_bt_rsp_cte_receiver_configure_t, result),
+    SWAP_FIELD(sl_bt_evt_cte_receiver_connection_iq_report_t, status),
+    SWAP_FIELD(sl_bt_evt_cte_receiver_connection_iq_report_t, event_counter),
+    SWAP_FIELD(sl_bt_rsp_gattdb_new_session_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_new_session_t, session),
+    SWAP_FIELD(sl_bt_rsp_memory_profiler_get_status_t, result),
+    SWAP_FIELD(sl_bt_rsp_memory_profiler_get_status_t, num_memory_trackers),
+    SWAP_FIELD(sl_bt_rsp_memory_profiler_get_status_t, num_live_allocations),
+    SWAP_FIELD(sl_bt_rsp_memory_profiler_get_status_t, peak_live_allocations),
+    SWAP_FIELD(sl_bt_rsp_memory_profiler_get_status_t, num_heap_bytes_used),
+    SWAP_FIELD(sl_bt_rsp_memory_profiler_get_status_t, peak_heap_bytes_used),
+    SWAP_FIELD(sl_bt_rsp_memory_profiler_get_status_t, peak_stack_bytes_used),
+    SWAP_FIELD(sl_bt_rsp_memory_profiler_get_status_t, errors),
+    SWAP_FIELD(sl_bt_evt_memory_profiler_ram_usage_entry_t, depth),
+    SWAP_FIELD(sl_bt_evt_memory_profiler_ram_usage_entry_t, total_size),
+    SWAP_FIELD(sl_bt_evt_memory_profiler_ram_usage_entry_t, num_allocations),
+    SWAP_FIELD(sl_bt_evt_memory_profiler_ram_usage_entry_t, num_failed_allocations),
+    SWAP_FIELD(sl_bt_evt_memory_profiler_ram_usage_entry_t, bytes_allocated),
+    SWAP_FIELD(sl_bt_evt_memory_profiler_ram_usage_entry_t, peak_bytes_allocated),
+    SWAP_FIELD(sl_bt_rsp_user_message_to_target_t, result),
+    SWAP_FIELD(sl_bt_rsp_dfu_flash_set_address_t, result),
+    SWAP_FIELD(sl_bt_evt_dfu_boot_failure_t, reason),
+    SWAP_FIELD(sl_bt_rsp_gap_set_privacy_mode_t, result),
+    SWAP_FIELD(sl_bt_rsp_advertiser_create_set_t, result),
+    SWAP_FIELD(sl_bt_rsp_scanner_set_timing_t, result),
+    SWAP_FIELD(sl_bt_evt_scanner_scan_report_t, periodic_interval),
+    SWAP_FIELD(sl_bt_rsp_connection_set_default_preferred_phy_t, result),
+    SWAP_FIELD(sl_bt_evt_connection_closed_t, reason),
+    SWAP_FIELD(sl_bt_rsp_gatt_discover_primary_services_t, result),
+    SWAP_FIELD(sl_bt_evt_gatt_service_t, service),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_read_attribute_type_t, result),
+    SWAP_FIELD(sl_bt_evt_gatt_server_user_read_request_t, characteristic),
+    SWAP_FIELD(sl_bt_evt_gatt_server_user_read_request_t, offset),
+    SWAP_FIELD(sl_bt_rsp_nvm_erase_all_t, result),
+    SWAP_FIELD(sl_bt_rsp_test_dtm_rx_t, result),
+    SWAP_FIELD(sl_bt_rsp_sm_configure_t, result),
+    SWAP_FIELD(sl_bt_rsp_ota_set_device_name_t, result),
+    SWAP_FIELD(sl_bt_rsp_coex_get_counters_t, result),
+    SWAP_FIELD(sl_bt_rsp_sync_close_t, result),
+    SWAP_FIELD(sl_bt_evt_sync_closed_t, reason),
+    SWAP_FIELD(sl_bt_evt_sync_closed_t, sync),
+    SWAP_FIELD(sl_bt_rsp_l2cap_coc_send_connection_request_t, result),
+    SWAP_FIELD(sl_bt_evt_l2cap_coc_connection_request_t, le_psm),
+    SWAP_FIELD(sl_bt_evt_l2cap_coc_connection_request_t, source_cid),
+    SWAP_FIELD(sl_bt_evt_l2cap_coc_connection_request_t, mtu),
+    SWAP_FIELD(sl_bt_evt_l2cap_coc_connection_request_t, mps),
+    SWAP_FIELD(sl_bt_evt_l2cap_coc_connection_request_t, initial_credit),
+    SWAP_FIELD(sl_bt_rsp_cte_transmitter_disable_connection_cte_t, result),
+    SWAP_FIELD(sl_bt_rsp_cte_receiver_enable_connection_cte_t, result),
+    SWAP_FIELD(sl_bt_evt_cte_receiver_connectionless_iq_report_t, status),
+    SWAP_FIELD(sl_bt_evt_cte_receiver_connectionless_iq_report_t, sync),
+    SWAP_FIELD(sl_bt_evt_cte_receiver_connectionless_iq_report_t, event_counter),
+    SWAP_FIELD(sl_bt_rsp_gattdb_add_service_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_add_service_t, service),
+    SWAP_FIELD(sl_bt_rsp_memory_profiler_reset_t, result),
+    SWAP_FIELD(sl_bt_rsp_user_manage_event_filter_t, result),
+    SWAP_FIELD(sl_bt_rsp_dfu_flash_upload_t, result),
+    SWAP_FIELD(sl_bt_rsp_gap_set_data_channel_classification_t, result),
+    SWAP_FIELD(sl_bt_rsp_advertiser_delete_set_t, result),
+    SWAP_FIELD(sl_bt_rsp_scanner_set_mode_t, result),
+    SWAP_FIELD(sl_bt_rsp_connection_get_rssi_t, result),
+    SWAP_FIELD(sl_bt_evt_connection_parameters_t, interval),
+    SWAP_FIELD(sl_bt_evt_connection_parameters_t, latency),
+    SWAP_FIELD(sl_bt_evt_connection_parameters_t, timeout),
+    SWAP_FIELD(sl_bt_evt_connection_parameters_t, txsize),
+    SWAP_FIELD(sl_bt_rsp_gatt_discover_primary_services_by_uuid_t, result),
+    SWAP_FIELD(sl_bt_evt_gatt_characteristic_t, characteristic),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_write_attribute_value_t, result),
+    SWAP_FIELD(sl_bt_evt_gatt_server_user_write_request_t, characteristic),
+    SWAP_FIELD(sl_bt_evt_gatt_server_user_write_request_t, offset),
+    SWAP_FIELD(sl_bt_rsp_nvm_save_t, result),
+    SWAP_FIELD(sl_bt_rsp_test_dtm_end_t, result),
+    SWAP_FIELD(sl_bt_rsp_sm_store_bonding_configuration_t, result),
+    SWAP_FIELD(sl_bt_evt_sm_confirm_passkey_t, passkey),
+    SWAP_FIELD(sl_bt_rsp_ota_set_advertising_data_t, result),
+    SWAP_FIELD(sl_bt_rsp_coex_set_parameters_t, result),
+    SWAP_FIELD(sl_bt_rsp_sync_set_parameters_t, result),
+    SWAP_FIELD(sl_bt_evt_sync_data_t, sync),
+    SWAP_FIELD(sl_bt_rsp_l2cap_coc_send_connection_response_t, result),
+    SWAP_FIELD(sl_bt_evt_l2cap_coc_connection_response_t, destination_cid),
+    SWAP_FIELD(sl_bt_evt_l2cap_coc_connection_response_t, mtu),
+    SWAP_FIELD(sl_bt_evt_l2cap_coc_connection_response_t, mps),
+    SWAP_FIELD(sl_bt_evt_l2cap_coc_connection_response_t, initial_credit),
+    SWAP_FIELD(sl_bt_evt_l2cap_coc_connection_response_t, l2cap_errorcode),
+    SWAP_FIELD(sl_bt_rsp_cte_transmitter_enable_connectionless_cte_t, result),
+    SWAP_FIELD(sl_bt_rsp_cte_receiver_disable_connection_cte_t, result),
+    SWAP_FIELD(sl_bt_evt_cte_receiver_dtm_iq_report_t, status),
+    SWAP_FIELD(sl_bt_evt_cte_receiver_dtm_iq_report_t, event_counter),
+    SWAP_FIELD(sl_bt_rsp_gattdb_remove_service_t, result),
+    SWAP_FIELD(sl_bt_rsp_memory_profiler_list_ram_usage_t, result),
+    SWAP_FIELD(sl_bt_rsp_dfu_flash_upload_finish_t, result),
+    SWAP_FIELD(sl_bt_evt_system_external_signal_t, extsignals),
+    SWAP_FIELD(sl_bt_rsp_gap_enable_whitelisting_t, result),
+    SWAP_FIELD(sl_bt_rsp_advertiser_set_timing_t, result),
+    SWAP_FIELD(sl_bt_evt_advertiser_periodic_advertising_status_t, status),
+    SWAP_FIELD(sl_bt_rsp_scanner_start_t, result),
+    SWAP_FIELD(sl_bt_rsp_connection_disable_slave_latency_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_discover_characteristics_t, result),
+    SWAP_FIELD(sl_bt_evt_gatt_descriptor_t, descriptor),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_send_user_read_response_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_send_user_read_response_t, sent_len),
+    SWAP_FIELD(sl_bt_evt_gatt_server_characteristic_status_t, characteristic),
+    SWAP_FIELD(sl_bt_evt_gatt_server_characteristic_status_t, client_config_flags),
+    SWAP_FIELD(sl_bt_evt_gatt_server_characteristic_status_t, client_config),
+    SWAP_FIELD(sl_bt_rsp_nvm_load_t, result),
+    SWAP_FIELD(sl_bt_rsp_test_dtm_tx_v4_t, result),
+    SWAP_FIELD(sl_bt_rsp_ota_set_configuration_t, result),
+    SWAP_FIELD(sl_bt_rsp_coex_set_directional_priority_pulse_t, result),
+    SWAP_FIELD(sl_bt_rsp_l2cap_coc_send_le_flow_control_credit_t, result),
+    SWAP_FIELD(sl_bt_evt_l2cap_coc_le_flow_control_credit_t, cid),
+    SWAP_FIELD(sl_bt_evt_l2cap_coc_le_flow_control_credit_t, credits),
+    SWAP_FIELD(sl_bt_rsp_cte_transmitter_disable_connectionless_cte_t, result),
+    SWAP_FIELD(sl_bt_rsp_cte_receiver_enable_connectionless_cte_t, result),
+    SWAP_FIELD(sl_bt_evt_cte_receiver_silabs_iq_report_t, status),
+    SWAP_FIELD(sl_bt_evt_cte_receiver_silabs_iq_report_t, packet_counter),
+    SWAP_FIELD(sl_bt_rsp_gattdb_add_included_service_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_add_included_service_t, attribute),
+    SWAP_FIELD(sl_bt_rsp_advertiser_set_channel_map_t, result),
+    SWAP_FIELD(sl_bt_rsp_connection_open_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_discover_characteristics_by_uuid_t, result),
+    SWAP_FIELD(sl_bt_evt_gatt_characteristic_value_t, characteristic),
+    SWAP_FIELD(sl_bt_evt_gatt_characteristic_value_t, offset),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_send_user_write_response_t, result),
+    SWAP_FIELD(sl_bt_evt_gatt_server_execute_write_completed_t, result),
+    SWAP_FIELD(sl_bt_rsp_nvm_erase_t, result),
+    SWAP_FIELD(sl_bt_rsp_sm_increase_security_t, result),
+    SWAP_FIELD(sl_bt_evt_sm_bonding_failed_t, reason),
+    SWAP_FIELD(sl_bt_rsp_ota_set_rf_path_t, result),
+    SWAP_FIELD(sl_bt_rsp_l2cap_coc_send_disconnection_request_t, result),
+    SWAP_FIELD(sl_bt_evt_l2cap_coc_channel_disconnected_t, cid),
+    SWAP_FIELD(sl_bt_evt_l2cap_coc_channel_disconnected_t, reason),
+    SWAP_FIELD(sl_bt_rsp_cte_transmitter_set_dtm_parameters_t, result),
+    SWAP_FIELD(sl_bt_rsp_cte_receiver_disable_connectionless_cte_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_remove_included_service_t, result),
+    SWAP_FIELD(sl_bt_evt_system_hardware_error_t, status),
+    SWAP_FIELD(sl_bt_rsp_advertiser_set_report_scan_request_t, result),
+    SWAP_FIELD(sl_bt_rsp_scanner_stop_t, result),
+    SWAP_FIELD(sl_bt_rsp_connection_close_t, result),
+    SWAP_FIELD(sl_bt_evt_connection_get_remote_tx_power_completed_t, status),
+    SWAP_FIELD(sl_bt_rsp_gatt_set_characteristic_notification_t, result),
+    SWAP_FIELD(sl_bt_evt_gatt_descriptor_value_t, descriptor),
+    SWAP_FIELD(sl_bt_evt_gatt_descriptor_value_t, offset),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_send_characteristic_notification_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_send_characteristic_notification_t, sent_len),
+    SWAP_FIELD(sl_bt_rsp_l2cap_coc_send_data_t, result),
+    SWAP_FIELD(sl_bt_evt_l2cap_coc_data_t, cid),
+    SWAP_FIELD(sl_bt_rsp_cte_transmitter_clear_dtm_parameters_t, result),
+    SWAP_FIELD(sl_bt_rsp_cte_receiver_set_dtm_parameters_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_add_uuid16_characteristic_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_add_uuid16_characteristic_t, characteristic),
+    SWAP_FIELD(sl_bt_evt_system_error_t, reason),
+    SWAP_FIELD(sl_bt_rsp_advertiser_set_phy_t, result),
+    SWAP_FIELD(sl_bt_rsp_connection_set_parameters_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_discover_descriptors_t, result),
+    SWAP_FIELD(sl_bt_evt_gatt_procedure_completed_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_find_attribute_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_find_attribute_t, attribute),
+    SWAP_FIELD(sl_bt_rsp_sm_delete_bonding_t, result),
+    SWAP_FIELD(sl_bt_evt_l2cap_command_rejected_t, reason),
+    SWAP_FIELD(sl_bt_rsp_cte_transmitter_enable_silabs_cte_t, result),
+    SWAP_FIELD(sl_bt_rsp_cte_receiver_clear_dtm_parameters_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_add_uuid128_characteristic_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_add_uuid128_characteristic_t, characteristic),
+    SWAP_FIELD(sl_bt_rsp_advertiser_set_configuration_t, result),
+    SWAP_FIELD(sl_bt_rsp_connection_read_channel_map_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_read_characteristic_value_t, result),
+    SWAP_FIELD(sl_bt_rsp_sm_delete_bondings_t, result),
+    SWAP_FIELD(sl_bt_rsp_cte_transmitter_disable_silabs_cte_t, result),
+    SWAP_FIELD(sl_bt_rsp_cte_receiver_enable_silabs_cte_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_remove_characteristic_t, result),
+    SWAP_FIELD(sl_bt_rsp_advertiser_clear_configuration_t, result),
+    SWAP_FIELD(sl_bt_rsp_connection_set_preferred_phy_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_read_characteristic_value_by_uuid_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_set_capabilities_t, result),
+    SWAP_FIELD(sl_bt_rsp_sm_enter_passkey_t, result),
+    SWAP_FIELD(sl_bt_rsp_cte_receiver_disable_silabs_cte_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_add_uuid16_descriptor_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_add_uuid16_descriptor_t, descriptor),
+    SWAP_FIELD(sl_bt_rsp_advertiser_start_t, result),
+    SWAP_FIELD(sl_bt_rsp_connection_set_power_reporting_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_write_characteristic_value_t, result),
+    SWAP_FIELD(sl_bt_rsp_sm_passkey_confirm_t, result),
+    SWAP_FIELD(sl_bt_rsp_cte_receiver_set_sync_cte_type_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_add_uuid128_descriptor_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_add_uuid128_descriptor_t, descriptor),
+    SWAP_FIELD(sl_bt_rsp_advertiser_stop_t, result),
+    SWAP_FIELD(sl_bt_rsp_connection_set_remote_power_reporting_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_write_characteristic_value_without_response_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_write_characteristic_value_without_response_t, sent_len),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_set_max_mtu_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_set_max_mtu_t, max_mtu_out),
+    SWAP_FIELD(sl_bt_rsp_sm_set_oob_data_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_remove_descriptor_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_get_random_data_t, result),
+    SWAP_FIELD(sl_bt_rsp_advertiser_set_tx_power_t, result),
+    SWAP_FIELD(sl_bt_rsp_advertiser_set_tx_power_t, set_power),
+    SWAP_FIELD(sl_bt_rsp_connection_get_tx_power_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_prepare_characteristic_value_write_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_prepare_characteristic_value_write_t, sent_len),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_get_mtu_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_get_mtu_t, mtu),
+    SWAP_FIELD(sl_bt_rsp_sm_list_all_bondings_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_start_service_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_halt_t, result),
+    SWAP_FIELD(sl_bt_rsp_advertiser_start_periodic_advertising_t, result),
+    SWAP_FIELD(sl_bt_rsp_connection_get_remote_tx_power_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_execute_characteristic_value_write_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_enable_capabilities_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_stop_service_t, result),
+    SWAP_FIELD(sl_bt_rsp_advertiser_stop_periodic_advertising_t, result),
+    SWAP_FIELD(sl_bt_rsp_connection_read_remote_used_features_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_send_characteristic_confirmation_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_disable_capabilities_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_start_characteristic_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_linklayer_configure_t, result),
+    SWAP_FIELD(sl_bt_rsp_advertiser_set_long_data_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_read_descriptor_value_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_get_enabled_capabilities_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_get_enabled_capabilities_t, caps),
+    SWAP_FIELD(sl_bt_rsp_sm_bonding_confirm_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_stop_characteristic_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_get_counters_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_get_counters_t, tx_packets),
+    SWAP_FIELD(sl_bt_rsp_system_get_counters_t, rx_packets),
+    SWAP_FIELD(sl_bt_rsp_system_get_counters_t, crc_errors),
+    SWAP_FIELD(sl_bt_rsp_system_get_counters_t, failures),
+    SWAP_FIELD(sl_bt_rsp_advertiser_set_data_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_write_descriptor_value_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_send_notification_t, result),
+    SWAP_FIELD(sl_bt_rsp_sm_set_debug_mode_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_commit_t, result),
+    SWAP_FIELD(sl_bt_rsp_advertiser_set_random_address_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_find_included_services_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_send_indication_t, result),
+    SWAP_FIELD(sl_bt_rsp_sm_set_passkey_t, result),
+    SWAP_FIELD(sl_bt_rsp_gattdb_abort_t, result),
+    SWAP_FIELD(sl_bt_rsp_advertiser_clear_random_address_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_read_multiple_characteristic_values_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_notify_all_t, result),
+    SWAP_FIELD(sl_bt_rsp_sm_use_sc_oob_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_data_buffer_write_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_read_characteristic_value_from_offset_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_read_client_configuration_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_read_client_configuration_t, client_config_flags),
+    SWAP_FIELD(sl_bt_rsp_sm_set_sc_remote_oob_data_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_set_identity_address_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_prepare_characteristic_value_reliable_write_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_prepare_characteristic_value_reliable_write_t, sent_len),
+    SWAP_FIELD(sl_bt_rsp_sm_add_to_whitelist_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_data_buffer_clear_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_send_user_prepare_write_response_t, result),
+    SWAP_FIELD(sl_bt_rsp_sm_set_minimum_key_size_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_get_identity_address_t, result),
+    SWAP_FIELD(sl_bt_rsp_gatt_server_read_client_supported_features_t, result),
+    SWAP_FIELD(sl_bt_rsp_sm_get_bonding_handles_t, result),
+    SWAP_FIELD(sl_bt_rsp_sm_get_bonding_handles_t, num_bondings),
+    SWAP_FIELD(sl_bt_rsp_system_set_max_tx_power_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_set_max_tx_power_t, set_power),
+    SWAP_FIELD(sl_bt_rsp_sm_get_bonding_details_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_set_tx_power_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_set_tx_power_t, set_min),
+    SWAP_FIELD(sl_bt_rsp_system_set_tx_power_t, set_max),
+    SWAP_FIELD(sl_bt_rsp_sm_find_bonding_by_address_t, result),
+    SWAP_FIELD(sl_bt_rsp_sm_find_bonding_by_address_t, bonding),
+    SWAP_FIELD(sl_bt_rsp_system_get_tx_power_setting_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_get_tx_power_setting_t, support_min),
+    SWAP_FIELD(sl_bt_rsp_system_get_tx_power_setting_t, support_max),
+    SWAP_FIELD(sl_bt_rsp_system_get_tx_power_setting_t, set_min),
+    SWAP_FIELD(sl_bt_rsp_system_get_tx_power_setting_t, set_max),
+    SWAP_FIELD(sl_bt_rsp_system_get_tx_power_setting_t, rf_path_gain),
+    SWAP_FIELD(sl_bt_rsp_sm_set_bonding_key_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_set_soft_timer_t, result),
+    SWAP_FIELD(sl_bt_rsp_sm_set_legacy_oob_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_set_lazy_soft_timer_t, result),
+    SWAP_FIELD(sl_bt_rsp_sm_set_oob_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_get_version_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_get_version_t, major),
+    SWAP_FIELD(sl_bt_rsp_system_get_version_t, minor),
+    SWAP_FIELD(sl_bt_rsp_system_get_version_t, patch),
+    SWAP_FIELD(sl_bt_rsp_system_get_version_t, build),
+    SWAP_FIELD(sl_bt_rsp_system_get_version_t, bootloader),
+    SWAP_FIELD(sl_bt_rsp_system_get_version_t, hash),
+    SWAP_FIELD(sl_bt_rsp_sm_set_remote_oob_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_start_bluetooth_t, result),
+    SWAP_FIELD(sl_bt_rsp_system_stop_bluetooth_t, result),
+};
+
+static const swap_msg_t swap_cmd_msgs[] = {
+    { sl_bt_cmd_connection_set_default_parameters_id, 0, 6 },
+    { sl_bt_cmd_gatt_set_max_mtu_id, 6, 1 },
+    { sl_bt_cmd_gatt_server_read_attribute_value_id, 7, 2 },
+    { sl_bt_cmd_coex_set_options_id, 9, 2 },
+    { sl_bt_cmd_dfu_flash_set_address_id, 11, 1 },
+    { sl_bt_cmd_scanner_set_timing_id, 12, 2 },
+    { sl_bt_cmd_gatt_server_read_attribute_type_id, 14, 1 },
+    { sl_bt_cmd_sync_close_id, 15, 1 },
+    { sl_bt_cmd_l2cap_coc_send_connection_request_id, 16, 4 },
+    { sl_bt_cmd_cte_receiver_enable_connection_cte_id, 20, 1 },
+    { sl_bt_cmd_gattdb_add_service_id, 21, 1 },
+    { sl_bt_cmd_memory_profiler_reset_id, 22, 1 },
+    { sl_bt_cmd_gatt_server_write_attribute_value_id, 23, 2 },
+    { sl_bt_cmd_nvm_save_id, 25, 1 },
+    { sl_bt_cmd_sync_set_parameters_id, 26, 3 },
+    { sl_bt_cmd_l2cap_coc_send_connection_response_id, 29, 5 },
+    { sl_bt_cmd_gattdb_remove_service_id, 34, 2 },
+    { sl_bt_cmd_advertiser_set_timing_id, 36, 3 },
+    { sl_bt_cmd_gatt_discover_characteristics_id, 39, 1 },
+    { sl_bt_cmd_gatt_server_send_user_read_response_id, 40, 1 },
+    { sl_bt_cmd_nvm_load_id, 41, 1 },
+    { sl_bt_cmd_ota_set_configuration_id, 42, 1 },
+    { sl_bt_cmd_l2cap_coc_send_le_flow_control_credit_id, 43, 2 },
+    { sl_bt_cmd_cte_receiver_enable_connectionless_cte_id, 45, 1 },
+    { sl_bt_cmd_gattdb_add_included_service_id, 46, 3 },
+    { sl_bt_cmd_gatt_discover_characteristics_by_uuid_id, 49, 1 },
+    { sl_bt_cmd_gatt_server_send_user_write_response_id, 50, 1 },
+    { sl_bt_cmd_nvm_erase_id, 51, 1 },
+    { sl_bt_cmd_l2cap_coc_send_disconnection_request_id, 52, 1 },
+    { sl_bt_cmd_cte_receiver_disable_connectionless_cte_id, 53, 1 },
+    { sl_bt_cmd_gattdb_remove_included_service_id, 54, 2 },
+    { sl_bt_cmd_gatt_set_characteristic_notification_id, 56, 1 },
+    { sl_bt_cmd_gatt_server_send_characteristic_notification_id, 57, 1 },
+    { sl_bt_cmd_l2cap_coc_send_data_id, 58, 1 },
+    { sl_bt_cmd_gattdb_add_uuid16_characteristic_id, 59, 6 },
+    { sl_bt_cmd_connection_set_parameters_id, 65, 6 },
+    { sl_bt_cmd_gatt_discover_descriptors_id, 71, 1 },
+    { sl_bt_cmd_gatt_server_find_attribute_id, 72, 1 },
+    { sl_bt_cmd_gattdb_add_uuid128_characteristic_id, 73, 6 },
+    { sl_bt_cmd_advertiser_set_configuration_id, 79, 1 },
+    { sl_bt_cmd_gatt_read_characteristic_value_id, 80, 1 },
+    { sl_bt_cmd_gattdb_remove_characteristic_id, 81, 2 },
+    { sl_bt_cmd_advertiser_clear_configuration_id, 83, 1 },
+    { sl_bt_cmd_gatt_read_characteristic_value_by_uuid_id, 84, 1 },
+    { sl_bt_cmd_gatt_server_set_capabilities_id, 85, 2 },
+    { sl_bt_cmd_sm_enter_passkey_id, 87, 1 },
+    { sl_bt_cmd_gattdb_add_uuid16_descriptor_id, 88, 6 },
+    { sl_bt_cmd_gatt_write_characteristic_value_id, 94, 1 },
+    { sl_bt_cmd_gattdb_add_uuid128_descriptor_id, 95, 6 },
+    { sl_bt_cmd_gatt_write_characteristic_value_without_response_id, 101, 1 },
+    { sl_bt_cmd_gatt_server_set_max_mtu_id, 102, 1 },
+    { sl_bt_cmd_gattdb_remove_descriptor_id, 103, 2 },
+    { sl_bt_cmd_advertiser_set_tx_power_id, 105, 1 },
+    { sl_bt_cmd_gatt_prepare_characteristic_value_write_id, 106, 2 },
+    { sl_bt_cmd_gattdb_start_service_id, 108, 2 },
+    { sl_bt_cmd_advertiser_start_periodic_advertising_id, 110, 3 },
+    { sl_bt_cmd_gatt_server_enable_capabilities_id, 113, 1 },
+    { sl_bt_cmd_gattdb_stop_service_id, 114, 2 },
+    { sl_bt_cmd_gatt_server_disable_capabilities_id, 116, 1 },
+    { sl_bt_cmd_gattdb_start_characteristic_id, 117, 2 },
+    { sl_bt_cmd_gatt_read_descriptor_value_id, 119, 1 },
+    { sl_bt_cmd_gattdb_stop_characteristic_id, 120, 2 },
+    { sl_bt_cmd_gatt_write_descriptor_value_id, 122, 1 },
+    { sl_bt_cmd_gatt_server_send_notification_id, 123, 1 },
+    { sl_bt_cmd_gattdb_commit_id, 124, 1 },
+    { sl_bt_cmd_gatt_find_included_services_id, 125, 1 },
+    { sl_bt_cmd_gatt_server_send_indication_id, 126, 1 },
+    { sl_bt_cmd_sm_set_passkey_id, 127, 1 },
+    { sl_bt_cmd_gattdb_abort_id, 128, 1 },
+    { sl_bt_cmd_gatt_server_notify_all_id, 129, 1 },
+    { sl_bt_cmd_gatt_read_characteristic_value_from_offset_id, 130, 3 },
+    { sl_bt_cmd_gatt_server_read_client_configuration_id, 133, 1 },
+    { sl_bt_cmd_gatt_prepare_characteristic_value_reliable_write_id, 134, 2 },
+    { sl_bt_cmd_gatt_server_send_user_prepare_write_response_id, 136, 2 },
+    { sl_bt_cmd_sm_get_bonding_handles_id, 138, 1 },
+    { sl_bt_cmd_system_set_max_tx_power_id, 139, 1 },
+    { sl_bt_cmd_sm_get_bonding_details_id, 140, 1 },
+    { sl_bt_cmd_system_set_tx_power_id, 141, 2 },
+    { sl_bt_cmd_sm_set_bonding_key_id, 143, 1 },
+    { sl_bt_cmd_system_set_soft_timer_id, 144, 1 },
+    { sl_bt_cmd_system_set_lazy_soft_timer_id, 145, 2 },
+};
+
+static const swap_msg_t swap_rx_msgs[] = {
+    { sl_bt_evt_dfu_boot_id, 147, 1 },
+    { sl_bt_rsp_system_hello_id, 148, 1 },
+    { sl_bt_evt_system_boot_id, 149, 7 },
+    { sl_bt_rsp_connection_set_default_parameters_id, 156, 1 },
+    { sl_bt_rsp_gatt_set_max_mtu_id, 157, 2 },
+    { sl_bt_evt_gatt_mtu_exchanged_id, 159, 1 },
+    { sl_bt_rsp_gatt_server_read_attribute_value_id, 160, 1 },
+    { sl_bt_evt_gatt_server_attribute_value_id, 161, 2 },
+    { sl_bt_rsp_test_dtm_tx_id, 163, 1 },
+    { sl_bt_evt_test_dtm_completed_id, 164, 2 },
+    { sl_bt_rsp_sm_set_bondable_mode_id, 166, 1 },
+    { sl_bt_evt_sm_passkey_display_id, 167, 1 },
+    { sl_bt_rsp_coex_set_options_id, 168, 1 },
+    { sl_bt_rsp_sync_open_id, 169, 2 },
+    { sl_bt_evt_sync_opened_id, 171, 3 },
+    { sl_bt_rsp_cte_transmitter_enable_connection_cte_id, 174, 1 },
+    { sl_bt_rsp_cte_receiver_configure_id, 175, 1 },
+    { sl_bt_evt_cte_receiver_connection_iq_report_id, 176, 2 },
+    { sl_bt_rsp_gattdb_new_session_id, 178, 2 },
+    { sl_bt_rsp_memory_profiler_get_status_id, 180, 8 },
+    { sl_bt_evt_memory_profiler_ram_usage_entry_id, 188, 6 },
+    { sl_bt_rsp_user_message_to_target_id, 194, 1 },
+    { sl_bt_rsp_dfu_flash_set_address_id, 195, 1 },
+    { sl_bt_evt_dfu_boot_failure_id, 196, 1 },
+    { sl_bt_rsp_gap_set_privacy_mode_id, 197, 1 },
+    { sl_bt_rsp_advertiser_create_set_id, 198, 1 },
+    { sl_bt_rsp_scanner_set_timing_id, 199, 1 },
+    { sl_bt_evt_scanner_scan_report_id, 200, 1 },
+    { sl_bt_rsp_connection_set_default_preferred_phy_id, 201, 1 },
+    { sl_bt_evt_connection_closed_id, 202, 1 },
+    { sl_bt_rsp_gatt_discover_primary_services_id, 203, 1 },
+    { sl_bt_evt_gatt_service_id, 204, 1 },
+    { sl_bt_rsp_gatt_server_read_attribute_type_id, 205, 1 },
+    { sl_bt_evt_gatt_server_user_read_request_id, 206, 2 },
+    { sl_bt_rsp_nvm_erase_all_id, 208, 1 },
+    { sl_bt_rsp_test_dtm_rx_id, 209, 1 },
+    { sl_bt_rsp_sm_configure_id, 210, 1 },
+    { sl_bt_rsp_ota_set_device_name_id, 211, 1 },
+    { sl_bt_rsp_coex_get_counters_id, 212, 1 },
+    { sl_bt_rsp_sync_close_id, 213, 1 },
+    { sl_bt_evt_sync_closed_id, 214, 2 },
+    { sl_bt_rsp_l2cap_coc_send_connection_request_id, 216, 1 },
+    { sl_bt_evt_l2cap_coc_connection_request_id, 217, 5 },
+    { sl_bt_rsp_cte_transmitter_disable_connection_cte_id, 222, 1 },
+    { sl_bt_rsp_cte_receiver_enable_connection_cte_id, 223, 1 },
+    { sl_bt_evt_cte_receiver_connectionless_iq_report_id, 224, 3 },
+    { sl_bt_rsp_gattdb_add_service_id, 227, 2 },
+    { sl_bt_rsp_memory_profiler_reset_id, 229, 1 },
+    { sl_bt_rsp_user_manage_event_filter_id, 230, 1 },
+    { sl_bt_rsp_dfu_flash_upload_id, 231, 1 },
+    { sl_bt_rsp_gap_set_data_channel_classification_id, 232, 1 },
+    { sl_bt_rsp_advertiser_delete_set_id, 233, 1 },
+    { sl_bt_rsp_scanner_set_mode_id, 234, 1 },
+    { sl_bt_rsp_connection_get_rssi_id, 235, 1 },
+    { sl_bt_evt_connection_parameters_id, 236, 4 },
+    { sl_bt_rsp_gatt_discover_primary_services_by_uuid_id, 240, 1 },
+    { sl_bt_evt_gatt_characteristic_id, 241, 1 },
+    { sl_bt_rsp_gatt_server_write_attribute_value_id, 242, 1 },
+    { sl_bt_evt_gatt_server_user_write_request_id, 243, 2 },
+    { sl_bt_rsp_nvm_save_id, 245, 1 },
+    { sl_bt_rsp_test_dtm_end_id, 246, 1 },
+    { sl_bt_rsp_sm_store_bonding_configuration_id, 247, 1 },
+    { sl_bt_evt_sm_confirm_passkey_id, 248, 1 },
+    { sl_bt_rsp_ota_set_advertising_data_id, 249, 1 },
+    { sl_bt_rsp_coex_set_parameters_id, 250, 1 },
+    { sl_bt_rsp_sync_set_parameters_id, 251, 1 },
+    { sl_bt_evt_sync_data_id, 252, 1 },
+    { sl_bt_rsp_l2cap_coc_send_connection_response_id, 253, 1 },
+    { sl_bt_evt_l2cap_coc_connection_response_id, 254, 5 },
+    { sl_bt_rsp_cte_transmitter_enable_connectionless_cte_id, 259, 1 },
+    { sl_bt_rsp_cte_receiver_disable_connection_cte_id, 260, 1 },
+    { sl_bt_evt_cte_receiver_dtm_iq_report_id, 261, 2 },
+    { sl_bt_rsp_gattdb_remove_service_id, 263, 1 },
+    { sl_bt_rsp_memory_profiler_list_ram_usage_id, 264, 1 },
+    { sl_bt_rsp_dfu_flash_upload_finish_id, 265, 1 },
+    { sl_bt_evt_system_external_signal_id, 266, 1 },
+    { sl_bt_rsp_gap_enable_whitelisting_id, 267, 1 },
+    { sl_bt_rsp_advertiser_set_timing_id, 268, 1 },
+    { sl_bt_evt_advertiser_periodic_advertising_status_id, 269, 1 },
+    { sl_bt_rsp_scanner_start_id, 270, 1 },
+    { sl_bt_rsp_connection_disable_slave_latency_id, 271, 1 },
+    { sl_bt_rsp_gatt_discover_characteristics_id, 272, 1 },
+    { sl_bt_evt_gatt_descriptor_id, 273, 1 },
+    { sl_bt_rsp_gatt_server_send_user_read_response_id, 274, 2 },
+    { sl_bt_evt_gatt_server_characteristic_status_id, 276, 3 },
+    { sl_bt_rsp_nvm_load_id, 279, 1 },
+    { sl_bt_rsp_test_dtm_tx_v4_id, 280, 1 },
+    { sl_bt_rsp_ota_set_configuration_id, 281, 1 },
+    { sl_bt_rsp_coex_set_directional_priority_pulse_id, 282, 1 },
+    { sl_bt_rsp_l2cap_coc_send_le_flow_control_credit_id, 283, 1 },
+    { sl_bt_evt_l2cap_coc_le_flow_control_credit_id, 284, 2 },
+    { sl_bt_rsp_cte_transmitter_disable_connectionless_cte_id, 286, 1 },
+    { sl_bt_rsp_cte_receiver_enable_connectionless_cte_id, 287, 1 },
+    { sl_bt_evt_cte_receiver_silabs_iq_report_id, 288, 2 },
+    { sl_bt_rsp_gattdb_add_included_service_id, 290, 2 },
+    { sl_bt_rsp_advertiser_set_channel_map_id, 292, 1 },
+    { sl_bt_rsp_connection_open_id, 293, 1 },
+    { sl_bt_rsp_gatt_discover_characteristics_by_uuid_id, 294, 1 },
+    { sl_bt_evt_gatt_characteristic_value_id, 295, 2 },
+    { sl_bt_rsp_gatt_server_send_user_write_response_id, 297, 1 },
+    { sl_bt_evt_gatt_server_execute_write_completed_id, 298, 1 },
+    { sl_bt_rsp_nvm_erase_id, 299, 1 },
+    { sl_bt_rsp_sm_increase_security_id, 300, 1 },
+    { sl_bt_evt_sm_bonding_failed_id, 301, 1 },
+    { sl_bt_rsp_ota_set_rf_path_id, 302, 1 },
+    { sl_bt_rsp_l2cap_coc_send_disconnection_request_id, 303, 1 },
+    { sl_bt_evt_l2cap_coc_channel_disconnected_id, 304, 2 },
+    { sl_bt_rsp_cte_transmitter_set_dtm_parameters_id, 306, 1 },
+    { sl_bt_rsp_cte_receiver_disable_connectionless_cte_id, 307, 1 },
+    { sl_bt_rsp_gattdb_remove_included_service_id, 308, 1 },
+    { sl_bt_evt_system_hardware_error_id, 309, 1 },
+    { sl_bt_rsp_advertiser_set_report_scan_request_id, 310, 1 },
+    { sl_bt_rsp_scanner_stop_id, 311, 1 },
+    { sl_bt_rsp_connection_close_id, 312, 1 },
+    { sl_bt_evt_connection_get_remote_tx_power_completed_id, 313, 1 },
+    { sl_bt_rsp_gatt_set_characteristic_notification_id, 314, 1 },
+    { sl_bt_evt_gatt_descriptor_value_id, 315, 2 },
+    { sl_bt_rsp_gatt_server_send_characteristic_notification_id, 317, 2 },
+    { sl_bt_rsp_l2cap_coc_send_data_id, 319, 1 },
+    { sl_bt_evt_l2cap_coc_data_id, 320, 1 },
+    { sl_bt_rsp_cte_transmitter_clear_dtm_parameters_id, 321, 1 },
+    { sl_bt_rsp_cte_receiver_set_dtm_parameters_id, 322, 1 },
+    { sl_bt_rsp_gattdb_add_uuid16_characteristic_id, 323, 2 },
+    { sl_bt_evt_system_error_id, 325, 1 },
+    { sl_bt_rsp_advertiser_set_phy_id, 326, 1 },
+    { sl_bt_rsp_connection_set_parameters_id, 327, 1 },
+    { sl_bt_rsp_gatt_discover_descriptors_id, 328, 1 },
+    { sl_bt_evt_gatt_procedure_completed_id, 329, 1 },
+    { sl_bt_rsp_gatt_server_find_attribute_id, 330, 2 },
+    { sl_bt_rsp_sm_delete_bonding_id, 332, 1 },
+    { sl_bt_evt_l2cap_command_rejected_id, 333, 1 },
+    { sl_bt_rsp_cte_transmitter_enable_silabs_cte_id, 334, 1 },
+    { sl_bt_rsp_cte_receiver_clear_dtm_parameters_id, 335, 1 },
+    { sl_bt_rsp_gattdb_add_uuid128_characteristic_id, 336, 2 },
+    { sl_bt_rsp_advertiser_set_configuration_id, 338, 1 },
+    { sl_bt_rsp_connection_read_channel_map_id, 339, 1 },
+    { sl_bt_rsp_gatt_read_characteristic_value_id, 340, 1 },
+    { sl_bt_rsp_sm_delete_bondings_id, 341, 1 },
+    { sl_bt_rsp_cte_transmitter_disable_silabs_cte_id, 342, 1 },
+    { sl_bt_rsp_cte_receiver_enable_silabs_cte_id, 343, 1 },
+    { sl_bt_rsp_gattdb_remove_characteristic_id, 344, 1 },
+    { sl_bt_rsp_advertiser_clear_configuration_id, 345, 1 },
+    { sl_bt_rsp_connection_set_preferred_phy_id, 346, 1 },
+    { sl_bt_rsp_gatt_read_characteristic_value_by_uuid_id, 347, 1 },
+    { sl_bt_rsp_gatt_server_set_capabilities_id, 348, 1 },
+    { sl_bt_rsp_sm_enter_passkey_id, 349, 1 },
+    { sl_bt_rsp_cte_receiver_disable_silabs_cte_id, 350, 1 },
+    { sl_bt_rsp_gattdb_add_uuid16_descriptor_id, 351, 2 },
+    { sl_bt_rsp_advertiser_start_id, 353, 1 },
+    { sl_bt_rsp_connection_set_power_reporting_id, 354, 1 },
+    { sl_bt_rsp_gatt_write_characteristic_value_id, 355, 1 },
+    { sl_bt_rsp_sm_passkey_confirm_id, 356, 1 },
+    { sl_bt_rsp_cte_receiver_set_sync_cte_type_id, 357, 1 },
+    { sl_bt_rsp_gattdb_add_uuid128_descriptor_id, 358, 2 },
+    { sl_bt_rsp_advertiser_stop_id, 360, 1 },
+    { sl_bt_rsp_connection_set_remote_power_reporting_id, 361, 1 },
+    { sl_bt_rsp_gatt_write_characteristic_value_without_response_id, 362, 2 },
+    { sl_bt_rsp_gatt_server_set_max_mtu_id, 364, 2 },
+    { sl_bt_rsp_sm_set_oob_data_id, 366, 1 },
+    { sl_bt_rsp_gattdb_remove_descriptor_id, 367, 1 },
+    { sl_bt_rsp_system_get_random_data_id, 368, 1 },
+    { sl_bt_rsp_advertiser_set_tx_power_id, 369, 2 },
+    { sl_bt_rsp_connection_get_tx_power_id, 371, 1 },
+    { sl_bt_rsp_gatt_prepare_characteristic_value_write_id, 372, 2 },
+    { sl_bt_rsp_gatt_server_get_mtu_id, 374, 2 },
+    { sl_bt_rsp_sm_list_all_bondings_id, 376, 1 },
+    { sl_bt_rsp_gattdb_start_service_id, 377, 1 },
+    { sl_bt_rsp_system_halt_id, 378, 1 },
+    { sl_bt_rsp_advertiser_start_periodic_advertising_id, 379, 1 },
+    { sl_bt_rsp_connection_get_remote_tx_power_id, 380, 1 },
+    { sl_bt_rsp_gatt_execute_characteristic_value_write_id, 381, 1 },
+    { sl_bt_rsp_gatt_server_enable_capabilities_id, 382, 1 },
+    { sl_bt_rsp_gattdb_stop_service_id, 383, 1 },
+    { sl_bt_rsp_advertiser_stop_periodic_advertising_id, 384, 1 },
+    { sl_bt_rsp_connection_read_remote_used_features_id, 385, 1 },
+    { sl_bt_rsp_gatt_send_characteristic_confirmation_id, 386, 1 },
+    { sl_bt_rsp_gatt_server_disable_capabilities_id, 387, 1 },
+    { sl_bt_rsp_gattdb_start_characteristic_id, 388, 1 },
+    { sl_bt_rsp_system_linklayer_configure_id, 389, 1 },
+    { sl_bt_rsp_advertiser_set_long_data_id, 390, 1 },
+    { sl_bt_rsp_gatt_read_descriptor_value_id, 391, 1 },
+    { sl_bt_rsp_gatt_server_get_enabled_capabilities_id, 392, 2 },
+    { sl_bt_rsp_sm_bonding_confirm_id, 394, 1 },
+    { sl_bt_rsp_gattdb_stop_characteristic_id, 395, 1 },
+    { sl_bt_rsp_system_get_counters_id, 396, 5 },
+    { sl_bt_rsp_advertiser_set_data_id, 401, 1 },
+    { sl_bt_rsp_gatt_write_descriptor_value_id, 402, 1 },
+    { sl_bt_rsp_gatt_server_send_notification_id, 403, 1 },
+    { sl_bt_rsp_sm_set_debug_mode_id, 404, 1 },
+    { sl_bt_rsp_gattdb_commit_id, 405, 1 },
+    { sl_bt_rsp_advertiser_set_random_address_id, 406, 1 },
+    { sl_bt_rsp_gatt_find_included_services_id, 407, 1 },
+    { sl_bt_rsp_gatt_server_send_indication_id, 408, 1 },
+    { sl_bt_rsp_sm_set_passkey_id, 409, 1 },
+    { sl_bt_rsp_gattdb_abort_id, 410, 1 },
+    { sl_bt_rsp_advertiser_clear_random_address_id, 411, 1 },
+    { sl_bt_rsp_gatt_read_multiple_characteristic_values_id, 412, 1 },
+    { sl_bt_rsp_gatt_server_notify_all_id, 413, 1 },
+    { sl_bt_rsp_sm_use_sc_oob_id, 414, 1 },
+    { sl_bt_rsp_system_data_buffer_write_id, 415, 1 },
+    { sl_bt_rsp_gatt_read_characteristic_value_from_offset_id, 416, 1 },
+    { sl_bt_rsp_gatt_server_read_client_configuration_id, 417, 2 },
+    { sl_bt_rsp_sm_set_sc_remote_oob_data_id, 419, 1 },
+    { sl_bt_rsp_system_set_identity_address_id, 420, 1 },
+    { sl_bt_rsp_gatt_prepare_characteristic_value_reliable_write_id, 421, 2 },
+    { sl_bt_rsp_sm_add_to_whitelist_id, 423, 1 },
+    { sl_bt_rsp_system_data_buffer_clear_id, 424, 1 },
+    { sl_bt_rsp_gatt_server_send_user_prepare_write_response_id, 425, 1 },
+    { sl_bt_rsp_sm_set_minimum_key_size_id, 426, 1 },
+    { sl_bt_rsp_system_get_identity_address_id, 427, 1 },
+    { sl_bt_rsp_gatt_server_read_client_supported_features_id, 428, 1 },
+    { sl_bt_rsp_sm_get_bonding_handles_id, 429, 2 },
+    { sl_bt_rsp_system_set_max_tx_power_id, 431, 2 },
+    { sl_bt_rsp_sm_get_bonding_details_id, 433, 1 },
+    { sl_bt_rsp_system_set_tx_power_id, 434, 3 },
+    { sl_bt_rsp_sm_find_bonding_by_address_id, 437, 2 },
+    { sl_bt_rsp_system_get_tx_power_setting_id, 439, 6 },
+    { sl_bt_rsp_sm_set_bonding_key_id, 445, 1 },
+    { sl_bt_rsp_system_set_soft_timer_id, 446, 1 },
+    { sl_bt_rsp_sm_set_legacy_oob_id, 447, 1 },
+    { sl_bt_rsp_system_set_lazy_soft_timer_id, 448, 1 },
+    { sl_bt_rsp_sm_set_oob_id, 449, 1 },
+    { sl_bt_rsp_system_get_version_id, 450, 7 },
+    { sl_bt_rsp_sm_set_remote_oob_id, 457, 1 },
+    { sl_bt_rsp_system_start_bluetooth_id, 458, 1 },
+    { sl_bt_rsp_system_stop_bluetooth_id, 459, 1 },
+};
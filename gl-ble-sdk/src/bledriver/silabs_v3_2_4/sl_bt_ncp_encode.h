@@ -0,0 +1,1327 @@
+/* Generated by tools/cmdgen/cmdgen.py from sl_bt_api.h and sli_bt_api.h, do not edit. */
+
+#ifndef SL_BT_NCP_ENCODE_H
+#define SL_BT_NCP_ENCODE_H
+
+#include "sli_bt_api.h"
+#include "silabs_msg.h"
+
+static inline void sl_bt_encode_dfu_reset(struct sl_bt_packet *cmd, uint8_t dfu)
+{
+    cmd->data.cmd_dfu_reset.dfu = dfu;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_dfu_reset_id, sizeof(sl_bt_cmd_dfu_reset_t));
+}
+
+static inline void sl_bt_encode_system_hello(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_hello_id, 0);
+}
+
+static inline void sl_bt_encode_connection_set_default_parameters(struct sl_bt_packet *cmd, uint16_t min_interval, uint16_t max_interval, uint16_t latency, uint16_t timeout, uint16_t min_ce_length, uint16_t max_ce_length)
+{
+    cmd->data.cmd_connection_set_default_parameters.min_interval = min_interval;
+    cmd->data.cmd_connection_set_default_parameters.max_interval = max_interval;
+    cmd->data.cmd_connection_set_default_parameters.latency = latency;
+    cmd->data.cmd_connection_set_default_parameters.timeout = timeout;
+    cmd->data.cmd_connection_set_default_parameters.min_ce_length = min_ce_length;
+    cmd->data.cmd_connection_set_default_parameters.max_ce_length = max_ce_length;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_connection_set_default_parameters_id, sizeof(sl_bt_cmd_connection_set_default_parameters_t));
+}
+
+static inline void sl_bt_encode_gatt_set_max_mtu(struct sl_bt_packet *cmd, uint16_t max_mtu)
+{
+    cmd->data.cmd_gatt_set_max_mtu.max_mtu = max_mtu;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_set_max_mtu_id, sizeof(sl_bt_cmd_gatt_set_max_mtu_t));
+}
+
+static inline void sl_bt_encode_gatt_server_read_attribute_value(struct sl_bt_packet *cmd, uint16_t attribute, uint16_t offset)
+{
+    cmd->data.cmd_gatt_server_read_attribute_value.attribute = attribute;
+    cmd->data.cmd_gatt_server_read_attribute_value.offset = offset;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_read_attribute_value_id, sizeof(sl_bt_cmd_gatt_server_read_attribute_value_t));
+}
+
+static inline void sl_bt_encode_test_dtm_tx(struct sl_bt_packet *cmd, uint8_t packet_type, uint8_t length, uint8_t channel, uint8_t phy)
+{
+    cmd->data.cmd_test_dtm_tx.packet_type = packet_type;
+    cmd->data.cmd_test_dtm_tx.length = length;
+    cmd->data.cmd_test_dtm_tx.channel = channel;
+    cmd->data.cmd_test_dtm_tx.phy = phy;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_test_dtm_tx_id, sizeof(sl_bt_cmd_test_dtm_tx_t));
+}
+
+static inline void sl_bt_encode_sm_set_bondable_mode(struct sl_bt_packet *cmd, uint8_t bondable)
+{
+    cmd->data.cmd_sm_set_bondable_mode.bondable = bondable;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_set_bondable_mode_id, sizeof(sl_bt_cmd_sm_set_bondable_mode_t));
+}
+
+static inline void sl_bt_encode_coex_set_options(struct sl_bt_packet *cmd, uint32_t mask, uint32_t options)
+{
+    cmd->data.cmd_coex_set_options.mask = mask;
+    cmd->data.cmd_coex_set_options.options = options;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_coex_set_options_id, sizeof(sl_bt_cmd_coex_set_options_t));
+}
+
+static inline void sl_bt_encode_sync_open(struct sl_bt_packet *cmd, bd_addr address, uint8_t address_type, uint8_t adv_sid)
+{
+    cmd->data.cmd_sync_open.address = address;
+    cmd->data.cmd_sync_open.address_type = address_type;
+    cmd->data.cmd_sync_open.adv_sid = adv_sid;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sync_open_id, sizeof(sl_bt_cmd_sync_open_t));
+}
+
+static inline void sl_bt_encode_cte_transmitter_enable_connection_cte(struct sl_bt_packet *cmd, uint8_t connection, uint8_t cte_types, size_t switching_pattern_len)
+{
+    cmd->data.cmd_cte_transmitter_enable_connection_cte.connection = connection;
+    cmd->data.cmd_cte_transmitter_enable_connection_cte.cte_types = cte_types;
+    cmd->data.cmd_cte_transmitter_enable_connection_cte.switching_pattern.len = (uint8_t)switching_pattern_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_transmitter_enable_connection_cte_id, sizeof(sl_bt_cmd_cte_transmitter_enable_connection_cte_t) + switching_pattern_len);
+}
+
+static inline void sl_bt_encode_cte_receiver_configure(struct sl_bt_packet *cmd, uint8_t flags)
+{
+    cmd->data.cmd_cte_receiver_configure.flags = flags;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_receiver_configure_id, sizeof(sl_bt_cmd_cte_receiver_configure_t));
+}
+
+static inline void sl_bt_encode_gattdb_new_session(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_new_session_id, 0);
+}
+
+static inline void sl_bt_encode_memory_profiler_get_status(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_memory_profiler_get_status_id, 0);
+}
+
+static inline void sl_bt_encode_user_message_to_target(struct sl_bt_packet *cmd, size_t data_len)
+{
+    cmd->data.cmd_user_message_to_target.data.len = (uint8_t)data_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_user_message_to_target_id, sizeof(sl_bt_cmd_user_message_to_target_t) + data_len);
+}
+
+static inline void sl_bt_encode_dfu_flash_set_address(struct sl_bt_packet *cmd, uint32_t address)
+{
+    cmd->data.cmd_dfu_flash_set_address.address = address;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_dfu_flash_set_address_id, sizeof(sl_bt_cmd_dfu_flash_set_address_t));
+}
+
+static inline void sl_bt_encode_system_reset(struct sl_bt_packet *cmd, uint8_t dfu)
+{
+    cmd->data.cmd_system_reset.dfu = dfu;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_reset_id, sizeof(sl_bt_cmd_system_reset_t));
+}
+
+static inline void sl_bt_encode_gap_set_privacy_mode(struct sl_bt_packet *cmd, uint8_t privacy, uint8_t interval)
+{
+    cmd->data.cmd_gap_set_privacy_mode.privacy = privacy;
+    cmd->data.cmd_gap_set_privacy_mode.interval = interval;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gap_set_privacy_mode_id, sizeof(sl_bt_cmd_gap_set_privacy_mode_t));
+}
+
+static inline void sl_bt_encode_advertiser_create_set(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_create_set_id, 0);
+}
+
+static inline void sl_bt_encode_scanner_set_timing(struct sl_bt_packet *cmd, uint8_t phys, uint16_t scan_interval, uint16_t scan_window)
+{
+    cmd->data.cmd_scanner_set_timing.phys = phys;
+    cmd->data.cmd_scanner_set_timing.scan_interval = scan_interval;
+    cmd->data.cmd_scanner_set_timing.scan_window = scan_window;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_scanner_set_timing_id, sizeof(sl_bt_cmd_scanner_set_timing_t));
+}
+
+static inline void sl_bt_encode_connection_set_default_preferred_phy(struct sl_bt_packet *cmd, uint8_t preferred_phy, uint8_t accepted_phy)
+{
+    cmd->data.cmd_connection_set_default_preferred_phy.preferred_phy = preferred_phy;
+    cmd->data.cmd_connection_set_default_preferred_phy.accepted_phy = accepted_phy;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_connection_set_default_preferred_phy_id, sizeof(sl_bt_cmd_connection_set_default_preferred_phy_t));
+}
+
+static inline void sl_bt_encode_gatt_discover_primary_services(struct sl_bt_packet *cmd, uint8_t connection)
+{
+    cmd->data.cmd_gatt_discover_primary_services.connection = connection;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_discover_primary_services_id, sizeof(sl_bt_cmd_gatt_discover_primary_services_t));
+}
+
+static inline void sl_bt_encode_gatt_server_read_attribute_type(struct sl_bt_packet *cmd, uint16_t attribute)
+{
+    cmd->data.cmd_gatt_server_read_attribute_type.attribute = attribute;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_read_attribute_type_id, sizeof(sl_bt_cmd_gatt_server_read_attribute_type_t));
+}
+
+static inline void sl_bt_encode_nvm_erase_all(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_nvm_erase_all_id, 0);
+}
+
+static inline void sl_bt_encode_test_dtm_rx(struct sl_bt_packet *cmd, uint8_t channel, uint8_t phy)
+{
+    cmd->data.cmd_test_dtm_rx.channel = channel;
+    cmd->data.cmd_test_dtm_rx.phy = phy;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_test_dtm_rx_id, sizeof(sl_bt_cmd_test_dtm_rx_t));
+}
+
+static inline void sl_bt_encode_sm_configure(struct sl_bt_packet *cmd, uint8_t flags, uint8_t io_capabilities)
+{
+    cmd->data.cmd_sm_configure.flags = flags;
+    cmd->data.cmd_sm_configure.io_capabilities = io_capabilities;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_configure_id, sizeof(sl_bt_cmd_sm_configure_t));
+}
+
+static inline void sl_bt_encode_ota_set_device_name(struct sl_bt_packet *cmd, size_t name_len)
+{
+    cmd->data.cmd_ota_set_device_name.name.len = (uint8_t)name_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_ota_set_device_name_id, sizeof(sl_bt_cmd_ota_set_device_name_t) + name_len);
+}
+
+static inline void sl_bt_encode_coex_get_counters(struct sl_bt_packet *cmd, uint8_t reset)
+{
+    cmd->data.cmd_coex_get_counters.reset = reset;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_coex_get_counters_id, sizeof(sl_bt_cmd_coex_get_counters_t));
+}
+
+static inline void sl_bt_encode_sync_close(struct sl_bt_packet *cmd, uint16_t sync)
+{
+    cmd->data.cmd_sync_close.sync = sync;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sync_close_id, sizeof(sl_bt_cmd_sync_close_t));
+}
+
+static inline void sl_bt_encode_l2cap_coc_send_connection_request(struct sl_bt_packet *cmd, uint8_t connection, uint16_t le_psm, uint16_t mtu, uint16_t mps, uint16_t initial_credit)
+{
+    cmd->data.cmd_l2cap_coc_send_connection_request.connection = connection;
+    cmd->data.cmd_l2cap_coc_send_connection_request.le_psm = le_psm;
+    cmd->data.cmd_l2cap_coc_send_connection_request.mtu = mtu;
+    cmd->data.cmd_l2cap_coc_send_connection_request.mps = mps;
+    cmd->data.cmd_l2cap_coc_send_connection_request.initial_credit = initial_credit;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_l2cap_coc_send_connection_request_id, sizeof(sl_bt_cmd_l2cap_coc_send_connection_request_t));
+}
+
+static inline void sl_bt_encode_cte_transmitter_disable_connection_cte(struct sl_bt_packet *cmd, uint8_t connection)
+{
+    cmd->data.cmd_cte_transmitter_disable_connection_cte.connection = connection;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_transmitter_disable_connection_cte_id, sizeof(sl_bt_cmd_cte_transmitter_disable_connection_cte_t));
+}
+
+static inline void sl_bt_encode_cte_receiver_enable_connection_cte(struct sl_bt_packet *cmd, uint8_t connection, uint16_t interval, uint8_t cte_length, uint8_t cte_type, uint8_t slot_durations, size_t switching_pattern_len)
+{
+    cmd->data.cmd_cte_receiver_enable_connection_cte.connection = connection;
+    cmd->data.cmd_cte_receiver_enable_connection_cte.interval = interval;
+    cmd->data.cmd_cte_receiver_enable_connection_cte.cte_length = cte_length;
+    cmd->data.cmd_cte_receiver_enable_connection_cte.cte_type = cte_type;
+    cmd->data.cmd_cte_receiver_enable_connection_cte.slot_durations = slot_durations;
+    cmd->data.cmd_cte_receiver_enable_connection_cte.switching_pattern.len = (uint8_t)switching_pattern_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_receiver_enable_connection_cte_id, sizeof(sl_bt_cmd_cte_receiver_enable_connection_cte_t) + switching_pattern_len);
+}
+
+static inline void sl_bt_encode_gattdb_add_service(struct sl_bt_packet *cmd, uint16_t session, uint8_t type, uint8_t property, size_t uuid_len)
+{
+    cmd->data.cmd_gattdb_add_service.session = session;
+    cmd->data.cmd_gattdb_add_service.type = type;
+    cmd->data.cmd_gattdb_add_service.property = property;
+    cmd->data.cmd_gattdb_add_service.uuid.len = (uint8_t)uuid_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_add_service_id, sizeof(sl_bt_cmd_gattdb_add_service_t) + uuid_len);
+}
+
+static inline void sl_bt_encode_memory_profiler_reset(struct sl_bt_packet *cmd, uint32_t flags)
+{
+    cmd->data.cmd_memory_profiler_reset.flags = flags;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_memory_profiler_reset_id, sizeof(sl_bt_cmd_memory_profiler_reset_t));
+}
+
+static inline void sl_bt_encode_user_manage_event_filter(struct sl_bt_packet *cmd, size_t data_len)
+{
+    cmd->data.cmd_user_manage_event_filter.data.len = (uint8_t)data_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_user_manage_event_filter_id, sizeof(sl_bt_cmd_user_manage_event_filter_t) + data_len);
+}
+
+static inline void sl_bt_encode_dfu_flash_upload(struct sl_bt_packet *cmd, size_t data_len)
+{
+    cmd->data.cmd_dfu_flash_upload.data.len = (uint8_t)data_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_dfu_flash_upload_id, sizeof(sl_bt_cmd_dfu_flash_upload_t) + data_len);
+}
+
+static inline void sl_bt_encode_gap_set_data_channel_classification(struct sl_bt_packet *cmd, size_t channel_map_len)
+{
+    cmd->data.cmd_gap_set_data_channel_classification.channel_map.len = (uint8_t)channel_map_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gap_set_data_channel_classification_id, sizeof(sl_bt_cmd_gap_set_data_channel_classification_t) + channel_map_len);
+}
+
+static inline void sl_bt_encode_advertiser_delete_set(struct sl_bt_packet *cmd, uint8_t handle)
+{
+    cmd->data.cmd_advertiser_delete_set.handle = handle;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_delete_set_id, sizeof(sl_bt_cmd_advertiser_delete_set_t));
+}
+
+static inline void sl_bt_encode_scanner_set_mode(struct sl_bt_packet *cmd, uint8_t phys, uint8_t scan_mode)
+{
+    cmd->data.cmd_scanner_set_mode.phys = phys;
+    cmd->data.cmd_scanner_set_mode.scan_mode = scan_mode;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_scanner_set_mode_id, sizeof(sl_bt_cmd_scanner_set_mode_t));
+}
+
+static inline void sl_bt_encode_connection_get_rssi(struct sl_bt_packet *cmd, uint8_t connection)
+{
+    cmd->data.cmd_connection_get_rssi.connection = connection;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_connection_get_rssi_id, sizeof(sl_bt_cmd_connection_get_rssi_t));
+}
+
+static inline void sl_bt_encode_gatt_discover_primary_services_by_uuid(struct sl_bt_packet *cmd, uint8_t connection, size_t uuid_len)
+{
+    cmd->data.cmd_gatt_discover_primary_services_by_uuid.connection = connection;
+    cmd->data.cmd_gatt_discover_primary_services_by_uuid.uuid.len = (uint8_t)uuid_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_discover_primary_services_by_uuid_id, sizeof(sl_bt_cmd_gatt_discover_primary_services_by_uuid_t) + uuid_len);
+}
+
+static inline void sl_bt_encode_gatt_server_write_attribute_value(struct sl_bt_packet *cmd, uint16_t attribute, uint16_t offset, size_t value_len)
+{
+    cmd->data.cmd_gatt_server_write_attribute_value.attribute = attribute;
+    cmd->data.cmd_gatt_server_write_attribute_value.offset = offset;
+    cmd->data.cmd_gatt_server_write_attribute_value.value.len = (uint8_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_write_attribute_value_id, sizeof(sl_bt_cmd_gatt_server_write_attribute_value_t) + value_len);
+}
+
+static inline void sl_bt_encode_nvm_save(struct sl_bt_packet *cmd, uint16_t key, size_t value_len)
+{
+    cmd->data.cmd_nvm_save.key = key;
+    cmd->data.cmd_nvm_save.value.len = (uint8_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_nvm_save_id, sizeof(sl_bt_cmd_nvm_save_t) + value_len);
+}
+
+static inline void sl_bt_encode_test_dtm_end(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_test_dtm_end_id, 0);
+}
+
+static inline void sl_bt_encode_sm_store_bonding_configuration(struct sl_bt_packet *cmd, uint8_t max_bonding_count, uint8_t policy_flags)
+{
+    cmd->data.cmd_sm_store_bonding_configuration.max_bonding_count = max_bonding_count;
+    cmd->data.cmd_sm_store_bonding_configuration.policy_flags = policy_flags;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_store_bonding_configuration_id, sizeof(sl_bt_cmd_sm_store_bonding_configuration_t));
+}
+
+static inline void sl_bt_encode_ota_set_advertising_data(struct sl_bt_packet *cmd, uint8_t packet_type, size_t adv_data_len)
+{
+    cmd->data.cmd_ota_set_advertising_data.packet_type = packet_type;
+    cmd->data.cmd_ota_set_advertising_data.adv_data.len = (uint8_t)adv_data_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_ota_set_advertising_data_id, sizeof(sl_bt_cmd_ota_set_advertising_data_t) + adv_data_len);
+}
+
+static inline void sl_bt_encode_coex_set_parameters(struct sl_bt_packet *cmd, uint8_t priority, uint8_t request, uint8_t pwm_period, uint8_t pwm_dutycycle)
+{
+    cmd->data.cmd_coex_set_parameters.priority = priority;
+    cmd->data.cmd_coex_set_parameters.request = request;
+    cmd->data.cmd_coex_set_parameters.pwm_period = pwm_period;
+    cmd->data.cmd_coex_set_parameters.pwm_dutycycle = pwm_dutycycle;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_coex_set_parameters_id, sizeof(sl_bt_cmd_coex_set_parameters_t));
+}
+
+static inline void sl_bt_encode_sync_set_parameters(struct sl_bt_packet *cmd, uint16_t skip, uint16_t timeout, uint32_t flags)
+{
+    cmd->data.cmd_sync_set_parameters.skip = skip;
+    cmd->data.cmd_sync_set_parameters.timeout = timeout;
+    cmd->data.cmd_sync_set_parameters.flags = flags;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sync_set_parameters_id, sizeof(sl_bt_cmd_sync_set_parameters_t));
+}
+
+static inline void sl_bt_encode_l2cap_coc_send_connection_response(struct sl_bt_packet *cmd, uint8_t connection, uint16_t cid, uint16_t mtu, uint16_t mps, uint16_t initial_credit, uint16_t l2cap_errorcode)
+{
+    cmd->data.cmd_l2cap_coc_send_connection_response.connection = connection;
+    cmd->data.cmd_l2cap_coc_send_connection_response.cid = cid;
+    cmd->data.cmd_l2cap_coc_send_connection_response.mtu = mtu;
+    cmd->data.cmd_l2cap_coc_send_connection_response.mps = mps;
+    cmd->data.cmd_l2cap_coc_send_connection_response.initial_credit = initial_credit;
+    cmd->data.cmd_l2cap_coc_send_connection_response.l2cap_errorcode = l2cap_errorcode;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_l2cap_coc_send_connection_response_id, sizeof(sl_bt_cmd_l2cap_coc_send_connection_response_t));
+}
+
+static inline void sl_bt_encode_cte_transmitter_enable_connectionless_cte(struct sl_bt_packet *cmd, uint8_t handle, uint8_t cte_length, uint8_t cte_type, uint8_t cte_count, size_t switching_pattern_len)
+{
+    cmd->data.cmd_cte_transmitter_enable_connectionless_cte.handle = handle;
+    cmd->data.cmd_cte_transmitter_enable_connectionless_cte.cte_length = cte_length;
+    cmd->data.cmd_cte_transmitter_enable_connectionless_cte.cte_type = cte_type;
+    cmd->data.cmd_cte_transmitter_enable_connectionless_cte.cte_count = cte_count;
+    cmd->data.cmd_cte_transmitter_enable_connectionless_cte.switching_pattern.len = (uint8_t)switching_pattern_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_transmitter_enable_connectionless_cte_id, sizeof(sl_bt_cmd_cte_transmitter_enable_connectionless_cte_t) + switching_pattern_len);
+}
+
+static inline void sl_bt_encode_cte_receiver_disable_connection_cte(struct sl_bt_packet *cmd, uint8_t connection)
+{
+    cmd->data.cmd_cte_receiver_disable_connection_cte.connection = connection;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_receiver_disable_connection_cte_id, sizeof(sl_bt_cmd_cte_receiver_disable_connection_cte_t));
+}
+
+static inline void sl_bt_encode_gattdb_remove_service(struct sl_bt_packet *cmd, uint16_t session, uint16_t service)
+{
+    cmd->data.cmd_gattdb_remove_service.session = session;
+    cmd->data.cmd_gattdb_remove_service.service = service;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_remove_service_id, sizeof(sl_bt_cmd_gattdb_remove_service_t));
+}
+
+static inline void sl_bt_encode_memory_profiler_list_ram_usage(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_memory_profiler_list_ram_usage_id, 0);
+}
+
+static inline void sl_bt_encode_dfu_flash_upload_finish(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_dfu_flash_upload_finish_id, 0);
+}
+
+static inline void sl_bt_encode_gap_enable_whitelisting(struct sl_bt_packet *cmd, uint8_t enable)
+{
+    cmd->data.cmd_gap_enable_whitelisting.enable = enable;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gap_enable_whitelisting_id, sizeof(sl_bt_cmd_gap_enable_whitelisting_t));
+}
+
+static inline void sl_bt_encode_advertiser_set_timing(struct sl_bt_packet *cmd, uint8_t handle, uint32_t interval_min, uint32_t interval_max, uint16_t duration, uint8_t maxevents)
+{
+    cmd->data.cmd_advertiser_set_timing.handle = handle;
+    cmd->data.cmd_advertiser_set_timing.interval_min = interval_min;
+    cmd->data.cmd_advertiser_set_timing.interval_max = interval_max;
+    cmd->data.cmd_advertiser_set_timing.duration = duration;
+    cmd->data.cmd_advertiser_set_timing.maxevents = maxevents;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_set_timing_id, sizeof(sl_bt_cmd_advertiser_set_timing_t));
+}
+
+static inline void sl_bt_encode_scanner_start(struct sl_bt_packet *cmd, uint8_t scanning_phy, uint8_t discover_mode)
+{
+    cmd->data.cmd_scanner_start.scanning_phy = scanning_phy;
+    cmd->data.cmd_scanner_start.discover_mode = discover_mode;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_scanner_start_id, sizeof(sl_bt_cmd_scanner_start_t));
+}
+
+static inline void sl_bt_encode_connection_disable_slave_latency(struct sl_bt_packet *cmd, uint8_t connection, uint8_t disable)
+{
+    cmd->data.cmd_connection_disable_slave_latency.connection = connection;
+    cmd->data.cmd_connection_disable_slave_latency.disable = disable;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_connection_disable_slave_latency_id, sizeof(sl_bt_cmd_connection_disable_slave_latency_t));
+}
+
+static inline void sl_bt_encode_gatt_discover_characteristics(struct sl_bt_packet *cmd, uint8_t connection, uint32_t service)
+{
+    cmd->data.cmd_gatt_discover_characteristics.connection = connection;
+    cmd->data.cmd_gatt_discover_characteristics.service = service;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_discover_characteristics_id, sizeof(sl_bt_cmd_gatt_discover_characteristics_t));
+}
+
+static inline void sl_bt_encode_gatt_server_send_user_read_response(struct sl_bt_packet *cmd, uint8_t connection, uint16_t characteristic, uint8_t att_errorcode, size_t value_len)
+{
+    cmd->data.cmd_gatt_server_send_user_read_response.connection = connection;
+    cmd->data.cmd_gatt_server_send_user_read_response.characteristic = characteristic;
+    cmd->data.cmd_gatt_server_send_user_read_response.att_errorcode = att_errorcode;
+    cmd->data.cmd_gatt_server_send_user_read_response.value.len = (uint8_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_send_user_read_response_id, sizeof(sl_bt_cmd_gatt_server_send_user_read_response_t) + value_len);
+}
+
+static inline void sl_bt_encode_nvm_load(struct sl_bt_packet *cmd, uint16_t key)
+{
+    cmd->data.cmd_nvm_load.key = key;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_nvm_load_id, sizeof(sl_bt_cmd_nvm_load_t));
+}
+
+static inline void sl_bt_encode_test_dtm_tx_v4(struct sl_bt_packet *cmd, uint8_t packet_type, uint8_t length, uint8_t channel, uint8_t phy, int8_t power_level)
+{
+    cmd->data.cmd_test_dtm_tx_v4.packet_type = packet_type;
+    cmd->data.cmd_test_dtm_tx_v4.length = length;
+    cmd->data.cmd_test_dtm_tx_v4.channel = channel;
+    cmd->data.cmd_test_dtm_tx_v4.phy = phy;
+    cmd->data.cmd_test_dtm_tx_v4.power_level = power_level;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_test_dtm_tx_v4_id, sizeof(sl_bt_cmd_test_dtm_tx_v4_t));
+}
+
+static inline void sl_bt_encode_ota_set_configuration(struct sl_bt_packet *cmd, uint32_t flags)
+{
+    cmd->data.cmd_ota_set_configuration.flags = flags;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_ota_set_configuration_id, sizeof(sl_bt_cmd_ota_set_configuration_t));
+}
+
+static inline void sl_bt_encode_coex_set_directional_priority_pulse(struct sl_bt_packet *cmd, uint8_t pulse)
+{
+    cmd->data.cmd_coex_set_directional_priority_pulse.pulse = pulse;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_coex_set_directional_priority_pulse_id, sizeof(sl_bt_cmd_coex_set_directional_priority_pulse_t));
+}
+
+static inline void sl_bt_encode_l2cap_coc_send_le_flow_control_credit(struct sl_bt_packet *cmd, uint8_t connection, uint16_t cid, uint16_t credits)
+{
+    cmd->data.cmd_l2cap_coc_send_le_flow_control_credit.connection = connection;
+    cmd->data.cmd_l2cap_coc_send_le_flow_control_credit.cid = cid;
+    cmd->data.cmd_l2cap_coc_send_le_flow_control_credit.credits = credits;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_l2cap_coc_send_le_flow_control_credit_id, sizeof(sl_bt_cmd_l2cap_coc_send_le_flow_control_credit_t));
+}
+
+static inline void sl_bt_encode_cte_transmitter_disable_connectionless_cte(struct sl_bt_packet *cmd, uint8_t handle)
+{
+    cmd->data.cmd_cte_transmitter_disable_connectionless_cte.handle = handle;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_transmitter_disable_connectionless_cte_id, sizeof(sl_bt_cmd_cte_transmitter_disable_connectionless_cte_t));
+}
+
+static inline void sl_bt_encode_cte_receiver_enable_connectionless_cte(struct sl_bt_packet *cmd, uint16_t sync, uint8_t slot_durations, uint8_t cte_count, size_t switching_pattern_len)
+{
+    cmd->data.cmd_cte_receiver_enable_connectionless_cte.sync = sync;
+    cmd->data.cmd_cte_receiver_enable_connectionless_cte.slot_durations = slot_durations;
+    cmd->data.cmd_cte_receiver_enable_connectionless_cte.cte_count = cte_count;
+    cmd->data.cmd_cte_receiver_enable_connectionless_cte.switching_pattern.len = (uint8_t)switching_pattern_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_receiver_enable_connectionless_cte_id, sizeof(sl_bt_cmd_cte_receiver_enable_connectionless_cte_t) + switching_pattern_len);
+}
+
+static inline void sl_bt_encode_gattdb_add_included_service(struct sl_bt_packet *cmd, uint16_t session, uint16_t service, uint16_t included_service)
+{
+    cmd->data.cmd_gattdb_add_included_service.session = session;
+    cmd->data.cmd_gattdb_add_included_service.service = service;
+    cmd->data.cmd_gattdb_add_included_service.included_service = included_service;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_add_included_service_id, sizeof(sl_bt_cmd_gattdb_add_included_service_t));
+}
+
+static inline void sl_bt_encode_advertiser_set_channel_map(struct sl_bt_packet *cmd, uint8_t handle, uint8_t channel_map)
+{
+    cmd->data.cmd_advertiser_set_channel_map.handle = handle;
+    cmd->data.cmd_advertiser_set_channel_map.channel_map = channel_map;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_set_channel_map_id, sizeof(sl_bt_cmd_advertiser_set_channel_map_t));
+}
+
+static inline void sl_bt_encode_connection_open(struct sl_bt_packet *cmd, bd_addr address, uint8_t address_type, uint8_t initiating_phy)
+{
+    cmd->data.cmd_connection_open.address = address;
+    cmd->data.cmd_connection_open.address_type = address_type;
+    cmd->data.cmd_connection_open.initiating_phy = initiating_phy;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_connection_open_id, sizeof(sl_bt_cmd_connection_open_t));
+}
+
+static inline void sl_bt_encode_gatt_discover_characteristics_by_uuid(struct sl_bt_packet *cmd, uint8_t connection, uint32_t service, size_t uuid_len)
+{
+    cmd->data.cmd_gatt_discover_characteristics_by_uuid.connection = connection;
+    cmd->data.cmd_gatt_discover_characteristics_by_uuid.service = service;
+    cmd->data.cmd_gatt_discover_characteristics_by_uuid.uuid.len = (uint8_t)uuid_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_discover_characteristics_by_uuid_id, sizeof(sl_bt_cmd_gatt_discover_characteristics_by_uuid_t) + uuid_len);
+}
+
+static inline void sl_bt_encode_gatt_server_send_user_write_response(struct sl_bt_packet *cmd, uint8_t connection, uint16_t characteristic, uint8_t att_errorcode)
+{
+    cmd->data.cmd_gatt_server_send_user_write_response.connection = connection;
+    cmd->data.cmd_gatt_server_send_user_write_response.characteristic = characteristic;
+    cmd->data.cmd_gatt_server_send_user_write_response.att_errorcode = att_errorcode;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_send_user_write_response_id, sizeof(sl_bt_cmd_gatt_server_send_user_write_response_t));
+}
+
+static inline void sl_bt_encode_nvm_erase(struct sl_bt_packet *cmd, uint16_t key)
+{
+    cmd->data.cmd_nvm_erase.key = key;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_nvm_erase_id, sizeof(sl_bt_cmd_nvm_erase_t));
+}
+
+static inline void sl_bt_encode_sm_increase_security(struct sl_bt_packet *cmd, uint8_t connection)
+{
+    cmd->data.cmd_sm_increase_security.connection = connection;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_increase_security_id, sizeof(sl_bt_cmd_sm_increase_security_t));
+}
+
+static inline void sl_bt_encode_ota_set_rf_path(struct sl_bt_packet *cmd, uint8_t enable, uint8_t antenna)
+{
+    cmd->data.cmd_ota_set_rf_path.enable = enable;
+    cmd->data.cmd_ota_set_rf_path.antenna = antenna;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_ota_set_rf_path_id, sizeof(sl_bt_cmd_ota_set_rf_path_t));
+}
+
+static inline void sl_bt_encode_l2cap_coc_send_disconnection_request(struct sl_bt_packet *cmd, uint8_t connection, uint16_t cid)
+{
+    cmd->data.cmd_l2cap_coc_send_disconnection_request.connection = connection;
+    cmd->data.cmd_l2cap_coc_send_disconnection_request.cid = cid;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_l2cap_coc_send_disconnection_request_id, sizeof(sl_bt_cmd_l2cap_coc_send_disconnection_request_t));
+}
+
+static inline void sl_bt_encode_cte_transmitter_set_dtm_parameters(struct sl_bt_packet *cmd, uint8_t cte_length, uint8_t cte_type, size_t switching_pattern_len)
+{
+    cmd->data.cmd_cte_transmitter_set_dtm_parameters.cte_length = cte_length;
+    cmd->data.cmd_cte_transmitter_set_dtm_parameters.cte_type = cte_type;
+    cmd->data.cmd_cte_transmitter_set_dtm_parameters.switching_pattern.len = (uint8_t)switching_pattern_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_transmitter_set_dtm_parameters_id, sizeof(sl_bt_cmd_cte_transmitter_set_dtm_parameters_t) + switching_pattern_len);
+}
+
+static inline void sl_bt_encode_cte_receiver_disable_connectionless_cte(struct sl_bt_packet *cmd, uint16_t sync)
+{
+    cmd->data.cmd_cte_receiver_disable_connectionless_cte.sync = sync;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_receiver_disable_connectionless_cte_id, sizeof(sl_bt_cmd_cte_receiver_disable_connectionless_cte_t));
+}
+
+static inline void sl_bt_encode_gattdb_remove_included_service(struct sl_bt_packet *cmd, uint16_t session, uint16_t attribute)
+{
+    cmd->data.cmd_gattdb_remove_included_service.session = session;
+    cmd->data.cmd_gattdb_remove_included_service.attribute = attribute;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_remove_included_service_id, sizeof(sl_bt_cmd_gattdb_remove_included_service_t));
+}
+
+static inline void sl_bt_encode_advertiser_set_report_scan_request(struct sl_bt_packet *cmd, uint8_t handle, uint8_t report_scan_req)
+{
+    cmd->data.cmd_advertiser_set_report_scan_request.handle = handle;
+    cmd->data.cmd_advertiser_set_report_scan_request.report_scan_req = report_scan_req;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_set_report_scan_request_id, sizeof(sl_bt_cmd_advertiser_set_report_scan_request_t));
+}
+
+static inline void sl_bt_encode_scanner_stop(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_scanner_stop_id, 0);
+}
+
+static inline void sl_bt_encode_connection_close(struct sl_bt_packet *cmd, uint8_t connection)
+{
+    cmd->data.cmd_connection_close.connection = connection;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_connection_close_id, sizeof(sl_bt_cmd_connection_close_t));
+}
+
+static inline void sl_bt_encode_gatt_set_characteristic_notification(struct sl_bt_packet *cmd, uint8_t connection, uint16_t characteristic, uint8_t flags)
+{
+    cmd->data.cmd_gatt_set_characteristic_notification.connection = connection;
+    cmd->data.cmd_gatt_set_characteristic_notification.characteristic = characteristic;
+    cmd->data.cmd_gatt_set_characteristic_notification.flags = flags;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_set_characteristic_notification_id, sizeof(sl_bt_cmd_gatt_set_characteristic_notification_t));
+}
+
+static inline void sl_bt_encode_gatt_server_send_characteristic_notification(struct sl_bt_packet *cmd, uint8_t connection, uint16_t characteristic, size_t value_len)
+{
+    cmd->data.cmd_gatt_server_send_characteristic_notification.connection = connection;
+    cmd->data.cmd_gatt_server_send_characteristic_notification.characteristic = characteristic;
+    cmd->data.cmd_gatt_server_send_characteristic_notification.value.len = (uint8_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_send_characteristic_notification_id, sizeof(sl_bt_cmd_gatt_server_send_characteristic_notification_t) + value_len);
+}
+
+static inline void sl_bt_encode_l2cap_coc_send_data(struct sl_bt_packet *cmd, uint8_t connection, uint16_t cid, size_t data_len)
+{
+    cmd->data.cmd_l2cap_coc_send_data.connection = connection;
+    cmd->data.cmd_l2cap_coc_send_data.cid = cid;
+    cmd->data.cmd_l2cap_coc_send_data.data.len = (uint8_t)data_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_l2cap_coc_send_data_id, sizeof(sl_bt_cmd_l2cap_coc_send_data_t) + data_len);
+}
+
+static inline void sl_bt_encode_cte_transmitter_clear_dtm_parameters(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_transmitter_clear_dtm_parameters_id, 0);
+}
+
+static inline void sl_bt_encode_cte_receiver_set_dtm_parameters(struct sl_bt_packet *cmd, uint8_t cte_length, uint8_t cte_type, uint8_t slot_durations, size_t switching_pattern_len)
+{
+    cmd->data.cmd_cte_receiver_set_dtm_parameters.cte_length = cte_length;
+    cmd->data.cmd_cte_receiver_set_dtm_parameters.cte_type = cte_type;
+    cmd->data.cmd_cte_receiver_set_dtm_parameters.slot_durations = slot_durations;
+    cmd->data.cmd_cte_receiver_set_dtm_parameters.switching_pattern.len = (uint8_t)switching_pattern_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_receiver_set_dtm_parameters_id, sizeof(sl_bt_cmd_cte_receiver_set_dtm_parameters_t) + switching_pattern_len);
+}
+
+static inline void sl_bt_encode_gattdb_add_uuid16_characteristic(struct sl_bt_packet *cmd, uint16_t session, uint16_t service, uint16_t property, uint16_t security, uint8_t flag, sl_bt_uuid_16_t uuid, uint8_t value_type, uint16_t maxlen, size_t value_len)
+{
+    cmd->data.cmd_gattdb_add_uuid16_characteristic.session = session;
+    cmd->data.cmd_gattdb_add_uuid16_characteristic.service = service;
+    cmd->data.cmd_gattdb_add_uuid16_characteristic.property = property;
+    cmd->data.cmd_gattdb_add_uuid16_characteristic.security = security;
+    cmd->data.cmd_gattdb_add_uuid16_characteristic.flag = flag;
+    cmd->data.cmd_gattdb_add_uuid16_characteristic.uuid = uuid;
+    cmd->data.cmd_gattdb_add_uuid16_characteristic.value_type = value_type;
+    cmd->data.cmd_gattdb_add_uuid16_characteristic.maxlen = maxlen;
+    cmd->data.cmd_gattdb_add_uuid16_characteristic.value.len = (uint16_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_add_uuid16_characteristic_id, sizeof(sl_bt_cmd_gattdb_add_uuid16_characteristic_t) + value_len);
+}
+
+static inline void sl_bt_encode_advertiser_set_phy(struct sl_bt_packet *cmd, uint8_t handle, uint8_t primary_phy, uint8_t secondary_phy)
+{
+    cmd->data.cmd_advertiser_set_phy.handle = handle;
+    cmd->data.cmd_advertiser_set_phy.primary_phy = primary_phy;
+    cmd->data.cmd_advertiser_set_phy.secondary_phy = secondary_phy;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_set_phy_id, sizeof(sl_bt_cmd_advertiser_set_phy_t));
+}
+
+static inline void sl_bt_encode_connection_set_parameters(struct sl_bt_packet *cmd, uint8_t connection, uint16_t min_interval, uint16_t max_interval, uint16_t latency, uint16_t timeout, uint16_t min_ce_length, uint16_t max_ce_length)
+{
+    cmd->data.cmd_connection_set_parameters.connection = connection;
+    cmd->data.cmd_connection_set_parameters.min_interval = min_interval;
+    cmd->data.cmd_connection_set_parameters.max_interval = max_interval;
+    cmd->data.cmd_connection_set_parameters.latency = latency;
+    cmd->data.cmd_connection_set_parameters.timeout = timeout;
+    cmd->data.cmd_connection_set_parameters.min_ce_length = min_ce_length;
+    cmd->data.cmd_connection_set_parameters.max_ce_length = max_ce_length;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_connection_set_parameters_id, sizeof(sl_bt_cmd_connection_set_parameters_t));
+}
+
+static inline void sl_bt_encode_gatt_discover_descriptors(struct sl_bt_packet *cmd, uint8_t connection, uint16_t characteristic)
+{
+    cmd->data.cmd_gatt_discover_descriptors.connection = connection;
+    cmd->data.cmd_gatt_discover_descriptors.characteristic = characteristic;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_discover_descriptors_id, sizeof(sl_bt_cmd_gatt_discover_descriptors_t));
+}
+
+static inline void sl_bt_encode_gatt_server_find_attribute(struct sl_bt_packet *cmd, uint16_t start, size_t type_len)
+{
+    cmd->data.cmd_gatt_server_find_attribute.start = start;
+    cmd->data.cmd_gatt_server_find_attribute.type.len = (uint8_t)type_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_find_attribute_id, sizeof(sl_bt_cmd_gatt_server_find_attribute_t) + type_len);
+}
+
+static inline void sl_bt_encode_sm_delete_bonding(struct sl_bt_packet *cmd, uint8_t bonding)
+{
+    cmd->data.cmd_sm_delete_bonding.bonding = bonding;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_delete_bonding_id, sizeof(sl_bt_cmd_sm_delete_bonding_t));
+}
+
+static inline void sl_bt_encode_cte_transmitter_enable_silabs_cte(struct sl_bt_packet *cmd, uint8_t handle, uint8_t cte_length, uint8_t cte_type, uint8_t cte_count, size_t switching_pattern_len)
+{
+    cmd->data.cmd_cte_transmitter_enable_silabs_cte.handle = handle;
+    cmd->data.cmd_cte_transmitter_enable_silabs_cte.cte_length = cte_length;
+    cmd->data.cmd_cte_transmitter_enable_silabs_cte.cte_type = cte_type;
+    cmd->data.cmd_cte_transmitter_enable_silabs_cte.cte_count = cte_count;
+    cmd->data.cmd_cte_transmitter_enable_silabs_cte.switching_pattern.len = (uint8_t)switching_pattern_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_transmitter_enable_silabs_cte_id, sizeof(sl_bt_cmd_cte_transmitter_enable_silabs_cte_t) + switching_pattern_len);
+}
+
+static inline void sl_bt_encode_cte_receiver_clear_dtm_parameters(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_receiver_clear_dtm_parameters_id, 0);
+}
+
+static inline void sl_bt_encode_gattdb_add_uuid128_characteristic(struct sl_bt_packet *cmd, uint16_t session, uint16_t service, uint16_t property, uint16_t security, uint8_t flag, uuid_128 uuid, uint8_t value_type, uint16_t maxlen, size_t value_len)
+{
+    cmd->data.cmd_gattdb_add_uuid128_characteristic.session = session;
+    cmd->data.cmd_gattdb_add_uuid128_characteristic.service = service;
+    cmd->data.cmd_gattdb_add_uuid128_characteristic.property = property;
+    cmd->data.cmd_gattdb_add_uuid128_characteristic.security = security;
+    cmd->data.cmd_gattdb_add_uuid128_characteristic.flag = flag;
+    cmd->data.cmd_gattdb_add_uuid128_characteristic.uuid = uuid;
+    cmd->data.cmd_gattdb_add_uuid128_characteristic.value_type = value_type;
+    cmd->data.cmd_gattdb_add_uuid128_characteristic.maxlen = maxlen;
+    cmd->data.cmd_gattdb_add_uuid128_characteristic.value.len = (uint16_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_add_uuid128_characteristic_id, sizeof(sl_bt_cmd_gattdb_add_uuid128_characteristic_t) + value_len);
+}
+
+static inline void sl_bt_encode_advertiser_set_configuration(struct sl_bt_packet *cmd, uint8_t handle, uint32_t configurations)
+{
+    cmd->data.cmd_advertiser_set_configuration.handle = handle;
+    cmd->data.cmd_advertiser_set_configuration.configurations = configurations;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_set_configuration_id, sizeof(sl_bt_cmd_advertiser_set_configuration_t));
+}
+
+static inline void sl_bt_encode_connection_read_channel_map(struct sl_bt_packet *cmd, uint8_t connection)
+{
+    cmd->data.cmd_connection_read_channel_map.connection = connection;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_connection_read_channel_map_id, sizeof(sl_bt_cmd_connection_read_channel_map_t));
+}
+
+static inline void sl_bt_encode_gatt_read_characteristic_value(struct sl_bt_packet *cmd, uint8_t connection, uint16_t characteristic)
+{
+    cmd->data.cmd_gatt_read_characteristic_value.connection = connection;
+    cmd->data.cmd_gatt_read_characteristic_value.characteristic = characteristic;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_read_characteristic_value_id, sizeof(sl_bt_cmd_gatt_read_characteristic_value_t));
+}
+
+static inline void sl_bt_encode_sm_delete_bondings(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_delete_bondings_id, 0);
+}
+
+static inline void sl_bt_encode_cte_transmitter_disable_silabs_cte(struct sl_bt_packet *cmd, uint8_t handle)
+{
+    cmd->data.cmd_cte_transmitter_disable_silabs_cte.handle = handle;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_transmitter_disable_silabs_cte_id, sizeof(sl_bt_cmd_cte_transmitter_disable_silabs_cte_t));
+}
+
+static inline void sl_bt_encode_cte_receiver_enable_silabs_cte(struct sl_bt_packet *cmd, uint8_t slot_durations, uint8_t cte_count, size_t switching_pattern_len)
+{
+    cmd->data.cmd_cte_receiver_enable_silabs_cte.slot_durations = slot_durations;
+    cmd->data.cmd_cte_receiver_enable_silabs_cte.cte_count = cte_count;
+    cmd->data.cmd_cte_receiver_enable_silabs_cte.switching_pattern.len = (uint8_t)switching_pattern_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_receiver_enable_silabs_cte_id, sizeof(sl_bt_cmd_cte_receiver_enable_silabs_cte_t) + switching_pattern_len);
+}
+
+static inline void sl_bt_encode_gattdb_remove_characteristic(struct sl_bt_packet *cmd, uint16_t session, uint16_t characteristic)
+{
+    cmd->data.cmd_gattdb_remove_characteristic.session = session;
+    cmd->data.cmd_gattdb_remove_characteristic.characteristic = characteristic;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_remove_characteristic_id, sizeof(sl_bt_cmd_gattdb_remove_characteristic_t));
+}
+
+static inline void sl_bt_encode_advertiser_clear_configuration(struct sl_bt_packet *cmd, uint8_t handle, uint32_t configurations)
+{
+    cmd->data.cmd_advertiser_clear_configuration.handle = handle;
+    cmd->data.cmd_advertiser_clear_configuration.configurations = configurations;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_clear_configuration_id, sizeof(sl_bt_cmd_advertiser_clear_configuration_t));
+}
+
+static inline void sl_bt_encode_connection_set_preferred_phy(struct sl_bt_packet *cmd, uint8_t connection, uint8_t preferred_phy, uint8_t accepted_phy)
+{
+    cmd->data.cmd_connection_set_preferred_phy.connection = connection;
+    cmd->data.cmd_connection_set_preferred_phy.preferred_phy = preferred_phy;
+    cmd->data.cmd_connection_set_preferred_phy.accepted_phy = accepted_phy;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_connection_set_preferred_phy_id, sizeof(sl_bt_cmd_connection_set_preferred_phy_t));
+}
+
+static inline void sl_bt_encode_gatt_read_characteristic_value_by_uuid(struct sl_bt_packet *cmd, uint8_t connection, uint32_t service, size_t uuid_len)
+{
+    cmd->data.cmd_gatt_read_characteristic_value_by_uuid.connection = connection;
+    cmd->data.cmd_gatt_read_characteristic_value_by_uuid.service = service;
+    cmd->data.cmd_gatt_read_characteristic_value_by_uuid.uuid.len = (uint8_t)uuid_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_read_characteristic_value_by_uuid_id, sizeof(sl_bt_cmd_gatt_read_characteristic_value_by_uuid_t) + uuid_len);
+}
+
+static inline void sl_bt_encode_gatt_server_set_capabilities(struct sl_bt_packet *cmd, uint32_t caps, uint32_t reserved)
+{
+    cmd->data.cmd_gatt_server_set_capabilities.caps = caps;
+    cmd->data.cmd_gatt_server_set_capabilities.reserved = reserved;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_set_capabilities_id, sizeof(sl_bt_cmd_gatt_server_set_capabilities_t));
+}
+
+static inline void sl_bt_encode_sm_enter_passkey(struct sl_bt_packet *cmd, uint8_t connection, int32_t passkey)
+{
+    cmd->data.cmd_sm_enter_passkey.connection = connection;
+    cmd->data.cmd_sm_enter_passkey.passkey = passkey;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_enter_passkey_id, sizeof(sl_bt_cmd_sm_enter_passkey_t));
+}
+
+static inline void sl_bt_encode_cte_receiver_disable_silabs_cte(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_receiver_disable_silabs_cte_id, 0);
+}
+
+static inline void sl_bt_encode_gattdb_add_uuid16_descriptor(struct sl_bt_packet *cmd, uint16_t session, uint16_t characteristic, uint16_t property, uint16_t security, sl_bt_uuid_16_t uuid, uint8_t value_type, uint16_t maxlen, size_t value_len)
+{
+    cmd->data.cmd_gattdb_add_uuid16_descriptor.session = session;
+    cmd->data.cmd_gattdb_add_uuid16_descriptor.characteristic = characteristic;
+    cmd->data.cmd_gattdb_add_uuid16_descriptor.property = property;
+    cmd->data.cmd_gattdb_add_uuid16_descriptor.security = security;
+    cmd->data.cmd_gattdb_add_uuid16_descriptor.uuid = uuid;
+    cmd->data.cmd_gattdb_add_uuid16_descriptor.value_type = value_type;
+    cmd->data.cmd_gattdb_add_uuid16_descriptor.maxlen = maxlen;
+    cmd->data.cmd_gattdb_add_uuid16_descriptor.value.len = (uint16_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_add_uuid16_descriptor_id, sizeof(sl_bt_cmd_gattdb_add_uuid16_descriptor_t) + value_len);
+}
+
+static inline void sl_bt_encode_advertiser_start(struct sl_bt_packet *cmd, uint8_t handle, uint8_t discover, uint8_t connect)
+{
+    cmd->data.cmd_advertiser_start.handle = handle;
+    cmd->data.cmd_advertiser_start.discover = discover;
+    cmd->data.cmd_advertiser_start.connect = connect;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_start_id, sizeof(sl_bt_cmd_advertiser_start_t));
+}
+
+static inline void sl_bt_encode_connection_set_power_reporting(struct sl_bt_packet *cmd, uint8_t connection, uint8_t mode)
+{
+    cmd->data.cmd_connection_set_power_reporting.connection = connection;
+    cmd->data.cmd_connection_set_power_reporting.mode = mode;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_connection_set_power_reporting_id, sizeof(sl_bt_cmd_connection_set_power_reporting_t));
+}
+
+static inline void sl_bt_encode_gatt_write_characteristic_value(struct sl_bt_packet *cmd, uint8_t connection, uint16_t characteristic, size_t value_len)
+{
+    cmd->data.cmd_gatt_write_characteristic_value.connection = connection;
+    cmd->data.cmd_gatt_write_characteristic_value.characteristic = characteristic;
+    cmd->data.cmd_gatt_write_characteristic_value.value.len = (uint8_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_write_characteristic_value_id, sizeof(sl_bt_cmd_gatt_write_characteristic_value_t) + value_len);
+}
+
+static inline void sl_bt_encode_sm_passkey_confirm(struct sl_bt_packet *cmd, uint8_t connection, uint8_t confirm)
+{
+    cmd->data.cmd_sm_passkey_confirm.connection = connection;
+    cmd->data.cmd_sm_passkey_confirm.confirm = confirm;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_passkey_confirm_id, sizeof(sl_bt_cmd_sm_passkey_confirm_t));
+}
+
+static inline void sl_bt_encode_cte_receiver_set_sync_cte_type(struct sl_bt_packet *cmd, uint8_t sync_cte_type)
+{
+    cmd->data.cmd_cte_receiver_set_sync_cte_type.sync_cte_type = sync_cte_type;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_cte_receiver_set_sync_cte_type_id, sizeof(sl_bt_cmd_cte_receiver_set_sync_cte_type_t));
+}
+
+static inline void sl_bt_encode_gattdb_add_uuid128_descriptor(struct sl_bt_packet *cmd, uint16_t session, uint16_t characteristic, uint16_t property, uint16_t security, uuid_128 uuid, uint8_t value_type, uint16_t maxlen, size_t value_len)
+{
+    cmd->data.cmd_gattdb_add_uuid128_descriptor.session = session;
+    cmd->data.cmd_gattdb_add_uuid128_descriptor.characteristic = characteristic;
+    cmd->data.cmd_gattdb_add_uuid128_descriptor.property = property;
+    cmd->data.cmd_gattdb_add_uuid128_descriptor.security = security;
+    cmd->data.cmd_gattdb_add_uuid128_descriptor.uuid = uuid;
+    cmd->data.cmd_gattdb_add_uuid128_descriptor.value_type = value_type;
+    cmd->data.cmd_gattdb_add_uuid128_descriptor.maxlen = maxlen;
+    cmd->data.cmd_gattdb_add_uuid128_descriptor.value.len = (uint16_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_add_uuid128_descriptor_id, sizeof(sl_bt_cmd_gattdb_add_uuid128_descriptor_t) + value_len);
+}
+
+static inline void sl_bt_encode_advertiser_stop(struct sl_bt_packet *cmd, uint8_t handle)
+{
+    cmd->data.cmd_advertiser_stop.handle = handle;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_stop_id, sizeof(sl_bt_cmd_advertiser_stop_t));
+}
+
+static inline void sl_bt_encode_connection_set_remote_power_reporting(struct sl_bt_packet *cmd, uint8_t connection, uint8_t mode)
+{
+    cmd->data.cmd_connection_set_remote_power_reporting.connection = connection;
+    cmd->data.cmd_connection_set_remote_power_reporting.mode = mode;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_connection_set_remote_power_reporting_id, sizeof(sl_bt_cmd_connection_set_remote_power_reporting_t));
+}
+
+static inline void sl_bt_encode_gatt_write_characteristic_value_without_response(struct sl_bt_packet *cmd, uint8_t connection, uint16_t characteristic, size_t value_len)
+{
+    cmd->data.cmd_gatt_write_characteristic_value_without_response.connection = connection;
+    cmd->data.cmd_gatt_write_characteristic_value_without_response.characteristic = characteristic;
+    cmd->data.cmd_gatt_write_characteristic_value_without_response.value.len = (uint8_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_write_characteristic_value_without_response_id, sizeof(sl_bt_cmd_gatt_write_characteristic_value_without_response_t) + value_len);
+}
+
+static inline void sl_bt_encode_gatt_server_set_max_mtu(struct sl_bt_packet *cmd, uint16_t max_mtu)
+{
+    cmd->data.cmd_gatt_server_set_max_mtu.max_mtu = max_mtu;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_set_max_mtu_id, sizeof(sl_bt_cmd_gatt_server_set_max_mtu_t));
+}
+
+static inline void sl_bt_encode_sm_set_oob_data(struct sl_bt_packet *cmd, size_t oob_data_len)
+{
+    cmd->data.cmd_sm_set_oob_data.oob_data.len = (uint8_t)oob_data_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_set_oob_data_id, sizeof(sl_bt_cmd_sm_set_oob_data_t) + oob_data_len);
+}
+
+static inline void sl_bt_encode_gattdb_remove_descriptor(struct sl_bt_packet *cmd, uint16_t session, uint16_t descriptor)
+{
+    cmd->data.cmd_gattdb_remove_descriptor.session = session;
+    cmd->data.cmd_gattdb_remove_descriptor.descriptor = descriptor;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_remove_descriptor_id, sizeof(sl_bt_cmd_gattdb_remove_descriptor_t));
+}
+
+static inline void sl_bt_encode_system_get_random_data(struct sl_bt_packet *cmd, uint8_t length)
+{
+    cmd->data.cmd_system_get_random_data.length = length;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_get_random_data_id, sizeof(sl_bt_cmd_system_get_random_data_t));
+}
+
+static inline void sl_bt_encode_advertiser_set_tx_power(struct sl_bt_packet *cmd, uint8_t handle, int16_t power)
+{
+    cmd->data.cmd_advertiser_set_tx_power.handle = handle;
+    cmd->data.cmd_advertiser_set_tx_power.power = power;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_set_tx_power_id, sizeof(sl_bt_cmd_advertiser_set_tx_power_t));
+}
+
+static inline void sl_bt_encode_connection_get_tx_power(struct sl_bt_packet *cmd, uint8_t connection, uint8_t phy)
+{
+    cmd->data.cmd_connection_get_tx_power.connection = connection;
+    cmd->data.cmd_connection_get_tx_power.phy = phy;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_connection_get_tx_power_id, sizeof(sl_bt_cmd_connection_get_tx_power_t));
+}
+
+static inline void sl_bt_encode_gatt_prepare_characteristic_value_write(struct sl_bt_packet *cmd, uint8_t connection, uint16_t characteristic, uint16_t offset, size_t value_len)
+{
+    cmd->data.cmd_gatt_prepare_characteristic_value_write.connection = connection;
+    cmd->data.cmd_gatt_prepare_characteristic_value_write.characteristic = characteristic;
+    cmd->data.cmd_gatt_prepare_characteristic_value_write.offset = offset;
+    cmd->data.cmd_gatt_prepare_characteristic_value_write.value.len = (uint8_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_prepare_characteristic_value_write_id, sizeof(sl_bt_cmd_gatt_prepare_characteristic_value_write_t) + value_len);
+}
+
+static inline void sl_bt_encode_gatt_server_get_mtu(struct sl_bt_packet *cmd, uint8_t connection)
+{
+    cmd->data.cmd_gatt_server_get_mtu.connection = connection;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_get_mtu_id, sizeof(sl_bt_cmd_gatt_server_get_mtu_t));
+}
+
+static inline void sl_bt_encode_sm_list_all_bondings(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_list_all_bondings_id, 0);
+}
+
+static inline void sl_bt_encode_gattdb_start_service(struct sl_bt_packet *cmd, uint16_t session, uint16_t service)
+{
+    cmd->data.cmd_gattdb_start_service.session = session;
+    cmd->data.cmd_gattdb_start_service.service = service;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_start_service_id, sizeof(sl_bt_cmd_gattdb_start_service_t));
+}
+
+static inline void sl_bt_encode_system_halt(struct sl_bt_packet *cmd, uint8_t halt)
+{
+    cmd->data.cmd_system_halt.halt = halt;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_halt_id, sizeof(sl_bt_cmd_system_halt_t));
+}
+
+static inline void sl_bt_encode_advertiser_start_periodic_advertising(struct sl_bt_packet *cmd, uint8_t handle, uint16_t interval_min, uint16_t interval_max, uint32_t flags)
+{
+    cmd->data.cmd_advertiser_start_periodic_advertising.handle = handle;
+    cmd->data.cmd_advertiser_start_periodic_advertising.interval_min = interval_min;
+    cmd->data.cmd_advertiser_start_periodic_advertising.interval_max = interval_max;
+    cmd->data.cmd_advertiser_start_periodic_advertising.flags = flags;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_start_periodic_advertising_id, sizeof(sl_bt_cmd_advertiser_start_periodic_advertising_t));
+}
+
+static inline void sl_bt_encode_connection_get_remote_tx_power(struct sl_bt_packet *cmd, uint8_t connection, uint8_t phy)
+{
+    cmd->data.cmd_connection_get_remote_tx_power.connection = connection;
+    cmd->data.cmd_connection_get_remote_tx_power.phy = phy;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_connection_get_remote_tx_power_id, sizeof(sl_bt_cmd_connection_get_remote_tx_power_t));
+}
+
+static inline void sl_bt_encode_gatt_execute_characteristic_value_write(struct sl_bt_packet *cmd, uint8_t connection, uint8_t flags)
+{
+    cmd->data.cmd_gatt_execute_characteristic_value_write.connection = connection;
+    cmd->data.cmd_gatt_execute_characteristic_value_write.flags = flags;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_execute_characteristic_value_write_id, sizeof(sl_bt_cmd_gatt_execute_characteristic_value_write_t));
+}
+
+static inline void sl_bt_encode_gatt_server_enable_capabilities(struct sl_bt_packet *cmd, uint32_t caps)
+{
+    cmd->data.cmd_gatt_server_enable_capabilities.caps = caps;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_enable_capabilities_id, sizeof(sl_bt_cmd_gatt_server_enable_capabilities_t));
+}
+
+static inline void sl_bt_encode_gattdb_stop_service(struct sl_bt_packet *cmd, uint16_t session, uint16_t service)
+{
+    cmd->data.cmd_gattdb_stop_service.session = session;
+    cmd->data.cmd_gattdb_stop_service.service = service;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_stop_service_id, sizeof(sl_bt_cmd_gattdb_stop_service_t));
+}
+
+static inline void sl_bt_encode_advertiser_stop_periodic_advertising(struct sl_bt_packet *cmd, uint8_t handle)
+{
+    cmd->data.cmd_advertiser_stop_periodic_advertising.handle = handle;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_stop_periodic_advertising_id, sizeof(sl_bt_cmd_advertiser_stop_periodic_advertising_t));
+}
+
+static inline void sl_bt_encode_connection_read_remote_used_features(struct sl_bt_packet *cmd, uint8_t connection)
+{
+    cmd->data.cmd_connection_read_remote_used_features.connection = connection;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_connection_read_remote_used_features_id, sizeof(sl_bt_cmd_connection_read_remote_used_features_t));
+}
+
+static inline void sl_bt_encode_gatt_send_characteristic_confirmation(struct sl_bt_packet *cmd, uint8_t connection)
+{
+    cmd->data.cmd_gatt_send_characteristic_confirmation.connection = connection;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_send_characteristic_confirmation_id, sizeof(sl_bt_cmd_gatt_send_characteristic_confirmation_t));
+}
+
+static inline void sl_bt_encode_gatt_server_disable_capabilities(struct sl_bt_packet *cmd, uint32_t caps)
+{
+    cmd->data.cmd_gatt_server_disable_capabilities.caps = caps;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_disable_capabilities_id, sizeof(sl_bt_cmd_gatt_server_disable_capabilities_t));
+}
+
+static inline void sl_bt_encode_gattdb_start_characteristic(struct sl_bt_packet *cmd, uint16_t session, uint16_t characteristic)
+{
+    cmd->data.cmd_gattdb_start_characteristic.session = session;
+    cmd->data.cmd_gattdb_start_characteristic.characteristic = characteristic;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_start_characteristic_id, sizeof(sl_bt_cmd_gattdb_start_characteristic_t));
+}
+
+static inline void sl_bt_encode_system_linklayer_configure(struct sl_bt_packet *cmd, uint8_t key, size_t data_len)
+{
+    cmd->data.cmd_system_linklayer_configure.key = key;
+    cmd->data.cmd_system_linklayer_configure.data.len = (uint8_t)data_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_linklayer_configure_id, sizeof(sl_bt_cmd_system_linklayer_configure_t) + data_len);
+}
+
+static inline void sl_bt_encode_advertiser_set_long_data(struct sl_bt_packet *cmd, uint8_t handle, uint8_t packet_type)
+{
+    cmd->data.cmd_advertiser_set_long_data.handle = handle;
+    cmd->data.cmd_advertiser_set_long_data.packet_type = packet_type;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_set_long_data_id, sizeof(sl_bt_cmd_advertiser_set_long_data_t));
+}
+
+static inline void sl_bt_encode_gatt_read_descriptor_value(struct sl_bt_packet *cmd, uint8_t connection, uint16_t descriptor)
+{
+    cmd->data.cmd_gatt_read_descriptor_value.connection = connection;
+    cmd->data.cmd_gatt_read_descriptor_value.descriptor = descriptor;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_read_descriptor_value_id, sizeof(sl_bt_cmd_gatt_read_descriptor_value_t));
+}
+
+static inline void sl_bt_encode_gatt_server_get_enabled_capabilities(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_get_enabled_capabilities_id, 0);
+}
+
+static inline void sl_bt_encode_sm_bonding_confirm(struct sl_bt_packet *cmd, uint8_t connection, uint8_t confirm)
+{
+    cmd->data.cmd_sm_bonding_confirm.connection = connection;
+    cmd->data.cmd_sm_bonding_confirm.confirm = confirm;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_bonding_confirm_id, sizeof(sl_bt_cmd_sm_bonding_confirm_t));
+}
+
+static inline void sl_bt_encode_gattdb_stop_characteristic(struct sl_bt_packet *cmd, uint16_t session, uint16_t characteristic)
+{
+    cmd->data.cmd_gattdb_stop_characteristic.session = session;
+    cmd->data.cmd_gattdb_stop_characteristic.characteristic = characteristic;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_stop_characteristic_id, sizeof(sl_bt_cmd_gattdb_stop_characteristic_t));
+}
+
+static inline void sl_bt_encode_system_get_counters(struct sl_bt_packet *cmd, uint8_t reset)
+{
+    cmd->data.cmd_system_get_counters.reset = reset;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_get_counters_id, sizeof(sl_bt_cmd_system_get_counters_t));
+}
+
+static inline void sl_bt_encode_advertiser_set_data(struct sl_bt_packet *cmd, uint8_t handle, uint8_t packet_type, size_t adv_data_len)
+{
+    cmd->data.cmd_advertiser_set_data.handle = handle;
+    cmd->data.cmd_advertiser_set_data.packet_type = packet_type;
+    cmd->data.cmd_advertiser_set_data.adv_data.len = (uint8_t)adv_data_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_set_data_id, sizeof(sl_bt_cmd_advertiser_set_data_t) + adv_data_len);
+}
+
+static inline void sl_bt_encode_gatt_write_descriptor_value(struct sl_bt_packet *cmd, uint8_t connection, uint16_t descriptor, size_t value_len)
+{
+    cmd->data.cmd_gatt_write_descriptor_value.connection = connection;
+    cmd->data.cmd_gatt_write_descriptor_value.descriptor = descriptor;
+    cmd->data.cmd_gatt_write_descriptor_value.value.len = (uint8_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_write_descriptor_value_id, sizeof(sl_bt_cmd_gatt_write_descriptor_value_t) + value_len);
+}
+
+static inline void sl_bt_encode_gatt_server_send_notification(struct sl_bt_packet *cmd, uint8_t connection, uint16_t characteristic, size_t value_len)
+{
+    cmd->data.cmd_gatt_server_send_notification.connection = connection;
+    cmd->data.cmd_gatt_server_send_notification.characteristic = characteristic;
+    cmd->data.cmd_gatt_server_send_notification.value.len = (uint8_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_send_notification_id, sizeof(sl_bt_cmd_gatt_server_send_notification_t) + value_len);
+}
+
+static inline void sl_bt_encode_sm_set_debug_mode(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_set_debug_mode_id, 0);
+}
+
+static inline void sl_bt_encode_gattdb_commit(struct sl_bt_packet *cmd, uint16_t session)
+{
+    cmd->data.cmd_gattdb_commit.session = session;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_commit_id, sizeof(sl_bt_cmd_gattdb_commit_t));
+}
+
+static inline void sl_bt_encode_advertiser_set_random_address(struct sl_bt_packet *cmd, uint8_t handle, uint8_t addr_type, bd_addr address)
+{
+    cmd->data.cmd_advertiser_set_random_address.handle = handle;
+    cmd->data.cmd_advertiser_set_random_address.addr_type = addr_type;
+    cmd->data.cmd_advertiser_set_random_address.address = address;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_set_random_address_id, sizeof(sl_bt_cmd_advertiser_set_random_address_t));
+}
+
+static inline void sl_bt_encode_gatt_find_included_services(struct sl_bt_packet *cmd, uint8_t connection, uint32_t service)
+{
+    cmd->data.cmd_gatt_find_included_services.connection = connection;
+    cmd->data.cmd_gatt_find_included_services.service = service;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_find_included_services_id, sizeof(sl_bt_cmd_gatt_find_included_services_t));
+}
+
+static inline void sl_bt_encode_gatt_server_send_indication(struct sl_bt_packet *cmd, uint8_t connection, uint16_t characteristic, size_t value_len)
+{
+    cmd->data.cmd_gatt_server_send_indication.connection = connection;
+    cmd->data.cmd_gatt_server_send_indication.characteristic = characteristic;
+    cmd->data.cmd_gatt_server_send_indication.value.len = (uint8_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_send_indication_id, sizeof(sl_bt_cmd_gatt_server_send_indication_t) + value_len);
+}
+
+static inline void sl_bt_encode_sm_set_passkey(struct sl_bt_packet *cmd, int32_t passkey)
+{
+    cmd->data.cmd_sm_set_passkey.passkey = passkey;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_set_passkey_id, sizeof(sl_bt_cmd_sm_set_passkey_t));
+}
+
+static inline void sl_bt_encode_gattdb_abort(struct sl_bt_packet *cmd, uint16_t session)
+{
+    cmd->data.cmd_gattdb_abort.session = session;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gattdb_abort_id, sizeof(sl_bt_cmd_gattdb_abort_t));
+}
+
+static inline void sl_bt_encode_advertiser_clear_random_address(struct sl_bt_packet *cmd, uint8_t handle)
+{
+    cmd->data.cmd_advertiser_clear_random_address.handle = handle;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_advertiser_clear_random_address_id, sizeof(sl_bt_cmd_advertiser_clear_random_address_t));
+}
+
+static inline void sl_bt_encode_gatt_read_multiple_characteristic_values(struct sl_bt_packet *cmd, uint8_t connection, size_t characteristic_list_len)
+{
+    cmd->data.cmd_gatt_read_multiple_characteristic_values.connection = connection;
+    cmd->data.cmd_gatt_read_multiple_characteristic_values.characteristic_list.len = (uint8_t)characteristic_list_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_read_multiple_characteristic_values_id, sizeof(sl_bt_cmd_gatt_read_multiple_characteristic_values_t) + characteristic_list_len);
+}
+
+static inline void sl_bt_encode_gatt_server_notify_all(struct sl_bt_packet *cmd, uint16_t characteristic, size_t value_len)
+{
+    cmd->data.cmd_gatt_server_notify_all.characteristic = characteristic;
+    cmd->data.cmd_gatt_server_notify_all.value.len = (uint8_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_notify_all_id, sizeof(sl_bt_cmd_gatt_server_notify_all_t) + value_len);
+}
+
+static inline void sl_bt_encode_sm_use_sc_oob(struct sl_bt_packet *cmd, uint8_t enable)
+{
+    cmd->data.cmd_sm_use_sc_oob.enable = enable;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_use_sc_oob_id, sizeof(sl_bt_cmd_sm_use_sc_oob_t));
+}
+
+static inline void sl_bt_encode_system_data_buffer_write(struct sl_bt_packet *cmd, size_t data_len)
+{
+    cmd->data.cmd_system_data_buffer_write.data.len = (uint8_t)data_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_data_buffer_write_id, sizeof(sl_bt_cmd_system_data_buffer_write_t) + data_len);
+}
+
+static inline void sl_bt_encode_gatt_read_characteristic_value_from_offset(struct sl_bt_packet *cmd, uint8_t connection, uint16_t characteristic, uint16_t offset, uint16_t maxlen)
+{
+    cmd->data.cmd_gatt_read_characteristic_value_from_offset.connection = connection;
+    cmd->data.cmd_gatt_read_characteristic_value_from_offset.characteristic = characteristic;
+    cmd->data.cmd_gatt_read_characteristic_value_from_offset.offset = offset;
+    cmd->data.cmd_gatt_read_characteristic_value_from_offset.maxlen = maxlen;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_read_characteristic_value_from_offset_id, sizeof(sl_bt_cmd_gatt_read_characteristic_value_from_offset_t));
+}
+
+static inline void sl_bt_encode_gatt_server_read_client_configuration(struct sl_bt_packet *cmd, uint8_t connection, uint16_t characteristic)
+{
+    cmd->data.cmd_gatt_server_read_client_configuration.connection = connection;
+    cmd->data.cmd_gatt_server_read_client_configuration.characteristic = characteristic;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_read_client_configuration_id, sizeof(sl_bt_cmd_gatt_server_read_client_configuration_t));
+}
+
+static inline void sl_bt_encode_sm_set_sc_remote_oob_data(struct sl_bt_packet *cmd, size_t oob_data_len)
+{
+    cmd->data.cmd_sm_set_sc_remote_oob_data.oob_data.len = (uint8_t)oob_data_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_set_sc_remote_oob_data_id, sizeof(sl_bt_cmd_sm_set_sc_remote_oob_data_t) + oob_data_len);
+}
+
+static inline void sl_bt_encode_system_set_identity_address(struct sl_bt_packet *cmd, bd_addr address, uint8_t type)
+{
+    cmd->data.cmd_system_set_identity_address.address = address;
+    cmd->data.cmd_system_set_identity_address.type = type;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_set_identity_address_id, sizeof(sl_bt_cmd_system_set_identity_address_t));
+}
+
+static inline void sl_bt_encode_gatt_prepare_characteristic_value_reliable_write(struct sl_bt_packet *cmd, uint8_t connection, uint16_t characteristic, uint16_t offset, size_t value_len)
+{
+    cmd->data.cmd_gatt_prepare_characteristic_value_reliable_write.connection = connection;
+    cmd->data.cmd_gatt_prepare_characteristic_value_reliable_write.characteristic = characteristic;
+    cmd->data.cmd_gatt_prepare_characteristic_value_reliable_write.offset = offset;
+    cmd->data.cmd_gatt_prepare_characteristic_value_reliable_write.value.len = (uint8_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_prepare_characteristic_value_reliable_write_id, sizeof(sl_bt_cmd_gatt_prepare_characteristic_value_reliable_write_t) + value_len);
+}
+
+static inline void sl_bt_encode_sm_add_to_whitelist(struct sl_bt_packet *cmd, bd_addr address, uint8_t address_type)
+{
+    cmd->data.cmd_sm_add_to_whitelist.address = address;
+    cmd->data.cmd_sm_add_to_whitelist.address_type = address_type;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_add_to_whitelist_id, sizeof(sl_bt_cmd_sm_add_to_whitelist_t));
+}
+
+static inline void sl_bt_encode_system_data_buffer_clear(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_data_buffer_clear_id, 0);
+}
+
+static inline void sl_bt_encode_gatt_server_send_user_prepare_write_response(struct sl_bt_packet *cmd, uint8_t connection, uint16_t characteristic, uint8_t att_errorcode, uint16_t offset, size_t value_len)
+{
+    cmd->data.cmd_gatt_server_send_user_prepare_write_response.connection = connection;
+    cmd->data.cmd_gatt_server_send_user_prepare_write_response.characteristic = characteristic;
+    cmd->data.cmd_gatt_server_send_user_prepare_write_response.att_errorcode = att_errorcode;
+    cmd->data.cmd_gatt_server_send_user_prepare_write_response.offset = offset;
+    cmd->data.cmd_gatt_server_send_user_prepare_write_response.value.len = (uint8_t)value_len;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_send_user_prepare_write_response_id, sizeof(sl_bt_cmd_gatt_server_send_user_prepare_write_response_t) + value_len);
+}
+
+static inline void sl_bt_encode_sm_set_minimum_key_size(struct sl_bt_packet *cmd, uint8_t minimum_key_size)
+{
+    cmd->data.cmd_sm_set_minimum_key_size.minimum_key_size = minimum_key_size;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_set_minimum_key_size_id, sizeof(sl_bt_cmd_sm_set_minimum_key_size_t));
+}
+
+static inline void sl_bt_encode_system_get_identity_address(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_get_identity_address_id, 0);
+}
+
+static inline void sl_bt_encode_gatt_server_read_client_supported_features(struct sl_bt_packet *cmd, uint8_t connection)
+{
+    cmd->data.cmd_gatt_server_read_client_supported_features.connection = connection;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_gatt_server_read_client_supported_features_id, sizeof(sl_bt_cmd_gatt_server_read_client_supported_features_t));
+}
+
+static inline void sl_bt_encode_sm_get_bonding_handles(struct sl_bt_packet *cmd, uint32_t reserved)
+{
+    cmd->data.cmd_sm_get_bonding_handles.reserved = reserved;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_get_bonding_handles_id, sizeof(sl_bt_cmd_sm_get_bonding_handles_t));
+}
+
+static inline void sl_bt_encode_system_set_max_tx_power(struct sl_bt_packet *cmd, int16_t power)
+{
+    cmd->data.cmd_system_set_max_tx_power.power = power;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_set_max_tx_power_id, sizeof(sl_bt_cmd_system_set_max_tx_power_t));
+}
+
+static inline void sl_bt_encode_sm_get_bonding_details(struct sl_bt_packet *cmd, uint32_t bonding)
+{
+    cmd->data.cmd_sm_get_bonding_details.bonding = bonding;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_get_bonding_details_id, sizeof(sl_bt_cmd_sm_get_bonding_details_t));
+}
+
+static inline void sl_bt_encode_system_set_tx_power(struct sl_bt_packet *cmd, int16_t min_power, int16_t max_power)
+{
+    cmd->data.cmd_system_set_tx_power.min_power = min_power;
+    cmd->data.cmd_system_set_tx_power.max_power = max_power;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_set_tx_power_id, sizeof(sl_bt_cmd_system_set_tx_power_t));
+}
+
+static inline void sl_bt_encode_sm_find_bonding_by_address(struct sl_bt_packet *cmd, bd_addr address)
+{
+    cmd->data.cmd_sm_find_bonding_by_address.address = address;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_find_bonding_by_address_id, sizeof(sl_bt_cmd_sm_find_bonding_by_address_t));
+}
+
+static inline void sl_bt_encode_system_get_tx_power_setting(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_get_tx_power_setting_id, 0);
+}
+
+static inline void sl_bt_encode_sm_set_bonding_key(struct sl_bt_packet *cmd, uint32_t bonding, uint8_t key_type, aes_key_128 key)
+{
+    cmd->data.cmd_sm_set_bonding_key.bonding = bonding;
+    cmd->data.cmd_sm_set_bonding_key.key_type = key_type;
+    cmd->data.cmd_sm_set_bonding_key.key = key;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_set_bonding_key_id, sizeof(sl_bt_cmd_sm_set_bonding_key_t));
+}
+
+static inline void sl_bt_encode_system_set_soft_timer(struct sl_bt_packet *cmd, uint32_t time, uint8_t handle, uint8_t single_shot)
+{
+    cmd->data.cmd_system_set_soft_timer.time = time;
+    cmd->data.cmd_system_set_soft_timer.handle = handle;
+    cmd->data.cmd_system_set_soft_timer.single_shot = single_shot;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_set_soft_timer_id, sizeof(sl_bt_cmd_system_set_soft_timer_t));
+}
+
+static inline void sl_bt_encode_sm_set_legacy_oob(struct sl_bt_packet *cmd, uint8_t enable, aes_key_128 oob_data)
+{
+    cmd->data.cmd_sm_set_legacy_oob.enable = enable;
+    cmd->data.cmd_sm_set_legacy_oob.oob_data = oob_data;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_set_legacy_oob_id, sizeof(sl_bt_cmd_sm_set_legacy_oob_t));
+}
+
+static inline void sl_bt_encode_system_set_lazy_soft_timer(struct sl_bt_packet *cmd, uint32_t time, uint32_t slack, uint8_t handle, uint8_t single_shot)
+{
+    cmd->data.cmd_system_set_lazy_soft_timer.time = time;
+    cmd->data.cmd_system_set_lazy_soft_timer.slack = slack;
+    cmd->data.cmd_system_set_lazy_soft_timer.handle = handle;
+    cmd->data.cmd_system_set_lazy_soft_timer.single_shot = single_shot;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_set_lazy_soft_timer_id, sizeof(sl_bt_cmd_system_set_lazy_soft_timer_t));
+}
+
+static inline void sl_bt_encode_sm_set_oob(struct sl_bt_packet *cmd, uint8_t enable)
+{
+    cmd->data.cmd_sm_set_oob.enable = enable;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_set_oob_id, sizeof(sl_bt_cmd_sm_set_oob_t));
+}
+
+static inline void sl_bt_encode_system_get_version(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_get_version_id, 0);
+}
+
+static inline void sl_bt_encode_sm_set_remote_oob(struct sl_bt_packet *cmd, uint8_t enable, aes_key_128 random, aes_key_128 confirm)
+{
+    cmd->data.cmd_sm_set_remote_oob.enable = enable;
+    cmd->data.cmd_sm_set_remote_oob.random = random;
+    cmd->data.cmd_sm_set_remote_oob.confirm = confirm;
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_sm_set_remote_oob_id, sizeof(sl_bt_cmd_sm_set_remote_oob_t));
+}
+
+static inline void sl_bt_encode_system_start_bluetooth(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_start_bluetooth_id, 0);
+}
+
+static inline void sl_bt_encode_system_stop_bluetooth(struct sl_bt_packet *cmd)
+{
+    cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_system_stop_bluetooth_id, 0);
+}
+
+#endif
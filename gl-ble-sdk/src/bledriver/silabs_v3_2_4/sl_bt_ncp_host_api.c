@@ -17,32 +17,22 @@
 #include "sl_bt_api.h"
 #include "sli_bt_api.h"
 #include "silabs_msg.h"
+#include "sl_bt_ncp_encode.h"
 #include "gl_log.h"
 #include <stdio.h>
 
-extern struct sl_bt_packet *sl_bt_cmd_msg;
-extern struct sl_bt_packet *sl_bt_rsp_msg;
-
 void sl_bt_dfu_reset(uint8_t dfu)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
-    cmd->data.cmd_dfu_reset.dfu = dfu;
-
-    cmd->header = sl_bt_cmd_dfu_reset_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_dfu_reset(sl_bt_cmd_msg, dfu);
 
     sl_bt_host_handle_command_noresponse();
 }
 
 sl_status_t sl_bt_dfu_flash_set_address(uint32_t address)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_dfu_flash_set_address.address = address;
-
-    cmd->header = sl_bt_cmd_dfu_flash_set_address_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_dfu_flash_set_address(sl_bt_cmd_msg, address);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_dfu_flash_set_address.result;
@@ -50,26 +40,19 @@ sl_status_t sl_bt_dfu_flash_set_address(uint32_t address)
 
 sl_status_t sl_bt_dfu_flash_upload(size_t data_len, const uint8_t *data)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_dfu_flash_upload.data.len = data_len;
-    memcpy(cmd->data.cmd_dfu_flash_upload.data.data, data, data_len);
-
-    cmd->header = sl_bt_cmd_dfu_flash_upload_id + (((1 + data_len) & 0xff) << 8) + (((1 + data_len) & 0x700) >> 8);
+    sl_bt_encode_dfu_flash_upload(sl_bt_cmd_msg, data_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, data, data_len);
     return rsp->data.rsp_dfu_flash_upload.result;
 }
 
 sl_status_t sl_bt_dfu_flash_upload_finish()
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_dfu_flash_upload_finish_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_dfu_flash_upload_finish(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_dfu_flash_upload_finish.result;
@@ -77,11 +60,9 @@ sl_status_t sl_bt_dfu_flash_upload_finish()
 
 sl_status_t sl_bt_system_hello()
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_system_hello_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_system_hello(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_system_hello.result;
@@ -89,11 +70,9 @@ sl_status_t sl_bt_system_hello()
 
 sl_status_t sl_bt_system_start_bluetooth()
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_system_start_bluetooth_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_system_start_bluetooth(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_system_start_bluetooth.result;
@@ -101,11 +80,9 @@ sl_status_t sl_bt_system_start_bluetooth()
 
 sl_status_t sl_bt_system_stop_bluetooth()
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_system_stop_bluetooth_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_system_stop_bluetooth(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_system_stop_bluetooth.result;
@@ -118,11 +95,9 @@ sl_status_t sl_bt_system_get_version(uint16_t *major,
                                      uint32_t *bootloader,
                                      uint32_t *hash)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_system_get_version_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_system_get_version(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     *major = rsp->data.rsp_system_get_version.major;
@@ -136,24 +111,16 @@ sl_status_t sl_bt_system_get_version(uint16_t *major,
 
 void sl_bt_system_reset(uint8_t dfu)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
-    cmd->data.cmd_system_reset.dfu = dfu;
-
-    cmd->header = sl_bt_cmd_system_reset_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_system_reset(sl_bt_cmd_msg, dfu);
 
     sl_bt_host_handle_command_noresponse();
 }
 
 sl_status_t sl_bt_system_halt(uint8_t halt)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_system_halt.halt = halt;
-
-    cmd->header = sl_bt_cmd_system_halt_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_system_halt(sl_bt_cmd_msg, halt);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_system_halt.result;
@@ -163,29 +130,19 @@ sl_status_t sl_bt_system_linklayer_configure(uint8_t key,
                                              size_t data_len,
                                              const uint8_t *data)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_system_linklayer_configure.key = key;
-    cmd->data.cmd_system_linklayer_configure.data.len = data_len;
-    memcpy(cmd->data.cmd_system_linklayer_configure.data.data, data, data_len);
-
-    cmd->header = sl_bt_cmd_system_linklayer_configure_id + (((2 + data_len) & 0xff) << 8) + (((2 + data_len) & 0x700) >> 8);
+    sl_bt_encode_system_linklayer_configure(sl_bt_cmd_msg, key, data_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, data, data_len);
     return rsp->data.rsp_system_linklayer_configure.result;
 }
 
 SL_BGAPI_DEPRECATED sl_status_t sl_bt_system_set_max_tx_power(int16_t power, int16_t *set_power)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_system_set_max_tx_power.power = power;
-
-    cmd->header = sl_bt_cmd_system_set_max_tx_power_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_system_set_max_tx_power(sl_bt_cmd_msg, power);
 
     sl_bt_host_handle_command();
     *set_power = rsp->data.rsp_system_set_max_tx_power.set_power;
@@ -197,14 +154,9 @@ sl_status_t sl_bt_system_set_tx_power(int16_t min_power,
                                       int16_t *set_min,
                                       int16_t *set_max)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_system_set_tx_power.min_power = min_power;
-    cmd->data.cmd_system_set_tx_power.max_power = max_power;
-
-    cmd->header = sl_bt_cmd_system_set_tx_power_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_system_set_tx_power(sl_bt_cmd_msg, min_power, max_power);
 
     sl_bt_host_handle_command();
     *set_min = rsp->data.rsp_system_set_tx_power.set_min;
@@ -218,11 +170,9 @@ sl_status_t sl_bt_system_get_tx_power_setting(int16_t *support_min,
                                               int16_t *set_max,
                                               int16_t *rf_path_gain)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_system_get_tx_power_setting_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_system_get_tx_power_setting(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     *support_min = rsp->data.rsp_system_get_tx_power_setting.support_min;
@@ -235,14 +185,9 @@ sl_status_t sl_bt_system_get_tx_power_setting(int16_t *support_min,
 
 sl_status_t sl_bt_system_set_identity_address(bd_addr address, uint8_t type)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    memcpy(&cmd->data.cmd_system_set_identity_address.address, &address, sizeof(bd_addr));
-    cmd->data.cmd_system_set_identity_address.type = type;
-
-    cmd->header = sl_bt_cmd_system_set_identity_address_id + (((7) & 0xff) << 8) + (((7) & 0x700) >> 8);
+    sl_bt_encode_system_set_identity_address(sl_bt_cmd_msg, address, type);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_system_set_identity_address.result;
@@ -250,11 +195,9 @@ sl_status_t sl_bt_system_set_identity_address(bd_addr address, uint8_t type)
 
 sl_status_t sl_bt_system_get_identity_address(bd_addr *address, uint8_t *type)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_system_get_identity_address_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_system_get_identity_address(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     memcpy(address, &rsp->data.rsp_system_get_identity_address.address, sizeof(bd_addr));
@@ -267,13 +210,9 @@ sl_status_t sl_bt_system_get_random_data(uint8_t length,
                                          size_t *data_len,
                                          uint8_t *data)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_system_get_random_data.length = length;
-
-    cmd->header = sl_bt_cmd_system_get_random_data_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_system_get_random_data(sl_bt_cmd_msg, length);
 
     sl_bt_host_handle_command();
     *data_len = rsp->data.rsp_system_get_random_data.data.len;
@@ -287,26 +226,19 @@ sl_status_t sl_bt_system_get_random_data(uint8_t length,
 sl_status_t sl_bt_system_data_buffer_write(size_t data_len,
                                            const uint8_t *data)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_system_data_buffer_write.data.len = data_len;
-    memcpy(cmd->data.cmd_system_data_buffer_write.data.data, data, data_len);
-
-    cmd->header = sl_bt_cmd_system_data_buffer_write_id + (((1 + data_len) & 0xff) << 8) + (((1 + data_len) & 0x700) >> 8);
+    sl_bt_encode_system_data_buffer_write(sl_bt_cmd_msg, data_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, data, data_len);
     return rsp->data.rsp_system_data_buffer_write.result;
 }
 
 sl_status_t sl_bt_system_data_buffer_clear()
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_system_data_buffer_clear_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_system_data_buffer_clear(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_system_data_buffer_clear.result;
@@ -318,13 +250,9 @@ sl_status_t sl_bt_system_get_counters(uint8_t reset,
                                       uint16_t *crc_errors,
                                       uint16_t *failures)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_system_get_counters.reset = reset;
-
-    cmd->header = sl_bt_cmd_system_get_counters_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_system_get_counters(sl_bt_cmd_msg, reset);
 
     sl_bt_host_handle_command();
     *tx_packets = rsp->data.rsp_system_get_counters.tx_packets;
@@ -338,15 +266,9 @@ SL_BGAPI_DEPRECATED sl_status_t sl_bt_system_set_soft_timer(uint32_t time,
                                                             uint8_t handle,
                                                             uint8_t single_shot)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_system_set_soft_timer.time = time;
-    cmd->data.cmd_system_set_soft_timer.handle = handle;
-    cmd->data.cmd_system_set_soft_timer.single_shot = single_shot;
-
-    cmd->header = sl_bt_cmd_system_set_soft_timer_id + (((6) & 0xff) << 8) + (((6) & 0x700) >> 8);
+    sl_bt_encode_system_set_soft_timer(sl_bt_cmd_msg, time, handle, single_shot);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_system_set_soft_timer.result;
@@ -357,16 +279,9 @@ SL_BGAPI_DEPRECATED sl_status_t sl_bt_system_set_lazy_soft_timer(uint32_t time,
                                                                  uint8_t handle,
                                                                  uint8_t single_shot)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_system_set_lazy_soft_timer.time = time;
-    cmd->data.cmd_system_set_lazy_soft_timer.slack = slack;
-    cmd->data.cmd_system_set_lazy_soft_timer.handle = handle;
-    cmd->data.cmd_system_set_lazy_soft_timer.single_shot = single_shot;
-
-    cmd->header = sl_bt_cmd_system_set_lazy_soft_timer_id + (((10) & 0xff) << 8) + (((10) & 0x700) >> 8);
+    sl_bt_encode_system_set_lazy_soft_timer(sl_bt_cmd_msg, time, slack, handle, single_shot);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_system_set_lazy_soft_timer.result;
@@ -374,14 +289,9 @@ SL_BGAPI_DEPRECATED sl_status_t sl_bt_system_set_lazy_soft_timer(uint32_t time,
 
 sl_status_t sl_bt_gap_set_privacy_mode(uint8_t privacy, uint8_t interval)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gap_set_privacy_mode.privacy = privacy;
-    cmd->data.cmd_gap_set_privacy_mode.interval = interval;
-
-    cmd->header = sl_bt_cmd_gap_set_privacy_mode_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_gap_set_privacy_mode(sl_bt_cmd_msg, privacy, interval);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gap_set_privacy_mode.result;
@@ -390,28 +300,19 @@ sl_status_t sl_bt_gap_set_privacy_mode(uint8_t privacy, uint8_t interval)
 sl_status_t sl_bt_gap_set_data_channel_classification(size_t channel_map_len,
                                                       const uint8_t *channel_map)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gap_set_data_channel_classification.channel_map.len = channel_map_len;
-    memcpy(cmd->data.cmd_gap_set_data_channel_classification.channel_map.data, channel_map, channel_map_len);
-
-    cmd->header = sl_bt_cmd_gap_set_data_channel_classification_id + (((1 + channel_map_len) & 0xff) << 8) + (((1 + channel_map_len) & 0x700) >> 8);
+    sl_bt_encode_gap_set_data_channel_classification(sl_bt_cmd_msg, channel_map_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, channel_map, channel_map_len);
     return rsp->data.rsp_gap_set_data_channel_classification.result;
 }
 
 sl_status_t sl_bt_gap_enable_whitelisting(uint8_t enable)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gap_enable_whitelisting.enable = enable;
-
-    cmd->header = sl_bt_cmd_gap_enable_whitelisting_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_gap_enable_whitelisting(sl_bt_cmd_msg, enable);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gap_enable_whitelisting.result;
@@ -419,11 +320,9 @@ sl_status_t sl_bt_gap_enable_whitelisting(uint8_t enable)
 
 sl_status_t sl_bt_advertiser_create_set(uint8_t *handle)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_advertiser_create_set_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_advertiser_create_set(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     *handle = rsp->data.rsp_advertiser_create_set.handle;
@@ -436,24 +335,9 @@ sl_status_t sl_bt_advertiser_set_timing(uint8_t handle,
                                         uint16_t duration,
                                         uint8_t maxevents)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    if (ENDIAN)
-    {
-        reverse_endian((uint8_t *)&interval_min, 4);
-        reverse_endian((uint8_t *)&interval_max, 4);
-        reverse_endian((uint8_t *)&duration, 2);
-    }
-   
-    cmd->data.cmd_advertiser_set_timing.handle = handle;
-    cmd->data.cmd_advertiser_set_timing.interval_min = interval_min;
-    cmd->data.cmd_advertiser_set_timing.interval_max = interval_max;
-    cmd->data.cmd_advertiser_set_timing.duration = duration;
-    cmd->data.cmd_advertiser_set_timing.maxevents = maxevents;
-
-    cmd->header = sl_bt_cmd_advertiser_set_timing_id + (((12) & 0xff) << 8) + (((12) & 0x700) >> 8);
+    sl_bt_encode_advertiser_set_timing(sl_bt_cmd_msg, handle, interval_min, interval_max, duration, maxevents);
     
     sl_bt_host_handle_command();
     return rsp->data.rsp_advertiser_set_timing.result;
@@ -463,15 +347,9 @@ sl_status_t sl_bt_advertiser_set_phy(uint8_t handle,
                                      uint8_t primary_phy,
                                      uint8_t secondary_phy)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_advertiser_set_phy.handle = handle;
-    cmd->data.cmd_advertiser_set_phy.primary_phy = primary_phy;
-    cmd->data.cmd_advertiser_set_phy.secondary_phy = secondary_phy;
-
-    cmd->header = sl_bt_cmd_advertiser_set_phy_id + (((3) & 0xff) << 8) + (((3) & 0x700) >> 8);
+    sl_bt_encode_advertiser_set_phy(sl_bt_cmd_msg, handle, primary_phy, secondary_phy);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_advertiser_set_phy.result;
@@ -480,14 +358,9 @@ sl_status_t sl_bt_advertiser_set_phy(uint8_t handle,
 sl_status_t sl_bt_advertiser_set_channel_map(uint8_t handle,
                                              uint8_t channel_map)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_advertiser_set_channel_map.handle = handle;
-    cmd->data.cmd_advertiser_set_channel_map.channel_map = channel_map;
-
-    cmd->header = sl_bt_cmd_advertiser_set_channel_map_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_advertiser_set_channel_map(sl_bt_cmd_msg, handle, channel_map);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_advertiser_set_channel_map.result;
@@ -497,14 +370,9 @@ sl_status_t sl_bt_advertiser_set_tx_power(uint8_t handle,
                                           int16_t power,
                                           int16_t *set_power)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_advertiser_set_tx_power.handle = handle;
-    cmd->data.cmd_advertiser_set_tx_power.power = power;
-
-    cmd->header = sl_bt_cmd_advertiser_set_tx_power_id + (((3) & 0xff) << 8) + (((3) & 0x700) >> 8);
+    sl_bt_encode_advertiser_set_tx_power(sl_bt_cmd_msg, handle, power);
 
     sl_bt_host_handle_command();
     *set_power = rsp->data.rsp_advertiser_set_tx_power.set_power;
@@ -514,14 +382,9 @@ sl_status_t sl_bt_advertiser_set_tx_power(uint8_t handle,
 sl_status_t sl_bt_advertiser_set_report_scan_request(uint8_t handle,
                                                      uint8_t report_scan_req)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_advertiser_set_report_scan_request.handle = handle;
-    cmd->data.cmd_advertiser_set_report_scan_request.report_scan_req = report_scan_req;
-
-    cmd->header = sl_bt_cmd_advertiser_set_report_scan_request_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_advertiser_set_report_scan_request(sl_bt_cmd_msg, handle, report_scan_req);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_advertiser_set_report_scan_request.result;
@@ -532,15 +395,9 @@ sl_status_t sl_bt_advertiser_set_random_address(uint8_t handle,
                                                 bd_addr address,
                                                 bd_addr *address_out)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_advertiser_set_random_address.handle = handle;
-    cmd->data.cmd_advertiser_set_random_address.addr_type = addr_type;
-    memcpy(&cmd->data.cmd_advertiser_set_random_address.address, &address, sizeof(bd_addr));
-
-    cmd->header = sl_bt_cmd_advertiser_set_random_address_id + (((8) & 0xff) << 8) + (((8) & 0x700) >> 8);
+    sl_bt_encode_advertiser_set_random_address(sl_bt_cmd_msg, handle, addr_type, address);
 
     sl_bt_host_handle_command();
     memcpy(address_out, &rsp->data.rsp_advertiser_set_random_address.address_out, sizeof(bd_addr));
@@ -549,13 +406,9 @@ sl_status_t sl_bt_advertiser_set_random_address(uint8_t handle,
 
 sl_status_t sl_bt_advertiser_clear_random_address(uint8_t handle)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_advertiser_clear_random_address.handle = handle;
-
-    cmd->header = sl_bt_cmd_advertiser_clear_random_address_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_advertiser_clear_random_address(sl_bt_cmd_msg, handle);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_advertiser_clear_random_address.result;
@@ -564,14 +417,9 @@ sl_status_t sl_bt_advertiser_clear_random_address(uint8_t handle)
 sl_status_t sl_bt_advertiser_set_configuration(uint8_t handle,
                                                uint32_t configurations)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_advertiser_set_configuration.handle = handle;
-    cmd->data.cmd_advertiser_set_configuration.configurations = configurations;
-
-    cmd->header = sl_bt_cmd_advertiser_set_configuration_id + (((5) & 0xff) << 8) + (((5) & 0x700) >> 8);
+    sl_bt_encode_advertiser_set_configuration(sl_bt_cmd_msg, handle, configurations);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_advertiser_set_configuration.result;
@@ -580,14 +428,9 @@ sl_status_t sl_bt_advertiser_set_configuration(uint8_t handle,
 sl_status_t sl_bt_advertiser_clear_configuration(uint8_t handle,
                                                  uint32_t configurations)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_advertiser_clear_configuration.handle = handle;
-    cmd->data.cmd_advertiser_clear_configuration.configurations = configurations;
-
-    cmd->header = sl_bt_cmd_advertiser_clear_configuration_id + (((5) & 0xff) << 8) + (((5) & 0x700) >> 8);
+    sl_bt_encode_advertiser_clear_configuration(sl_bt_cmd_msg, handle, configurations);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_advertiser_clear_configuration.result;
@@ -598,31 +441,19 @@ sl_status_t sl_bt_advertiser_set_data(uint8_t handle,
                                       size_t adv_data_len,
                                       const uint8_t *adv_data)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_advertiser_set_data.handle = handle;
-    cmd->data.cmd_advertiser_set_data.packet_type = packet_type;
-    cmd->data.cmd_advertiser_set_data.adv_data.len = adv_data_len;
-    memcpy(cmd->data.cmd_advertiser_set_data.adv_data.data, adv_data, adv_data_len);
-
-    cmd->header = sl_bt_cmd_advertiser_set_data_id + (((3 + adv_data_len) & 0xff) << 8) + (((3 + adv_data_len) & 0x700) >> 8);
+    sl_bt_encode_advertiser_set_data(sl_bt_cmd_msg, handle, packet_type, adv_data_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, adv_data, adv_data_len);
     return rsp->data.rsp_advertiser_set_data.result;
 }
 
 sl_status_t sl_bt_advertiser_set_long_data(uint8_t handle, uint8_t packet_type)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_advertiser_set_long_data.handle = handle;
-    cmd->data.cmd_advertiser_set_long_data.packet_type = packet_type;
-
-    cmd->header = sl_bt_cmd_advertiser_set_long_data_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_advertiser_set_long_data(sl_bt_cmd_msg, handle, packet_type);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_advertiser_set_long_data.result;
@@ -632,15 +463,9 @@ sl_status_t sl_bt_advertiser_start(uint8_t handle,
                                    uint8_t discover,
                                    uint8_t connect)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_advertiser_start.handle = handle;
-    cmd->data.cmd_advertiser_start.discover = discover;
-    cmd->data.cmd_advertiser_start.connect = connect;
-
-    cmd->header = sl_bt_cmd_advertiser_start_id + (((3) & 0xff) << 8) + (((3) & 0x700) >> 8);
+    sl_bt_encode_advertiser_start(sl_bt_cmd_msg, handle, discover, connect);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_advertiser_start.result;
@@ -648,13 +473,9 @@ sl_status_t sl_bt_advertiser_start(uint8_t handle,
 
 sl_status_t sl_bt_advertiser_stop(uint8_t handle)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_advertiser_stop.handle = handle;
-
-    cmd->header = sl_bt_cmd_advertiser_stop_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_advertiser_stop(sl_bt_cmd_msg, handle);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_advertiser_stop.result;
@@ -665,16 +486,9 @@ sl_status_t sl_bt_advertiser_start_periodic_advertising(uint8_t handle,
                                                         uint16_t interval_max,
                                                         uint32_t flags)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_advertiser_start_periodic_advertising.handle = handle;
-    cmd->data.cmd_advertiser_start_periodic_advertising.interval_min = interval_min;
-    cmd->data.cmd_advertiser_start_periodic_advertising.interval_max = interval_max;
-    cmd->data.cmd_advertiser_start_periodic_advertising.flags = flags;
-
-    cmd->header = sl_bt_cmd_advertiser_start_periodic_advertising_id + (((9) & 0xff) << 8) + (((9) & 0x700) >> 8);
+    sl_bt_encode_advertiser_start_periodic_advertising(sl_bt_cmd_msg, handle, interval_min, interval_max, flags);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_advertiser_start_periodic_advertising.result;
@@ -682,13 +496,9 @@ sl_status_t sl_bt_advertiser_start_periodic_advertising(uint8_t handle,
 
 sl_status_t sl_bt_advertiser_stop_periodic_advertising(uint8_t handle)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_advertiser_stop_periodic_advertising.handle = handle;
-
-    cmd->header = sl_bt_cmd_advertiser_stop_periodic_advertising_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_advertiser_stop_periodic_advertising(sl_bt_cmd_msg, handle);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_advertiser_stop_periodic_advertising.result;
@@ -696,13 +506,9 @@ sl_status_t sl_bt_advertiser_stop_periodic_advertising(uint8_t handle)
 
 sl_status_t sl_bt_advertiser_delete_set(uint8_t handle)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_advertiser_delete_set.handle = handle;
-
-    cmd->header = sl_bt_cmd_advertiser_delete_set_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_advertiser_delete_set(sl_bt_cmd_msg, handle);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_advertiser_delete_set.result;
@@ -712,15 +518,9 @@ sl_status_t sl_bt_scanner_set_timing(uint8_t phys,
                                      uint16_t scan_interval,
                                      uint16_t scan_window)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_scanner_set_timing.phys = phys;
-    cmd->data.cmd_scanner_set_timing.scan_interval = scan_interval;
-    cmd->data.cmd_scanner_set_timing.scan_window = scan_window;
-
-    cmd->header = sl_bt_cmd_scanner_set_timing_id + (((5) & 0xff) << 8) + (((5) & 0x700) >> 8);
+    sl_bt_encode_scanner_set_timing(sl_bt_cmd_msg, phys, scan_interval, scan_window);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_scanner_set_timing.result;
@@ -728,14 +528,9 @@ sl_status_t sl_bt_scanner_set_timing(uint8_t phys,
 
 sl_status_t sl_bt_scanner_set_mode(uint8_t phys, uint8_t scan_mode)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_scanner_set_mode.phys = phys;
-    cmd->data.cmd_scanner_set_mode.scan_mode = scan_mode;
-
-    cmd->header = sl_bt_cmd_scanner_set_mode_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_scanner_set_mode(sl_bt_cmd_msg, phys, scan_mode);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_scanner_set_mode.result;
@@ -743,14 +538,9 @@ sl_status_t sl_bt_scanner_set_mode(uint8_t phys, uint8_t scan_mode)
 
 sl_status_t sl_bt_scanner_start(uint8_t scanning_phy, uint8_t discover_mode)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_scanner_start.scanning_phy = scanning_phy;
-    cmd->data.cmd_scanner_start.discover_mode = discover_mode;
-
-    cmd->header = sl_bt_cmd_scanner_start_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_scanner_start(sl_bt_cmd_msg, scanning_phy, discover_mode);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_scanner_start.result;
@@ -758,11 +548,9 @@ sl_status_t sl_bt_scanner_start(uint8_t scanning_phy, uint8_t discover_mode)
 
 sl_status_t sl_bt_scanner_stop()
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_scanner_stop_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_scanner_stop(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_scanner_stop.result;
@@ -772,15 +560,9 @@ sl_status_t sl_bt_sync_set_parameters(uint16_t skip,
                                       uint16_t timeout,
                                       uint32_t flags)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sync_set_parameters.skip = skip;
-    cmd->data.cmd_sync_set_parameters.timeout = timeout;
-    cmd->data.cmd_sync_set_parameters.flags = flags;
-
-    cmd->header = sl_bt_cmd_sync_set_parameters_id + (((8) & 0xff) << 8) + (((8) & 0x700) >> 8);
+    sl_bt_encode_sync_set_parameters(sl_bt_cmd_msg, skip, timeout, flags);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sync_set_parameters.result;
@@ -791,15 +573,9 @@ sl_status_t sl_bt_sync_open(bd_addr address,
                             uint8_t adv_sid,
                             uint16_t *sync)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    memcpy(&cmd->data.cmd_sync_open.address, &address, sizeof(bd_addr));
-    cmd->data.cmd_sync_open.address_type = address_type;
-    cmd->data.cmd_sync_open.adv_sid = adv_sid;
-
-    cmd->header = sl_bt_cmd_sync_open_id + (((8) & 0xff) << 8) + (((8) & 0x700) >> 8);
+    sl_bt_encode_sync_open(sl_bt_cmd_msg, address, address_type, adv_sid);
 
     sl_bt_host_handle_command();
     *sync = rsp->data.rsp_sync_open.sync;
@@ -808,13 +584,9 @@ sl_status_t sl_bt_sync_open(bd_addr address,
 
 sl_status_t sl_bt_sync_close(uint16_t sync)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sync_close.sync = sync;
-
-    cmd->header = sl_bt_cmd_sync_close_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_sync_close(sl_bt_cmd_msg, sync);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sync_close.result;
@@ -827,18 +599,9 @@ sl_status_t sl_bt_connection_set_default_parameters(uint16_t min_interval,
                                                     uint16_t min_ce_length,
                                                     uint16_t max_ce_length)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_connection_set_default_parameters.min_interval = min_interval;
-    cmd->data.cmd_connection_set_default_parameters.max_interval = max_interval;
-    cmd->data.cmd_connection_set_default_parameters.latency = latency;
-    cmd->data.cmd_connection_set_default_parameters.timeout = timeout;
-    cmd->data.cmd_connection_set_default_parameters.min_ce_length = min_ce_length;
-    cmd->data.cmd_connection_set_default_parameters.max_ce_length = max_ce_length;
-
-    cmd->header = sl_bt_cmd_connection_set_default_parameters_id + (((12) & 0xff) << 8) + (((12) & 0x700) >> 8);
+    sl_bt_encode_connection_set_default_parameters(sl_bt_cmd_msg, min_interval, max_interval, latency, timeout, min_ce_length, max_ce_length);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_connection_set_default_parameters.result;
@@ -847,14 +610,9 @@ sl_status_t sl_bt_connection_set_default_parameters(uint16_t min_interval,
 sl_status_t sl_bt_connection_set_default_preferred_phy(uint8_t preferred_phy,
                                                        uint8_t accepted_phy)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_connection_set_default_preferred_phy.preferred_phy = preferred_phy;
-    cmd->data.cmd_connection_set_default_preferred_phy.accepted_phy = accepted_phy;
-
-    cmd->header = sl_bt_cmd_connection_set_default_preferred_phy_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_connection_set_default_preferred_phy(sl_bt_cmd_msg, preferred_phy, accepted_phy);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_connection_set_default_preferred_phy.result;
@@ -865,15 +623,9 @@ sl_status_t sl_bt_connection_open(bd_addr address,
                                   uint8_t initiating_phy,
                                   uint8_t *connection)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    memcpy(&cmd->data.cmd_connection_open.address, &address, sizeof(bd_addr));
-    cmd->data.cmd_connection_open.address_type = address_type;
-    cmd->data.cmd_connection_open.initiating_phy = initiating_phy;
-
-    cmd->header = sl_bt_cmd_connection_open_id + (((8) & 0xff) << 8) + (((8) & 0x700) >> 8);
+    sl_bt_encode_connection_open(sl_bt_cmd_msg, address, address_type, initiating_phy);
 
     sl_bt_host_handle_command();
     *connection = rsp->data.rsp_connection_open.connection;
@@ -888,19 +640,9 @@ sl_status_t sl_bt_connection_set_parameters(uint8_t connection,
                                             uint16_t min_ce_length,
                                             uint16_t max_ce_length)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_connection_set_parameters.connection = connection;
-    cmd->data.cmd_connection_set_parameters.min_interval = min_interval;
-    cmd->data.cmd_connection_set_parameters.max_interval = max_interval;
-    cmd->data.cmd_connection_set_parameters.latency = latency;
-    cmd->data.cmd_connection_set_parameters.timeout = timeout;
-    cmd->data.cmd_connection_set_parameters.min_ce_length = min_ce_length;
-    cmd->data.cmd_connection_set_parameters.max_ce_length = max_ce_length;
-
-    cmd->header = sl_bt_cmd_connection_set_parameters_id + (((13) & 0xff) << 8) + (((13) & 0x700) >> 8);
+    sl_bt_encode_connection_set_parameters(sl_bt_cmd_msg, connection, min_interval, max_interval, latency, timeout, min_ce_length, max_ce_length);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_connection_set_parameters.result;
@@ -910,15 +652,9 @@ sl_status_t sl_bt_connection_set_preferred_phy(uint8_t connection,
                                                uint8_t preferred_phy,
                                                uint8_t accepted_phy)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_connection_set_preferred_phy.connection = connection;
-    cmd->data.cmd_connection_set_preferred_phy.preferred_phy = preferred_phy;
-    cmd->data.cmd_connection_set_preferred_phy.accepted_phy = accepted_phy;
-
-    cmd->header = sl_bt_cmd_connection_set_preferred_phy_id + (((3) & 0xff) << 8) + (((3) & 0x700) >> 8);
+    sl_bt_encode_connection_set_preferred_phy(sl_bt_cmd_msg, connection, preferred_phy, accepted_phy);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_connection_set_preferred_phy.result;
@@ -927,14 +663,9 @@ sl_status_t sl_bt_connection_set_preferred_phy(uint8_t connection,
 sl_status_t sl_bt_connection_disable_slave_latency(uint8_t connection,
                                                    uint8_t disable)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_connection_disable_slave_latency.connection = connection;
-    cmd->data.cmd_connection_disable_slave_latency.disable = disable;
-
-    cmd->header = sl_bt_cmd_connection_disable_slave_latency_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_connection_disable_slave_latency(sl_bt_cmd_msg, connection, disable);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_connection_disable_slave_latency.result;
@@ -942,13 +673,9 @@ sl_status_t sl_bt_connection_disable_slave_latency(uint8_t connection,
 
 sl_status_t sl_bt_connection_get_rssi(uint8_t connection)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_connection_get_rssi.connection = connection;
-
-    cmd->header = sl_bt_cmd_connection_get_rssi_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_connection_get_rssi(sl_bt_cmd_msg, connection);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_connection_get_rssi.result;
@@ -959,13 +686,9 @@ sl_status_t sl_bt_connection_read_channel_map(uint8_t connection,
                                               size_t *channel_map_len,
                                               uint8_t *channel_map)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_connection_read_channel_map.connection = connection;
-
-    cmd->header = sl_bt_cmd_connection_read_channel_map_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_connection_read_channel_map(sl_bt_cmd_msg, connection);
 
     sl_bt_host_handle_command();
     *channel_map_len = rsp->data.rsp_connection_read_channel_map.channel_map.len;
@@ -979,14 +702,9 @@ sl_status_t sl_bt_connection_read_channel_map(uint8_t connection,
 sl_status_t sl_bt_connection_set_power_reporting(uint8_t connection,
                                                  uint8_t mode)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_connection_set_power_reporting.connection = connection;
-    cmd->data.cmd_connection_set_power_reporting.mode = mode;
-
-    cmd->header = sl_bt_cmd_connection_set_power_reporting_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_connection_set_power_reporting(sl_bt_cmd_msg, connection, mode);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_connection_set_power_reporting.result;
@@ -995,14 +713,9 @@ sl_status_t sl_bt_connection_set_power_reporting(uint8_t connection,
 sl_status_t sl_bt_connection_set_remote_power_reporting(uint8_t connection,
                                                         uint8_t mode)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_connection_set_remote_power_reporting.connection = connection;
-    cmd->data.cmd_connection_set_remote_power_reporting.mode = mode;
-
-    cmd->header = sl_bt_cmd_connection_set_remote_power_reporting_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_connection_set_remote_power_reporting(sl_bt_cmd_msg, connection, mode);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_connection_set_remote_power_reporting.result;
@@ -1013,14 +726,9 @@ sl_status_t sl_bt_connection_get_tx_power(uint8_t connection,
                                           int8_t *current_level,
                                           int8_t *max_level)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_connection_get_tx_power.connection = connection;
-    cmd->data.cmd_connection_get_tx_power.phy = phy;
-
-    cmd->header = sl_bt_cmd_connection_get_tx_power_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_connection_get_tx_power(sl_bt_cmd_msg, connection, phy);
 
     sl_bt_host_handle_command();
     *current_level = rsp->data.rsp_connection_get_tx_power.current_level;
@@ -1031,14 +739,9 @@ sl_status_t sl_bt_connection_get_tx_power(uint8_t connection,
 sl_status_t sl_bt_connection_get_remote_tx_power(uint8_t connection,
                                                  uint8_t phy)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_connection_get_remote_tx_power.connection = connection;
-    cmd->data.cmd_connection_get_remote_tx_power.phy = phy;
-
-    cmd->header = sl_bt_cmd_connection_get_remote_tx_power_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_connection_get_remote_tx_power(sl_bt_cmd_msg, connection, phy);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_connection_get_remote_tx_power.result;
@@ -1046,13 +749,9 @@ sl_status_t sl_bt_connection_get_remote_tx_power(uint8_t connection,
 
 sl_status_t sl_bt_connection_close(uint8_t connection)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_connection_close.connection = connection;
-
-    cmd->header = sl_bt_cmd_connection_close_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_connection_close(sl_bt_cmd_msg, connection);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_connection_close.result;
@@ -1060,13 +759,9 @@ sl_status_t sl_bt_connection_close(uint8_t connection)
 
 sl_status_t sl_bt_connection_read_remote_used_features(uint8_t connection)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_connection_read_remote_used_features.connection = connection;
-
-    cmd->header = sl_bt_cmd_connection_read_remote_used_features_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_connection_read_remote_used_features(sl_bt_cmd_msg, connection);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_connection_read_remote_used_features.result;
@@ -1074,13 +769,9 @@ sl_status_t sl_bt_connection_read_remote_used_features(uint8_t connection)
 
 sl_status_t sl_bt_gatt_set_max_mtu(uint16_t max_mtu, uint16_t *max_mtu_out)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_set_max_mtu.max_mtu = max_mtu;
-
-    cmd->header = sl_bt_cmd_gatt_set_max_mtu_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_gatt_set_max_mtu(sl_bt_cmd_msg, max_mtu);
 
     sl_bt_host_handle_command();
     *max_mtu_out = rsp->data.rsp_gatt_set_max_mtu.max_mtu_out;
@@ -1089,13 +780,9 @@ sl_status_t sl_bt_gatt_set_max_mtu(uint16_t max_mtu, uint16_t *max_mtu_out)
 
 sl_status_t sl_bt_gatt_discover_primary_services(uint8_t connection)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_discover_primary_services.connection = connection;
-
-    cmd->header = sl_bt_cmd_gatt_discover_primary_services_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_gatt_discover_primary_services(sl_bt_cmd_msg, connection);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gatt_discover_primary_services.result;
@@ -1105,31 +792,20 @@ sl_status_t sl_bt_gatt_discover_primary_services_by_uuid(uint8_t connection,
                                                          size_t uuid_len,
                                                          const uint8_t *uuid)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_discover_primary_services_by_uuid.connection = connection;
-    cmd->data.cmd_gatt_discover_primary_services_by_uuid.uuid.len = uuid_len;
-    memcpy(cmd->data.cmd_gatt_discover_primary_services_by_uuid.uuid.data, uuid, uuid_len);
-
-    cmd->header = sl_bt_cmd_gatt_discover_primary_services_by_uuid_id + (((2 + uuid_len) & 0xff) << 8) + (((2 + uuid_len) & 0x700) >> 8);
+    sl_bt_encode_gatt_discover_primary_services_by_uuid(sl_bt_cmd_msg, connection, uuid_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, uuid, uuid_len);
     return rsp->data.rsp_gatt_discover_primary_services_by_uuid.result;
 }
 
 sl_status_t sl_bt_gatt_find_included_services(uint8_t connection,
                                               uint32_t service)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_find_included_services.connection = connection;
-    cmd->data.cmd_gatt_find_included_services.service = service;
-
-    cmd->header = sl_bt_cmd_gatt_find_included_services_id + (((5) & 0xff) << 8) + (((5) & 0x700) >> 8);
+    sl_bt_encode_gatt_find_included_services(sl_bt_cmd_msg, connection, service);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gatt_find_included_services.result;
@@ -1138,14 +814,9 @@ sl_status_t sl_bt_gatt_find_included_services(uint8_t connection,
 sl_status_t sl_bt_gatt_discover_characteristics(uint8_t connection,
                                                 uint32_t service)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_discover_characteristics.connection = connection;
-    cmd->data.cmd_gatt_discover_characteristics.service = service;
-
-    cmd->header = sl_bt_cmd_gatt_discover_characteristics_id + (((5) & 0xff) << 8) + (((5) & 0x700) >> 8);
+    sl_bt_encode_gatt_discover_characteristics(sl_bt_cmd_msg, connection, service);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gatt_discover_characteristics.result;
@@ -1156,32 +827,20 @@ sl_status_t sl_bt_gatt_discover_characteristics_by_uuid(uint8_t connection,
                                                         size_t uuid_len,
                                                         const uint8_t *uuid)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_discover_characteristics_by_uuid.connection = connection;
-    cmd->data.cmd_gatt_discover_characteristics_by_uuid.service = service;
-    cmd->data.cmd_gatt_discover_characteristics_by_uuid.uuid.len = uuid_len;
-    memcpy(cmd->data.cmd_gatt_discover_characteristics_by_uuid.uuid.data, uuid, uuid_len);
+    sl_bt_encode_gatt_discover_characteristics_by_uuid(sl_bt_cmd_msg, connection, service, uuid_len);
 
-    cmd->header = sl_bt_cmd_gatt_discover_characteristics_by_uuid_id + (((6 + uuid_len) & 0xff) << 8) + (((6 + uuid_len) & 0x700) >> 8);
-
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, uuid, uuid_len);
     return rsp->data.rsp_gatt_discover_characteristics_by_uuid.result;
 }
 
 sl_status_t sl_bt_gatt_discover_descriptors(uint8_t connection,
                                             uint16_t characteristic)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_discover_descriptors.connection = connection;
-    cmd->data.cmd_gatt_discover_descriptors.characteristic = characteristic;
-
-    cmd->header = sl_bt_cmd_gatt_discover_descriptors_id + (((3) & 0xff) << 8) + (((3) & 0x700) >> 8);
+    sl_bt_encode_gatt_discover_descriptors(sl_bt_cmd_msg, connection, characteristic);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gatt_discover_descriptors.result;
@@ -1191,15 +850,9 @@ sl_status_t sl_bt_gatt_set_characteristic_notification(uint8_t connection,
                                                        uint16_t characteristic,
                                                        uint8_t flags)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_set_characteristic_notification.connection = connection;
-    cmd->data.cmd_gatt_set_characteristic_notification.characteristic = characteristic;
-    cmd->data.cmd_gatt_set_characteristic_notification.flags = flags;
-
-    cmd->header = sl_bt_cmd_gatt_set_characteristic_notification_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_gatt_set_characteristic_notification(sl_bt_cmd_msg, connection, characteristic, flags);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gatt_set_characteristic_notification.result;
@@ -1207,13 +860,9 @@ sl_status_t sl_bt_gatt_set_characteristic_notification(uint8_t connection,
 
 sl_status_t sl_bt_gatt_send_characteristic_confirmation(uint8_t connection)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_send_characteristic_confirmation.connection = connection;
-
-    cmd->header = sl_bt_cmd_gatt_send_characteristic_confirmation_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_gatt_send_characteristic_confirmation(sl_bt_cmd_msg, connection);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gatt_send_characteristic_confirmation.result;
@@ -1222,14 +871,9 @@ sl_status_t sl_bt_gatt_send_characteristic_confirmation(uint8_t connection)
 sl_status_t sl_bt_gatt_read_characteristic_value(uint8_t connection,
                                                  uint16_t characteristic)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_read_characteristic_value.connection = connection;
-    cmd->data.cmd_gatt_read_characteristic_value.characteristic = characteristic;
-
-    cmd->header = sl_bt_cmd_gatt_read_characteristic_value_id + (((3) & 0xff) << 8) + (((3) & 0x700) >> 8);
+    sl_bt_encode_gatt_read_characteristic_value(sl_bt_cmd_msg, connection, characteristic);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gatt_read_characteristic_value.result;
@@ -1240,16 +884,9 @@ sl_status_t sl_bt_gatt_read_characteristic_value_from_offset(uint8_t connection,
                                                              uint16_t offset,
                                                              uint16_t maxlen)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_read_characteristic_value_from_offset.connection = connection;
-    cmd->data.cmd_gatt_read_characteristic_value_from_offset.characteristic = characteristic;
-    cmd->data.cmd_gatt_read_characteristic_value_from_offset.offset = offset;
-    cmd->data.cmd_gatt_read_characteristic_value_from_offset.maxlen = maxlen;
-
-    cmd->header = sl_bt_cmd_gatt_read_characteristic_value_from_offset_id + (((7) & 0xff) << 8) + (((7) & 0x700) >> 8);
+    sl_bt_encode_gatt_read_characteristic_value_from_offset(sl_bt_cmd_msg, connection, characteristic, offset, maxlen);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gatt_read_characteristic_value_from_offset.result;
@@ -1259,17 +896,11 @@ sl_status_t sl_bt_gatt_read_multiple_characteristic_values(uint8_t connection,
                                                            size_t characteristic_list_len,
                                                            const uint8_t *characteristic_list)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_read_multiple_characteristic_values.connection = connection;
-    cmd->data.cmd_gatt_read_multiple_characteristic_values.characteristic_list.len = characteristic_list_len;
-    memcpy(cmd->data.cmd_gatt_read_multiple_characteristic_values.characteristic_list.data, characteristic_list, characteristic_list_len);
-
-    cmd->header = sl_bt_cmd_gatt_read_multiple_characteristic_values_id + (((2 + characteristic_list_len) & 0xff) << 8) + (((2 + characteristic_list_len) & 0x700) >> 8);
+    sl_bt_encode_gatt_read_multiple_characteristic_values(sl_bt_cmd_msg, connection, characteristic_list_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, characteristic_list, characteristic_list_len);
     return rsp->data.rsp_gatt_read_multiple_characteristic_values.result;
 }
 
@@ -1278,18 +909,11 @@ sl_status_t sl_bt_gatt_read_characteristic_value_by_uuid(uint8_t connection,
                                                          size_t uuid_len,
                                                          const uint8_t *uuid)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_read_characteristic_value_by_uuid.connection = connection;
-    cmd->data.cmd_gatt_read_characteristic_value_by_uuid.service = service;
-    cmd->data.cmd_gatt_read_characteristic_value_by_uuid.uuid.len = uuid_len;
-    memcpy(cmd->data.cmd_gatt_read_characteristic_value_by_uuid.uuid.data, uuid, uuid_len);
-
-    cmd->header = sl_bt_cmd_gatt_read_characteristic_value_by_uuid_id + (((6 + uuid_len) & 0xff) << 8) + (((6 + uuid_len) & 0x700) >> 8);
+    sl_bt_encode_gatt_read_characteristic_value_by_uuid(sl_bt_cmd_msg, connection, service, uuid_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, uuid, uuid_len);
     return rsp->data.rsp_gatt_read_characteristic_value_by_uuid.result;
 }
 
@@ -1298,18 +922,11 @@ sl_status_t sl_bt_gatt_write_characteristic_value(uint8_t connection,
                                                   size_t value_len,
                                                   const uint8_t *value)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_write_characteristic_value.connection = connection;
-    cmd->data.cmd_gatt_write_characteristic_value.characteristic = characteristic;
-    cmd->data.cmd_gatt_write_characteristic_value.value.len = value_len;
-    memcpy(cmd->data.cmd_gatt_write_characteristic_value.value.data, value, value_len);
+    sl_bt_encode_gatt_write_characteristic_value(sl_bt_cmd_msg, connection, characteristic, value_len);
 
-    cmd->header = sl_bt_cmd_gatt_write_characteristic_value_id + (((4 + value_len) & 0xff) << 8) + (((4 + value_len) & 0x700) >> 8);
-
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     return rsp->data.rsp_gatt_write_characteristic_value.result;
 }
 
@@ -1319,18 +936,11 @@ sl_status_t sl_bt_gatt_write_characteristic_value_without_response(uint8_t conne
                                                                    const uint8_t *value,
                                                                    uint16_t *sent_len)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_write_characteristic_value_without_response.connection = connection;
-    cmd->data.cmd_gatt_write_characteristic_value_without_response.characteristic = characteristic;
-    cmd->data.cmd_gatt_write_characteristic_value_without_response.value.len = value_len;
-    memcpy(cmd->data.cmd_gatt_write_characteristic_value_without_response.value.data, value, value_len);
+    sl_bt_encode_gatt_write_characteristic_value_without_response(sl_bt_cmd_msg, connection, characteristic, value_len);
 
-    cmd->header = sl_bt_cmd_gatt_write_characteristic_value_without_response_id + (((4 + value_len) & 0xff) << 8) + (((4 + value_len) & 0x700) >> 8);
-
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     *sent_len = rsp->data.rsp_gatt_write_characteristic_value_without_response.sent_len;
     return rsp->data.rsp_gatt_write_characteristic_value_without_response.result;
 }
@@ -1342,19 +952,11 @@ sl_status_t sl_bt_gatt_prepare_characteristic_value_write(uint8_t connection,
                                                           const uint8_t *value,
                                                           uint16_t *sent_len)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_prepare_characteristic_value_write.connection = connection;
-    cmd->data.cmd_gatt_prepare_characteristic_value_write.characteristic = characteristic;
-    cmd->data.cmd_gatt_prepare_characteristic_value_write.offset = offset;
-    cmd->data.cmd_gatt_prepare_characteristic_value_write.value.len = value_len;
-    memcpy(cmd->data.cmd_gatt_prepare_characteristic_value_write.value.data, value, value_len);
+    sl_bt_encode_gatt_prepare_characteristic_value_write(sl_bt_cmd_msg, connection, characteristic, offset, value_len);
 
-    cmd->header = sl_bt_cmd_gatt_prepare_characteristic_value_write_id + (((6 + value_len) & 0xff) << 8) + (((6 + value_len) & 0x700) >> 8);
-
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     *sent_len = rsp->data.rsp_gatt_prepare_characteristic_value_write.sent_len;
     return rsp->data.rsp_gatt_prepare_characteristic_value_write.result;
 }
@@ -1366,19 +968,11 @@ sl_status_t sl_bt_gatt_prepare_characteristic_value_reliable_write(uint8_t conne
                                                                    const uint8_t *value,
                                                                    uint16_t *sent_len)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_prepare_characteristic_value_reliable_write.connection = connection;
-    cmd->data.cmd_gatt_prepare_characteristic_value_reliable_write.characteristic = characteristic;
-    cmd->data.cmd_gatt_prepare_characteristic_value_reliable_write.offset = offset;
-    cmd->data.cmd_gatt_prepare_characteristic_value_reliable_write.value.len = value_len;
-    memcpy(cmd->data.cmd_gatt_prepare_characteristic_value_reliable_write.value.data, value, value_len);
+    sl_bt_encode_gatt_prepare_characteristic_value_reliable_write(sl_bt_cmd_msg, connection, characteristic, offset, value_len);
 
-    cmd->header = sl_bt_cmd_gatt_prepare_characteristic_value_reliable_write_id + (((6 + value_len) & 0xff) << 8) + (((6 + value_len) & 0x700) >> 8);
-
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     *sent_len = rsp->data.rsp_gatt_prepare_characteristic_value_reliable_write.sent_len;
     return rsp->data.rsp_gatt_prepare_characteristic_value_reliable_write.result;
 }
@@ -1386,14 +980,9 @@ sl_status_t sl_bt_gatt_prepare_characteristic_value_reliable_write(uint8_t conne
 sl_status_t sl_bt_gatt_execute_characteristic_value_write(uint8_t connection,
                                                           uint8_t flags)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_execute_characteristic_value_write.connection = connection;
-    cmd->data.cmd_gatt_execute_characteristic_value_write.flags = flags;
-
-    cmd->header = sl_bt_cmd_gatt_execute_characteristic_value_write_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_gatt_execute_characteristic_value_write(sl_bt_cmd_msg, connection, flags);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gatt_execute_characteristic_value_write.result;
@@ -1402,14 +991,9 @@ sl_status_t sl_bt_gatt_execute_characteristic_value_write(uint8_t connection,
 sl_status_t sl_bt_gatt_read_descriptor_value(uint8_t connection,
                                              uint16_t descriptor)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_read_descriptor_value.connection = connection;
-    cmd->data.cmd_gatt_read_descriptor_value.descriptor = descriptor;
-
-    cmd->header = sl_bt_cmd_gatt_read_descriptor_value_id + (((3) & 0xff) << 8) + (((3) & 0x700) >> 8);
+    sl_bt_encode_gatt_read_descriptor_value(sl_bt_cmd_msg, connection, descriptor);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gatt_read_descriptor_value.result;
@@ -1420,28 +1004,19 @@ sl_status_t sl_bt_gatt_write_descriptor_value(uint8_t connection,
                                               size_t value_len,
                                               const uint8_t *value)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_write_descriptor_value.connection = connection;
-    cmd->data.cmd_gatt_write_descriptor_value.descriptor = descriptor;
-    cmd->data.cmd_gatt_write_descriptor_value.value.len = value_len;
-    memcpy(cmd->data.cmd_gatt_write_descriptor_value.value.data, value, value_len);
-
-    cmd->header = sl_bt_cmd_gatt_write_descriptor_value_id + (((4 + value_len) & 0xff) << 8) + (((4 + value_len) & 0x700) >> 8);
+    sl_bt_encode_gatt_write_descriptor_value(sl_bt_cmd_msg, connection, descriptor, value_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     return rsp->data.rsp_gatt_write_descriptor_value.result;
 }
 
 sl_status_t sl_bt_gattdb_new_session(uint16_t *session)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_gattdb_new_session_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_gattdb_new_session(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     *session = rsp->data.rsp_gattdb_new_session.session;
@@ -1455,33 +1030,20 @@ sl_status_t sl_bt_gattdb_add_service(uint16_t session,
                                      const uint8_t *uuid,
                                      uint16_t *service)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_add_service.session = session;
-    cmd->data.cmd_gattdb_add_service.type = type;
-    cmd->data.cmd_gattdb_add_service.property = property;
-    cmd->data.cmd_gattdb_add_service.uuid.len = uuid_len;
-    memcpy(cmd->data.cmd_gattdb_add_service.uuid.data, uuid, uuid_len);
-
-    cmd->header = sl_bt_cmd_gattdb_add_service_id + (((5 + uuid_len) & 0xff) << 8) + (((5 + uuid_len) & 0x700) >> 8);
+    sl_bt_encode_gattdb_add_service(sl_bt_cmd_msg, session, type, property, uuid_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, uuid, uuid_len);
     *service = rsp->data.rsp_gattdb_add_service.service;
     return rsp->data.rsp_gattdb_add_service.result;
 }
 
 sl_status_t sl_bt_gattdb_remove_service(uint16_t session, uint16_t service)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_remove_service.session = session;
-    cmd->data.cmd_gattdb_remove_service.service = service;
-
-    cmd->header = sl_bt_cmd_gattdb_remove_service_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_gattdb_remove_service(sl_bt_cmd_msg, session, service);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gattdb_remove_service.result;
@@ -1492,15 +1054,9 @@ sl_status_t sl_bt_gattdb_add_included_service(uint16_t session,
                                               uint16_t included_service,
                                               uint16_t *attribute)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_add_included_service.session = session;
-    cmd->data.cmd_gattdb_add_included_service.service = service;
-    cmd->data.cmd_gattdb_add_included_service.included_service = included_service;
-
-    cmd->header = sl_bt_cmd_gattdb_add_included_service_id + (((6) & 0xff) << 8) + (((6) & 0x700) >> 8);
+    sl_bt_encode_gattdb_add_included_service(sl_bt_cmd_msg, session, service, included_service);
 
     sl_bt_host_handle_command();
     *attribute = rsp->data.rsp_gattdb_add_included_service.attribute;
@@ -1510,14 +1066,9 @@ sl_status_t sl_bt_gattdb_add_included_service(uint16_t session,
 sl_status_t sl_bt_gattdb_remove_included_service(uint16_t session,
                                                  uint16_t attribute)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_remove_included_service.session = session;
-    cmd->data.cmd_gattdb_remove_included_service.attribute = attribute;
-
-    cmd->header = sl_bt_cmd_gattdb_remove_included_service_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_gattdb_remove_included_service(sl_bt_cmd_msg, session, attribute);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gattdb_remove_included_service.result;
@@ -1535,24 +1086,11 @@ sl_status_t sl_bt_gattdb_add_uuid16_characteristic(uint16_t session,
                                                    const uint8_t *value,
                                                    uint16_t *characteristic)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_add_uuid16_characteristic.session = session;
-    cmd->data.cmd_gattdb_add_uuid16_characteristic.service = service;
-    cmd->data.cmd_gattdb_add_uuid16_characteristic.property = property;
-    cmd->data.cmd_gattdb_add_uuid16_characteristic.security = security;
-    cmd->data.cmd_gattdb_add_uuid16_characteristic.flag = flag;
-    cmd->data.cmd_gattdb_add_uuid16_characteristic.uuid = uuid;
-    cmd->data.cmd_gattdb_add_uuid16_characteristic.value_type = value_type;
-    cmd->data.cmd_gattdb_add_uuid16_characteristic.maxlen = maxlen;
-    cmd->data.cmd_gattdb_add_uuid16_characteristic.value.len = value_len;
-    memcpy(cmd->data.cmd_gattdb_add_uuid16_characteristic.value.data, value, value_len);
-
-    cmd->header = sl_bt_cmd_gattdb_add_uuid16_characteristic_id + (((16 + value_len) & 0xff) << 8) + (((16 + value_len) & 0x700) >> 8);
+    sl_bt_encode_gattdb_add_uuid16_characteristic(sl_bt_cmd_msg, session, service, property, security, flag, uuid, value_type, maxlen, value_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     *characteristic = rsp->data.rsp_gattdb_add_uuid16_characteristic.characteristic;
     return rsp->data.rsp_gattdb_add_uuid16_characteristic.result;
 }
@@ -1569,24 +1107,11 @@ sl_status_t sl_bt_gattdb_add_uuid128_characteristic(uint16_t session,
                                                     const uint8_t *value,
                                                     uint16_t *characteristic)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_add_uuid128_characteristic.session = session;
-    cmd->data.cmd_gattdb_add_uuid128_characteristic.service = service;
-    cmd->data.cmd_gattdb_add_uuid128_characteristic.property = property;
-    cmd->data.cmd_gattdb_add_uuid128_characteristic.security = security;
-    cmd->data.cmd_gattdb_add_uuid128_characteristic.flag = flag;
-    cmd->data.cmd_gattdb_add_uuid128_characteristic.uuid = uuid;
-    cmd->data.cmd_gattdb_add_uuid128_characteristic.value_type = value_type;
-    cmd->data.cmd_gattdb_add_uuid128_characteristic.maxlen = maxlen;
-    cmd->data.cmd_gattdb_add_uuid128_characteristic.value.len = value_len;
-    memcpy(cmd->data.cmd_gattdb_add_uuid128_characteristic.value.data, value, value_len);
-
-    cmd->header = sl_bt_cmd_gattdb_add_uuid128_characteristic_id + (((30 + value_len) & 0xff) << 8) + (((30 + value_len) & 0x700) >> 8);
+    sl_bt_encode_gattdb_add_uuid128_characteristic(sl_bt_cmd_msg, session, service, property, security, flag, uuid, value_type, maxlen, value_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     *characteristic = rsp->data.rsp_gattdb_add_uuid128_characteristic.characteristic;
     return rsp->data.rsp_gattdb_add_uuid128_characteristic.result;
 }
@@ -1594,14 +1119,9 @@ sl_status_t sl_bt_gattdb_add_uuid128_characteristic(uint16_t session,
 sl_status_t sl_bt_gattdb_remove_characteristic(uint16_t session,
                                                uint16_t characteristic)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_remove_characteristic.session = session;
-    cmd->data.cmd_gattdb_remove_characteristic.characteristic = characteristic;
-
-    cmd->header = sl_bt_cmd_gattdb_remove_characteristic_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_gattdb_remove_characteristic(sl_bt_cmd_msg, session, characteristic);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gattdb_remove_characteristic.result;
@@ -1618,23 +1138,11 @@ sl_status_t sl_bt_gattdb_add_uuid16_descriptor(uint16_t session,
                                                const uint8_t *value,
                                                uint16_t *descriptor)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_add_uuid16_descriptor.session = session;
-    cmd->data.cmd_gattdb_add_uuid16_descriptor.characteristic = characteristic;
-    cmd->data.cmd_gattdb_add_uuid16_descriptor.property = property;
-    cmd->data.cmd_gattdb_add_uuid16_descriptor.security = security;
-    cmd->data.cmd_gattdb_add_uuid16_descriptor.uuid = uuid;
-    cmd->data.cmd_gattdb_add_uuid16_descriptor.value_type = value_type;
-    cmd->data.cmd_gattdb_add_uuid16_descriptor.maxlen = maxlen;
-    cmd->data.cmd_gattdb_add_uuid16_descriptor.value.len = value_len;
-    memcpy(cmd->data.cmd_gattdb_add_uuid16_descriptor.value.data, value, value_len);
-
-    cmd->header = sl_bt_cmd_gattdb_add_uuid16_descriptor_id + (((15 + value_len) & 0xff) << 8) + (((15 + value_len) & 0x700) >> 8);
+    sl_bt_encode_gattdb_add_uuid16_descriptor(sl_bt_cmd_msg, session, characteristic, property, security, uuid, value_type, maxlen, value_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     *descriptor = rsp->data.rsp_gattdb_add_uuid16_descriptor.descriptor;
     return rsp->data.rsp_gattdb_add_uuid16_descriptor.result;
 }
@@ -1650,23 +1158,11 @@ sl_status_t sl_bt_gattdb_add_uuid128_descriptor(uint16_t session,
                                                 const uint8_t *value,
                                                 uint16_t *descriptor)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_add_uuid128_descriptor.session = session;
-    cmd->data.cmd_gattdb_add_uuid128_descriptor.characteristic = characteristic;
-    cmd->data.cmd_gattdb_add_uuid128_descriptor.property = property;
-    cmd->data.cmd_gattdb_add_uuid128_descriptor.security = security;
-    cmd->data.cmd_gattdb_add_uuid128_descriptor.uuid = uuid;
-    cmd->data.cmd_gattdb_add_uuid128_descriptor.value_type = value_type;
-    cmd->data.cmd_gattdb_add_uuid128_descriptor.maxlen = maxlen;
-    cmd->data.cmd_gattdb_add_uuid128_descriptor.value.len = value_len;
-    memcpy(cmd->data.cmd_gattdb_add_uuid128_descriptor.value.data, value, value_len);
-
-    cmd->header = sl_bt_cmd_gattdb_add_uuid128_descriptor_id + (((29 + value_len) & 0xff) << 8) + (((29 + value_len) & 0x700) >> 8);
+    sl_bt_encode_gattdb_add_uuid128_descriptor(sl_bt_cmd_msg, session, characteristic, property, security, uuid, value_type, maxlen, value_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     *descriptor = rsp->data.rsp_gattdb_add_uuid128_descriptor.descriptor;
     return rsp->data.rsp_gattdb_add_uuid128_descriptor.result;
 }
@@ -1674,14 +1170,9 @@ sl_status_t sl_bt_gattdb_add_uuid128_descriptor(uint16_t session,
 sl_status_t sl_bt_gattdb_remove_descriptor(uint16_t session,
                                            uint16_t descriptor)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_remove_descriptor.session = session;
-    cmd->data.cmd_gattdb_remove_descriptor.descriptor = descriptor;
-
-    cmd->header = sl_bt_cmd_gattdb_remove_descriptor_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_gattdb_remove_descriptor(sl_bt_cmd_msg, session, descriptor);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gattdb_remove_descriptor.result;
@@ -1689,14 +1180,9 @@ sl_status_t sl_bt_gattdb_remove_descriptor(uint16_t session,
 
 sl_status_t sl_bt_gattdb_start_service(uint16_t session, uint16_t service)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_start_service.session = session;
-    cmd->data.cmd_gattdb_start_service.service = service;
-
-    cmd->header = sl_bt_cmd_gattdb_start_service_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_gattdb_start_service(sl_bt_cmd_msg, session, service);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gattdb_start_service.result;
@@ -1704,14 +1190,9 @@ sl_status_t sl_bt_gattdb_start_service(uint16_t session, uint16_t service)
 
 sl_status_t sl_bt_gattdb_stop_service(uint16_t session, uint16_t service)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_stop_service.session = session;
-    cmd->data.cmd_gattdb_stop_service.service = service;
-
-    cmd->header = sl_bt_cmd_gattdb_stop_service_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_gattdb_stop_service(sl_bt_cmd_msg, session, service);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gattdb_stop_service.result;
@@ -1720,14 +1201,9 @@ sl_status_t sl_bt_gattdb_stop_service(uint16_t session, uint16_t service)
 sl_status_t sl_bt_gattdb_start_characteristic(uint16_t session,
                                               uint16_t characteristic)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_start_characteristic.session = session;
-    cmd->data.cmd_gattdb_start_characteristic.characteristic = characteristic;
-
-    cmd->header = sl_bt_cmd_gattdb_start_characteristic_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_gattdb_start_characteristic(sl_bt_cmd_msg, session, characteristic);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gattdb_start_characteristic.result;
@@ -1736,14 +1212,9 @@ sl_status_t sl_bt_gattdb_start_characteristic(uint16_t session,
 sl_status_t sl_bt_gattdb_stop_characteristic(uint16_t session,
                                              uint16_t characteristic)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_stop_characteristic.session = session;
-    cmd->data.cmd_gattdb_stop_characteristic.characteristic = characteristic;
-
-    cmd->header = sl_bt_cmd_gattdb_stop_characteristic_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_gattdb_stop_characteristic(sl_bt_cmd_msg, session, characteristic);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gattdb_stop_characteristic.result;
@@ -1751,13 +1222,9 @@ sl_status_t sl_bt_gattdb_stop_characteristic(uint16_t session,
 
 sl_status_t sl_bt_gattdb_commit(uint16_t session)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_commit.session = session;
-
-    cmd->header = sl_bt_cmd_gattdb_commit_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_gattdb_commit(sl_bt_cmd_msg, session);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gattdb_commit.result;
@@ -1765,13 +1232,9 @@ sl_status_t sl_bt_gattdb_commit(uint16_t session)
 
 sl_status_t sl_bt_gattdb_abort(uint16_t session)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gattdb_abort.session = session;
-
-    cmd->header = sl_bt_cmd_gattdb_abort_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_gattdb_abort(sl_bt_cmd_msg, session);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gattdb_abort.result;
@@ -1780,13 +1243,9 @@ sl_status_t sl_bt_gattdb_abort(uint16_t session)
 sl_status_t sl_bt_gatt_server_set_max_mtu(uint16_t max_mtu,
                                           uint16_t *max_mtu_out)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_set_max_mtu.max_mtu = max_mtu;
-
-    cmd->header = sl_bt_cmd_gatt_server_set_max_mtu_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_set_max_mtu(sl_bt_cmd_msg, max_mtu);
 
     sl_bt_host_handle_command();
     *max_mtu_out = rsp->data.rsp_gatt_server_set_max_mtu.max_mtu_out;
@@ -1795,13 +1254,9 @@ sl_status_t sl_bt_gatt_server_set_max_mtu(uint16_t max_mtu,
 
 sl_status_t sl_bt_gatt_server_get_mtu(uint8_t connection, uint16_t *mtu)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_get_mtu.connection = connection;
-
-    cmd->header = sl_bt_cmd_gatt_server_get_mtu_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_get_mtu(sl_bt_cmd_msg, connection);
 
     sl_bt_host_handle_command();
     *mtu = rsp->data.rsp_gatt_server_get_mtu.mtu;
@@ -1813,17 +1268,11 @@ sl_status_t sl_bt_gatt_server_find_attribute(uint16_t start,
                                              const uint8_t *type,
                                              uint16_t *attribute)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_find_attribute.start = start;
-    cmd->data.cmd_gatt_server_find_attribute.type.len = type_len;
-    memcpy(cmd->data.cmd_gatt_server_find_attribute.type.data, type, type_len);
+    sl_bt_encode_gatt_server_find_attribute(sl_bt_cmd_msg, start, type_len);
 
-    cmd->header = sl_bt_cmd_gatt_server_find_attribute_id + (((3 + type_len) & 0xff) << 8) + (((3 + type_len) & 0x700) >> 8);
-
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, type, type_len);
     *attribute = rsp->data.rsp_gatt_server_find_attribute.attribute;
     return rsp->data.rsp_gatt_server_find_attribute.result;
 }
@@ -1834,14 +1283,9 @@ sl_status_t sl_bt_gatt_server_read_attribute_value(uint16_t attribute,
                                                    size_t *value_len,
                                                    uint8_t *value)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_read_attribute_value.attribute = attribute;
-    cmd->data.cmd_gatt_server_read_attribute_value.offset = offset;
-
-    cmd->header = sl_bt_cmd_gatt_server_read_attribute_value_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_read_attribute_value(sl_bt_cmd_msg, attribute, offset);
 
     sl_bt_host_handle_command();
     *value_len = rsp->data.rsp_gatt_server_read_attribute_value.value.len;
@@ -1857,13 +1301,9 @@ sl_status_t sl_bt_gatt_server_read_attribute_type(uint16_t attribute,
                                                   size_t *type_len,
                                                   uint8_t *type)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_read_attribute_type.attribute = attribute;
-
-    cmd->header = sl_bt_cmd_gatt_server_read_attribute_type_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_read_attribute_type(sl_bt_cmd_msg, attribute);
 
     sl_bt_host_handle_command();
     *type_len = rsp->data.rsp_gatt_server_read_attribute_type.type.len;
@@ -1879,18 +1319,11 @@ sl_status_t sl_bt_gatt_server_write_attribute_value(uint16_t attribute,
                                                     size_t value_len,
                                                     const uint8_t *value)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_write_attribute_value.attribute = attribute;
-    cmd->data.cmd_gatt_server_write_attribute_value.offset = offset;
-    cmd->data.cmd_gatt_server_write_attribute_value.value.len = value_len;
-    memcpy(cmd->data.cmd_gatt_server_write_attribute_value.value.data, value, value_len);
-
-    cmd->header = sl_bt_cmd_gatt_server_write_attribute_value_id + (((5 + value_len) & 0xff) << 8) + (((5 + value_len) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_write_attribute_value(sl_bt_cmd_msg, attribute, offset, value_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     return rsp->data.rsp_gatt_server_write_attribute_value.result;
 }
 
@@ -1901,19 +1334,11 @@ sl_status_t sl_bt_gatt_server_send_user_read_response(uint8_t connection,
                                                       const uint8_t *value,
                                                       uint16_t *sent_len)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_send_user_read_response.connection = connection;
-    cmd->data.cmd_gatt_server_send_user_read_response.characteristic = characteristic;
-    cmd->data.cmd_gatt_server_send_user_read_response.att_errorcode = att_errorcode;
-    cmd->data.cmd_gatt_server_send_user_read_response.value.len = value_len;
-    memcpy(cmd->data.cmd_gatt_server_send_user_read_response.value.data, value, value_len);
-
-    cmd->header = sl_bt_cmd_gatt_server_send_user_read_response_id + (((5 + value_len) & 0xff) << 8) + (((5 + value_len) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_send_user_read_response(sl_bt_cmd_msg, connection, characteristic, att_errorcode, value_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     *sent_len = rsp->data.rsp_gatt_server_send_user_read_response.sent_len;
     return rsp->data.rsp_gatt_server_send_user_read_response.result;
 }
@@ -1922,15 +1347,9 @@ sl_status_t sl_bt_gatt_server_send_user_write_response(uint8_t connection,
                                                        uint16_t characteristic,
                                                        uint8_t att_errorcode)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_send_user_write_response.connection = connection;
-    cmd->data.cmd_gatt_server_send_user_write_response.characteristic = characteristic;
-    cmd->data.cmd_gatt_server_send_user_write_response.att_errorcode = att_errorcode;
-
-    cmd->header = sl_bt_cmd_gatt_server_send_user_write_response_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_send_user_write_response(sl_bt_cmd_msg, connection, characteristic, att_errorcode);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gatt_server_send_user_write_response.result;
@@ -1942,18 +1361,11 @@ SL_BGAPI_DEPRECATED sl_status_t sl_bt_gatt_server_send_characteristic_notificati
                                                                                    const uint8_t *value,
                                                                                    uint16_t *sent_len)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_send_characteristic_notification.connection = connection;
-    cmd->data.cmd_gatt_server_send_characteristic_notification.characteristic = characteristic;
-    cmd->data.cmd_gatt_server_send_characteristic_notification.value.len = value_len;
-    memcpy(cmd->data.cmd_gatt_server_send_characteristic_notification.value.data, value, value_len);
-
-    cmd->header = sl_bt_cmd_gatt_server_send_characteristic_notification_id + (((4 + value_len) & 0xff) << 8) + (((4 + value_len) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_send_characteristic_notification(sl_bt_cmd_msg, connection, characteristic, value_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     *sent_len = rsp->data.rsp_gatt_server_send_characteristic_notification.sent_len;
     return rsp->data.rsp_gatt_server_send_characteristic_notification.result;
 }
@@ -1963,18 +1375,11 @@ sl_status_t sl_bt_gatt_server_send_notification(uint8_t connection,
                                                 size_t value_len,
                                                 const uint8_t *value)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_send_notification.connection = connection;
-    cmd->data.cmd_gatt_server_send_notification.characteristic = characteristic;
-    cmd->data.cmd_gatt_server_send_notification.value.len = value_len;
-    memcpy(cmd->data.cmd_gatt_server_send_notification.value.data, value, value_len);
-
-    cmd->header = sl_bt_cmd_gatt_server_send_notification_id + (((4 + value_len) & 0xff) << 8) + (((4 + value_len) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_send_notification(sl_bt_cmd_msg, connection, characteristic, value_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     return rsp->data.rsp_gatt_server_send_notification.result;
 }
 
@@ -1983,18 +1388,11 @@ sl_status_t sl_bt_gatt_server_send_indication(uint8_t connection,
                                               size_t value_len,
                                               const uint8_t *value)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_send_indication.connection = connection;
-    cmd->data.cmd_gatt_server_send_indication.characteristic = characteristic;
-    cmd->data.cmd_gatt_server_send_indication.value.len = value_len;
-    memcpy(cmd->data.cmd_gatt_server_send_indication.value.data, value, value_len);
-
-    cmd->header = sl_bt_cmd_gatt_server_send_indication_id + (((4 + value_len) & 0xff) << 8) + (((4 + value_len) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_send_indication(sl_bt_cmd_msg, connection, characteristic, value_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     return rsp->data.rsp_gatt_server_send_indication.result;
 }
 
@@ -2002,17 +1400,11 @@ sl_status_t sl_bt_gatt_server_notify_all(uint16_t characteristic,
                                          size_t value_len,
                                          const uint8_t *value)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_notify_all.characteristic = characteristic;
-    cmd->data.cmd_gatt_server_notify_all.value.len = value_len;
-    memcpy(cmd->data.cmd_gatt_server_notify_all.value.data, value, value_len);
-
-    cmd->header = sl_bt_cmd_gatt_server_notify_all_id + (((3 + value_len) & 0xff) << 8) + (((3 + value_len) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_notify_all(sl_bt_cmd_msg, characteristic, value_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     return rsp->data.rsp_gatt_server_notify_all.result;
 }
 
@@ -2020,14 +1412,9 @@ sl_status_t sl_bt_gatt_server_read_client_configuration(uint8_t connection,
                                                         uint16_t characteristic,
                                                         uint16_t *client_config_flags)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_read_client_configuration.connection = connection;
-    cmd->data.cmd_gatt_server_read_client_configuration.characteristic = characteristic;
-
-    cmd->header = sl_bt_cmd_gatt_server_read_client_configuration_id + (((3) & 0xff) << 8) + (((3) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_read_client_configuration(sl_bt_cmd_msg, connection, characteristic);
 
     sl_bt_host_handle_command();
     *client_config_flags = rsp->data.rsp_gatt_server_read_client_configuration.client_config_flags;
@@ -2041,34 +1428,20 @@ sl_status_t sl_bt_gatt_server_send_user_prepare_write_response(uint8_t connectio
                                                                size_t value_len,
                                                                const uint8_t *value)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_send_user_prepare_write_response.connection = connection;
-    cmd->data.cmd_gatt_server_send_user_prepare_write_response.characteristic = characteristic;
-    cmd->data.cmd_gatt_server_send_user_prepare_write_response.att_errorcode = att_errorcode;
-    cmd->data.cmd_gatt_server_send_user_prepare_write_response.offset = offset;
-    cmd->data.cmd_gatt_server_send_user_prepare_write_response.value.len = value_len;
-    memcpy(cmd->data.cmd_gatt_server_send_user_prepare_write_response.value.data, value, value_len);
-
-    cmd->header = sl_bt_cmd_gatt_server_send_user_prepare_write_response_id + (((7 + value_len) & 0xff) << 8) + (((7 + value_len) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_send_user_prepare_write_response(sl_bt_cmd_msg, connection, characteristic, att_errorcode, offset, value_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     return rsp->data.rsp_gatt_server_send_user_prepare_write_response.result;
 }
 
 sl_status_t sl_bt_gatt_server_set_capabilities(uint32_t caps,
                                                uint32_t reserved)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_set_capabilities.caps = caps;
-    cmd->data.cmd_gatt_server_set_capabilities.reserved = reserved;
-
-    cmd->header = sl_bt_cmd_gatt_server_set_capabilities_id + (((8) & 0xff) << 8) + (((8) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_set_capabilities(sl_bt_cmd_msg, caps, reserved);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gatt_server_set_capabilities.result;
@@ -2076,13 +1449,9 @@ sl_status_t sl_bt_gatt_server_set_capabilities(uint32_t caps,
 
 sl_status_t sl_bt_gatt_server_enable_capabilities(uint32_t caps)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_enable_capabilities.caps = caps;
-
-    cmd->header = sl_bt_cmd_gatt_server_enable_capabilities_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_enable_capabilities(sl_bt_cmd_msg, caps);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gatt_server_enable_capabilities.result;
@@ -2090,13 +1459,9 @@ sl_status_t sl_bt_gatt_server_enable_capabilities(uint32_t caps)
 
 sl_status_t sl_bt_gatt_server_disable_capabilities(uint32_t caps)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_disable_capabilities.caps = caps;
-
-    cmd->header = sl_bt_cmd_gatt_server_disable_capabilities_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_disable_capabilities(sl_bt_cmd_msg, caps);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_gatt_server_disable_capabilities.result;
@@ -2104,11 +1469,9 @@ sl_status_t sl_bt_gatt_server_disable_capabilities(uint32_t caps)
 
 sl_status_t sl_bt_gatt_server_get_enabled_capabilities(uint32_t *caps)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_gatt_server_get_enabled_capabilities_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_get_enabled_capabilities(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     *caps = rsp->data.rsp_gatt_server_get_enabled_capabilities.caps;
@@ -2118,13 +1481,9 @@ sl_status_t sl_bt_gatt_server_get_enabled_capabilities(uint32_t *caps)
 sl_status_t sl_bt_gatt_server_read_client_supported_features(uint8_t connection,
                                                              uint8_t *client_features)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_gatt_server_read_client_supported_features.connection = connection;
-
-    cmd->header = sl_bt_cmd_gatt_server_read_client_supported_features_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_gatt_server_read_client_supported_features(sl_bt_cmd_msg, connection);
 
     sl_bt_host_handle_command();
     *client_features = rsp->data.rsp_gatt_server_read_client_supported_features.client_features;
@@ -2135,17 +1494,11 @@ sl_status_t sl_bt_nvm_save(uint16_t key,
                            size_t value_len,
                            const uint8_t *value)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_nvm_save.key = key;
-    cmd->data.cmd_nvm_save.value.len = value_len;
-    memcpy(cmd->data.cmd_nvm_save.value.data, value, value_len);
+    sl_bt_encode_nvm_save(sl_bt_cmd_msg, key, value_len);
 
-    cmd->header = sl_bt_cmd_nvm_save_id + (((3 + value_len) & 0xff) << 8) + (((3 + value_len) & 0x700) >> 8);
-
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, value, value_len);
     return rsp->data.rsp_nvm_save.result;
 }
 
@@ -2154,13 +1507,9 @@ sl_status_t sl_bt_nvm_load(uint16_t key,
                            size_t *value_len,
                            uint8_t *value)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_nvm_load.key = key;
-
-    cmd->header = sl_bt_cmd_nvm_load_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_nvm_load(sl_bt_cmd_msg, key);
 
     sl_bt_host_handle_command();
     *value_len = rsp->data.rsp_nvm_load.value.len;
@@ -2173,13 +1522,9 @@ sl_status_t sl_bt_nvm_load(uint16_t key,
 
 sl_status_t sl_bt_nvm_erase(uint16_t key)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_nvm_erase.key = key;
-
-    cmd->header = sl_bt_cmd_nvm_erase_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_nvm_erase(sl_bt_cmd_msg, key);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_nvm_erase.result;
@@ -2187,11 +1532,9 @@ sl_status_t sl_bt_nvm_erase(uint16_t key)
 
 sl_status_t sl_bt_nvm_erase_all()
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_nvm_erase_all_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_nvm_erase_all(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_nvm_erase_all.result;
@@ -2202,16 +1545,9 @@ SL_BGAPI_DEPRECATED sl_status_t sl_bt_test_dtm_tx(uint8_t packet_type,
                                                   uint8_t channel,
                                                   uint8_t phy)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_test_dtm_tx.packet_type = packet_type;
-    cmd->data.cmd_test_dtm_tx.length = length;
-    cmd->data.cmd_test_dtm_tx.channel = channel;
-    cmd->data.cmd_test_dtm_tx.phy = phy;
-
-    cmd->header = sl_bt_cmd_test_dtm_tx_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_test_dtm_tx(sl_bt_cmd_msg, packet_type, length, channel, phy);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_test_dtm_tx.result;
@@ -2223,17 +1559,9 @@ sl_status_t sl_bt_test_dtm_tx_v4(uint8_t packet_type,
                                  uint8_t phy,
                                  int8_t power_level)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_test_dtm_tx_v4.packet_type = packet_type;
-    cmd->data.cmd_test_dtm_tx_v4.length = length;
-    cmd->data.cmd_test_dtm_tx_v4.channel = channel;
-    cmd->data.cmd_test_dtm_tx_v4.phy = phy;
-    cmd->data.cmd_test_dtm_tx_v4.power_level = power_level;
-
-    cmd->header = sl_bt_cmd_test_dtm_tx_v4_id + (((5) & 0xff) << 8) + (((5) & 0x700) >> 8);
+    sl_bt_encode_test_dtm_tx_v4(sl_bt_cmd_msg, packet_type, length, channel, phy, power_level);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_test_dtm_tx_v4.result;
@@ -2241,14 +1569,9 @@ sl_status_t sl_bt_test_dtm_tx_v4(uint8_t packet_type,
 
 sl_status_t sl_bt_test_dtm_rx(uint8_t channel, uint8_t phy)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_test_dtm_rx.channel = channel;
-    cmd->data.cmd_test_dtm_rx.phy = phy;
-
-    cmd->header = sl_bt_cmd_test_dtm_rx_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_test_dtm_rx(sl_bt_cmd_msg, channel, phy);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_test_dtm_rx.result;
@@ -2256,11 +1579,9 @@ sl_status_t sl_bt_test_dtm_rx(uint8_t channel, uint8_t phy)
 
 sl_status_t sl_bt_test_dtm_end()
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_test_dtm_end_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_test_dtm_end(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_test_dtm_end.result;
@@ -2268,14 +1589,9 @@ sl_status_t sl_bt_test_dtm_end()
 
 sl_status_t sl_bt_sm_configure(uint8_t flags, uint8_t io_capabilities)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_configure.flags = flags;
-    cmd->data.cmd_sm_configure.io_capabilities = io_capabilities;
-
-    cmd->header = sl_bt_cmd_sm_configure_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_sm_configure(sl_bt_cmd_msg, flags, io_capabilities);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_configure.result;
@@ -2283,13 +1599,9 @@ sl_status_t sl_bt_sm_configure(uint8_t flags, uint8_t io_capabilities)
 
 sl_status_t sl_bt_sm_set_minimum_key_size(uint8_t minimum_key_size)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_set_minimum_key_size.minimum_key_size = minimum_key_size;
-
-    cmd->header = sl_bt_cmd_sm_set_minimum_key_size_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_sm_set_minimum_key_size(sl_bt_cmd_msg, minimum_key_size);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_set_minimum_key_size.result;
@@ -2297,11 +1609,9 @@ sl_status_t sl_bt_sm_set_minimum_key_size(uint8_t minimum_key_size)
 
 sl_status_t sl_bt_sm_set_debug_mode()
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_sm_set_debug_mode_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_sm_set_debug_mode(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_set_debug_mode.result;
@@ -2309,14 +1619,9 @@ sl_status_t sl_bt_sm_set_debug_mode()
 
 sl_status_t sl_bt_sm_add_to_whitelist(bd_addr address, uint8_t address_type)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    memcpy(&cmd->data.cmd_sm_add_to_whitelist.address, &address, sizeof(bd_addr));
-    cmd->data.cmd_sm_add_to_whitelist.address_type = address_type;
-
-    cmd->header = sl_bt_cmd_sm_add_to_whitelist_id + (((7) & 0xff) << 8) + (((7) & 0x700) >> 8);
+    sl_bt_encode_sm_add_to_whitelist(sl_bt_cmd_msg, address, address_type);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_add_to_whitelist.result;
@@ -2325,14 +1630,9 @@ sl_status_t sl_bt_sm_add_to_whitelist(bd_addr address, uint8_t address_type)
 sl_status_t sl_bt_sm_store_bonding_configuration(uint8_t max_bonding_count,
                                                  uint8_t policy_flags)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_store_bonding_configuration.max_bonding_count = max_bonding_count;
-    cmd->data.cmd_sm_store_bonding_configuration.policy_flags = policy_flags;
-
-    cmd->header = sl_bt_cmd_sm_store_bonding_configuration_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_sm_store_bonding_configuration(sl_bt_cmd_msg, max_bonding_count, policy_flags);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_store_bonding_configuration.result;
@@ -2340,13 +1640,9 @@ sl_status_t sl_bt_sm_store_bonding_configuration(uint8_t max_bonding_count,
 
 sl_status_t sl_bt_sm_set_bondable_mode(uint8_t bondable)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_set_bondable_mode.bondable = bondable;
-
-    cmd->header = sl_bt_cmd_sm_set_bondable_mode_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_sm_set_bondable_mode(sl_bt_cmd_msg, bondable);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_set_bondable_mode.result;
@@ -2354,13 +1650,9 @@ sl_status_t sl_bt_sm_set_bondable_mode(uint8_t bondable)
 
 sl_status_t sl_bt_sm_set_passkey(int32_t passkey)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_set_passkey.passkey = passkey;
-
-    cmd->header = sl_bt_cmd_sm_set_passkey_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_sm_set_passkey(sl_bt_cmd_msg, passkey);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_set_passkey.result;
@@ -2368,16 +1660,11 @@ sl_status_t sl_bt_sm_set_passkey(int32_t passkey)
 
 SL_BGAPI_DEPRECATED sl_status_t sl_bt_sm_set_oob_data(size_t oob_data_len, const uint8_t *oob_data)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_set_oob_data.oob_data.len = oob_data_len;
-    memcpy(cmd->data.cmd_sm_set_oob_data.oob_data.data, oob_data, oob_data_len);
-
-    cmd->header = sl_bt_cmd_sm_set_oob_data_id + (((1 + oob_data_len) & 0xff) << 8) + (((1 + oob_data_len) & 0x700) >> 8);
+    sl_bt_encode_sm_set_oob_data(sl_bt_cmd_msg, oob_data_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, oob_data, oob_data_len);
     return rsp->data.rsp_sm_set_oob_data.result;
 }
 
@@ -2386,13 +1673,9 @@ SL_BGAPI_DEPRECATED sl_status_t sl_bt_sm_use_sc_oob(uint8_t enable,
                                                     size_t *oob_data_len,
                                                     uint8_t *oob_data)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_use_sc_oob.enable = enable;
-
-    cmd->header = sl_bt_cmd_sm_use_sc_oob_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_sm_use_sc_oob(sl_bt_cmd_msg, enable);
 
     sl_bt_host_handle_command();
     *oob_data_len = rsp->data.rsp_sm_use_sc_oob.oob_data.len;
@@ -2406,28 +1689,19 @@ SL_BGAPI_DEPRECATED sl_status_t sl_bt_sm_use_sc_oob(uint8_t enable,
 SL_BGAPI_DEPRECATED sl_status_t sl_bt_sm_set_sc_remote_oob_data(size_t oob_data_len,
                                                                 const uint8_t *oob_data)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_set_sc_remote_oob_data.oob_data.len = oob_data_len;
-    memcpy(cmd->data.cmd_sm_set_sc_remote_oob_data.oob_data.data, oob_data, oob_data_len);
+    sl_bt_encode_sm_set_sc_remote_oob_data(sl_bt_cmd_msg, oob_data_len);
 
-    cmd->header = sl_bt_cmd_sm_set_sc_remote_oob_data_id + (((1 + oob_data_len) & 0xff) << 8) + (((1 + oob_data_len) & 0x700) >> 8);
-
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, oob_data, oob_data_len);
     return rsp->data.rsp_sm_set_sc_remote_oob_data.result;
 }
 
 sl_status_t sl_bt_sm_increase_security(uint8_t connection)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_increase_security.connection = connection;
-
-    cmd->header = sl_bt_cmd_sm_increase_security_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_sm_increase_security(sl_bt_cmd_msg, connection);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_increase_security.result;
@@ -2435,14 +1709,9 @@ sl_status_t sl_bt_sm_increase_security(uint8_t connection)
 
 sl_status_t sl_bt_sm_enter_passkey(uint8_t connection, int32_t passkey)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_enter_passkey.connection = connection;
-    cmd->data.cmd_sm_enter_passkey.passkey = passkey;
-
-    cmd->header = sl_bt_cmd_sm_enter_passkey_id + (((5) & 0xff) << 8) + (((5) & 0x700) >> 8);
+    sl_bt_encode_sm_enter_passkey(sl_bt_cmd_msg, connection, passkey);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_enter_passkey.result;
@@ -2450,14 +1719,9 @@ sl_status_t sl_bt_sm_enter_passkey(uint8_t connection, int32_t passkey)
 
 sl_status_t sl_bt_sm_passkey_confirm(uint8_t connection, uint8_t confirm)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_passkey_confirm.connection = connection;
-    cmd->data.cmd_sm_passkey_confirm.confirm = confirm;
-
-    cmd->header = sl_bt_cmd_sm_passkey_confirm_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_sm_passkey_confirm(sl_bt_cmd_msg, connection, confirm);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_passkey_confirm.result;
@@ -2465,14 +1729,9 @@ sl_status_t sl_bt_sm_passkey_confirm(uint8_t connection, uint8_t confirm)
 
 sl_status_t sl_bt_sm_bonding_confirm(uint8_t connection, uint8_t confirm)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_bonding_confirm.connection = connection;
-    cmd->data.cmd_sm_bonding_confirm.confirm = confirm;
-
-    cmd->header = sl_bt_cmd_sm_bonding_confirm_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_sm_bonding_confirm(sl_bt_cmd_msg, connection, confirm);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_bonding_confirm.result;
@@ -2480,11 +1739,9 @@ sl_status_t sl_bt_sm_bonding_confirm(uint8_t connection, uint8_t confirm)
 
 SL_BGAPI_DEPRECATED sl_status_t sl_bt_sm_list_all_bondings()
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_sm_list_all_bondings_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_sm_list_all_bondings(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_list_all_bondings.result;
@@ -2492,13 +1749,9 @@ SL_BGAPI_DEPRECATED sl_status_t sl_bt_sm_list_all_bondings()
 
 sl_status_t sl_bt_sm_delete_bonding(uint8_t bonding)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_delete_bonding.bonding = bonding;
-
-    cmd->header = sl_bt_cmd_sm_delete_bonding_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_sm_delete_bonding(sl_bt_cmd_msg, bonding);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_delete_bonding.result;
@@ -2506,11 +1759,9 @@ sl_status_t sl_bt_sm_delete_bonding(uint8_t bonding)
 
 sl_status_t sl_bt_sm_delete_bondings()
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_sm_delete_bondings_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_sm_delete_bondings(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_delete_bondings.result;
@@ -2522,13 +1773,9 @@ sl_status_t sl_bt_sm_get_bonding_handles(uint32_t reserved,
                                          size_t *bondings_len,
                                          uint8_t *bondings)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_get_bonding_handles.reserved = reserved;
-
-    cmd->header = sl_bt_cmd_sm_get_bonding_handles_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_sm_get_bonding_handles(sl_bt_cmd_msg, reserved);
 
     sl_bt_host_handle_command();
     *num_bondings = rsp->data.rsp_sm_get_bonding_handles.num_bondings;
@@ -2546,13 +1793,9 @@ sl_status_t sl_bt_sm_get_bonding_details(uint32_t bonding,
                                          uint8_t *security_mode,
                                          uint8_t *key_size)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_get_bonding_details.bonding = bonding;
-
-    cmd->header = sl_bt_cmd_sm_get_bonding_details_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_sm_get_bonding_details(sl_bt_cmd_msg, bonding);
 
     sl_bt_host_handle_command();
     memcpy(address, &rsp->data.rsp_sm_get_bonding_details.address, sizeof(bd_addr));
@@ -2567,13 +1810,9 @@ sl_status_t sl_bt_sm_find_bonding_by_address(bd_addr address,
                                              uint8_t *security_mode,
                                              uint8_t *key_size)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    memcpy(&cmd->data.cmd_sm_find_bonding_by_address.address, &address, sizeof(bd_addr));
-
-    cmd->header = sl_bt_cmd_sm_find_bonding_by_address_id + (((6) & 0xff) << 8) + (((6) & 0x700) >> 8);
+    sl_bt_encode_sm_find_bonding_by_address(sl_bt_cmd_msg, address);
 
     sl_bt_host_handle_command();
     *bonding = rsp->data.rsp_sm_find_bonding_by_address.bonding;
@@ -2586,15 +1825,9 @@ sl_status_t sl_bt_sm_set_bonding_key(uint32_t bonding,
                                      uint8_t key_type,
                                      aes_key_128 key)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_set_bonding_key.bonding = bonding;
-    cmd->data.cmd_sm_set_bonding_key.key_type = key_type;
-    memcpy(&cmd->data.cmd_sm_set_bonding_key.key, &key, sizeof(aes_key_128));
-
-    cmd->header = sl_bt_cmd_sm_set_bonding_key_id + (((21) & 0xff) << 8) + (((21) & 0x700) >> 8);
+    sl_bt_encode_sm_set_bonding_key(sl_bt_cmd_msg, bonding, key_type, key);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_set_bonding_key.result;
@@ -2602,14 +1835,9 @@ sl_status_t sl_bt_sm_set_bonding_key(uint32_t bonding,
 
 sl_status_t sl_bt_sm_set_legacy_oob(uint8_t enable, aes_key_128 oob_data)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_set_legacy_oob.enable = enable;
-    memcpy(&cmd->data.cmd_sm_set_legacy_oob.oob_data, &oob_data, sizeof(aes_key_128));
-
-    cmd->header = sl_bt_cmd_sm_set_legacy_oob_id + (((17) & 0xff) << 8) + (((17) & 0x700) >> 8);
+    sl_bt_encode_sm_set_legacy_oob(sl_bt_cmd_msg, enable, oob_data);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_set_legacy_oob.result;
@@ -2619,13 +1847,9 @@ sl_status_t sl_bt_sm_set_oob(uint8_t enable,
                              aes_key_128 *random,
                              aes_key_128 *confirm)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_set_oob.enable = enable;
-
-    cmd->header = sl_bt_cmd_sm_set_oob_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_sm_set_oob(sl_bt_cmd_msg, enable);
 
     sl_bt_host_handle_command();
     memcpy(random, &rsp->data.rsp_sm_set_oob.random, sizeof(aes_key_128));
@@ -2637,15 +1861,9 @@ sl_status_t sl_bt_sm_set_remote_oob(uint8_t enable,
                                     aes_key_128 random,
                                     aes_key_128 confirm)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_sm_set_remote_oob.enable = enable;
-    memcpy(&cmd->data.cmd_sm_set_remote_oob.random, &random, sizeof(aes_key_128));
-    memcpy(&cmd->data.cmd_sm_set_remote_oob.confirm, &confirm, sizeof(aes_key_128));
-
-    cmd->header = sl_bt_cmd_sm_set_remote_oob_id + (((33) & 0xff) << 8) + (((33) & 0x700) >> 8);
+    sl_bt_encode_sm_set_remote_oob(sl_bt_cmd_msg, enable, random, confirm);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_sm_set_remote_oob.result;
@@ -2653,16 +1871,11 @@ sl_status_t sl_bt_sm_set_remote_oob(uint8_t enable,
 
 sl_status_t sl_bt_ota_set_device_name(size_t name_len, const uint8_t *name)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_ota_set_device_name.name.len = name_len;
-    memcpy(cmd->data.cmd_ota_set_device_name.name.data, name, name_len);
-
-    cmd->header = sl_bt_cmd_ota_set_device_name_id + (((1 + name_len) & 0xff) << 8) + (((1 + name_len) & 0x700) >> 8);
+    sl_bt_encode_ota_set_device_name(sl_bt_cmd_msg, name_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, name, name_len);
     return rsp->data.rsp_ota_set_device_name.result;
 }
 
@@ -2670,29 +1883,19 @@ sl_status_t sl_bt_ota_set_advertising_data(uint8_t packet_type,
                                            size_t adv_data_len,
                                            const uint8_t *adv_data)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_ota_set_advertising_data.packet_type = packet_type;
-    cmd->data.cmd_ota_set_advertising_data.adv_data.len = adv_data_len;
-    memcpy(cmd->data.cmd_ota_set_advertising_data.adv_data.data, adv_data, adv_data_len);
-
-    cmd->header = sl_bt_cmd_ota_set_advertising_data_id + (((2 + adv_data_len) & 0xff) << 8) + (((2 + adv_data_len) & 0x700) >> 8);
+    sl_bt_encode_ota_set_advertising_data(sl_bt_cmd_msg, packet_type, adv_data_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, adv_data, adv_data_len);
     return rsp->data.rsp_ota_set_advertising_data.result;
 }
 
 sl_status_t sl_bt_ota_set_configuration(uint32_t flags)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_ota_set_configuration.flags = flags;
-
-    cmd->header = sl_bt_cmd_ota_set_configuration_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_ota_set_configuration(sl_bt_cmd_msg, flags);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_ota_set_configuration.result;
@@ -2700,14 +1903,9 @@ sl_status_t sl_bt_ota_set_configuration(uint32_t flags)
 
 sl_status_t sl_bt_ota_set_rf_path(uint8_t enable, uint8_t antenna)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_ota_set_rf_path.enable = enable;
-    cmd->data.cmd_ota_set_rf_path.antenna = antenna;
-
-    cmd->header = sl_bt_cmd_ota_set_rf_path_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_ota_set_rf_path(sl_bt_cmd_msg, enable, antenna);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_ota_set_rf_path.result;
@@ -2715,14 +1913,9 @@ sl_status_t sl_bt_ota_set_rf_path(uint8_t enable, uint8_t antenna)
 
 sl_status_t sl_bt_coex_set_options(uint32_t mask, uint32_t options)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_coex_set_options.mask = mask;
-    cmd->data.cmd_coex_set_options.options = options;
-
-    cmd->header = sl_bt_cmd_coex_set_options_id + (((8) & 0xff) << 8) + (((8) & 0x700) >> 8);
+    sl_bt_encode_coex_set_options(sl_bt_cmd_msg, mask, options);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_coex_set_options.result;
@@ -2733,16 +1926,9 @@ sl_status_t sl_bt_coex_set_parameters(uint8_t priority,
                                       uint8_t pwm_period,
                                       uint8_t pwm_dutycycle)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_coex_set_parameters.priority = priority;
-    cmd->data.cmd_coex_set_parameters.request = request;
-    cmd->data.cmd_coex_set_parameters.pwm_period = pwm_period;
-    cmd->data.cmd_coex_set_parameters.pwm_dutycycle = pwm_dutycycle;
-
-    cmd->header = sl_bt_cmd_coex_set_parameters_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_coex_set_parameters(sl_bt_cmd_msg, priority, request, pwm_period, pwm_dutycycle);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_coex_set_parameters.result;
@@ -2750,13 +1936,9 @@ sl_status_t sl_bt_coex_set_parameters(uint8_t priority,
 
 sl_status_t sl_bt_coex_set_directional_priority_pulse(uint8_t pulse)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_coex_set_directional_priority_pulse.pulse = pulse;
-
-    cmd->header = sl_bt_cmd_coex_set_directional_priority_pulse_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_coex_set_directional_priority_pulse(sl_bt_cmd_msg, pulse);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_coex_set_directional_priority_pulse.result;
@@ -2767,13 +1949,9 @@ sl_status_t sl_bt_coex_get_counters(uint8_t reset,
                                     size_t *counters_len,
                                     uint8_t *counters)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_coex_get_counters.reset = reset;
-
-    cmd->header = sl_bt_cmd_coex_get_counters_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_coex_get_counters(sl_bt_cmd_msg, reset);
 
     sl_bt_host_handle_command();
     *counters_len = rsp->data.rsp_coex_get_counters.counters.len;
@@ -2790,17 +1968,9 @@ sl_status_t sl_bt_l2cap_coc_send_connection_request(uint8_t connection,
                                                     uint16_t mps,
                                                     uint16_t initial_credit)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_l2cap_coc_send_connection_request.connection = connection;
-    cmd->data.cmd_l2cap_coc_send_connection_request.le_psm = le_psm;
-    cmd->data.cmd_l2cap_coc_send_connection_request.mtu = mtu;
-    cmd->data.cmd_l2cap_coc_send_connection_request.mps = mps;
-    cmd->data.cmd_l2cap_coc_send_connection_request.initial_credit = initial_credit;
-
-    cmd->header = sl_bt_cmd_l2cap_coc_send_connection_request_id + (((9) & 0xff) << 8) + (((9) & 0x700) >> 8);
+    sl_bt_encode_l2cap_coc_send_connection_request(sl_bt_cmd_msg, connection, le_psm, mtu, mps, initial_credit);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_l2cap_coc_send_connection_request.result;
@@ -2813,18 +1983,9 @@ sl_status_t sl_bt_l2cap_coc_send_connection_response(uint8_t connection,
                                                      uint16_t initial_credit,
                                                      uint16_t l2cap_errorcode)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_l2cap_coc_send_connection_response.connection = connection;
-    cmd->data.cmd_l2cap_coc_send_connection_response.cid = cid;
-    cmd->data.cmd_l2cap_coc_send_connection_response.mtu = mtu;
-    cmd->data.cmd_l2cap_coc_send_connection_response.mps = mps;
-    cmd->data.cmd_l2cap_coc_send_connection_response.initial_credit = initial_credit;
-    cmd->data.cmd_l2cap_coc_send_connection_response.l2cap_errorcode = l2cap_errorcode;
-
-    cmd->header = sl_bt_cmd_l2cap_coc_send_connection_response_id + (((11) & 0xff) << 8) + (((11) & 0x700) >> 8);
+    sl_bt_encode_l2cap_coc_send_connection_response(sl_bt_cmd_msg, connection, cid, mtu, mps, initial_credit, l2cap_errorcode);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_l2cap_coc_send_connection_response.result;
@@ -2834,15 +1995,9 @@ sl_status_t sl_bt_l2cap_coc_send_le_flow_control_credit(uint8_t connection,
                                                         uint16_t cid,
                                                         uint16_t credits)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_l2cap_coc_send_le_flow_control_credit.connection = connection;
-    cmd->data.cmd_l2cap_coc_send_le_flow_control_credit.cid = cid;
-    cmd->data.cmd_l2cap_coc_send_le_flow_control_credit.credits = credits;
-
-    cmd->header = sl_bt_cmd_l2cap_coc_send_le_flow_control_credit_id + (((5) & 0xff) << 8) + (((5) & 0x700) >> 8);
+    sl_bt_encode_l2cap_coc_send_le_flow_control_credit(sl_bt_cmd_msg, connection, cid, credits);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_l2cap_coc_send_le_flow_control_credit.result;
@@ -2851,14 +2006,9 @@ sl_status_t sl_bt_l2cap_coc_send_le_flow_control_credit(uint8_t connection,
 sl_status_t sl_bt_l2cap_coc_send_disconnection_request(uint8_t connection,
                                                        uint16_t cid)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_l2cap_coc_send_disconnection_request.connection = connection;
-    cmd->data.cmd_l2cap_coc_send_disconnection_request.cid = cid;
-
-    cmd->header = sl_bt_cmd_l2cap_coc_send_disconnection_request_id + (((3) & 0xff) << 8) + (((3) & 0x700) >> 8);
+    sl_bt_encode_l2cap_coc_send_disconnection_request(sl_bt_cmd_msg, connection, cid);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_l2cap_coc_send_disconnection_request.result;
@@ -2869,18 +2019,11 @@ sl_status_t sl_bt_l2cap_coc_send_data(uint8_t connection,
                                       size_t data_len,
                                       const uint8_t *data)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_l2cap_coc_send_data.connection = connection;
-    cmd->data.cmd_l2cap_coc_send_data.cid = cid;
-    cmd->data.cmd_l2cap_coc_send_data.data.len = data_len;
-    memcpy(cmd->data.cmd_l2cap_coc_send_data.data.data, data, data_len);
-
-    cmd->header = sl_bt_cmd_l2cap_coc_send_data_id + (((4 + data_len) & 0xff) << 8) + (((4 + data_len) & 0x700) >> 8);
+    sl_bt_encode_l2cap_coc_send_data(sl_bt_cmd_msg, connection, cid, data_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, data, data_len);
     return rsp->data.rsp_l2cap_coc_send_data.result;
 }
 
@@ -2889,28 +2032,19 @@ sl_status_t sl_bt_cte_transmitter_set_dtm_parameters(uint8_t cte_length,
                                                      size_t switching_pattern_len,
                                                      const uint8_t *switching_pattern)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_cte_transmitter_set_dtm_parameters.cte_length = cte_length;
-    cmd->data.cmd_cte_transmitter_set_dtm_parameters.cte_type = cte_type;
-    cmd->data.cmd_cte_transmitter_set_dtm_parameters.switching_pattern.len = switching_pattern_len;
-    memcpy(cmd->data.cmd_cte_transmitter_set_dtm_parameters.switching_pattern.data, switching_pattern, switching_pattern_len);
-
-    cmd->header = sl_bt_cmd_cte_transmitter_set_dtm_parameters_id + (((3 + switching_pattern_len) & 0xff) << 8) + (((3 + switching_pattern_len) & 0x700) >> 8);
+    sl_bt_encode_cte_transmitter_set_dtm_parameters(sl_bt_cmd_msg, cte_length, cte_type, switching_pattern_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, switching_pattern, switching_pattern_len);
     return rsp->data.rsp_cte_transmitter_set_dtm_parameters.result;
 }
 
 sl_status_t sl_bt_cte_transmitter_clear_dtm_parameters()
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_cte_transmitter_clear_dtm_parameters_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_cte_transmitter_clear_dtm_parameters(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_cte_transmitter_clear_dtm_parameters.result;
@@ -2921,30 +2055,19 @@ sl_status_t sl_bt_cte_transmitter_enable_connection_cte(uint8_t connection,
                                                         size_t switching_pattern_len,
                                                         const uint8_t *switching_pattern)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_cte_transmitter_enable_connection_cte.connection = connection;
-    cmd->data.cmd_cte_transmitter_enable_connection_cte.cte_types = cte_types;
-    cmd->data.cmd_cte_transmitter_enable_connection_cte.switching_pattern.len = switching_pattern_len;
-    memcpy(cmd->data.cmd_cte_transmitter_enable_connection_cte.switching_pattern.data, switching_pattern, switching_pattern_len);
-
-    cmd->header = sl_bt_cmd_cte_transmitter_enable_connection_cte_id + (((3 + switching_pattern_len) & 0xff) << 8) + (((3 + switching_pattern_len) & 0x700) >> 8);
+    sl_bt_encode_cte_transmitter_enable_connection_cte(sl_bt_cmd_msg, connection, cte_types, switching_pattern_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, switching_pattern, switching_pattern_len);
     return rsp->data.rsp_cte_transmitter_enable_connection_cte.result;
 }
 
 sl_status_t sl_bt_cte_transmitter_disable_connection_cte(uint8_t connection)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_cte_transmitter_disable_connection_cte.connection = connection;
-
-    cmd->header = sl_bt_cmd_cte_transmitter_disable_connection_cte_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_cte_transmitter_disable_connection_cte(sl_bt_cmd_msg, connection);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_cte_transmitter_disable_connection_cte.result;
@@ -2957,32 +2080,19 @@ sl_status_t sl_bt_cte_transmitter_enable_connectionless_cte(uint8_t handle,
                                                             size_t switching_pattern_len,
                                                             const uint8_t *switching_pattern)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_cte_transmitter_enable_connectionless_cte.handle = handle;
-    cmd->data.cmd_cte_transmitter_enable_connectionless_cte.cte_length = cte_length;
-    cmd->data.cmd_cte_transmitter_enable_connectionless_cte.cte_type = cte_type;
-    cmd->data.cmd_cte_transmitter_enable_connectionless_cte.cte_count = cte_count;
-    cmd->data.cmd_cte_transmitter_enable_connectionless_cte.switching_pattern.len = switching_pattern_len;
-    memcpy(cmd->data.cmd_cte_transmitter_enable_connectionless_cte.switching_pattern.data, switching_pattern, switching_pattern_len);
-
-    cmd->header = sl_bt_cmd_cte_transmitter_enable_connectionless_cte_id + (((5 + switching_pattern_len) & 0xff) << 8) + (((5 + switching_pattern_len) & 0x700) >> 8);
+    sl_bt_encode_cte_transmitter_enable_connectionless_cte(sl_bt_cmd_msg, handle, cte_length, cte_type, cte_count, switching_pattern_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, switching_pattern, switching_pattern_len);
     return rsp->data.rsp_cte_transmitter_enable_connectionless_cte.result;
 }
 
 sl_status_t sl_bt_cte_transmitter_disable_connectionless_cte(uint8_t handle)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_cte_transmitter_disable_connectionless_cte.handle = handle;
-
-    cmd->header = sl_bt_cmd_cte_transmitter_disable_connectionless_cte_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_cte_transmitter_disable_connectionless_cte(sl_bt_cmd_msg, handle);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_cte_transmitter_disable_connectionless_cte.result;
@@ -2995,32 +2105,19 @@ sl_status_t sl_bt_cte_transmitter_enable_silabs_cte(uint8_t handle,
                                                     size_t switching_pattern_len,
                                                     const uint8_t *switching_pattern)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_cte_transmitter_enable_silabs_cte.handle = handle;
-    cmd->data.cmd_cte_transmitter_enable_silabs_cte.cte_length = cte_length;
-    cmd->data.cmd_cte_transmitter_enable_silabs_cte.cte_type = cte_type;
-    cmd->data.cmd_cte_transmitter_enable_silabs_cte.cte_count = cte_count;
-    cmd->data.cmd_cte_transmitter_enable_silabs_cte.switching_pattern.len = switching_pattern_len;
-    memcpy(cmd->data.cmd_cte_transmitter_enable_silabs_cte.switching_pattern.data, switching_pattern, switching_pattern_len);
+    sl_bt_encode_cte_transmitter_enable_silabs_cte(sl_bt_cmd_msg, handle, cte_length, cte_type, cte_count, switching_pattern_len);
 
-    cmd->header = sl_bt_cmd_cte_transmitter_enable_silabs_cte_id + (((5 + switching_pattern_len) & 0xff) << 8) + (((5 + switching_pattern_len) & 0x700) >> 8);
-
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, switching_pattern, switching_pattern_len);
     return rsp->data.rsp_cte_transmitter_enable_silabs_cte.result;
 }
 
 sl_status_t sl_bt_cte_transmitter_disable_silabs_cte(uint8_t handle)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_cte_transmitter_disable_silabs_cte.handle = handle;
-
-    cmd->header = sl_bt_cmd_cte_transmitter_disable_silabs_cte_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_cte_transmitter_disable_silabs_cte(sl_bt_cmd_msg, handle);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_cte_transmitter_disable_silabs_cte.result;
@@ -3032,29 +2129,19 @@ sl_status_t sl_bt_cte_receiver_set_dtm_parameters(uint8_t cte_length,
                                                   size_t switching_pattern_len,
                                                   const uint8_t *switching_pattern)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_cte_receiver_set_dtm_parameters.cte_length = cte_length;
-    cmd->data.cmd_cte_receiver_set_dtm_parameters.cte_type = cte_type;
-    cmd->data.cmd_cte_receiver_set_dtm_parameters.slot_durations = slot_durations;
-    cmd->data.cmd_cte_receiver_set_dtm_parameters.switching_pattern.len = switching_pattern_len;
-    memcpy(cmd->data.cmd_cte_receiver_set_dtm_parameters.switching_pattern.data, switching_pattern, switching_pattern_len);
-
-    cmd->header = sl_bt_cmd_cte_receiver_set_dtm_parameters_id + (((4 + switching_pattern_len) & 0xff) << 8) + (((4 + switching_pattern_len) & 0x700) >> 8);
+    sl_bt_encode_cte_receiver_set_dtm_parameters(sl_bt_cmd_msg, cte_length, cte_type, slot_durations, switching_pattern_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, switching_pattern, switching_pattern_len);
     return rsp->data.rsp_cte_receiver_set_dtm_parameters.result;
 }
 
 sl_status_t sl_bt_cte_receiver_clear_dtm_parameters()
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_cte_receiver_clear_dtm_parameters_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_cte_receiver_clear_dtm_parameters(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_cte_receiver_clear_dtm_parameters.result;
@@ -3062,13 +2149,9 @@ sl_status_t sl_bt_cte_receiver_clear_dtm_parameters()
 
 sl_status_t sl_bt_cte_receiver_set_sync_cte_type(uint8_t sync_cte_type)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_cte_receiver_set_sync_cte_type.sync_cte_type = sync_cte_type;
-
-    cmd->header = sl_bt_cmd_cte_receiver_set_sync_cte_type_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_cte_receiver_set_sync_cte_type(sl_bt_cmd_msg, sync_cte_type);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_cte_receiver_set_sync_cte_type.result;
@@ -3076,13 +2159,9 @@ sl_status_t sl_bt_cte_receiver_set_sync_cte_type(uint8_t sync_cte_type)
 
 sl_status_t sl_bt_cte_receiver_configure(uint8_t flags)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_cte_receiver_configure.flags = flags;
-
-    cmd->header = sl_bt_cmd_cte_receiver_configure_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_cte_receiver_configure(sl_bt_cmd_msg, flags);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_cte_receiver_configure.result;
@@ -3096,33 +2175,19 @@ sl_status_t sl_bt_cte_receiver_enable_connection_cte(uint8_t connection,
                                                      size_t switching_pattern_len,
                                                      const uint8_t *switching_pattern)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_cte_receiver_enable_connection_cte.connection = connection;
-    cmd->data.cmd_cte_receiver_enable_connection_cte.interval = interval;
-    cmd->data.cmd_cte_receiver_enable_connection_cte.cte_length = cte_length;
-    cmd->data.cmd_cte_receiver_enable_connection_cte.cte_type = cte_type;
-    cmd->data.cmd_cte_receiver_enable_connection_cte.slot_durations = slot_durations;
-    cmd->data.cmd_cte_receiver_enable_connection_cte.switching_pattern.len = switching_pattern_len;
-    memcpy(cmd->data.cmd_cte_receiver_enable_connection_cte.switching_pattern.data, switching_pattern, switching_pattern_len);
-
-    cmd->header = sl_bt_cmd_cte_receiver_enable_connection_cte_id + (((7 + switching_pattern_len) & 0xff) << 8) + (((7 + switching_pattern_len) & 0x700) >> 8);
+    sl_bt_encode_cte_receiver_enable_connection_cte(sl_bt_cmd_msg, connection, interval, cte_length, cte_type, slot_durations, switching_pattern_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, switching_pattern, switching_pattern_len);
     return rsp->data.rsp_cte_receiver_enable_connection_cte.result;
 }
 
 sl_status_t sl_bt_cte_receiver_disable_connection_cte(uint8_t connection)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_cte_receiver_disable_connection_cte.connection = connection;
-
-    cmd->header = sl_bt_cmd_cte_receiver_disable_connection_cte_id + (((1) & 0xff) << 8) + (((1) & 0x700) >> 8);
+    sl_bt_encode_cte_receiver_disable_connection_cte(sl_bt_cmd_msg, connection);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_cte_receiver_disable_connection_cte.result;
@@ -3134,31 +2199,19 @@ sl_status_t sl_bt_cte_receiver_enable_connectionless_cte(uint16_t sync,
                                                          size_t switching_pattern_len,
                                                          const uint8_t *switching_pattern)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_cte_receiver_enable_connectionless_cte.sync = sync;
-    cmd->data.cmd_cte_receiver_enable_connectionless_cte.slot_durations = slot_durations;
-    cmd->data.cmd_cte_receiver_enable_connectionless_cte.cte_count = cte_count;
-    cmd->data.cmd_cte_receiver_enable_connectionless_cte.switching_pattern.len = switching_pattern_len;
-    memcpy(cmd->data.cmd_cte_receiver_enable_connectionless_cte.switching_pattern.data, switching_pattern, switching_pattern_len);
+    sl_bt_encode_cte_receiver_enable_connectionless_cte(sl_bt_cmd_msg, sync, slot_durations, cte_count, switching_pattern_len);
 
-    cmd->header = sl_bt_cmd_cte_receiver_enable_connectionless_cte_id + (((5 + switching_pattern_len) & 0xff) << 8) + (((5 + switching_pattern_len) & 0x700) >> 8);
-
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, switching_pattern, switching_pattern_len);
     return rsp->data.rsp_cte_receiver_enable_connectionless_cte.result;
 }
 
 sl_status_t sl_bt_cte_receiver_disable_connectionless_cte(uint16_t sync)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_cte_receiver_disable_connectionless_cte.sync = sync;
-
-    cmd->header = sl_bt_cmd_cte_receiver_disable_connectionless_cte_id + (((2) & 0xff) << 8) + (((2) & 0x700) >> 8);
+    sl_bt_encode_cte_receiver_disable_connectionless_cte(sl_bt_cmd_msg, sync);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_cte_receiver_disable_connectionless_cte.result;
@@ -3169,28 +2222,19 @@ sl_status_t sl_bt_cte_receiver_enable_silabs_cte(uint8_t slot_durations,
                                                  size_t switching_pattern_len,
                                                  const uint8_t *switching_pattern)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_cte_receiver_enable_silabs_cte.slot_durations = slot_durations;
-    cmd->data.cmd_cte_receiver_enable_silabs_cte.cte_count = cte_count;
-    cmd->data.cmd_cte_receiver_enable_silabs_cte.switching_pattern.len = switching_pattern_len;
-    memcpy(cmd->data.cmd_cte_receiver_enable_silabs_cte.switching_pattern.data, switching_pattern, switching_pattern_len);
-
-    cmd->header = sl_bt_cmd_cte_receiver_enable_silabs_cte_id + (((3 + switching_pattern_len) & 0xff) << 8) + (((3 + switching_pattern_len) & 0x700) >> 8);
+    sl_bt_encode_cte_receiver_enable_silabs_cte(sl_bt_cmd_msg, slot_durations, cte_count, switching_pattern_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, switching_pattern, switching_pattern_len);
     return rsp->data.rsp_cte_receiver_enable_silabs_cte.result;
 }
 
 sl_status_t sl_bt_cte_receiver_disable_silabs_cte()
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_cte_receiver_disable_silabs_cte_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_cte_receiver_disable_silabs_cte(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_cte_receiver_disable_silabs_cte.result;
@@ -3204,11 +2248,9 @@ sl_status_t sl_bt_memory_profiler_get_status(uint32_t *num_memory_trackers,
                                              uint32_t *peak_stack_bytes_used,
                                              uint32_t *errors)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_memory_profiler_get_status_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_memory_profiler_get_status(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     *num_memory_trackers = rsp->data.rsp_memory_profiler_get_status.num_memory_trackers;
@@ -3223,13 +2265,9 @@ sl_status_t sl_bt_memory_profiler_get_status(uint32_t *num_memory_trackers,
 
 sl_status_t sl_bt_memory_profiler_reset(uint32_t flags)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_memory_profiler_reset.flags = flags;
-
-    cmd->header = sl_bt_cmd_memory_profiler_reset_id + (((4) & 0xff) << 8) + (((4) & 0x700) >> 8);
+    sl_bt_encode_memory_profiler_reset(sl_bt_cmd_msg, flags);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_memory_profiler_reset.result;
@@ -3237,11 +2275,9 @@ sl_status_t sl_bt_memory_profiler_reset(uint32_t flags)
 
 sl_status_t sl_bt_memory_profiler_list_ram_usage()
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->header = sl_bt_cmd_memory_profiler_list_ram_usage_id + (((0) & 0xff) << 8) + (((0) & 0x700) >> 8);
+    sl_bt_encode_memory_profiler_list_ram_usage(sl_bt_cmd_msg);
 
     sl_bt_host_handle_command();
     return rsp->data.rsp_memory_profiler_list_ram_usage.result;
@@ -3253,16 +2289,11 @@ sl_status_t sl_bt_user_message_to_target(size_t data_len,
                                          size_t *response_len,
                                          uint8_t *response)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_user_message_to_target.data.len = data_len;
-    memcpy(cmd->data.cmd_user_message_to_target.data.data, data, data_len);
-
-    cmd->header = sl_bt_cmd_user_message_to_target_id + (((1 + data_len) & 0xff) << 8) + (((1 + data_len) & 0x700) >> 8);
+    sl_bt_encode_user_message_to_target(sl_bt_cmd_msg, data_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, data, data_len);
     *response_len = rsp->data.rsp_user_message_to_target.response.len;
     if (rsp->data.rsp_user_message_to_target.response.len <= max_response_size)
     {
@@ -3274,15 +2305,10 @@ sl_status_t sl_bt_user_message_to_target(size_t data_len,
 sl_status_t sl_bt_user_manage_event_filter(size_t data_len,
                                            const uint8_t *data)
 {
-    struct sl_bt_packet *cmd = (struct sl_bt_packet *)sl_bt_cmd_msg;
-
     struct sl_bt_packet *rsp = (struct sl_bt_packet *)sl_bt_rsp_msg;
 
-    cmd->data.cmd_user_manage_event_filter.data.len = data_len;
-    memcpy(cmd->data.cmd_user_manage_event_filter.data.data, data, data_len);
-
-    cmd->header = sl_bt_cmd_user_manage_event_filter_id + (((1 + data_len) & 0xff) << 8) + (((1 + data_len) & 0x700) >> 8);
+    sl_bt_encode_user_manage_event_filter(sl_bt_cmd_msg, data_len);
 
-    sl_bt_host_handle_command();
+    sl_bt_host_send(sl_bt_cmd_msg, data, data_len);
     return rsp->data.rsp_user_manage_event_filter.result;
 }
@@ -70,13 +70,12 @@ int hex2str(uint8_t* head, int len, char* value) {
 }
 
 void reverse_endian(uint8_t* header, uint8_t length) {
-    uint8_t* tmp = (uint8_t*)malloc(length);
-    memcpy(tmp, header, length);
-    int i = length - 1;
-    int j = 0;
-    for (; i >= 0; i--, j++) {
-        *(header + j) = *(tmp + i);
+    int i = 0;
+    int j = length - 1;
+    for (; i < j; i++, j--) {
+        uint8_t tmp = header[i];
+        header[i] = header[j];
+        header[j] = tmp;
     }
-    free(tmp);
     return;
 }
@@ -18,22 +18,37 @@
  ******************************************************************************/
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
 #include <uci.h>
 #include <unistd.h>   
 #include <fcntl.h>   
+#include <dirent.h>
+#include <limits.h>
+#include <pthread.h>
+#ifdef GPIO_CHARDEV
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+#endif
 #include "gl_uart.h"
 #include "gl_log.h"
 #include "gl_hal.h"
+#include "gl_radio.h"
 #include "gl_hw_cfg.h"
 #include "gl_errno.h"
 
 unsigned char ENDIAN;
 
-char rston[64] = {0};
-char rstoff[64] = {0};
+// the reset line is driven through a descriptor kept open, no shell is forked
+static int rst_fd[RADIO_MAX] = { [0 ... RADIO_MAX - 1] = -1 };
+#ifdef GPIO_CHARDEV
+static int rst_chardev[RADIO_MAX];
+#endif
 
-char model[20] = {0};
-hw_cfg_t* ble_hw_cfg = NULL;
+// the model is looked up once for the process, init after destroy does not read UCI again
+static pthread_mutex_t hw_cfg_mutex = PTHREAD_MUTEX_INITIALIZER;
+static hw_cfg_t hw_cfg[RADIO_MAX];
+static bool hw_cfg_loaded[RADIO_MAX];
+static hw_cfg_t* ble_hw_cfg[RADIO_MAX];
 
 static int check_endian(void);
 static int serial_init(void);
@@ -61,29 +76,189 @@ static int check_endian(void)
   return 0;
 }
 
+static int write_file(const char *path, const char *value)
+{
+	int fd = open(path, O_WRONLY | O_CLOEXEC);
+	if(fd < 0)
+	{
+		return -1;
+	}
+
+	int ret = write(fd, value, strlen(value));
+	close(fd);
+
+	return (ret < 0) ? -1 : 0;
+}
+
+static int read_file(const char *path, char *value, int size)
+{
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if(fd < 0)
+	{
+		return -1;
+	}
+
+	int ret = read(fd, value, size - 1);
+	close(fd);
+	if(ret < 0)
+	{
+		return -1;
+	}
+
+	value[ret] = '\0';
+	value[strcspn(value, "\n")] = '\0';
+	return 0;
+}
+
+#ifdef GPIO_CHARDEV
+/* Request the reset line from the GPIO character device.
+	The sysfs number is base + offset of a gpiochip, the chip is found again in /dev by its label.
+	Fails if the line is exported in sysfs, it is used through sysfs then.
+*/
+static int chardev_request_rst_io(void)
+{
+	int radio = radio_cur();
+	char path[PATH_MAX];
+	char value[64];
+	char label[32] = {0};
+	int offset = -1;
+	int lines = 0;
+
+	DIR *dir = opendir("/sys/class/gpio");
+	if(!dir)
+	{
+		return -1;
+	}
+
+	struct dirent *ent;
+	while((ent = readdir(dir)) != NULL)
+	{
+		if(strncmp(ent->d_name, "gpiochip", 8))
+		{
+			continue;
+		}
+
+		snprintf(path, sizeof(path), "/sys/class/gpio/%s/base", ent->d_name);
+		if(read_file(path, value, sizeof(value)) < 0)
+		{
+			continue;
+		}
+		int base = atoi(value);
+
+		snprintf(path, sizeof(path), "/sys/class/gpio/%s/ngpio", ent->d_name);
+		if(read_file(path, value, sizeof(value)) < 0)
+		{
+			continue;
+		}
+		int ngpio = atoi(value);
+
+		if((ble_hw_cfg[radio]->rst_gpio < base) || (ble_hw_cfg[radio]->rst_gpio >= base + ngpio))
+		{
+			continue;
+		}
+
+		snprintf(path, sizeof(path), "/sys/class/gpio/%s/label", ent->d_name);
+		if(read_file(path, label, sizeof(label)) == 0)
+		{
+			offset = ble_hw_cfg[radio]->rst_gpio - base;
+			lines = ngpio;
+		}
+		break;
+	}
+	closedir(dir);
+
+	if(offset < 0)
+	{
+		return -1;
+	}
+
+	int i;
+	for(i = 0; i < 32; i++)
+	{
+		snprintf(path, sizeof(path), "/dev/gpiochip%d", i);
+		int chip_fd = open(path, O_RDWR | O_CLOEXEC);
+		if(chip_fd < 0)
+		{
+			continue;
+		}
+
+		struct gpiochip_info info;
+		memset(&info, 0, sizeof(info));
+		if((ioctl(chip_fd, GPIO_GET_CHIPINFO_IOCTL, &info) < 0) || ((int)info.lines != lines) || strncmp(info.label, label, sizeof(info.label)))
+		{
+			close(chip_fd);
+			continue;
+		}
+
+		// keep a running module on, it may be probed instead of reset
+		struct gpiohandle_request req;
+		memset(&req, 0, sizeof(req));
+		req.lineoffsets[0] = offset;
+		req.lines = 1;
+		req.flags = GPIOHANDLE_REQUEST_OUTPUT;
+		req.default_values[0] = ble_hw_cfg[radio]->rst_trigger;
+		strncpy(req.consumer_label, "gl-ble-rst", sizeof(req.consumer_label) - 1);
+
+		int ret = ioctl(chip_fd, GPIO_GET_LINEHANDLE_IOCTL, &req);
+		close(chip_fd);
+		if(ret < 0)
+		{
+			log_debug("Request ble rst line %s:%d failed: %d\n", path, offset, errno);
+			return -1;
+		}
+
+		log_debug("Ble rst io: %s line %d.\n", path, offset);
+		rst_fd[radio] = req.fd;
+		rst_chardev[radio] = 1;
+		return 0;
+	}
+
+	return -1;
+}
+#endif
+
 static GL_RET normal_check_rst_io(void)
 {
-	if(!ble_hw_cfg)
+	int radio = radio_cur();
+
+	if(!ble_hw_cfg[radio])
 	{
 		log_err("HW cfg lost!\n");
 		return GL_UNKNOW_ERR;
 	}
 
+	if(ble_hw_cfg[radio]->flags & HW_CFG_NO_RST_IO)
+	{
+		return GL_SUCCESS;
+	}
+
+	// a module behind a pty or socket is not on this board, the RTS reset needs no GPIO
+	if((ble_hw_cfg[radio]->flags & HW_CFG_RTS_RST) || (!uartIsTty((int8_t*)ble_hw_cfg[radio]->port)))
+	{
+		return GL_SUCCESS;
+	}
+
+#ifdef GPIO_CHARDEV
+	if(chardev_request_rst_io() == 0)
+	{
+		return GL_SUCCESS;
+	}
+#endif
+
 	char io[32] = {0};
-	sprintf(io, "/sys/class/gpio/gpio%d", ble_hw_cfg->rst_gpio);
+	sprintf(io, "/sys/class/gpio/gpio%d", ble_hw_cfg[radio]->rst_gpio);
 
-	char create_io[64] = {0};   
-	sprintf(create_io, "echo %d > /sys/class/gpio/export", ble_hw_cfg->rst_gpio);
+	char io_num[8] = {0};
+	sprintf(io_num, "%d", ble_hw_cfg[radio]->rst_gpio);
 
-	char create_io_direction[80] = {0};   
-	sprintf(create_io_direction, "echo out > /sys/class/gpio/gpio%d/direction", ble_hw_cfg->rst_gpio);
+	char path[64] = {0};
 
 	// create IO
 	int i = 0;
 	while((access(io, F_OK)) != 0)
 	{
 		log_debug("Ble rst io: %s not exist. Now trying create ... Time: %d\n", io, i+1);   
-		system(create_io);
+		write_file("/sys/class/gpio/export", io_num);
 
 		i++;
 		usleep(300000);
@@ -95,14 +270,81 @@ static GL_RET normal_check_rst_io(void)
 		}
 	}
 
-	// set IO direction
-	system(create_io_direction);
+	// set IO direction, an output is left as it is so a running module stays on
+	char direction[8] = {0};
+	sprintf(path, "%s/direction", io);
+	if((read_file(path, direction, sizeof(direction)) < 0) || strcmp(direction, "out"))
+	{
+		write_file(path, ble_hw_cfg[radio]->rst_trigger ? "high" : "low");
+	}
+
+	sprintf(path, "%s/value", io);
+	rst_fd[radio] = open(path, O_WRONLY | O_CLOEXEC);
+	if(rst_fd[radio] < 0)
+	{
+		log_err("Open ble RST IO failed!\n");
+		return GL_UNKNOW_ERR;
+	}
 
 	log_debug("Ble rst io: %s exist.\n", io);
 
 	return GL_SUCCESS;
 }
 
+int hal_rst_set(int on)
+{
+	int radio = radio_cur();
+
+	if(!ble_hw_cfg[radio])
+	{
+		return -1;
+	}
+
+	// rst trigger is the level which turns the module on
+	int level = on ? ble_hw_cfg[radio]->rst_trigger : !ble_hw_cfg[radio]->rst_trigger;
+
+	if(ble_hw_cfg[radio]->flags & HW_CFG_RTS_RST)
+	{
+		return uartReset(level);
+	}
+
+	if(rst_fd[radio] < 0)
+	{
+		return -1;
+	}
+
+#ifdef GPIO_CHARDEV
+	if(rst_chardev[radio])
+	{
+		struct gpiohandle_data data;
+		memset(&data, 0, sizeof(data));
+		data.values[0] = level;
+		return ioctl(rst_fd[radio], GPIOHANDLE_SET_LINE_VALUES_IOCTL, &data);
+	}
+#endif
+
+	return (pwrite(rst_fd[radio], level ? "1" : "0", 1, 0) == 1) ? 0 : -1;
+}
+
+int hal_rst_io(void)
+{
+	int radio = radio_cur();
+
+	return (ble_hw_cfg[radio]) && (!(ble_hw_cfg[radio]->flags & HW_CFG_NO_RST_IO)) && (uartIsTty((int8_t*)ble_hw_cfg[radio]->port));
+}
+
+uint16_t hal_rst_pulse(void)
+{
+	int radio = radio_cur();
+
+	if((!ble_hw_cfg[radio]) || (!ble_hw_cfg[radio]->rst_pulse))
+	{
+		return HAL_RST_PULSE_DEFAULT;
+	}
+
+	return ble_hw_cfg[radio]->rst_pulse;
+}
+
 /* Check special openwrt version
 	QSDK in open source openwrt will have a special io base num.
 	If "/sys/class/gpio/gpiochip412" exist, all io shoule add 412.
@@ -110,16 +352,10 @@ static GL_RET normal_check_rst_io(void)
 #define SPECIAL_CHIP_IO 		"/sys/class/gpio/gpiochip412"
 static GL_RET qsdk_check_ver(void)
 {
-	if(!ble_hw_cfg)
-	{
-		log_err("HW cfg lost!\n");
-		return GL_UNKNOW_ERR;
-	}
-
 	if((access(SPECIAL_CHIP_IO, F_OK)) != -1)
 	{
 		log_debug("QSDK gpiochip412 exist.\n");
-		ble_hw_cfg->rst_gpio += 412;
+		hw_cfg[radio_cur()].rst_gpio += 412;
 	}
 
 	return GL_SUCCESS;
@@ -127,92 +363,206 @@ static GL_RET qsdk_check_ver(void)
 
 static int serial_init(void)
 {
-	if(!ble_hw_cfg)
+	int radio = radio_cur();
+
+	if(!ble_hw_cfg[radio])
 	{
 		log_err("HW cfg lost!\n");
 		return GL_UNKNOW_ERR;
 	}
 
-	if(ble_hw_cfg->rst_trigger == 1)
+	if((ble_hw_cfg[radio]->rst_trigger != 1) && (ble_hw_cfg[radio]->rst_trigger != 0))
 	{
-		sprintf(rston, "echo 1 > /sys/class/gpio/gpio%d/value", ble_hw_cfg->rst_gpio);
-		sprintf(rstoff, "echo 0 > /sys/class/gpio/gpio%d/value", ble_hw_cfg->rst_gpio);
-
-	}else if(ble_hw_cfg->rst_trigger == 0){
-		sprintf(rston, "echo 0 > /sys/class/gpio/gpio%d/value", ble_hw_cfg->rst_gpio);
-		sprintf(rstoff, "echo 1 > /sys/class/gpio/gpio%d/value", ble_hw_cfg->rst_gpio);
-
-	}else{
 		log_err("hw rst trigger cfg error!\n");
 		return GL_UNKNOW_ERR;
 	}
 
-    return uartOpen((int8_t*)ble_hw_cfg->port, ble_hw_cfg->baudRate, ble_hw_cfg->flowcontrol, 100);
+    return uartOpen((int8_t*)ble_hw_cfg[radio]->port, ble_hw_cfg[radio]->baudRate, ble_hw_cfg[radio]->flowcontrol, 100);
 }
 
-static GL_RET get_model_hw_cfg(void)
+static int uci_get_num(struct uci_context* ctx, const char* key, uint32_t* num)
+{
+	char value[64] = {0};
+	if((guci2_get(ctx, key, value) < 0) || (value[0] == '\0'))
+	{
+		return -1;
+	}
+
+	*num = strtoul(value, NULL, 0);
+	return 0;
+}
+
+/* Find the model in the table, then apply the options of gl_ble.hw.
+	A board missing in the table is described by gl_ble.hw alone.
+	Radio 1 and above are extra modules such as USB dongles, they are described by gl_ble.hw1, gl_ble.hw2 ...
+*/
+static GL_RET load_hw_cfg(void)
 {
-    struct uci_context* ctx = guci2_init();
+	int radio = radio_cur();
+	char section[8] = "hw";
+	char key[32];
+	char model[64] = {0};
+	char value[64] = {0};
+	uint32_t num;
+
+	struct uci_context* ctx = guci2_init();
 	if(!ctx)
 	{
 		log_err("open uci handle error\n");
 		return GL_UNKNOW_ERR;
 	}
 
-    if(guci2_get(ctx,"glconfig.general.model",model) < 0)
-    {
-		guci2_free(ctx);
-        log_err("serial config missing.\n");
-        return -1;
-    }
-
-	guci2_free(ctx);
+	if(radio)
+	{
+		sprintf(section, "hw%d", radio);
+	}
 
+	sprintf(key, "gl_ble.%s.model", section);
+	if((guci2_get(ctx, key, model) < 0) && (!radio))
+	{
+		guci2_get(ctx, "glconfig.general.model", model);
+	}
 
 	log_debug("Get model: %s\n", model);
 
-	if(0 == strcmp(model, "s1300"))
+	memset(&hw_cfg[radio], 0, sizeof(hw_cfg_t));
+	unsigned int i;
+	for(i = 0; i < MODEL_HW_CFG_NUM; i++)
+	{
+		if(0 == strcmp(model, model_hw_cfg_list[i].model))
+		{
+			memcpy(&hw_cfg[radio], &model_hw_cfg_list[i], sizeof(hw_cfg_t));
+			break;
+		}
+	}
+	strncpy(hw_cfg[radio].model, model, sizeof(hw_cfg[radio].model) - 1);
+
+	sprintf(key, "gl_ble.%s.port", section);
+	if((guci2_get(ctx, key, value) == 0) && (value[0] != '\0'))
+	{
+		strncpy(hw_cfg[radio].port, value, sizeof(hw_cfg[radio].port) - 1);
+	}
+	sprintf(key, "gl_ble.%s.baudrate", section);
+	if(uci_get_num(ctx, key, &num) == 0)
+	{
+		hw_cfg[radio].baudRate = num;
+	}
+	sprintf(key, "gl_ble.%s.flowcontrol", section);
+	if(uci_get_num(ctx, key, &num) == 0)
+	{
+		hw_cfg[radio].flowcontrol = num;
+	}
+	sprintf(key, "gl_ble.%s.rst_trigger", section);
+	if(uci_get_num(ctx, key, &num) == 0)
+	{
+		hw_cfg[radio].rst_trigger = (uint8_t)num;
+	}
+	sprintf(key, "gl_ble.%s.rst_gpio", section);
+	if(uci_get_num(ctx, key, &num) == 0)
+	{
+		hw_cfg[radio].rst_gpio = (uint16_t)num;
+	}
+	sprintf(key, "gl_ble.%s.rst_pulse", section);
+	if(uci_get_num(ctx, key, &num) == 0)
+	{
+		hw_cfg[radio].rst_pulse = (uint16_t)num;
+	}
+	sprintf(key, "gl_ble.%s.flags", section);
+	if(uci_get_num(ctx, key, &num) == 0)
+	{
+		hw_cfg[radio].flags = (uint8_t)num;
+	}
+	sprintf(key, "gl_ble.%s.max_conn", section);
+	if(uci_get_num(ctx, key, &num) == 0)
+	{
+		hw_cfg[radio].max_conn = (uint8_t)num;
+	}
+
+	guci2_free(ctx);
+
+	// the baud rate is only used by a serial port
+	if((hw_cfg[radio].port[0] == '\0') || ((hw_cfg[radio].baudRate == 0) && (uartIsTty((int8_t*)hw_cfg[radio].port))))
+	{
+		log_err("Unknow model!\n");
+		return GL_UNKNOW_ERR;
+	}
+
+	if(hw_cfg[radio].flags & HW_CFG_QSDK_GPIO)
 	{
-		ble_hw_cfg = &S1300_BLE_HW_CFG;
 		qsdk_check_ver();
+	}
 
-	}else if(0 == strcmp(model, "x750")){
-		ble_hw_cfg = &X750_BLE_HW_CFG;
+	if(hw_cfg[radio].flags & HW_CFG_QUIET_PRINTK)
+	{
 		// mark kernel log
-		system("echo 1 4 1 7 > /proc/sys/kernel/printk");
+		write_file("/proc/sys/kernel/printk", "1 4 1 7");
+	}
 
-	}else if(0 == strcmp(model, "xe300")){
-		ble_hw_cfg = &XE300_BLE_HW_CFG;
-		// mark kernel log
-		system("echo 1 4 1 7 > /proc/sys/kernel/printk");
+	hw_cfg_loaded[radio] = true;
+	return GL_SUCCESS;
+}
 
-	}else if(0 == strcmp(model, "mt300n-v2")){
-		ble_hw_cfg = &MT300N_V2_BLE_HW_CFG; 
+static GL_RET get_model_hw_cfg(void)
+{
+	int radio = radio_cur();
 
-	}else if(0 == strcmp(model, "x300b")){
-		ble_hw_cfg = &X300B_BLE_HW_CFG;
-		// mark kernel log
-		system("echo 1 4 1 7 > /proc/sys/kernel/printk");
+	pthread_mutex_lock(&hw_cfg_mutex);
+	if((!hw_cfg_loaded[radio]) && (load_hw_cfg() != GL_SUCCESS))
+	{
+		pthread_mutex_unlock(&hw_cfg_mutex);
+		ble_hw_cfg[radio] = NULL;
+		return GL_UNKNOW_ERR;
+	}
+	ble_hw_cfg[radio] = &hw_cfg[radio];
+	pthread_mutex_unlock(&hw_cfg_mutex);
 
-	}else if(0 == strcmp(model, "ap1300")){
-		ble_hw_cfg = &AP1300_BLE_HW_CFG;
-		qsdk_check_ver();
+	normal_check_rst_io();
 
-	}else if(0 == strcmp(model, "b2200")){
-		ble_hw_cfg = &B2200_BLE_HW_CFG;
-		qsdk_check_ver();
+	return GL_SUCCESS;
+}
 
-	}else if(0 == strcmp(model, "e750")){
-		ble_hw_cfg = &E750_BLE_HW_CFG;
+int hal_get_cfg(hw_cfg_t *cfg)
+{
+	int radio = radio_cur();
 
-	}else if(0 == strcmp(model, "s200")){
-    	ble_hw_cfg = &S200_BLE_HW_CFG;
-  	}else{
-		log_err("Unknow model!\n");
+	if(!cfg)
+	{
+		return GL_ERR_PARAM;
+	}
+
+	pthread_mutex_lock(&hw_cfg_mutex);
+	if((!hw_cfg_loaded[radio]) && (load_hw_cfg() != GL_SUCCESS))
+	{
+		pthread_mutex_unlock(&hw_cfg_mutex);
 		return GL_UNKNOW_ERR;
 	}
+	memcpy(cfg, &hw_cfg[radio], sizeof(hw_cfg_t));
+	pthread_mutex_unlock(&hw_cfg_mutex);
 
-	normal_check_rst_io();
+	return GL_SUCCESS;
+}
+
+int hal_set_cfg(const hw_cfg_t *cfg)
+{
+	int radio = radio_cur();
+
+	if((cfg) && ((cfg->port[0] == '\0') || ((cfg->baudRate == 0) && (uartIsTty((int8_t*)cfg->port))) || (cfg->rst_trigger > 1)))
+	{
+		return GL_ERR_PARAM;
+	}
+
+	pthread_mutex_lock(&hw_cfg_mutex);
+	if(cfg)
+	{
+		// taken as it is, the flags were applied by whoever made it
+		memcpy(&hw_cfg[radio], cfg, sizeof(hw_cfg_t));
+		hw_cfg_loaded[radio] = true;
+	}
+	else
+	{
+		hw_cfg_loaded[radio] = false;
+	}
+	pthread_mutex_unlock(&hw_cfg_mutex);
 
 	return GL_SUCCESS;
 }
@@ -238,6 +588,17 @@ int hal_init(void)
 
 int hal_destroy(void)
 {
+	int radio = radio_cur();
+
+	if(rst_fd[radio] >= 0)
+	{
+		close(rst_fd[radio]);
+		rst_fd[radio] = -1;
+	}
+#ifdef GPIO_CHARDEV
+	rst_chardev[radio] = 0;
+#endif
+
 	return uartClose();
 }
 
@@ -20,23 +20,32 @@
 #ifndef GL_HAL_H
 #define GL_HAL_H
 
+#include "gl_type.h"
 
-extern char rston[];
-extern char rstoff[];
+typedef gl_ble_hw_cfg_t hw_cfg_t;
 
-typedef struct {
-    char model[20];
-    char port[32];
-    uint32_t baudRate;
-    uint32_t flowcontrol;
-    uint8_t rst_trigger;
-    uint8_t rst_gpio;
-}hw_cfg_t;
+// ms the reset IO is held when the model does not set rst_pulse
+#define HAL_RST_PULSE_DEFAULT 20
 
 /*Initilize the hal*/
 int hal_init(void);
 
 int hal_destroy(void);
 
+/*Turn the ble module on or off with its reset IO, return 0 on success*/
+int hal_rst_set(int on);
+
+/*Return 1 if the ble module has a reset IO, a module without one is reset by command*/
+int hal_rst_io(void);
+
+/*Time the reset IO must be held to reset the ble module (ms)*/
+uint16_t hal_rst_pulse(void);
+
+/*Copy the hardware config, it is loaded the first time and kept for the process*/
+int hal_get_cfg(hw_cfg_t *cfg);
+
+/*Replace the hardware config for the next hal_init, NULL loads it again*/
+int hal_set_cfg(const hw_cfg_t *cfg);
+
 
 #endif
\ No newline at end of file
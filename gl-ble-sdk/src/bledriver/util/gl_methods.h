@@ -25,12 +25,18 @@
 
 #include "silabs_bleapi.h"
 #include "silabs_msg.h"
+#include "silabs_sampler.h"
 
 #define ble_driver						silabs_driver
 #define ble_watcher                     silabs_watcher
+#define ble_in_driver_thread            silabs_in_driver_thread
 
 #define ble_enable                      silabs_ble_enable
 #define ble_hard_reset                  silabs_ble_hard_reset
+#define ble_wait_boot                   silabs_ble_wait_boot
+#define ble_probe                       silabs_ble_probe
+#define ble_attach                      silabs_ble_attach
+#define ble_get_attach_info             silabs_ble_get_attach_info
 #define ble_local_mac                   silabs_ble_local_mac
 #define ble_set_power                   silabs_ble_set_power
 #define ble_discovery                   silabs_ble_discovery
@@ -45,10 +51,23 @@
 #define ble_get_service                 silabs_ble_get_service
 #define ble_get_char                    silabs_ble_get_char
 #define ble_read_char                   silabs_ble_read_char
+#define ble_read_multiple_char          silabs_ble_read_multiple_char
+#define ble_read_char_by_uuid           silabs_ble_read_char_by_uuid
 #define ble_write_char                  silabs_ble_write_char
+#define ble_read_char_sync              silabs_ble_read_char_sync
+#define ble_write_char_sync             silabs_ble_write_char_sync
+#define ble_read_char_async             silabs_ble_read_char_async
+#define ble_write_char_async            silabs_ble_write_char_async
 #define ble_set_notify                  silabs_ble_set_notify
+#define ble_l2cap_listen                silabs_ble_l2cap_listen
+#define ble_l2cap_stop_listen           silabs_ble_l2cap_stop_listen
+#define ble_l2cap_connect               silabs_ble_l2cap_connect
+#define ble_l2cap_send                  silabs_ble_l2cap_send
+#define ble_l2cap_disconnect            silabs_ble_l2cap_disconnect
 #define ble_sw_reset                    silabs_ble_sw_reset
 #define ble_dfu_uart_flash_upload       silabs_ble_dfu_uart_flash_upload
+#define ble_set_sampler                 silabs_sampler_set
+#define ble_get_ncp_stats               silabs_sampler_get
 
 #endif
 
@@ -0,0 +1,287 @@
+/*****************************************************************************
+ * @file  gl_replay.c
+ * @brief Link which plays the frames a module sent back from a capture
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/socket.h>
+
+#include "gl_transport.h"
+#include "gl_capture.h"
+#include "gl_radio.h"
+#include "timestamp.h"
+
+/***************************************************************************************************
+ * Local Variables
+ **************************************************************************************************/
+
+/* The driver reads one end of a socket pair, a feeder thread writes the received frames of the
+ * capture to the other end. Commands of the driver are dropped. */
+typedef struct {
+  int32_t fd;
+  int32_t peer;
+  bool fast;
+  bool started;
+  bool stop;
+  capture_reader_t reader;
+  char path[64];
+  pthread_t tid;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+} replay_t;
+
+static replay_t replayList[RADIO_MAX] = {
+  [0 ... RADIO_MAX - 1] = {
+    .fd = -1,
+    .peer = -1,
+    .mutex = PTHREAD_MUTEX_INITIALIZER,
+  },
+};
+static pthread_mutex_t listMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/***************************************************************************************************
+ * Static Function Definitions
+ **************************************************************************************************/
+
+static replay_t* replayFind(int32_t fd)
+{
+  uint32_t i;
+
+  for (i = 0; i < RADIO_MAX; i++) {
+    if (replayList[i].fd == fd) {
+      return &replayList[i];
+    }
+  }
+
+  return NULL;
+}
+
+/* Wait until the deadline, or until the link is closed. Return true if it was closed. */
+static bool replayWait(replay_t* replay, uint64_t deadline)
+{
+  struct timespec ts = { .tv_sec = deadline / 1000000000, .tv_nsec = deadline % 1000000000 };
+
+  pthread_mutex_lock(&replay->mutex);
+  while ((!replay->stop) && (utils_get_time_ns() < deadline)) {
+    pthread_cond_timedwait(&replay->cond, &replay->mutex, &ts);
+  }
+  bool stop = replay->stop;
+  pthread_mutex_unlock(&replay->mutex);
+
+  return stop;
+}
+
+static void* replayThread(void* arg)
+{
+  replay_t* replay = (replay_t*)arg;
+  capture_frame_t frame;
+  uint64_t first = 0;
+  uint64_t base = 0;
+  uint32_t frames = 0;
+
+  /* The module answers the host, the capture starts with the first command. Before it the driver
+   * flushes what the link holds. */
+  pthread_mutex_lock(&replay->mutex);
+  while ((!replay->started) && (!replay->stop)) {
+    pthread_cond_wait(&replay->cond, &replay->mutex);
+  }
+  pthread_mutex_unlock(&replay->mutex);
+
+  while (capture_reader_next(&replay->reader, &frame) == 1) {
+    if (frame.dir != CAPTURE_RX) {
+      continue;
+    }
+
+    /* Frames keep their distance to the first one, or follow each other as fast as the driver reads. */
+    if (!replay->fast) {
+      if (!frames) {
+        first = frame.time_ns;
+        base = utils_get_time_ns();
+      }
+      if ((frame.time_ns > first) && (replayWait(replay, base + (frame.time_ns - first)))) {
+        break;
+      }
+    }
+
+    uint8_t* data = frame.data;
+    uint32_t len = frame.len;
+    while (len) {
+      ssize_t ret = send(replay->peer, data, len, MSG_NOSIGNAL);
+      if (ret == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        goto done;
+      }
+      data += ret;
+      len -= ret;
+    }
+    frames++;
+  }
+
+  fprintf(stderr, "Replay of %s done, %u frames.\n", replay->path, frames);
+
+  /* The link stays open and reads time out, as a module which went quiet. */
+  done:
+  return NULL;
+}
+
+static int32_t replayOpen(const char* addr, bool fast)
+{
+  int32_t sv[2];
+  char path[64];
+  int32_t iface = 0;
+  pthread_condattr_t attr;
+  replay_t* replay = NULL;
+
+  /* addr is the file, and the radio of the capture after a '#' if it is not the first one. */
+  snprintf(path, sizeof(path), "%s", addr);
+  char* hash = strrchr(path, '#');
+  if (hash) {
+    *hash = '\0';
+    iface = atoi(hash + 1);
+  }
+
+  pthread_mutex_lock(&listMutex);
+  replay = replayFind(-1);
+  if (!replay) {
+    pthread_mutex_unlock(&listMutex);
+    return -1;
+  }
+
+  if (capture_reader_open(&replay->reader, path, iface) != 0) {
+    pthread_mutex_unlock(&listMutex);
+    fprintf(stderr, "Error opening capture %s.\n", path);
+    return -1;
+  }
+
+  if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv) == -1) {
+    capture_reader_close(&replay->reader);
+    pthread_mutex_unlock(&listMutex);
+    fprintf(stderr, "Error creating socket pair - %s(%d).\n", strerror(errno), errno);
+    return -1;
+  }
+
+  replay->fd = sv[0];
+  replay->peer = sv[1];
+  replay->fast = fast;
+  replay->started = false;
+  replay->stop = false;
+  snprintf(replay->path, sizeof(replay->path), "%s", path);
+  pthread_condattr_init(&attr);
+  pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+  pthread_cond_init(&replay->cond, &attr);
+  pthread_condattr_destroy(&attr);
+
+  if (pthread_create(&replay->tid, NULL, replayThread, replay) != 0) {
+    close(sv[0]);
+    close(sv[1]);
+    capture_reader_close(&replay->reader);
+    pthread_cond_destroy(&replay->cond);
+    replay->fd = -1;
+    replay->peer = -1;
+    pthread_mutex_unlock(&listMutex);
+    return -1;
+  }
+  pthread_mutex_unlock(&listMutex);
+
+  return sv[0];
+}
+
+static int32_t replayOpenPaced(const char* addr, uint32_t baudRate, uint32_t rtsCts, int32_t timeout)
+{
+  (void)baudRate;
+  (void)rtsCts;
+  (void)timeout;
+
+  return replayOpen(addr, false);
+}
+
+static int32_t replayOpenFast(const char* addr, uint32_t baudRate, uint32_t rtsCts, int32_t timeout)
+{
+  (void)baudRate;
+  (void)rtsCts;
+  (void)timeout;
+
+  return replayOpen(addr, true);
+}
+
+static int32_t replayWrite(int32_t fd, const struct iovec* iov, int32_t iovcnt)
+{
+  int32_t len = 0;
+  int32_t i;
+
+  for (i = 0; i < iovcnt; i++) {
+    len += iov[i].iov_len;
+  }
+
+  pthread_mutex_lock(&listMutex);
+  replay_t* replay = replayFind(fd);
+  if (replay) {
+    pthread_mutex_lock(&replay->mutex);
+    replay->started = true;
+    pthread_cond_broadcast(&replay->cond);
+    pthread_mutex_unlock(&replay->mutex);
+  }
+  pthread_mutex_unlock(&listMutex);
+
+  return len;
+}
+
+static int32_t replayClose(int32_t fd)
+{
+  pthread_mutex_lock(&listMutex);
+  replay_t* replay = replayFind(fd);
+  if (!replay) {
+    pthread_mutex_unlock(&listMutex);
+    return close(fd);
+  }
+
+  pthread_mutex_lock(&replay->mutex);
+  replay->stop = true;
+  pthread_cond_broadcast(&replay->cond);
+  pthread_mutex_unlock(&replay->mutex);
+
+  /* A feeder blocked on a full socket wakes up with an error. */
+  shutdown(replay->peer, SHUT_RDWR);
+  pthread_join(replay->tid, NULL);
+
+  close(replay->peer);
+  int32_t ret = close(replay->fd);
+  capture_reader_close(&replay->reader);
+  pthread_cond_destroy(&replay->cond);
+  replay->fd = -1;
+  replay->peer = -1;
+  pthread_mutex_unlock(&listMutex);
+
+  return ret;
+}
+
+/***************************************************************************************************
+   Public Function Definitions
+ **************************************************************************************************/
+
+/* The feeder never closes its end, a read of the driver sees data or a timeout like on a socket. */
+const transport_t transport_replay = { TRANSPORT_REPLAY, false, replayOpenPaced, transport_sock_read, replayWrite, replayClose, NULL };
+const transport_t transport_replay_fast = { TRANSPORT_REPLAY_FAST, false, replayOpenFast, transport_sock_read, replayWrite, replayClose, NULL };
@@ -0,0 +1,271 @@
+/*****************************************************************************
+ * @file  gl_transport.c
+ * @brief Pty and socket links, for a NCP emulated by software or reached over the network
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <netdb.h>
+#include <termios.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include "gl_transport.h"
+
+/***************************************************************************************************
+ * Static Function Definitions
+ **************************************************************************************************/
+
+/* Wait for data like VTIME does on the tty. Return 1 if there is data, 0 on timeout, -1 on failure. */
+static int32_t waitData(int32_t fd, int32_t timeout)
+{
+  struct pollfd pfd = { .fd = fd, .events = POLLIN };
+
+  int32_t ret = poll(&pfd, 1, timeout);
+  if ((ret == -1) && (errno == EINTR)) {
+    return 0;
+  }
+
+  return ret;
+}
+
+static int32_t ptyOpen(const char* addr, uint32_t baudRate, uint32_t rtsCts, int32_t timeout)
+{
+  struct termios ttyAttrs;
+
+  (void)baudRate;
+  (void)rtsCts;
+  (void)timeout;
+
+  int32_t fd = open(addr, O_RDWR | O_NOCTTY | O_CLOEXEC);
+  if (fd == -1) {
+    fprintf(stderr, "Error opening pty %s - %s(%d).\n", addr, strerror(errno), errno);
+    return -1;
+  }
+
+  /* The line discipline must pass the packets through untouched. */
+  if (tcgetattr(fd, &ttyAttrs) == 0) {
+    cfmakeraw(&ttyAttrs);
+    tcsetattr(fd, TCSANOW, &ttyAttrs);
+  }
+
+  return fd;
+}
+
+static int32_t ptyRead(int32_t fd, uint8_t* data, uint32_t dataLength, int32_t timeout)
+{
+  int32_t ret = waitData(fd, timeout);
+  if (ret <= 0) {
+    return ret;
+  }
+
+  ret = read(fd, data, dataLength);
+  if (ret == 0) {
+    errno = ENOTCONN;
+    return -1;
+  }
+  /* The slave reads EIO once the master is closed. */
+  if ((ret == -1) && (errno == EIO)) {
+    errno = ENOTCONN;
+  }
+
+  return ret;
+}
+
+static int32_t ptyWrite(int32_t fd, const struct iovec* iov, int32_t iovcnt)
+{
+  int32_t ret = writev(fd, iov, iovcnt);
+  if ((ret == -1) && (errno == EIO)) {
+    errno = ENOTCONN;
+  }
+
+  return ret;
+}
+
+static int32_t sockOpen(int32_t domain, const struct sockaddr* sa, socklen_t len, const char* addr)
+{
+  int32_t fd = socket(domain, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd == -1) {
+    fprintf(stderr, "Error creating socket for %s - %s(%d).\n", addr, strerror(errno), errno);
+    return -1;
+  }
+
+  if (connect(fd, sa, len) == -1) {
+    fprintf(stderr, "Error connecting %s - %s(%d).\n", addr, strerror(errno), errno);
+    close(fd);
+    return -1;
+  }
+
+  return fd;
+}
+
+static int32_t unixOpen(const char* addr, uint32_t baudRate, uint32_t rtsCts, int32_t timeout)
+{
+  struct sockaddr_un sun;
+
+  (void)baudRate;
+  (void)rtsCts;
+  (void)timeout;
+
+  if (strlen(addr) >= sizeof(sun.sun_path)) {
+    fprintf(stderr, "Socket path too long %s.\n", addr);
+    return -1;
+  }
+
+  memset(&sun, 0, sizeof(sun));
+  sun.sun_family = AF_UNIX;
+  strcpy(sun.sun_path, addr);
+
+  return sockOpen(AF_UNIX, (struct sockaddr*)&sun, sizeof(sun), addr);
+}
+
+/* addr is host:port, an IPv6 host is put in brackets. */
+static int32_t tcpOpen(const char* addr, uint32_t baudRate, uint32_t rtsCts, int32_t timeout)
+{
+  char host[64];
+  struct addrinfo hints, *res, *ai;
+  int32_t fd = -1;
+  int32_t one = 1;
+
+  (void)baudRate;
+  (void)rtsCts;
+  (void)timeout;
+
+  const char* port = strrchr(addr, ':');
+  if ((!port) || ((size_t)(port - addr) >= sizeof(host))) {
+    fprintf(stderr, "Bad tcp address %s.\n", addr);
+    return -1;
+  }
+
+  if ((addr[0] == '[') && (port[-1] == ']')) {
+    memcpy(host, addr + 1, port - addr - 2);
+    host[port - addr - 2] = '\0';
+  } else {
+    memcpy(host, addr, port - addr);
+    host[port - addr] = '\0';
+  }
+
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  if (getaddrinfo(host, port + 1, &hints, &res) != 0) {
+    fprintf(stderr, "Error resolving %s.\n", addr);
+    return -1;
+  }
+
+  for (ai = res; ai; ai = ai->ai_next) {
+    fd = sockOpen(ai->ai_family, ai->ai_addr, ai->ai_addrlen, addr);
+    if (fd != -1) {
+      break;
+    }
+  }
+  freeaddrinfo(res);
+
+  if (fd == -1) {
+    return -1;
+  }
+
+  /* A command is a small packet waiting for its response, it must not be held back by Nagle. */
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &one, sizeof(one));
+
+  return fd;
+}
+
+static int32_t sockRead(int32_t fd, uint8_t* data, uint32_t dataLength, int32_t timeout)
+{
+  int32_t ret = waitData(fd, timeout);
+  if (ret <= 0) {
+    return ret;
+  }
+
+  ret = recv(fd, data, dataLength, 0);
+  if (ret == 0) {
+    errno = ENOTCONN;
+    return -1;
+  }
+  if ((ret == -1) && ((errno == ECONNRESET) || (errno == ETIMEDOUT))) {
+    errno = ENOTCONN;
+  }
+
+  return ret;
+}
+
+static int32_t sockWrite(int32_t fd, const struct iovec* iov, int32_t iovcnt)
+{
+  struct msghdr msg = { .msg_iov = (struct iovec*)iov, .msg_iovlen = iovcnt };
+
+  /* A peer which went away must not kill the process with SIGPIPE. */
+  int32_t ret = sendmsg(fd, &msg, MSG_NOSIGNAL);
+  if ((ret == -1) && ((errno == EPIPE) || (errno == ECONNRESET))) {
+    errno = ENOTCONN;
+  }
+
+  return ret;
+}
+
+static int32_t linkClose(int32_t fd)
+{
+  return close(fd);
+}
+
+/***************************************************************************************************
+   Public Function Definitions
+ **************************************************************************************************/
+
+const transport_t transport_pty = { TRANSPORT_PTY, true, ptyOpen, ptyRead, ptyWrite, linkClose, NULL };
+const transport_t transport_unix = { TRANSPORT_UNIX, true, unixOpen, sockRead, sockWrite, linkClose, NULL };
+const transport_t transport_tcp = { TRANSPORT_TCP, true, tcpOpen, sockRead, sockWrite, linkClose, NULL };
+
+int32_t transport_sock_read(int32_t fd, uint8_t* data, uint32_t dataLength, int32_t timeout)
+{
+  return sockRead(fd, data, dataLength, timeout);
+}
+
+const transport_t* transport_find(const char* port, const char** addr)
+{
+  static const transport_t* const list[] = { &transport_pty, &transport_unix, &transport_tcp,
+                                             &transport_replay, &transport_replay_fast };
+  const transport_t* transport = &transport_tty;
+  const char* rest = port;
+  uint32_t i;
+
+  if (!strncmp(port, TRANSPORT_TTY, strlen(TRANSPORT_TTY))) {
+    rest = port + strlen(TRANSPORT_TTY);
+  } else {
+    for (i = 0; i < sizeof(list) / sizeof(list[0]); i++) {
+      if (!strncmp(port, list[i]->scheme, strlen(list[i]->scheme))) {
+        transport = list[i];
+        rest = port + strlen(list[i]->scheme);
+        break;
+      }
+    }
+  }
+
+  if (addr) {
+    *addr = rest;
+  }
+
+  return transport;
+}
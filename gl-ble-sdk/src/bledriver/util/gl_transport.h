@@ -0,0 +1,105 @@
+/*****************************************************************************
+ * @file  gl_transport.h
+ * @brief Links between the host and the NCP
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#ifndef GL_TRANSPORT_H
+#define GL_TRANSPORT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/uio.h>
+
+/*
+ * The port of the hw config selects the transport by its scheme:
+ *   /dev/ttyS0                   serial port of the board, "tty:" may be put in front
+ *   pty:/tmp/ncp0                slave side of a pty, such as the one of a software NCP
+ *   unix:/tmp/ncp0.sock          unix stream socket
+ *   tcp:192.168.8.1:4321         TCP server, such as ser2net in raw mode
+ *   replay:/tmp/ble.pcapng       frames the module sent in a capture, at their original pace
+ *   replay-fast:/tmp/ble.pcapng  the same as fast as the driver reads them
+ * A capture holds every radio, "#1" after the file replays radio 1 instead of radio 0.
+ */
+#define TRANSPORT_TTY         "tty:"
+#define TRANSPORT_PTY         "pty:"
+#define TRANSPORT_UNIX        "unix:"
+#define TRANSPORT_TCP         "tcp:"
+#define TRANSPORT_REPLAY      "replay:"
+#define TRANSPORT_REPLAY_FAST "replay-fast:"
+
+// ms between two attempts to open a link whose peer went away
+#define TRANSPORT_RETRY 1000
+
+typedef struct {
+  /** Scheme of the port, NULL for the tty which is also used by a port without scheme. */
+  const char* scheme;
+  /** The peer may go away and come back, the link is opened again instead of failing for good. */
+  bool reconnect;
+  /***********************************************************************************************//**
+   *  \brief  Open the link.
+   *  \param[in]  addr Port without its scheme.
+   *  \param[in]  baudRate Baud rate, used by the tty only.
+   *  \param[in]  rtsCts Hardware flow control, used by the tty only.
+   *  \param[in]  timeout Time a read waits for data (ms), < 0 waits for ever.
+   *  \return  Descriptor of the link or -1 on failure.
+   ************************************************************************************************/
+  int32_t (*open)(const char* addr, uint32_t baudRate, uint32_t rtsCts, int32_t timeout);
+  /***********************************************************************************************//**
+   *  \brief  Read what is available, wait for the timeout of open() if nothing is.
+   *  \return  The amount of bytes read, 0 on timeout or -1 on failure. The errno of a peer which
+   *           went away is ENOTCONN.
+   ************************************************************************************************/
+  int32_t (*read)(int32_t fd, uint8_t* data, uint32_t dataLength, int32_t timeout);
+  /***********************************************************************************************//**
+   *  \brief  Write a part of the data, gathered from iovcnt buffers in a single call.
+   *  \return  The amount of bytes written or -1 on failure.
+   ************************************************************************************************/
+  int32_t (*writev)(int32_t fd, const struct iovec* iov, int32_t iovcnt);
+  /***********************************************************************************************//**
+   *  \brief  Close the link.
+   *  \return  0 on success, -1 on failure.
+   ************************************************************************************************/
+  int32_t (*close)(int32_t fd);
+  /***********************************************************************************************//**
+   *  \brief  Drive the reset of the module through the link, NULL if the link cannot.
+   *  \param[in]  level 0:low level  1:high level
+   *  \return  0 on success, -1 on failure.
+   ************************************************************************************************/
+  int32_t (*reset)(int32_t fd, uint8_t level);
+} transport_t;
+
+extern const transport_t transport_tty;
+extern const transport_t transport_pty;
+extern const transport_t transport_unix;
+extern const transport_t transport_tcp;
+extern const transport_t transport_replay;
+extern const transport_t transport_replay_fast;
+
+/***********************************************************************************************//**
+ *  \brief  Find the transport of a port.
+ *  \param[in]  port Port of the hw config.
+ *  \param[out]  addr Port without its scheme, may be NULL.
+ *  \return  The transport, the tty if the port has no known scheme.
+ **************************************************************************************************/
+const transport_t* transport_find(const char* port, const char** addr);
+
+/***********************************************************************************************//**
+ *  \brief  Read of a stream socket, for the transports built on one.
+ *  \return  The same as the read of a transport.
+ **************************************************************************************************/
+int32_t transport_sock_read(int32_t fd, uint8_t* data, uint32_t dataLength, int32_t timeout);
+
+#endif
@@ -28,6 +28,8 @@
 #include <pthread.h>
 
 #include "gl_uart.h"
+#include "gl_transport.h"
+#include "gl_radio.h"
 
 /***************************************************************************************************
  * Local Variables
@@ -49,8 +51,16 @@ static struct {
   { 0, 0 }
 };
 
-static int32_t serialHandle = -1;
-static struct termios origTTYAttrs;
+// link of every radio, serialHandle keeps its number when the link is opened again
+static int32_t serialHandle[RADIO_MAX] = { [0 ... RADIO_MAX - 1] = -1 };
+static struct termios origTTYAttrs[RADIO_MAX];
+static struct {
+  const transport_t* transport;
+  char port[64];
+  uint32_t baudRate;
+  uint32_t rtsCts;
+  int32_t timeout;
+} linkCfg[RADIO_MAX];
 
 /***************************************************************************************************
  * Static Function Declarations
@@ -59,6 +69,7 @@ static int32_t uartOpenSerial(int8_t* device, uint32_t bps, uint32_t dataBits, u
                               uint32_t stopBits, uint32_t rtsCts, uint32_t xOnXOff,
                               int32_t timeout);
 static int32_t uartCloseSerial(int32_t handle);
+static int32_t linkRead(uint8_t* data, uint32_t dataLength);
 
 /***************************************************************************************************
    Public Function Definitions
@@ -66,10 +77,18 @@ static int32_t uartCloseSerial(int32_t handle);
 int32_t uartOpen(int8_t* port, uint32_t baudRate, uint32_t rtsCts, int32_t timeout)
 {
   uint8_t buf[4];
+  const char* addr;
+  int radio = radio_cur();
+
+  linkCfg[radio].transport = transport_find((char*)port, &addr);
+  snprintf(linkCfg[radio].port, sizeof(linkCfg[radio].port), "%s", addr);
+  linkCfg[radio].baudRate = baudRate;
+  linkCfg[radio].rtsCts = rtsCts;
+  linkCfg[radio].timeout = timeout;
 
-  serialHandle = uartOpenSerial(port, baudRate, 8, 0, 1, rtsCts, 0, timeout);
+  serialHandle[radio] = linkCfg[radio].transport->open(linkCfg[radio].port, baudRate, rtsCts, timeout);
 
-  if (-1 == serialHandle) {
+  if (-1 == serialHandle[radio]) {
     return -1;
   }
 
@@ -78,12 +97,21 @@ int32_t uartOpen(int8_t* port, uint32_t baudRate, uint32_t rtsCts, int32_t timeo
   while (uartRxNonBlocking(4, buf) == 4) {
   }
 
-  return serialHandle;
+  return serialHandle[radio];
 }
 
 int32_t uartClose(void)
 {
-  return uartCloseSerial(serialHandle);
+  int radio = radio_cur();
+
+  if ((serialHandle[radio] == -1) || (!linkCfg[radio].transport)) {
+    return -1;
+  }
+
+  int32_t ret = linkCfg[radio].transport->close(serialHandle[radio]);
+  serialHandle[radio] = -1;
+
+  return ret;
 }
 
 int32_t uartCacheClean(void)
@@ -103,12 +131,12 @@ int32_t uartRx(uint32_t dataLength, uint8_t* data)
   /** The amount of bytes still needed to be read. */
   size_t dataToRead = dataLength;
 
-  if (serialHandle == -1) {
+  if (serialHandle[radio_cur()] == -1) {
     return -1;
   }
 
   while (dataToRead) {
-    dataRead = read(serialHandle, (void*)data, dataToRead);
+    dataRead = linkRead(data, dataToRead);
     if (-1 == dataRead) {
       if (EAGAIN == errno) {
         continue;
@@ -125,30 +153,22 @@ int32_t uartRx(uint32_t dataLength, uint8_t* data)
 
 int32_t uartRxNonBlocking(uint32_t dataLength, uint8_t* data)
 {
-  /** The amount of bytes read. */
-  size_t dataRead;
-
-  if (serialHandle == -1) {
-    return -1;
-  }
-
-  dataRead = read(serialHandle, (void*)data, (size_t)dataLength);
-  if (-1 == dataRead) {
+  if (serialHandle[radio_cur()] == -1) {
     return -1;
   }
 
-  return (int32_t)dataRead;
+  return linkRead(data, dataLength);
 }
 
 int32_t uartRxPeek(void)
 {
   int32_t bytesInBuf;
 
-  if (serialHandle == -1) {
+  if (serialHandle[radio_cur()] == -1) {
     return -1;
   }
 
-  if (-1 == ioctl(serialHandle, FIONREAD, (int*)&bytesInBuf)) {
+  if (-1 == ioctl(serialHandle[radio_cur()], FIONREAD, (int*)&bytesInBuf)) {
     return -1;
   }
 
@@ -157,32 +177,73 @@ int32_t uartRxPeek(void)
 
 int32_t uartTx(uint32_t dataLength, uint8_t* data)
 {
+  struct iovec iov = { .iov_base = data, .iov_len = dataLength };
+
+  return uartTxv(&iov, 1);
+}
+
+int32_t uartTxv(const struct iovec* iov, int32_t iovcnt)
+{
+  /** The buffers still to write, the first one is advanced past what was written. */
+  struct iovec vec[UART_IOV_MAX];
   /** The amount of bytes written. */
-  size_t dataWritten;
+  ssize_t dataWritten;
   /** The amount of bytes still needed to be written. */
-  size_t dataToWrite = dataLength;
+  size_t dataToWrite = 0;
+  struct iovec* cur = vec;
+  int32_t i;
+  int radio = radio_cur();
 
-  if (serialHandle == -1) {
+  if ((serialHandle[radio] == -1) || (iovcnt > UART_IOV_MAX)) {
     return -1;
   }
 
+  for (i = 0; i < iovcnt; i++) {
+    vec[i] = iov[i];
+    dataToWrite += iov[i].iov_len;
+  }
+  size_t dataLength = dataToWrite;
+
   while (dataToWrite) {
-    dataWritten = write(serialHandle, (void*)data, dataToWrite);
+    dataWritten = linkCfg[radio].transport->writev(serialHandle[radio], cur, iovcnt);
     if (-1 == dataWritten) {
       if (EAGAIN == errno) {
         continue;
       } else {
         return -1;
       }
-    } else {
-      dataToWrite -= dataWritten;
-      data += dataWritten;
+    }
+    dataToWrite -= dataWritten;
+    while (iovcnt && ((size_t)dataWritten >= cur->iov_len)) {
+      dataWritten -= cur->iov_len;
+      cur++;
+      iovcnt--;
+    }
+    if (iovcnt) {
+      cur->iov_base = (uint8_t*)cur->iov_base + dataWritten;
+      cur->iov_len -= dataWritten;
     }
   }
 
   return (int32_t)dataLength;
 }
 
+int32_t uartReset(uint8_t level)
+{
+  int radio = radio_cur();
+
+  if ((serialHandle[radio] == -1) || (!linkCfg[radio].transport->reset)) {
+    return -1;
+  }
+
+  return linkCfg[radio].transport->reset(serialHandle[radio], level);
+}
+
+int32_t uartIsTty(int8_t* port)
+{
+  return transport_find((char*)port, NULL) == &transport_tty;
+}
+
 /***************************************************************************************************
  * Static Function Definitions
  **************************************************************************************************/
@@ -250,7 +311,7 @@ static int32_t uartOpenSerial(int8_t* device, uint32_t bps, uint32_t dataBits, u
   }
 
   /* Get the current options and save them so we can restore the default settings later. */
-  if (tcgetattr(serial, &origTTYAttrs) == -1) {
+  if (tcgetattr(serial, &origTTYAttrs[radio_cur()]) == -1) {
     fprintf(stderr, "Error getting tty attributes %s - %s(%d).\n",
             (char*)device,
             strerror(errno), errno);
@@ -259,7 +320,7 @@ static int32_t uartOpenSerial(int8_t* device, uint32_t bps, uint32_t dataBits, u
   /* The serial port attributes such as timeouts and baud rate are set by modifying the termios
    * structure and then calling tcsetattr to cause the changes to take effect. Note that the changes
    * will not take effect without the tcsetattr() call. */
-  ttyAttrs = origTTYAttrs;
+  ttyAttrs = origTTYAttrs[radio_cur()];
 
   /* Now that the device is open, clear the O_NONBLOCK flag so subsequent I/O will block. */
   if (fcntl(serial, F_SETFL, 0) == -1) {
@@ -397,16 +458,77 @@ static int32_t uartCloseSerial(int32_t handle)
   return ret;
 }
 
-int32_t setRtsStu(char stu)
+/* Open the link of the current radio again, the new link takes the number of the old one so that a
+ * writer never uses a closed descriptor. Return 0 on success, -1 on failure. */
+static int32_t linkReopen(void)
+{
+  int radio = radio_cur();
+  const transport_t* transport = linkCfg[radio].transport;
+
+  usleep(TRANSPORT_RETRY * 1000);
+
+  int32_t fd = transport->open(linkCfg[radio].port, linkCfg[radio].baudRate, linkCfg[radio].rtsCts,
+                               linkCfg[radio].timeout);
+  if (fd == -1) {
+    return -1;
+  }
+
+  int32_t ret = dup3(fd, serialHandle[radio], O_CLOEXEC);
+  transport->close(fd);
+  if (ret == -1) {
+    fprintf(stderr, "Error reopening %s - %s(%d).\n", linkCfg[radio].port, strerror(errno), errno);
+    return -1;
+  }
+
+  fprintf(stderr, "Link %s opened again.\n", linkCfg[radio].port);
+  return 0;
+}
+
+/* Read from the link of the current radio. A peer which went away reads as a timeout while the link
+ * is opened again, the driver goes on waiting for the NCP to come back. */
+static int32_t linkRead(uint8_t* data, uint32_t dataLength)
+{
+  int radio = radio_cur();
+  const transport_t* transport = linkCfg[radio].transport;
+
+  int32_t ret = transport->read(serialHandle[radio], data, dataLength, linkCfg[radio].timeout);
+  if ((ret == -1) && (errno == ENOTCONN) && (transport->reconnect)) {
+    linkReopen();
+    return 0;
+  }
+
+  return ret;
+}
+
+static int32_t ttyOpen(const char* addr, uint32_t baudRate, uint32_t rtsCts, int32_t timeout)
+{
+  return uartOpenSerial((int8_t*)addr, baudRate, 8, 0, 1, rtsCts, 0, timeout);
+}
+
+/* The timeout of the tty is VTIME, set by uartOpenSerial(). */
+static int32_t ttyRead(int32_t fd, uint8_t* data, uint32_t dataLength, int32_t timeout)
+{
+  (void)timeout;
+
+  return read(fd, (void*)data, (size_t)dataLength);
+}
+
+static int32_t ttyWrite(int32_t fd, const struct iovec* iov, int32_t iovcnt)
+{
+  return writev(fd, iov, iovcnt);
+}
+
+/* Set the RTS pin level, the RTS of a USB-TTL adapter may be wired to the reset of the module. */
+static int32_t ttyRts(int32_t fd, uint8_t level)
 {
   int32_t status;
 
-  if (ioctl(serialHandle, TIOCMGET, &status) == -1)
+  if (ioctl(fd, TIOCMGET, &status) == -1)
   {
     goto error;
   }
 
-  if (!stu)
+  if (!level)
   {
     status |= TIOCM_RTS;
   }
@@ -415,7 +537,7 @@ int32_t setRtsStu(char stu)
     status &= ~TIOCM_RTS;
   }
 
-  if (ioctl(serialHandle, TIOCMSET, &status) == -1)
+  if (ioctl(fd, TIOCMSET, &status) == -1)
   {
     goto error;
   }
@@ -427,11 +549,18 @@ error:
   return -1;
 }
 
+const transport_t transport_tty = { NULL, false, ttyOpen, ttyRead, ttyWrite, uartCloseSerial, ttyRts };
+
+int32_t setRtsStu(char stu)
+{
+  return ttyRts(serialHandle[radio_cur()], (uint8_t)stu);
+}
+
 int32_t setDtrStu(char stu)
 {
   int32_t status;
 
-  if (ioctl(serialHandle, TIOCMGET, &status) == -1)
+  if (ioctl(serialHandle[radio_cur()], TIOCMGET, &status) == -1)
   {
     goto error;
   }
@@ -445,7 +574,7 @@ int32_t setDtrStu(char stu)
     status &= ~TIOCM_DTR;
   }
 
-  if (ioctl(serialHandle, TIOCMSET, &status) == -1)
+  if (ioctl(serialHandle[radio_cur()], TIOCMSET, &status) == -1)
   {
     goto error;
   }
@@ -461,7 +590,7 @@ int32_t getDsrStu(void)
 {
   int32_t status;
 
-  if (ioctl(serialHandle, TIOCMGET, &status) == -1)
+  if (ioctl(serialHandle[radio_cur()], TIOCMGET, &status) == -1)
   {
     goto error;
   }
@@ -482,7 +611,7 @@ int32_t getCtsStu(void)
 {
   int32_t status;
 
-  if (ioctl(serialHandle, TIOCMGET, &status) == -1)
+  if (ioctl(serialHandle[radio_cur()], TIOCMGET, &status) == -1)
   {
     goto error;
   }
@@ -20,9 +20,14 @@
 #define GL_UART_H
 
 #include <stdint.h>
+#include <sys/uio.h>
+
+// buffers uartTxv() gathers at most
+#define UART_IOV_MAX 4
+
 /***********************************************************************************************//**
  *  \brief  Open the serial port.
- *  \param[in]  port Serial port to use.
+ *  \param[in]  port Serial port to use, or a pty or socket address, see gl_transport.h.
  *  \param[in]  baudRate Baud rate to use.
  *  \param[in]  rtsCts Enable/disable hardware flow control.
  *  \param[in]  timeout Constant used to calculate the total time-out period for read operations, in
@@ -74,9 +79,31 @@ int32_t uartRxPeek(void);
  **************************************************************************************************/
 int32_t uartTx(uint32_t dataLength, uint8_t* data);
 
+/***********************************************************************************************//**
+ *  \brief  Write the buffers to serial port one after the other, without copying them together.
+ *          The function will block until all of them have been written or an error occurs.
+ *  \param[in]  iov Buffers to write.
+ *  \param[in]  iovcnt The number of buffers, at most UART_IOV_MAX.
+ *  \return  The amount of bytes written or -1 on failure.
+ **************************************************************************************************/
+int32_t uartTxv(const struct iovec* iov, int32_t iovcnt);
+
 
 int32_t uartCacheClean(void);
 
+/***********************************************************************************************//**
+ *  \brief  Drive the reset of the module through the link, such as the RTS of a USB-TTL adapter.
+ *  \param[in]  level 0:low level  1:high level
+ *  \return  0:success -1:failed or the link cannot reset the module
+ **************************************************************************************************/
+int32_t uartReset(uint8_t level);
+
+/***********************************************************************************************//**
+ *  \brief  Tell if the port is a serial port of the board rather than a pty or a socket.
+ *  \return  1:serial port 0:pty or socket
+ **************************************************************************************************/
+int32_t uartIsTty(int8_t* port);
+
 /***********************************************************************************************//**
  *  \brief  Set the usB-TTL RTS pin level status
  *  \param[in]  0:low level  1:high level
@@ -0,0 +1,96 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+ 
+ http://www.apache.org/licenses/LICENSE-2.0
+ 
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#include <stdbool.h>
+
+#include "gl_balance.h"
+
+// a is placed before b
+static bool less_loaded(const gl_ble_radio_load_t *a, const gl_ble_radio_load_t *b)
+{
+    int free_a = (int)a->max_conn - (int)a->connections;
+    int free_b = (int)b->max_conn - (int)b->connections;
+
+    if (free_a != free_b)
+    {
+        return free_a > free_b;
+    }
+    return a->load < b->load;
+}
+
+int balance_pick(const gl_ble_radio_load_t *list, int num)
+{
+    int best = -1;
+
+    for (int i = 0; i < num; i++)
+    {
+        if ((!list[i].up) || (list[i].connections >= list[i].max_conn))
+        {
+            continue;
+        }
+
+        if ((best < 0) || (less_loaded(&list[i], &list[best])))
+        {
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+void balance_plan(gl_ble_radio_load_t *list, int num, int phys)
+{
+    int up = 0;
+
+    for (int i = 0; i < num; i++)
+    {
+        list[i].scan_phy = 0;
+        if (list[i].up)
+        {
+            up++;
+        }
+    }
+
+    if ((phys != (BALANCE_PHY_1M | BALANCE_PHY_CODED)) || (up < 2))
+    {
+        for (int i = 0; i < num; i++)
+        {
+            if (list[i].up)
+            {
+                list[i].scan_phy = (uint8_t)phys;
+            }
+        }
+        return;
+    }
+
+    // hand out the PHYs in turn, the least loaded radio first
+    for (int n = 0; n < up; n++)
+    {
+        int next = -1;
+        for (int i = 0; i < num; i++)
+        {
+            if ((!list[i].up) || (list[i].scan_phy))
+            {
+                continue;
+            }
+            if ((next < 0) || (less_loaded(&list[i], &list[next])))
+            {
+                next = i;
+            }
+        }
+        list[next].scan_phy = (n % 2) ? BALANCE_PHY_CODED : BALANCE_PHY_1M;
+    }
+}
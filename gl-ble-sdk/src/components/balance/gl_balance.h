@@ -0,0 +1,39 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+ 
+ http://www.apache.org/licenses/LICENSE-2.0
+ 
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#ifndef _GL_BALANCE_H_
+#define _GL_BALANCE_H_
+
+#include "gl_type.h"
+
+// scanning PHYs of the module, a balanced discovery asked for both is split between modules
+#define BALANCE_PHY_1M 0x01
+#define BALANCE_PHY_CODED 0x04
+
+/*
+ * Choose the radio for a new connection: the one with the most free connection slots, then the one
+ * with the fewest connection events, then the lowest index. Return -1 if no radio has a free slot.
+ */
+int balance_pick(const gl_ble_radio_load_t *list, int num);
+
+/*
+ * Set scan_phy of every radio which is up. When both PHYs are asked and two radios or more are up,
+ * the least loaded radio scans the 1M PHY, the next one the coded PHY and so on. Otherwise they all
+ * scan what was asked.
+ */
+void balance_plan(gl_ble_radio_load_t *list, int num, int phys);
+
+#endif
@@ -0,0 +1,514 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/time.h>
+
+#include "gl_capture.h"
+#include "gl_radio.h"
+#include "timestamp.h"
+
+#define PCAPNG_SHB 0x0a0d0d0a
+#define PCAPNG_IDB 1
+#define PCAPNG_EPB 6
+#define PCAPNG_BYTE_ORDER 0x1a2b3c4d
+
+#define OPT_END 0
+#define OPT_SHB_USERAPPL 4
+#define OPT_IF_NAME 2
+#define OPT_IF_TSRESOL 9
+#define OPT_EPB_FLAGS 2
+#define OPT_EPB_DROPCOUNT 4
+
+// the blocks written are far shorter, longer ones are skipped by the reader
+#define BLOCK_MAX 4096
+
+/*
+ * The ring is a bounded MPSC queue like the one of the log: a writer claims a slot by moving head and
+ * publishes it with seq, the writer thread empties it into the file. A frame is dropped if the ring is
+ * full, so the driver never waits for the file.
+ */
+typedef struct
+{
+    uint32_t seq;
+    int radio;
+    capture_frame_t frame;
+} capture_slot_t;
+
+static capture_slot_t ring[CAPTURE_RING_SIZE];
+static uint32_t head;
+static uint32_t tail;
+static int capturing;
+// writers between the check of capturing and the publish of their slot
+static uint32_t writers;
+static uint32_t drops;
+// drops not yet recorded in the file
+static uint32_t drops_pending;
+static FILE *capture_fp;
+// add to CLOCK_MONOTONIC for the time since the epoch
+static uint64_t wall_offset;
+static int stopping;
+static sem_t capture_sem;
+static pthread_t writer_tid;
+static pthread_mutex_t capture_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t capture_once = PTHREAD_ONCE_INIT;
+
+static int put_le(uint8_t *p, uint64_t v, int n)
+{
+    int i;
+    for (i = 0; i < n; i++)
+    {
+        p[i] = (uint8_t)(v >> (8 * i));
+    }
+    return n;
+}
+
+static uint64_t get_le(const uint8_t *p, int n)
+{
+    uint64_t v = 0;
+    int i;
+    for (i = n - 1; i >= 0; i--)
+    {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+// an option, its value padded to 4 bytes
+static int put_opt(uint8_t *p, int code, const void *value, int len)
+{
+    int n = put_le(p, code, 2);
+    n += put_le(p + n, len, 2);
+    memcpy(p + n, value, len);
+    n += len;
+    while (n & 3)
+    {
+        p[n++] = 0;
+    }
+    return n;
+}
+
+// fill in the length at both ends of the block and write it
+static void write_block(uint8_t *buf, int len)
+{
+    put_le(buf + 4, len + 4, 4);
+    put_le(buf + len, len + 4, 4);
+    fwrite(buf, 1, len + 4, capture_fp);
+}
+
+static void write_header(void)
+{
+    uint8_t buf[128];
+    char name[16];
+    int len = 0;
+    int i;
+
+    len += put_le(buf + len, PCAPNG_SHB, 4);
+    len += 4;
+    len += put_le(buf + len, PCAPNG_BYTE_ORDER, 4);
+    len += put_le(buf + len, 1, 2);
+    len += put_le(buf + len, 0, 2);
+    // section length not known
+    len += put_le(buf + len, UINT64_MAX, 8);
+    len += put_opt(buf + len, OPT_SHB_USERAPPL, "gl-ble-sdk", strlen("gl-ble-sdk"));
+    len += put_le(buf + len, OPT_END, 4);
+    write_block(buf, len);
+
+    // the interface id is the radio
+    for (i = 0; i < RADIO_MAX; i++)
+    {
+        uint8_t tsresol = 9;
+
+        len = 0;
+        len += put_le(buf + len, PCAPNG_IDB, 4);
+        len += 4;
+        len += put_le(buf + len, CAPTURE_LINKTYPE, 2);
+        len += put_le(buf + len, 0, 2);
+        len += put_le(buf + len, 0, 4);
+        snprintf(name, sizeof(name), "radio%d", i);
+        len += put_opt(buf + len, OPT_IF_NAME, name, strlen(name));
+        len += put_opt(buf + len, OPT_IF_TSRESOL, &tsresol, 1);
+        len += put_le(buf + len, OPT_END, 4);
+        write_block(buf, len);
+    }
+}
+
+static void write_frame(capture_slot_t *s)
+{
+    uint8_t buf[64 + CAPTURE_FRAME_MAX];
+    uint8_t opt[8];
+    uint64_t ts = s->frame.time_ns + wall_offset;
+    int len = 0;
+
+    len += put_le(buf + len, PCAPNG_EPB, 4);
+    len += 4;
+    len += put_le(buf + len, s->radio, 4);
+    len += put_le(buf + len, ts >> 32, 4);
+    len += put_le(buf + len, ts, 4);
+    len += put_le(buf + len, s->frame.len, 4);
+    len += put_le(buf + len, s->frame.len, 4);
+    memcpy(buf + len, s->frame.data, s->frame.len);
+    len += s->frame.len;
+    while (len & 3)
+    {
+        buf[len++] = 0;
+    }
+
+    put_le(opt, s->frame.dir, 4);
+    len += put_opt(buf + len, OPT_EPB_FLAGS, opt, 4);
+
+    // the frames lost since the previous one of any radio
+    uint32_t lost = __atomic_exchange_n(&drops_pending, 0, __ATOMIC_RELAXED);
+    if (lost)
+    {
+        put_le(opt, lost, 8);
+        len += put_opt(buf + len, OPT_EPB_DROPCOUNT, opt, 8);
+    }
+
+    len += put_le(buf + len, OPT_END, 4);
+    write_block(buf, len);
+}
+
+static void drain(void)
+{
+    while (1)
+    {
+        capture_slot_t *s = &ring[tail & (CAPTURE_RING_SIZE - 1)];
+        if (__atomic_load_n(&s->seq, __ATOMIC_ACQUIRE) != tail + 1)
+        {
+            break;
+        }
+
+        write_frame(s);
+
+        __atomic_store_n(&s->seq, tail + CAPTURE_RING_SIZE, __ATOMIC_RELEASE);
+        tail++;
+    }
+    fflush(capture_fp);
+}
+
+static void *writer_thread(void *arg)
+{
+    while (1)
+    {
+        sem_wait(&capture_sem);
+        drain();
+        if (__atomic_load_n(&stopping, __ATOMIC_ACQUIRE))
+        {
+            // the frames published while draining
+            drain();
+            break;
+        }
+    }
+    return NULL;
+}
+
+static void capture_init(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < CAPTURE_RING_SIZE; i++)
+    {
+        ring[i].seq = i;
+    }
+    sem_init(&capture_sem, 0, 0);
+}
+
+/*
+ * Must be called with capture_mutex locked.
+ */
+static void capture_stop_locked(void)
+{
+    if (!capture_fp)
+    {
+        return;
+    }
+
+    // no frame is queued once the writers inside have published theirs
+    __atomic_store_n(&capturing, 0, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(&writers, __ATOMIC_SEQ_CST))
+    {
+        sched_yield();
+    }
+
+    __atomic_store_n(&stopping, 1, __ATOMIC_RELEASE);
+    sem_post(&capture_sem);
+    pthread_join(writer_tid, NULL);
+
+    fclose(capture_fp);
+    capture_fp = NULL;
+}
+
+int capture_start(const char *path)
+{
+    struct timeval tv;
+
+    pthread_once(&capture_once, capture_init);
+
+    pthread_mutex_lock(&capture_mutex);
+    capture_stop_locked();
+
+    capture_fp = fopen(path, "wb");
+    if (!capture_fp)
+    {
+        pthread_mutex_unlock(&capture_mutex);
+        return -1;
+    }
+
+    gettimeofday(&tv, NULL);
+    wall_offset = (uint64_t)tv.tv_sec * 1000000000 + (uint64_t)tv.tv_usec * 1000 - utils_get_time_ns();
+    write_header();
+    fflush(capture_fp);
+
+    __atomic_store_n(&drops_pending, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&stopping, 0, __ATOMIC_RELAXED);
+    if (pthread_create(&writer_tid, NULL, writer_thread, NULL) != 0)
+    {
+        fclose(capture_fp);
+        capture_fp = NULL;
+        pthread_mutex_unlock(&capture_mutex);
+        return -1;
+    }
+    __atomic_store_n(&capturing, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&capture_mutex);
+
+    return 0;
+}
+
+void capture_stop(void)
+{
+    pthread_mutex_lock(&capture_mutex);
+    capture_stop_locked();
+    pthread_mutex_unlock(&capture_mutex);
+}
+
+void capture_frame_iov(int radio, int dir, uint64_t time_ns, const struct iovec *iov, int iovcnt)
+{
+    capture_slot_t *s = NULL;
+    uint32_t len = 0;
+    int i;
+
+    if (!__atomic_load_n(&capturing, __ATOMIC_RELAXED))
+    {
+        return;
+    }
+
+    __atomic_add_fetch(&writers, 1, __ATOMIC_SEQ_CST);
+    if (!__atomic_load_n(&capturing, __ATOMIC_SEQ_CST))
+    {
+        __atomic_sub_fetch(&writers, 1, __ATOMIC_SEQ_CST);
+        return;
+    }
+
+    uint32_t pos = __atomic_load_n(&head, __ATOMIC_RELAXED);
+    while (1)
+    {
+        s = &ring[pos & (CAPTURE_RING_SIZE - 1)];
+        int32_t diff = (int32_t)(__atomic_load_n(&s->seq, __ATOMIC_ACQUIRE) - pos);
+        if (diff == 0)
+        {
+            if (__atomic_compare_exchange_n(&head, &pos, pos + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            __atomic_fetch_add(&drops, 1, __ATOMIC_RELAXED);
+            __atomic_fetch_add(&drops_pending, 1, __ATOMIC_RELAXED);
+            __atomic_sub_fetch(&writers, 1, __ATOMIC_SEQ_CST);
+            return;
+        }
+        else
+        {
+            pos = __atomic_load_n(&head, __ATOMIC_RELAXED);
+        }
+    }
+
+    s->radio = radio;
+    s->frame.dir = dir;
+    s->frame.time_ns = time_ns;
+    for (i = 0; (i < iovcnt) && (len < CAPTURE_FRAME_MAX); i++)
+    {
+        uint32_t n = iov[i].iov_len;
+        if (n > CAPTURE_FRAME_MAX - len)
+        {
+            n = CAPTURE_FRAME_MAX - len;
+        }
+        memcpy(s->frame.data + len, iov[i].iov_base, n);
+        len += n;
+    }
+    s->frame.len = len;
+
+    __atomic_store_n(&s->seq, pos + 1, __ATOMIC_RELEASE);
+    __atomic_sub_fetch(&writers, 1, __ATOMIC_SEQ_CST);
+    sem_post(&capture_sem);
+}
+
+void capture_frame(int radio, int dir, uint64_t time_ns, const void *header, const void *payload, uint32_t payload_len)
+{
+    struct iovec iov[2] = {
+        { .iov_base = (void *)header, .iov_len = 4 },
+        { .iov_base = (void *)payload, .iov_len = payload_len },
+    };
+
+    capture_frame_iov(radio, dir, time_ns, iov, payload_len ? 2 : 1);
+}
+
+uint32_t capture_get_drops(void)
+{
+    return __atomic_load_n(&drops, __ATOMIC_RELAXED);
+}
+
+// find an option of a block, return its length or -1
+static int find_opt(const uint8_t *opt, int len, int code, const uint8_t **value)
+{
+    int pos = 0;
+
+    while (pos + 4 <= len)
+    {
+        int c = get_le(opt + pos, 2);
+        int l = get_le(opt + pos + 2, 2);
+        if ((c == OPT_END) || (pos + 4 + l > len))
+        {
+            break;
+        }
+        if (c == code)
+        {
+            *value = opt + pos + 4;
+            return l;
+        }
+        pos += 4 + ((l + 3) & ~3);
+    }
+
+    return -1;
+}
+
+int capture_reader_open(capture_reader_t *reader, const char *path, int iface)
+{
+    uint8_t buf[12];
+
+    memset(reader, 0, sizeof(capture_reader_t));
+    reader->iface = iface;
+    reader->unit_ns = 1000;
+
+    reader->fp = fopen(path, "rb");
+    if (!reader->fp)
+    {
+        return -1;
+    }
+
+    if ((fread(buf, 1, sizeof(buf), reader->fp) != sizeof(buf)) || (get_le(buf, 4) != PCAPNG_SHB) ||
+        (get_le(buf + 8, 4) != PCAPNG_BYTE_ORDER))
+    {
+        capture_reader_close(reader);
+        return -1;
+    }
+    rewind(reader->fp);
+
+    return 0;
+}
+
+int capture_reader_next(capture_reader_t *reader, capture_frame_t *frame)
+{
+    uint8_t buf[BLOCK_MAX];
+    const uint8_t *value = NULL;
+
+    while (1)
+    {
+        if (fread(buf, 1, 8, reader->fp) != 8)
+        {
+            return 0;
+        }
+
+        uint32_t type = get_le(buf, 4);
+        uint32_t len = get_le(buf + 4, 4);
+        if ((len < 12) || (len & 3))
+        {
+            return -1;
+        }
+        if (len > BLOCK_MAX)
+        {
+            if (fseek(reader->fp, len - 8, SEEK_CUR) != 0)
+            {
+                return -1;
+            }
+            continue;
+        }
+        if (fread(buf + 8, 1, len - 8, reader->fp) != len - 8)
+        {
+            return 0;
+        }
+
+        if (type == PCAPNG_SHB)
+        {
+            // interfaces are numbered again in a new section
+            reader->iface_num = 0;
+        }
+        else if ((type == PCAPNG_IDB) && (len >= 20))
+        {
+            if (reader->iface_num++ != reader->iface)
+            {
+                continue;
+            }
+            // a power of 10 only, the default is us
+            int l = find_opt(buf + 16, len - 20, OPT_IF_TSRESOL, &value);
+            if ((l == 1) && (!(value[0] & 0x80)) && (value[0] <= 9))
+            {
+                uint64_t unit = 1000000000;
+                int i;
+                for (i = 0; i < value[0]; i++)
+                {
+                    unit /= 10;
+                }
+                reader->unit_ns = unit;
+            }
+        }
+        else if ((type == PCAPNG_EPB) && (len >= 32))
+        {
+            uint32_t cap_len = get_le(buf + 20, 4);
+            uint32_t data_len = (cap_len + 3) & ~3;
+            if ((get_le(buf + 8, 4) != (uint64_t)reader->iface) || (28 + data_len + 4 > len))
+            {
+                continue;
+            }
+
+            uint64_t ts = (get_le(buf + 12, 4) << 32) | get_le(buf + 16, 4);
+            frame->time_ns = ts * reader->unit_ns;
+            frame->len = (cap_len > CAPTURE_FRAME_MAX) ? CAPTURE_FRAME_MAX : cap_len;
+            memcpy(frame->data, buf + 28, frame->len);
+            frame->dir = 0;
+            if (find_opt(buf + 28 + data_len, len - 28 - data_len - 4, OPT_EPB_FLAGS, &value) == 4)
+            {
+                frame->dir = get_le(value, 4) & 3;
+            }
+            return 1;
+        }
+    }
+}
+
+void capture_reader_close(capture_reader_t *reader)
+{
+    if (reader->fp)
+    {
+        fclose(reader->fp);
+        reader->fp = NULL;
+    }
+}
@@ -0,0 +1,97 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#ifndef _GL_CAPTURE_H_
+#define _GL_CAPTURE_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/uio.h>
+
+/*
+ * Capture of the BGAPI frames on the serial port of every radio to a pcapng file.
+ * Every radio is an interface of link type LINKTYPE_USER0, a frame is an enhanced packet block whose
+ * flags tell the direction, with the time of its header (ns since the epoch). The file is written
+ * little endian, Wireshark opens it and shows the frames as raw data.
+ */
+#define CAPTURE_LINKTYPE 147
+
+// frames waiting for the writer thread, must be a power of 2
+#define CAPTURE_RING_SIZE 256
+
+// header and the longest payload of a BGAPI frame
+#define CAPTURE_FRAME_MAX (4 + 256)
+
+// direction of a frame, the values of the inbound and outbound epb_flags of pcapng
+#define CAPTURE_RX 1
+#define CAPTURE_TX 2
+
+typedef struct
+{
+    int dir;
+    uint64_t time_ns;
+    uint32_t len;
+    uint8_t data[CAPTURE_FRAME_MAX];
+} capture_frame_t;
+
+typedef struct
+{
+    FILE *fp;
+    int iface;
+    int iface_num;
+    // ns of a time unit of the interface read
+    uint64_t unit_ns;
+} capture_reader_t;
+
+/*
+ * Start writing the frames of all radios to path, a capture which runs is stopped first.
+ * Return 0 on success, -1 if the file can't be created.
+ */
+int capture_start(const char *path);
+
+/*
+ * Write the frames still in the ring and close the file.
+ */
+void capture_stop(void);
+
+/*
+ * Queue a frame, called by the driver for every frame it reads or writes.
+ * header and payload are as on the wire, the frame is dropped if the ring is full.
+ */
+void capture_frame(int radio, int dir, uint64_t time_ns, const void *header, const void *payload, uint32_t payload_len);
+
+/*
+ * Queue a frame sent from several buffers, the first one starts with the header.
+ */
+void capture_frame_iov(int radio, int dir, uint64_t time_ns, const struct iovec *iov, int iovcnt);
+
+// frames dropped because the ring was full, since the SDK was loaded
+uint32_t capture_get_drops(void);
+
+/*
+ * Open a capture to read the frames of an interface, which is the index of the radio.
+ * Return 0 on success, -1 if the file is not a little endian pcapng.
+ */
+int capture_reader_open(capture_reader_t *reader, const char *path, int iface);
+
+/*
+ * Read the next frame of the interface. Return 1 on a frame, 0 at the end of the file, -1 on a bad block.
+ */
+int capture_reader_next(capture_reader_t *reader, capture_frame_t *frame);
+
+void capture_reader_close(capture_reader_t *reader);
+
+#endif
@@ -25,27 +25,34 @@
 
 #include "gl_errno.h"
 #include "gl_log.h"
+#include "timestamp.h"
+#include "gl_radio.h"
 
-ble_dev_mgr_ctx_t g_ble_dev_mgr = {0};
+// a device table for every radio, connection handles are only unique within a radio
+ble_dev_mgr_ctx_t g_ble_dev_mgr[RADIO_MAX] = {0};
 
 uint32_t HAL_TimeStamp(void) {
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    return tv.tv_sec;
+    return (uint32_t)(utils_get_time_ns() / 1000000000);
+}
+
+ble_dev_mgr_ctx_t *_ble_dev_mgr_get_ctx(void) 
+{
+    return &g_ble_dev_mgr[radio_cur()]; 
 }
 
 static void dev_list_MutexLock(void)
 {
     log_debug("dev_list_MutexLock\n");
 
-    if(!g_ble_dev_mgr.dev_list_mutex)
+    ble_dev_mgr_ctx_t *mgr_ctx = _ble_dev_mgr_get_ctx();
+    if(!mgr_ctx->dev_list_mutex)
     {
         log_err("dev_list_mutex NULL!\n");
         return ;
     }
 
     int err_num;
-    if (0 != (err_num = pthread_mutex_lock((pthread_mutex_t *)g_ble_dev_mgr.dev_list_mutex))) {
+    if (0 != (err_num = pthread_mutex_lock((pthread_mutex_t *)mgr_ctx->dev_list_mutex))) {
         log_err("lock mutex failed: - '%s' (%d)\n", strerror(err_num), err_num);
     }
 }
@@ -67,14 +74,15 @@ static void dev_list_MutexUnlock(void)
 {
     log_debug("dev_list_MutexUnlock\n");
     
-    if(!g_ble_dev_mgr.dev_list_mutex)
+    ble_dev_mgr_ctx_t *mgr_ctx = _ble_dev_mgr_get_ctx();
+    if(!mgr_ctx->dev_list_mutex)
     {
         log_err("dev_list_mutex NULL!\n");
         return ;
     }
 
     int err_num;
-    if (0 != (err_num = pthread_mutex_unlock((pthread_mutex_t *)g_ble_dev_mgr.dev_list_mutex))) {
+    if (0 != (err_num = pthread_mutex_unlock((pthread_mutex_t *)mgr_ctx->dev_list_mutex))) {
         log_err("unlock mutex failed - '%s' (%d)\n", strerror(err_num), err_num);
     }
 }
@@ -82,10 +90,6 @@ static void dev_list_MutexUnlock(void)
 
 /*************************************************************************************************************/
 
-ble_dev_mgr_ctx_t *_ble_dev_mgr_get_ctx(void) 
-{
-    return &g_ble_dev_mgr; 
-}
 
 
 int ble_dev_mgr_init(void) {
@@ -130,6 +134,7 @@ int ble_dev_mgr_destroy(void)
         log_err("destroy mutex failed\n");
     }
     free(mgr_ctx->dev_list_mutex);
+    mgr_ctx->dev_list_mutex = NULL;
 
     return GL_SUCCESS;
 }
@@ -167,7 +172,8 @@ static int search_ble_dev_by_addr(char *dev_addr, ble_dev_mgr_node_t **node) {
             return GL_SUCCESS;
         }
     }
-    log_err("The device is not in the list");
+    // a miss is normal here, callers decide if it is an error
+    log_debug("The device is not in the list");
     return GL_ERR_MSG;
 }
 
@@ -182,7 +188,7 @@ static int search_ble_dev_by_connection(uint16_t connection,
             return GL_SUCCESS;
         }
     }
-    log_err("The device is not in the list");
+    log_debug("The device is not in the list");
     return GL_ERR_MSG;
 }
 
@@ -329,6 +335,28 @@ int ble_dev_mgr_get_list_size(void) {
     return index;
 }
 
+int ble_dev_mgr_get_list(ble_dev_desc_t *list, int max) {
+    // get lock 
+    dev_list_MutexLock();
+
+    int index = 0;
+    ble_dev_mgr_ctx_t *ctx = _ble_dev_mgr_get_ctx();
+    ble_dev_mgr_node_t *node = NULL;
+
+    list_for_each_entry(node, &ctx->dev_list, linked_list) {
+        if (index >= max) {
+            break;
+        }
+        memcpy(&list[index], &node->ble_dev_desc, sizeof(ble_dev_desc_t));
+        index++;
+    }
+
+    // release lock
+    dev_list_MutexUnlock();
+
+    return index;
+}
+
 int ble_dev_mgr_update(uint16_t connection) {
     // get lock 
     dev_list_MutexLock();
@@ -347,6 +375,75 @@ int ble_dev_mgr_update(uint16_t connection) {
     return GL_SUCCESS;
 }
 
+int ble_dev_mgr_set_interval(uint16_t connection, uint16_t interval) {
+    // get lock 
+    dev_list_MutexLock();
+
+    ble_dev_mgr_node_t *node = NULL;
+
+    if (search_ble_dev_by_connection(connection, &node) != 0) {
+        dev_list_MutexUnlock();
+        return -1;
+    }
+    node->ble_dev_desc.interval = interval;
+
+    // release lock
+    dev_list_MutexUnlock();
+
+    return GL_SUCCESS;
+}
+
+int ble_dev_mgr_get_load(uint32_t *load) {
+    // get lock 
+    dev_list_MutexLock();
+
+    int index = 0;
+    uint32_t events = 0;
+    ble_dev_mgr_ctx_t *ctx = _ble_dev_mgr_get_ctx();
+    ble_dev_mgr_node_t *node = NULL;
+
+    list_for_each_entry(node, &ctx->dev_list, linked_list) {
+        uint16_t interval = node->ble_dev_desc.interval ? node->ble_dev_desc.interval : DEV_MGR_INTERVAL_DEFAULT;
+        // 800 events per second at an interval of 1.25 ms, a slow connection still counts
+        events += (800 + interval - 1) / interval;
+        index++;
+    }
+
+    // release lock
+    dev_list_MutexUnlock();
+
+    if (load) {
+        *load = events;
+    }
+    return index;
+}
+
+int ble_dev_mgr_find_radio(char *dev_addr) {
+    int cur = radio_cur();
+    int found = -1;
+
+    if (dev_addr == NULL) {
+        return -1;
+    }
+
+    // the lock functions work on the table of the bound radio
+    for (int radio = 0; (radio < RADIO_MAX) && (found < 0); radio++) {
+        if (!g_ble_dev_mgr[radio].dev_list_mutex) {
+            continue;
+        }
+
+        radio_bind(radio);
+        dev_list_MutexLock();
+        if (search_ble_dev_by_addr(dev_addr, NULL) == GL_SUCCESS) {
+            found = radio;
+        }
+        dev_list_MutexUnlock();
+    }
+    radio_bind(cur);
+
+    return found;
+}
+
 int ble_dev_mgr_del_all(void)
 {
     // get lock 
@@ -22,10 +22,14 @@
 
 #define MAC_STR_LEN 18
 
+// connection interval (1.25 ms) assumed until the parameters of a connection are known
+#define DEV_MGR_INTERVAL_DEFAULT 40
+
 typedef struct _silabs_dev_desc_t
 {
   char dev_addr[MAC_STR_LEN];
   uint16_t connection;
+  uint16_t interval;
 } ble_dev_desc_t;
 
 typedef struct
@@ -59,6 +63,17 @@ uint16_t ble_dev_mgr_get_address(uint16_t connection, char *mac);
 
 int ble_dev_mgr_get_list_size(void);
 
+// copy up to max devices to list, return the number copied
+int ble_dev_mgr_get_list(ble_dev_desc_t *list, int max);
+
+int ble_dev_mgr_set_interval(uint16_t connection, uint16_t interval);
+
+// return the number of devices, load is set to the connection events per second of them
+int ble_dev_mgr_get_load(uint32_t *load);
+
+// return the radio whose table holds the device, -1 if none does
+int ble_dev_mgr_find_radio(char *dev_addr);
+
 int ble_dev_mgr_destroy(void);
 
 #endif // !_GL_DEV_MGR_H_
@@ -15,9 +15,17 @@
  ******************************************************************************/
 
 #include "gl_log.h"
+#include "gl_log_fmt.h"
+#include "timestamp.h"
 #include <stdarg.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/time.h>
+#include <sys/types.h>
 
 #ifdef SYSLOG
 #include <syslog.h>
@@ -83,49 +91,480 @@ log_level_t IOT_GetLogLevel(void)
     return g_log_level;
 }
 
-void IOT_LogPrintf(const char* module, const char* file, const char* func, const int line, const int level, const char* fmt, ...)
+static void log_output(const char* module, const char* file, const char* func, const int line, const int level, const char* text)
 {
-    if (level > g_log_level) {
+    const char* file_name = _get_filename(file);
+
+    if (NULL != module) {
+#ifdef SYSLOG
+        syslog(level, "%s|%s|%s|%s(%d): %s\r\n", lvl_names[level].c_name, module, file_name, func, line, text);
+#else
+        printf("\033%s%s|%s|%s|%s(%d): %s\r\n\033[0m", lvl_color[level].c_color, lvl_names[level].c_name, module, file_name, func, line, text);
+#endif
+    } else {
+#ifdef SYSLOG
+        syslog(level, "%s|%s|%s(%d): %s\r\n", lvl_names[level].c_name, file_name, func, line, text);
+#else
+        printf("\033%s%s|%s|%s(%d): %s\r\n\033[0m", lvl_color[level].c_color, lvl_names[level].c_name, file_name, func, line, text);
+#endif
+    }
+}
+
+#ifndef LOG_SYNC
+/*
+ * The caller copies the arguments of a record, the log thread formats and prints it.
+ * The ring is a bounded MPSC queue, a writer claims a slot by moving head and publishes it with seq,
+ * if the ring is full the record is dropped, so logging never waits for the output.
+ * The arguments are laid out as in the binary log, see gl_log_fmt.h. A format they can't follow,
+ * or a string longer than 255 bytes, is formatted by the caller.
+ */
+typedef struct {
+    uint32_t seq;
+    int level;
+    int line;
+    const char* module;
+    const char* file;
+    const char* func;
+    const char* fmt;
+    uint64_t time_ns;
+    int binary;
+    int formatted; // text holds the message, else the arguments of fmt
+    int len;
+    char text[MAX_LOG_MSG_LEN];
+} log_record_t;
+
+// formats already written to the binary file, the index is the id
+typedef struct {
+    const char* fmt;
+    const char* file;
+    int line;
+    int level;
+} log_bin_fmt_t;
+
+static log_record_t log_ring[LOG_RING_SIZE];
+static uint32_t log_head;
+static uint32_t log_tail;
+static uint32_t log_drops;
+static int log_async;
+static int log_bin;
+static FILE* log_bin_fp;
+static log_bin_fmt_t log_bin_fmts[LOG_BIN_FORMATS];
+static int log_bin_fmt_num;
+static sem_t log_sem;
+static pthread_mutex_t log_reader_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t log_once = PTHREAD_ONCE_INIT;
+
+static int _put_le(uint8_t* p, uint64_t v, int n)
+{
+    int i;
+    for (i = 0; i < n; i++) {
+        p[i] = (uint8_t)(v >> (8 * i));
+    }
+    return n;
+}
+
+static int _put_str(uint8_t* p, const char* str, int n)
+{
+    int len = str ? strlen(str) : 0;
+    if (len >= (1 << (8 * n))) {
+        len = (1 << (8 * n)) - 1;
+    }
+    p += _put_le(p, len, n);
+    memcpy(p, str, len);
+    return n + len;
+}
+
+/*
+ * Copy the arguments of fmt into buf, return the length.
+ * complete is set if they all fit and no string was cut.
+ */
+static int _log_capture(uint8_t* buf, int size, const char* fmt, va_list ap, int* complete)
+{
+    log_fmt_spec_t s;
+    const char* p = fmt;
+    int len = 0;
+    int star = 0;
+    int cut = 0;
+    int i;
+
+    *complete = 0;
+
+    while (*p) {
+        if (*p++ != '%') {
+            continue;
+        }
+        if (*p == '%') {
+            p++;
+            continue;
+        }
+        p = log_fmt_parse(p - 1, &s);
+
+        for (i = 0; i < s.stars; i++) {
+            star = va_arg(ap, int);
+            if (len + 8 > size) {
+                return len;
+            }
+            len += _put_le(buf + len, (uint64_t)(int64_t)star, 8);
+        }
+
+        uint64_t v = 0;
+        switch (s.conv) {
+        case 'd':
+        case 'i':
+            switch (s.lmod) {
+            case 'H': v = (int64_t)(signed char)va_arg(ap, int); break;
+            case 'h': v = (int64_t)(short)va_arg(ap, int); break;
+            case 'l': v = (int64_t)va_arg(ap, long); break;
+            case 'L': v = (int64_t)va_arg(ap, long long); break;
+            case 'z': v = (int64_t)va_arg(ap, ssize_t); break;
+            case 'j': v = (int64_t)va_arg(ap, intmax_t); break;
+            case 't': v = (int64_t)va_arg(ap, ptrdiff_t); break;
+            default: v = (int64_t)va_arg(ap, int); break;
+            }
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            switch (s.lmod) {
+            case 'H': v = (unsigned char)va_arg(ap, unsigned int); break;
+            case 'h': v = (unsigned short)va_arg(ap, unsigned int); break;
+            case 'l': v = va_arg(ap, unsigned long); break;
+            case 'L': v = va_arg(ap, unsigned long long); break;
+            case 'z': v = va_arg(ap, size_t); break;
+            case 'j': v = va_arg(ap, uintmax_t); break;
+            case 't': v = (uint64_t)va_arg(ap, ptrdiff_t); break;
+            default: v = va_arg(ap, unsigned int); break;
+            }
+            break;
+        case 'c':
+            v = (int64_t)va_arg(ap, int);
+            break;
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A': {
+            double d = (s.lmod == 'L') ? (double)va_arg(ap, long double) : va_arg(ap, double);
+            memcpy(&v, &d, sizeof(v));
+            break;
+        }
+        case 'p':
+            v = (uintptr_t)va_arg(ap, void*);
+            break;
+        case 's': {
+            const char* str = va_arg(ap, const char*);
+            int n = 255;
+            int prec = (s.prec == -2) ? star : s.prec;
+            if (str == NULL) {
+                str = "(null)";
+            }
+            if (prec >= 0 && prec < n) {
+                n = prec;
+            }
+            n = strnlen(str, n);
+            if (n == 255 && (prec < 0 || prec > 255) && str[n] != '\0') {
+                cut = 1;
+            }
+            if (len + 1 + n > size) {
+                return len;
+            }
+            buf[len++] = (uint8_t)n;
+            memcpy(buf + len, str, n);
+            len += n;
+            continue;
+        }
+        case 'n':
+            (void)va_arg(ap, void*);
+            continue;
+        default:
+            // the rest can't be followed
+            return len;
+        }
+
+        if (len + 8 > size) {
+            return len;
+        }
+        len += _put_le(buf + len, v, 8);
+    }
+
+    *complete = !cut;
+    return len;
+}
+
+static void _log_bin_write(log_record_t* r)
+{
+    uint8_t buf[MAX_LOG_MSG_LEN + 16];
+    uint32_t h = (((uintptr_t)r->fmt >> 2) ^ ((uintptr_t)r->file >> 2) ^ (uint32_t)r->line) % LOG_BIN_FORMATS;
+    log_bin_fmt_t* f = NULL;
+    int len = 0;
+
+    // the same format can be used in several places, a place is the format, file, line and level
+    while (1) {
+        f = &log_bin_fmts[h];
+        if (f->fmt == NULL || (f->fmt == r->fmt && f->file == r->file && f->line == r->line && f->level == r->level)) {
+            break;
+        }
+        h = (h + 1) % LOG_BIN_FORMATS;
+    }
+
+    if (f->fmt == NULL) {
+        // keep the table sparse, the decoder takes the latest format of an id
+        if (log_bin_fmt_num >= LOG_BIN_FORMATS * 3 / 4) {
+            memset(log_bin_fmts, 0, sizeof(log_bin_fmts));
+            log_bin_fmt_num = 0;
+        }
+        f->fmt = r->fmt;
+        f->file = r->file;
+        f->line = r->line;
+        f->level = r->level;
+        log_bin_fmt_num++;
+
+        buf[len++] = LOG_BIN_FORMAT;
+        len += _put_le(buf + len, h, 2);
+        buf[len++] = (uint8_t)r->level;
+        len += _put_le(buf + len, r->line, 2);
+        len += _put_str(buf + len, _get_filename(r->file), 1);
+        len += _put_str(buf + len, r->func, 1);
+        len += _put_str(buf + len, r->module, 1);
+        fwrite(buf, 1, len, log_bin_fp);
+        len = 0;
+        uint8_t flen[2];
+        uint16_t n = strlen(r->fmt) > 0xffff ? 0xffff : strlen(r->fmt);
+        _put_le(flen, n, 2);
+        fwrite(flen, 1, 2, log_bin_fp);
+        fwrite(r->fmt, 1, n, log_bin_fp);
+    }
+
+    buf[len++] = LOG_BIN_RECORD;
+    len += _put_le(buf + len, h, 2);
+    len += _put_le(buf + len, r->time_ns, 8);
+    len += _put_le(buf + len, r->len, 2);
+    memcpy(buf + len, r->text, r->len);
+    len += r->len;
+    fwrite(buf, 1, len, log_bin_fp);
+}
+
+/*
+ * Must be called with log_reader_mutex locked.
+ */
+static void _log_drain_locked(void)
+{
+    uint32_t drops = __atomic_exchange_n(&log_drops, 0, __ATOMIC_RELAXED);
+    if (drops && log_bin_fp) {
+        uint8_t buf[5];
+        buf[0] = LOG_BIN_DROPS;
+        _put_le(buf + 1, drops, 4);
+        fwrite(buf, 1, sizeof(buf), log_bin_fp);
+    } else if (drops) {
+        char text[64];
+        snprintf(text, sizeof(text), "log ring full, %u messages dropped", drops);
+        log_output(NULL, __FILE__, __FUNCTION__, __LINE__, LOG_WARN_LEVEL, text);
+    }
+
+    while (1) {
+        log_record_t* r = &log_ring[log_tail & (LOG_RING_SIZE - 1)];
+        if (__atomic_load_n(&r->seq, __ATOMIC_ACQUIRE) != log_tail + 1) {
+            break;
+        }
+
+        if (r->binary && log_bin_fp) {
+            _log_bin_write(r);
+        } else if (r->formatted) {
+            log_output(r->module, r->file, r->func, r->line, r->level, r->text);
+        } else {
+            // also a binary record published after the switch back to text
+            char text[MAX_LOG_MSG_LEN];
+            log_fmt_format(text, sizeof(text), r->fmt, (uint8_t*)r->text, r->len);
+            log_output(r->module, r->file, r->func, r->line, r->level, text);
+        }
+
+        __atomic_store_n(&r->seq, log_tail + LOG_RING_SIZE, __ATOMIC_RELEASE);
+        log_tail++;
+    }
+    fflush(log_bin_fp ? log_bin_fp : stdout);
+}
+
+static void _log_drain(void)
+{
+    pthread_mutex_lock(&log_reader_mutex);
+    _log_drain_locked();
+    pthread_mutex_unlock(&log_reader_mutex);
+}
+
+static void* _log_thread(void* arg)
+{
+    while (1) {
+        sem_wait(&log_sem);
+        _log_drain();
+    }
+    return NULL;
+}
+
+static void _log_init(void)
+{
+    uint32_t i;
+    pthread_t tid;
+
+    for (i = 0; i < LOG_RING_SIZE; i++) {
+        log_ring[i].seq = i;
+    }
+    sem_init(&log_sem, 0, 0);
+
+    // fall back to printing in the caller if there is no log thread
+    if (pthread_create(&tid, NULL, _log_thread, NULL) != 0) {
         return;
     }
+    pthread_detach(tid);
+    atexit(IOT_LogFlush);
+    log_async = 1;
+}
 
-    /* format log content */
-    const char* file_name = _get_filename(file);
+static int _log_push(const char* module, const char* file, const char* func, const int line, const int level, const char* fmt, va_list ap)
+{
+    log_record_t* r = NULL;
+    uint32_t pos = __atomic_load_n(&log_head, __ATOMIC_RELAXED);
 
-    char sg_text_buf[MAX_LOG_MSG_LEN + 1];
-    char* tmp_buf = sg_text_buf;
-    char* o = tmp_buf;
-    memset(tmp_buf, 0, sizeof(sg_text_buf));
+    while (1) {
+        r = &log_ring[pos & (LOG_RING_SIZE - 1)];
+        int32_t diff = (int32_t)(__atomic_load_n(&r->seq, __ATOMIC_ACQUIRE) - pos);
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&log_head, &pos, pos + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (diff < 0) {
+            __atomic_fetch_add(&log_drops, 1, __ATOMIC_RELAXED);
+            return -1;
+        } else {
+            pos = __atomic_load_n(&log_head, __ATOMIC_RELAXED);
+        }
+    }
 
-    if (NULL != module) {
-        o += snprintf(o, sizeof(sg_text_buf), "%s|%s|%s|%s(%d): ", lvl_names[level].c_name, module, file_name, func, line);
+    r->module = module;
+    r->file = file;
+    r->func = func;
+    r->line = line;
+    r->level = level;
+    r->fmt = fmt;
+    r->binary = __atomic_load_n(&log_bin, __ATOMIC_RELAXED);
+    r->formatted = 0;
+    if (r->binary) {
+        int complete;
+        r->time_ns = utils_get_time_ns();
+        r->len = _log_capture((uint8_t*)r->text, sizeof(r->text), fmt, ap, &complete);
     } else {
-        o += snprintf(o, sizeof(sg_text_buf), "%s|%s|%s(%d): ", lvl_names[level].c_name, file_name, func, line);
+        int complete;
+        va_list aq;
+        va_copy(aq, ap);
+        r->len = _log_capture((uint8_t*)r->text, sizeof(r->text), fmt, ap, &complete);
+        if (!complete) {
+            vsnprintf(r->text, sizeof(r->text), fmt, aq);
+            r->formatted = 1;
+        }
+        va_end(aq);
     }
 
-    va_list ap;
-    va_start(ap, fmt);
-    o += vsnprintf(o, MAX_LOG_MSG_LEN - 2 - strlen(tmp_buf), fmt, ap);
-    va_end(ap);
+    __atomic_store_n(&r->seq, pos + 1, __ATOMIC_RELEASE);
+    sem_post(&log_sem);
 
-    strcat(tmp_buf, "\r\n");
-#ifndef SYSLOG
-    printf("%s%s", "\033", lvl_color[level].c_color);
-#endif
+    return 0;
+}
 
-    if (level <= g_log_level) {
-#ifdef SYSLOG
-        syslog(level, "%s", tmp_buf);
+void IOT_LogFlush(void)
+{
+    if (log_async) {
+        _log_drain();
+    }
+}
+
+uint32_t IOT_GetLogDrops(void)
+{
+    return __atomic_load_n(&log_drops, __ATOMIC_RELAXED);
+}
+
+int IOT_SetLogBinary(const char* path)
+{
+    FILE* fp = NULL;
+
+    pthread_once(&log_once, _log_init);
+    if (!log_async) {
+        return -1;
+    }
+
+    if (path) {
+        fp = fopen(path, "wb");
+        if (fp == NULL) {
+            return -1;
+        }
+        struct timeval tv;
+        uint8_t wall_clock[8];
+        gettimeofday(&tv, NULL);
+        _put_le(wall_clock, (uint64_t)tv.tv_sec * 1000000000 + (uint64_t)tv.tv_usec * 1000 - utils_get_time_ns(), 8);
+
+        fwrite(LOG_BIN_MAGIC, 1, strlen(LOG_BIN_MAGIC), fp);
+        fputc(LOG_BIN_VERSION, fp);
+        fwrite(wall_clock, 1, sizeof(wall_clock), fp);
+    }
+
+    pthread_mutex_lock(&log_reader_mutex);
+    // records queued before the switch still go to the old output
+    _log_drain_locked();
+    if (log_bin_fp) {
+        fclose(log_bin_fp);
+    }
+    log_bin_fp = fp;
+    memset(log_bin_fmts, 0, sizeof(log_bin_fmts));
+    log_bin_fmt_num = 0;
+    __atomic_store_n(&log_bin, fp ? 1 : 0, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&log_reader_mutex);
+
+    return 0;
+}
 #else
-        /* default log handler: print to console */
-        printf("%s", tmp_buf);
+void IOT_LogFlush(void)
+{
+    fflush(stdout);
+}
+
+uint32_t IOT_GetLogDrops(void)
+{
+    return 0;
+}
+
+int IOT_SetLogBinary(const char* path)
+{
+    return -1;
+}
 #endif
+
+void IOT_LogPrintf(const char* module, const char* file, const char* func, const int line, const int level, const char* fmt, ...)
+{
+    if (level > g_log_level) {
+        return;
     }
 
-#ifndef SYSLOG
-    printf("%s", "\033[0m");
+    va_list ap;
+
+#ifndef LOG_SYNC
+    pthread_once(&log_once, _log_init);
+    if (log_async) {
+        va_start(ap, fmt);
+        _log_push(module, file, func, line, level, fmt, ap);
+        va_end(ap);
+        return;
+    }
 #endif
 
+    char text[MAX_LOG_MSG_LEN];
+    va_start(ap, fmt);
+    vsnprintf(text, sizeof(text), fmt, ap);
+    va_end(ap);
+
+    log_output(module, file, func, line, level, text);
+
     return;
 }
 
@@ -22,9 +22,13 @@ extern "C" {
 #endif
 
 #include <stdio.h>
+#include <stdint.h>
 
 #define MAX_LOG_MSG_LEN 512
 
+// records waiting for the log thread, must be a power of 2
+#define LOG_RING_SIZE 128
+
 #define LOG_DIS "DIS"
 #define LOG_ERR "ERR"
 #define LOG_WRN "WRN"
@@ -56,63 +60,67 @@ void IOT_SetLogLevel(log_level_t level);
 log_level_t IOT_GetLogLevel(void);
 
 void IOT_LogPrintf(const char* module, const char* file, const char* func, const int line, const int level, const char* fmt, ...);
+
+// 打印所有未输出的日志, 日志默认由后台线程格式化并输出 (调用线程只复制参数, fmt 须为常量字符串), 定义 LOG_SYNC 则在调用线程中直接输出
+void IOT_LogFlush(void);
+// 日志缓冲区满时丢弃的日志条数
+uint32_t IOT_GetLogDrops(void);
+// 以二进制格式把日志写入文件, 只记录格式串和参数, 由 tools/logdecode 离线解析; path 为 NULL 时恢复文本输出
+int IOT_SetLogBinary(const char* path);
 void utils_log_hexdump(const char* title, const void* buff, const int len);
 
-// 全局日志输出宏
-#if 1
-#define log_debug(fmt, ...) IOT_LogPrintf(NULL, __FILE__, __FUNCTION__, __LINE__, LOG_DEBUG_LEVEL, fmt, ##__VA_ARGS__)
-#define log_info(fmt, ...) IOT_LogPrintf(NULL, __FILE__, __FUNCTION__, __LINE__, LOG_INFO_LEVEL, fmt, ##__VA_ARGS__)
-#define log_warning(fmt, ...) IOT_LogPrintf(NULL, __FILE__, __FUNCTION__, __LINE__, LOG_WARN_LEVEL, fmt, ##__VA_ARGS__)
-#define log_err(fmt, ...) IOT_LogPrintf(NULL, __FILE__, __FUNCTION__, __LINE__, LOG_ERROR_LEVEL, fmt, ##__VA_ARGS__)
+// 编译时日志级别, 高于该级别的日志不会被编译, 例如 -DLOG_COMPILE_LEVEL=6 去掉所有 debug 日志
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL 7
+#endif
 
-// #define log_debug(fmt, ...) printf(fmt, ##__VA_ARGS__);printf("\n");
-// #define log_info(fmt, ...) printf(fmt, ##__VA_ARGS__);printf("\n");
-// #define log_warning(fmt, ...) printf(fmt, ##__VA_ARGS__);printf("\n");
-// #define log_err(fmt, ...) printf(fmt, ##__VA_ARGS__);printf("\n");
+extern log_level_t g_log_level;
 
-#else
-#define log_debug(fmt, ...) \
-    do {                    \
-        ;                   \
-    } while (0)
-#define log_info(fmt, ...) \
-    do {                   \
-        ;                  \
+// 运行时级别在调用前判断, 被过滤的日志不会计算参数
+#define _log_call(module, level, fmt, ...)                                                          \
+    do {                                                                                            \
+        if ((level) <= g_log_level)                                                                 \
+            IOT_LogPrintf(module, __FILE__, __FUNCTION__, __LINE__, level, fmt, ##__VA_ARGS__);     \
     } while (0)
-#define log_warning(fmt, ...) \
-    do {                      \
-        ;                     \
+// 保留参数检查, 代码由编译器去掉
+#define _log_none(module, level, fmt, ...)                                                          \
+    do {                                                                                            \
+        if (0)                                                                                      \
+            IOT_LogPrintf(module, __FILE__, __FUNCTION__, __LINE__, level, fmt, ##__VA_ARGS__);     \
     } while (0)
-#define log_err(fmt, ...) \
-    do {                  \
-        ;                 \
-    } while (0)
-#endif
 
-// 基于模块级别的日志输出宏
-#if 1
-#define mlog_debug(module, fmt, ...) IOT_LogPrintf(module, __FILE__, __FUNCTION__, __LINE__, LOG_DEBUG_LEVEL, fmt, ##__VA_ARGS__)
-#define mlog_info(module, fmt, ...) IOT_LogPrintf(module, __FILE__, __FUNCTION__, __LINE__, LOG_INFO_LEVEL, fmt, ##__VA_ARGS__)
-#define mlog_warning(module, fmt, ...) IOT_LogPrintf(module, __FILE__, __FUNCTION__, __LINE__, LOG_WARN_LEVEL, fmt, ##__VA_ARGS__)
-#define mlog_err(module, fmt, ...) IOT_LogPrintf(module, __FILE__, __FUNCTION__, __LINE__, LOG_ERROR_LEVEL, fmt, ##__VA_ARGS__)
+#if LOG_COMPILE_LEVEL >= 7
+#define _log_debug _log_call
 #else
-#define mlog_debug(fmt, ...) \
-    do {                     \
-        ;                    \
-    } while (0)
-#define mlog_info(fmt, ...) \
-    do {                    \
-        ;                   \
-    } while (0)
-#define mlog_warning(fmt, ...) \
-    do {                       \
-        ;                      \
-    } while (0)
-#define mlog_err(fmt, ...) \
-    do {                   \
-        ;                  \
-    } while (0)
+#define _log_debug _log_none
+#endif
+#if LOG_COMPILE_LEVEL >= 6
+#define _log_info _log_call
+#else
+#define _log_info _log_none
 #endif
+#if LOG_COMPILE_LEVEL >= 4
+#define _log_warning _log_call
+#else
+#define _log_warning _log_none
+#endif
+#if LOG_COMPILE_LEVEL >= 3
+#define _log_err _log_call
+#else
+#define _log_err _log_none
+#endif
+
+// 全局日志输出宏
+#define log_debug(fmt, ...) _log_debug(NULL, LOG_DEBUG_LEVEL, fmt, ##__VA_ARGS__)
+#define log_info(fmt, ...) _log_info(NULL, LOG_INFO_LEVEL, fmt, ##__VA_ARGS__)
+#define log_warning(fmt, ...) _log_warning(NULL, LOG_WARN_LEVEL, fmt, ##__VA_ARGS__)
+#define log_err(fmt, ...) _log_err(NULL, LOG_ERROR_LEVEL, fmt, ##__VA_ARGS__)
+
+// 基于模块级别的日志输出宏
+#define mlog_debug(module, fmt, ...) _log_debug(module, LOG_DEBUG_LEVEL, fmt, ##__VA_ARGS__)
+#define mlog_info(module, fmt, ...) _log_info(module, LOG_INFO_LEVEL, fmt, ##__VA_ARGS__)
+#define mlog_warning(module, fmt, ...) _log_warning(module, LOG_WARN_LEVEL, fmt, ##__VA_ARGS__)
+#define mlog_err(module, fmt, ...) _log_err(module, LOG_ERROR_LEVEL, fmt, ##__VA_ARGS__)
 
 // 16进制打印
 #define log_hexdump(buf, len) utils_log_hexdump(#buf, (const void*)buf, (const int)len)
@@ -0,0 +1,276 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+ 
+ http://www.apache.org/licenses/LICENSE-2.0
+ 
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#ifndef _GL_LOG_FMT_H_
+#define _GL_LOG_FMT_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+
+/*
+ * Binary log file written by IOT_SetLogBinary() and read by tools/logdecode.
+ * All numbers are little endian.
+ *
+ * file:    "GLLOG" version(1) wall_clock(8)
+ * format:  LOG_BIN_FORMAT id(2) level(1) line(2) file(s8) func(s8) module(s8) fmt(s16)
+ * record:  LOG_BIN_RECORD id(2) time_ns(8) len(2) args(len)
+ * drops:   LOG_BIN_DROPS count(4)
+ *
+ * time_ns is the monotonic time, wall_clock is the wall clock minus the monotonic time (ns) when the file was opened.
+ * s8/s16 are strings with a 1/2 byte length. A format is written before its first record.
+ * args follow the conversions of the format: 8 bytes for every integer, double, pointer or '*',
+ * s8 for every string. Args which don't fit are left out.
+ */
+#define LOG_BIN_MAGIC "GLLOG"
+#define LOG_BIN_VERSION 1
+
+#define LOG_BIN_FORMAT 1
+#define LOG_BIN_RECORD 2
+#define LOG_BIN_DROPS 3
+
+// formats kept by the writer, ids are below this
+#define LOG_BIN_FORMATS 1024
+
+typedef struct {
+    int stars;  // number of '*' in width and precision
+    int prec;   // precision, -1 none, -2 given by an argument
+    int lmod;   // 'H' hh, 'h', 'l', 'L' ll or long double, 'z', 'j', 't', 0 none
+    char conv;  // conversion character
+    int len;    // length of spec
+    char spec[32]; // the spec without the length modifier
+} log_fmt_spec_t;
+
+/*
+ * Parse the conversion starting at fmt, which points to a '%' that is not "%%".
+ * Return the character after the conversion.
+ */
+static inline const char* log_fmt_parse(const char* fmt, log_fmt_spec_t* s)
+{
+    const char* p = fmt + 1;
+
+    memset(s, 0, sizeof(log_fmt_spec_t));
+    s->prec = -1;
+    s->spec[s->len++] = '%';
+
+    while (*p && (strchr("-+ #0'", *p) || (*p >= '0' && *p <= '9') || *p == '*' || *p == '.')) {
+        if (*p == '*') {
+            s->stars++;
+            if (s->prec == 0) {
+                s->prec = -2;
+            }
+        } else if (*p == '.') {
+            s->prec = 0;
+        } else if (*p >= '0' && *p <= '9' && s->prec >= 0) {
+            s->prec = s->prec * 10 + (*p - '0');
+        }
+        if (s->len < (int)sizeof(s->spec) - 4) {
+            s->spec[s->len++] = *p;
+        }
+        p++;
+    }
+
+    if (p[0] == 'h' && p[1] == 'h') {
+        s->lmod = 'H';
+        p += 2;
+    } else if (p[0] == 'l' && p[1] == 'l') {
+        s->lmod = 'L';
+        p += 2;
+    } else if (*p && strchr("hlLqzjt", *p)) {
+        s->lmod = (*p == 'q') ? 'L' : *p;
+        p++;
+    }
+
+    s->conv = *p;
+    if (*p) {
+        p++;
+    }
+    return p;
+}
+
+static inline void log_fmt_out(char* out, int size, int* n, const char* fmt, ...)
+{
+    va_list ap;
+
+    if (*n >= size - 1) {
+        return;
+    }
+    va_start(ap, fmt);
+    int ret = vsnprintf(out + *n, size - *n, fmt, ap);
+    va_end(ap);
+    if (ret > 0) {
+        *n += (ret < size - *n) ? ret : size - 1 - *n;
+    }
+}
+
+static inline int log_fmt_get(const uint8_t* args, int len, int* pos, uint64_t* v)
+{
+    int i;
+
+    if (*pos + 8 > len) {
+        return -1;
+    }
+    *v = 0;
+    for (i = 0; i < 8; i++) {
+        *v |= (uint64_t)args[(*pos)++] << (8 * i);
+    }
+    return 0;
+}
+
+/*
+ * Write to out what printf(fmt, ...) printed, the arguments taken from args as they are laid out
+ * in a record. A conversion whose arguments are missing is written as it is, with the rest of fmt.
+ * Return the length, out is always terminated.
+ */
+static inline int log_fmt_format(char* out, int size, const char* fmt, const uint8_t* args, int len)
+{
+    log_fmt_spec_t s;
+    const char* p = fmt;
+    char spec[48];
+    char str[256];
+    int star[2] = { 0, 0 };
+    uint64_t v = 0;
+    int pos = 0;
+    int n = 0;
+    int i;
+
+#define LOG_FMT_ARG(arg)                                                    \
+    do {                                                                    \
+        if (s.stars == 0)                                                   \
+            log_fmt_out(out, size, &n, spec, arg);                          \
+        else if (s.stars == 1)                                              \
+            log_fmt_out(out, size, &n, spec, star[0], arg);                 \
+        else                                                                \
+            log_fmt_out(out, size, &n, spec, star[0], star[1], arg);        \
+    } while (0)
+
+    out[0] = '\0';
+    while (*p) {
+        if (*p != '%') {
+            const char* next = strchr(p, '%');
+            int k = next ? (int)(next - p) : (int)strlen(p);
+            log_fmt_out(out, size, &n, "%.*s", k, p);
+            p += k;
+            continue;
+        }
+        if (p[1] == '%') {
+            log_fmt_out(out, size, &n, "%%");
+            p += 2;
+            continue;
+        }
+
+        const char* start = p;
+        p = log_fmt_parse(p, &s);
+
+        if (s.stars > 2) {
+            log_fmt_out(out, size, &n, "%.*s", (int)(p - start), start);
+            continue;
+        }
+        for (i = 0; i < s.stars; i++) {
+            if (log_fmt_get(args, len, &pos, &v) != 0) {
+                goto missing;
+            }
+            star[i] = (int)(int64_t)v;
+        }
+
+        memcpy(spec, s.spec, s.len);
+        spec[s.len] = '\0';
+
+        switch (s.conv) {
+        case 'd':
+        case 'i':
+            if (log_fmt_get(args, len, &pos, &v) != 0) {
+                goto missing;
+            }
+            strcat(spec, "lld");
+            LOG_FMT_ARG((long long)(int64_t)v);
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+        case 'c':
+            if (log_fmt_get(args, len, &pos, &v) != 0) {
+                goto missing;
+            }
+            if (s.conv == 'c') {
+                strcat(spec, "c");
+                LOG_FMT_ARG((int)v);
+            } else {
+                size_t k = strlen(spec);
+                spec[k] = 'l';
+                spec[k + 1] = 'l';
+                spec[k + 2] = s.conv;
+                spec[k + 3] = '\0';
+                LOG_FMT_ARG((unsigned long long)v);
+            }
+            break;
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A': {
+            double d = 0;
+            if (log_fmt_get(args, len, &pos, &v) != 0) {
+                goto missing;
+            }
+            memcpy(&d, &v, sizeof(d));
+            size_t k = strlen(spec);
+            spec[k] = s.conv;
+            spec[k + 1] = '\0';
+            LOG_FMT_ARG(d);
+            break;
+        }
+        case 'p':
+            if (log_fmt_get(args, len, &pos, &v) != 0) {
+                goto missing;
+            }
+            log_fmt_out(out, size, &n, "0x%llx", (unsigned long long)v);
+            break;
+        case 's': {
+            int k = (pos < len) ? args[pos] : 0;
+            if ((pos >= len) || (pos + 1 + k > len)) {
+                goto missing;
+            }
+            memcpy(str, args + pos + 1, k);
+            str[k] = '\0';
+            pos += 1 + k;
+            strcat(spec, "s");
+            LOG_FMT_ARG(str);
+            break;
+        }
+        case 'n':
+            break;
+        default:
+            goto missing;
+        }
+        continue;
+
+    missing:
+        // arguments which didn't fit in the record, the rest is written as it is
+        log_fmt_out(out, size, &n, "%s", start);
+        break;
+    }
+
+#undef LOG_FMT_ARG
+    return n;
+}
+
+#endif
@@ -0,0 +1,39 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+ 
+ http://www.apache.org/licenses/LICENSE-2.0
+ 
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#ifndef _GL_RADIO_H_
+#define _GL_RADIO_H_
+
+#include "gl_type.h"
+
+/*
+ * Every ble module driven by the process is a radio. Each module keeps the state of a radio in
+ * its slot of a RADIO_MAX array, the slot is chosen by the radio the calling thread is bound to.
+ * Threads of a radio bind themselves when they start, a thread which never binds uses radio 0.
+ */
+#define RADIO_MAX BLE_RADIO_MAX
+
+/*
+ * Index of the radio of the calling thread.
+ */
+int radio_cur(void);
+
+/*
+ * Bind the calling thread to a radio, the index is not checked.
+ */
+void radio_bind(int index);
+
+#endif
@@ -0,0 +1,361 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+ 
+ http://www.apache.org/licenses/LICENSE-2.0
+ 
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "gl_stats.h"
+
+typedef struct stats_block
+{
+    struct stats_block *next;
+    // written by its thread only, 32 bits so that the stores stay single instructions on mips32
+    uint32_t counter[STATS_COUNTER_MAX];
+    // the readers fold the counters into total under block_mutex, seen is the value last folded
+    uint32_t seen[STATS_COUNTER_MAX];
+    uint64_t total[STATS_COUNTER_MAX];
+} stats_block_t;
+
+// blocks of the running threads which counted something, the counts of ended threads are in retired
+static stats_block_t *block_list;
+static uint64_t retired[STATS_COUNTER_MAX];
+static pthread_mutex_t block_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t block_key;
+static pthread_once_t block_key_once = PTHREAD_ONCE_INIT;
+static __thread stats_block_t *thread_block;
+static uint32_t high[STATS_HIGH_MAX];
+
+static gl_hist_t stage_hist[LATENCY_STAGE_MAX];
+// classes get a histogram when their first command is sent
+static gl_hist_t *cmd_hist[256];
+
+static int hist_index(uint32_t v)
+{
+    if (v < HIST_SUB)
+    {
+        return v;
+    }
+
+    int shift = 31 - __builtin_clz(v) - HIST_SUB_BITS;
+    return (shift + 1) * HIST_SUB + (int)(v >> shift) - HIST_SUB;
+}
+
+// the highest value of a bucket
+static uint32_t hist_value(int index)
+{
+    if (index < HIST_SUB)
+    {
+        return index;
+    }
+
+    int shift = index / HIST_SUB - 1;
+    return (uint32_t)((((uint64_t)(HIST_SUB + index % HIST_SUB) + 1) << shift) - 1);
+}
+
+// the lowest value of a bucket
+static uint32_t hist_low(int index)
+{
+    return index ? hist_value(index - 1) + 1 : 0;
+}
+
+static void hist_record(gl_hist_t *h, uint64_t ns)
+{
+    uint64_t us = ns / 1000;
+    uint32_t v = (us > UINT32_MAX) ? UINT32_MAX : (uint32_t)us;
+    uint32_t old = 0;
+
+    __atomic_fetch_add(&h->bucket[hist_index(v)], 1, __ATOMIC_RELAXED);
+
+    old = __atomic_load_n(&h->max, __ATOMIC_RELAXED);
+    while ((v > old) && !__atomic_compare_exchange_n(&h->max, &old, v, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+
+    // min is kept plus 1, 0 before the first value
+    uint32_t v1 = (v == UINT32_MAX) ? v : v + 1;
+    old = __atomic_load_n(&h->min, __ATOMIC_RELAXED);
+    while (((v1 < old) || (old == 0)) && !__atomic_compare_exchange_n(&h->min, &old, v1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+
+    __atomic_fetch_add(&h->count, 1, __ATOMIC_RELAXED);
+}
+
+/*
+ * The histogram may be recorded meanwhile, the summary is close but not exact then.
+ */
+static void hist_summary(gl_hist_t *h, gl_ble_latency_t *latency)
+{
+    uint32_t bucket[HIST_BUCKETS];
+    uint32_t count = 0;
+    uint64_t sum = 0;
+    int i;
+
+    memset(latency, 0, sizeof(gl_ble_latency_t));
+    for (i = 0; i < HIST_BUCKETS; i++)
+    {
+        bucket[i] = __atomic_load_n(&h->bucket[i], __ATOMIC_RELAXED);
+        count += bucket[i];
+        // the middle of the bucket
+        sum += (uint64_t)bucket[i] * (((uint64_t)hist_low(i) + hist_value(i)) / 2);
+    }
+    if (count == 0)
+    {
+        return;
+    }
+
+    latency->count = count;
+    latency->min = __atomic_load_n(&h->min, __ATOMIC_RELAXED);
+    latency->min = latency->min ? latency->min - 1 : 0;
+    latency->max = __atomic_load_n(&h->max, __ATOMIC_RELAXED);
+    latency->mean = (uint32_t)(sum / count);
+    latency->mean = (latency->mean < latency->min) ? latency->min : latency->mean;
+    latency->mean = (latency->mean > latency->max) ? latency->max : latency->mean;
+
+    // per mille of the count below each percentile
+    const uint32_t pm[4] = {500, 900, 990, 999};
+    uint32_t *p[4] = {&latency->p50, &latency->p90, &latency->p99, &latency->p999};
+    uint64_t seen = 0;
+    int n = 0;
+    for (i = 0; (i < HIST_BUCKETS) && (n < 4); i++)
+    {
+        seen += bucket[i];
+        while ((n < 4) && (seen * 1000 >= (uint64_t)count * pm[n]))
+        {
+            *p[n] = (hist_value(i) < latency->max) ? hist_value(i) : latency->max;
+            n++;
+        }
+    }
+}
+
+static void hist_clear(gl_hist_t *h)
+{
+    int i;
+
+    for (i = 0; i < HIST_BUCKETS; i++)
+    {
+        __atomic_store_n(&h->bucket[i], 0, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&h->count, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&h->min, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&h->max, 0, __ATOMIC_RELAXED);
+}
+
+/*
+ * a thread ends, its counts are folded into retired and its block freed
+ */
+static void block_retire(void *arg)
+{
+    stats_block_t *block = (stats_block_t *)arg;
+    stats_block_t **p;
+    int i;
+
+    pthread_mutex_lock(&block_mutex);
+    for (p = &block_list; *p; p = &(*p)->next)
+    {
+        if (*p == block)
+        {
+            *p = block->next;
+            break;
+        }
+    }
+    for (i = 0; i < STATS_COUNTER_MAX; i++)
+    {
+        retired[i] += block->total[i] + (uint32_t)(block->counter[i] - block->seen[i]);
+    }
+    pthread_mutex_unlock(&block_mutex);
+
+    thread_block = NULL;
+    free(block);
+}
+
+static void block_key_init(void)
+{
+    pthread_key_create(&block_key, block_retire);
+}
+
+static stats_block_t *get_thread_block(void)
+{
+    if (thread_block)
+    {
+        return thread_block;
+    }
+
+    pthread_once(&block_key_once, block_key_init);
+
+    stats_block_t *block = (stats_block_t *)calloc(1, sizeof(stats_block_t));
+    if (!block)
+    {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&block_mutex);
+    block->next = block_list;
+    block_list = block;
+    pthread_mutex_unlock(&block_mutex);
+
+    pthread_setspecific(block_key, block);
+    thread_block = block;
+
+    return block;
+}
+
+void stats_add(stats_counter_t counter, uint32_t n)
+{
+    stats_block_t *block = get_thread_block();
+
+    if ((!block) || (counter >= STATS_COUNTER_MAX))
+    {
+        return;
+    }
+
+    // only this thread writes it, the store is atomic for the readers, a wrap is folded by the readers
+    __atomic_store_n(&block->counter[counter], block->counter[counter] + n, __ATOMIC_RELAXED);
+}
+
+void stats_high(stats_high_t which, uint32_t value)
+{
+    if (which >= STATS_HIGH_MAX)
+    {
+        return;
+    }
+
+    uint32_t old = __atomic_load_n(&high[which], __ATOMIC_RELAXED);
+    while ((value > old) && !__atomic_compare_exchange_n(&high[which], &old, value, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+}
+
+uint64_t stats_get_counter(stats_counter_t counter)
+{
+    stats_block_t *block;
+    uint64_t sum = 0;
+
+    if (counter >= STATS_COUNTER_MAX)
+    {
+        return 0;
+    }
+
+    // a block is not freed while it is read
+    pthread_mutex_lock(&block_mutex);
+    sum = retired[counter];
+    for (block = block_list; block; block = block->next)
+    {
+        uint32_t value = __atomic_load_n(&block->counter[counter], __ATOMIC_RELAXED);
+        block->total[counter] += (uint32_t)(value - block->seen[counter]);
+        block->seen[counter] = value;
+        sum += block->total[counter];
+    }
+    pthread_mutex_unlock(&block_mutex);
+
+    return sum;
+}
+
+void stats_get(gl_ble_stats_t *stats)
+{
+    memset(stats, 0, sizeof(gl_ble_stats_t));
+
+    stats->rx_evt_frames = stats_get_counter(STATS_RX_EVT_FRAMES);
+    stats->rx_evt_bytes = stats_get_counter(STATS_RX_EVT_BYTES);
+    stats->rx_rsp_frames = stats_get_counter(STATS_RX_RSP_FRAMES);
+    stats->rx_rsp_bytes = stats_get_counter(STATS_RX_RSP_BYTES);
+    stats->tx_cmd_frames = stats_get_counter(STATS_TX_CMD_FRAMES);
+    stats->tx_cmd_bytes = stats_get_counter(STATS_TX_CMD_BYTES);
+    stats->parse_errors = stats_get_counter(STATS_PARSE_ERRORS);
+    stats->resyncs = stats_get_counter(STATS_RESYNCS);
+    stats->evt_queue_drops = stats_get_counter(STATS_EVT_QUEUE_DROPS);
+    stats->watcher_queue_drops = stats_get_counter(STATS_WATCHER_QUEUE_DROPS);
+    stats->cmd_timeouts = stats_get_counter(STATS_CMD_TIMEOUTS);
+    stats->stale_rsps = stats_get_counter(STATS_STALE_RSPS);
+    stats->evt_queue_high = __atomic_load_n(&high[STATS_EVT_QUEUE_HIGH], __ATOMIC_RELAXED);
+    stats->watcher_queue_high = __atomic_load_n(&high[STATS_WATCHER_QUEUE_HIGH], __ATOMIC_RELAXED);
+}
+
+void stats_record_stage(gl_ble_latency_stage_t stage, uint64_t ns)
+{
+    if (stage >= LATENCY_STAGE_MAX)
+    {
+        return;
+    }
+    hist_record(&stage_hist[stage], ns);
+}
+
+void stats_record_cmd(uint8_t class_id, uint64_t ns)
+{
+    gl_hist_t *h = __atomic_load_n(&cmd_hist[class_id], __ATOMIC_ACQUIRE);
+
+    if (!h)
+    {
+        gl_hist_t *new_h = (gl_hist_t *)calloc(1, sizeof(gl_hist_t));
+        if (!new_h)
+        {
+            return;
+        }
+        // another thread may have been first
+        if (!__atomic_compare_exchange_n(&cmd_hist[class_id], &h, new_h, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        {
+            free(new_h);
+        }
+        else
+        {
+            h = new_h;
+        }
+    }
+
+    hist_record(h, ns);
+}
+
+void stats_get_latency(gl_ble_latency_stats_t *stats)
+{
+    int i;
+
+    memset(stats, 0, sizeof(gl_ble_latency_stats_t));
+    for (i = 0; i < LATENCY_STAGE_MAX; i++)
+    {
+        hist_summary(&stage_hist[i], &stats->stage[i]);
+    }
+
+    for (i = 0; (i < 256) && (stats->cmd_class_num < LATENCY_CMD_CLASS_MAX); i++)
+    {
+        gl_hist_t *h = __atomic_load_n(&cmd_hist[i], __ATOMIC_ACQUIRE);
+        if (!h)
+        {
+            continue;
+        }
+        stats->cmd[stats->cmd_class_num].class_id = i;
+        hist_summary(h, &stats->cmd[stats->cmd_class_num].latency);
+        stats->cmd_class_num++;
+    }
+}
+
+void stats_clear_latency(void)
+{
+    int i;
+
+    for (i = 0; i < LATENCY_STAGE_MAX; i++)
+    {
+        hist_clear(&stage_hist[i]);
+    }
+    for (i = 0; i < 256; i++)
+    {
+        gl_hist_t *h = __atomic_load_n(&cmd_hist[i], __ATOMIC_ACQUIRE);
+        if (h)
+        {
+            hist_clear(h);
+        }
+    }
+}
@@ -0,0 +1,93 @@
+/*****************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+ 
+ http://www.apache.org/licenses/LICENSE-2.0
+ 
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+
+#ifndef _GL_STATS_H_
+#define _GL_STATS_H_
+
+#include <stdint.h>
+
+#include "gl_type.h"
+
+/*
+ * Latencies are kept in log-linear histograms like HdrHistogram: every power of 2 is split in
+ * 2^HIST_SUB_BITS buckets, so a value is known within 1/8 of itself. Recording is a few relaxed
+ * atomic adds, it can be called from any thread. The fields are 32 bits, 64-bit atomics are
+ * library calls on mips32. The mean is taken from the buckets, it is known within 1/8 as well.
+ */
+#define HIST_SUB_BITS 3
+#define HIST_SUB (1 << HIST_SUB_BITS)
+#define HIST_BUCKETS ((32 - HIST_SUB_BITS + 1) * HIST_SUB)
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint32_t bucket[HIST_BUCKETS];
+} gl_hist_t;
+
+/*
+ * Counters are summed from a block per thread, each thread only writes its own block.
+ * The block of a thread which ends is folded into a total of the ended threads.
+ * A thread counts in 32 bits, the readers fold the wraps into 64-bit totals, so a counter
+ * has to be read before one thread adds 2^32 to it.
+ */
+typedef enum
+{
+    STATS_RX_EVT_FRAMES = 0,
+    STATS_RX_EVT_BYTES,
+    STATS_RX_RSP_FRAMES,
+    STATS_RX_RSP_BYTES,
+    STATS_TX_CMD_FRAMES,
+    STATS_TX_CMD_BYTES,
+    STATS_PARSE_ERRORS,
+    STATS_RESYNCS,
+    STATS_EVT_QUEUE_DROPS,
+    STATS_WATCHER_QUEUE_DROPS,
+    STATS_CMD_TIMEOUTS,
+    STATS_STALE_RSPS,
+    STATS_COUNTER_MAX,
+} stats_counter_t;
+
+typedef enum
+{
+    STATS_EVT_QUEUE_HIGH = 0,
+    STATS_WATCHER_QUEUE_HIGH,
+    STATS_HIGH_MAX,
+} stats_high_t;
+
+void stats_add(stats_counter_t counter, uint32_t n);
+
+// raise a high-water mark to value
+void stats_high(stats_high_t high, uint32_t value);
+
+// sum of a counter over all threads
+uint64_t stats_get_counter(stats_counter_t counter);
+
+// fill the counters of the driver, log_drops and dev_num are left to the caller
+void stats_get(gl_ble_stats_t *stats);
+
+// record a latency of the event stage (ns)
+void stats_record_stage(gl_ble_latency_stage_t stage, uint64_t ns);
+
+// record the round trip of a command of a BGAPI class (ns)
+void stats_record_cmd(uint8_t class_id, uint64_t ns);
+
+void stats_get_latency(gl_ble_latency_stats_t *stats);
+
+void stats_clear_latency(void);
+
+#endif
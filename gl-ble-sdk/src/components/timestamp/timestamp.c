@@ -20,10 +20,27 @@
 
 #include "timestamp.h"
 
+uint64_t utils_get_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
 uint32_t utils_get_timestamp(void)
 {
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
+    return (uint32_t)(utils_get_time_ns() / 1000000);
+}
 
-    return tv.tv_usec;
-}
\ No newline at end of file
+void utils_get_deadline(struct timespec *ts, uint32_t timeout)
+{
+    clock_gettime(CLOCK_MONOTONIC, ts);
+    ts->tv_sec += timeout / 1000;
+    ts->tv_nsec += (timeout % 1000) * 1000000;
+    if (ts->tv_nsec >= 1000000000)
+    {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000;
+    }
+}
@@ -17,22 +17,21 @@
 #ifndef _TIMESTAMP_H_
 #define _TIMESTAMP_H_
 
+#include <stdint.h>
+#include <time.h>
 #include <sys/time.h>
 
-uint32_t utils_get_timestamp(void);
-
-
-
-
-
-
-
-
-
-
-
+/*
+ * All times of the SDK are taken from CLOCK_MONOTONIC, they don't jump when the wall clock is set.
+ */
 
+// monotonic time (ns)
+uint64_t utils_get_time_ns(void);
 
+// monotonic time (ms), wraps after 49 days
+uint32_t utils_get_timestamp(void);
 
+// absolute CLOCK_MONOTONIC time timeout ms from now, for condition variables using that clock
+void utils_get_deadline(struct timespec *ts, uint32_t timeout);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,338 @@
+/*****************************************************************************
+ * @file  bled.c
+ * @brief BLE daemon, owns a module and shares it between the processes which connect to it
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <signal.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include "gl_bleapi.h"
+#include "gl_errno.h"
+#include "gl_type.h"
+#include "bled.h"
+
+// ms between two checks of the stop flag while no client connects
+#define ACCEPT_TIMEOUT 500
+
+typedef struct
+{
+	bled_conn_t conn;
+	pthread_t tid;
+	int used;
+} conn_slot_t;
+
+static volatile sig_atomic_t hold_loop = 1;
+static gl_ble_ctx_t *ble_ctx = NULL;
+static conn_slot_t conn_list[BLED_CONN_MAX];
+static pthread_mutex_t conn_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static int32_t ble_module_cb(gl_ble_module_event_t event, gl_ble_module_data_t *data)
+{
+	bled_ring_publish(BLED_CLASS_MODULE, event, data, sizeof(*data));
+	return 0;
+}
+
+static int32_t ble_gap_cb(gl_ble_gap_event_t event, gl_ble_gap_data_t *data)
+{
+	bled_ring_publish(BLED_CLASS_GAP, event, data, sizeof(*data));
+	return 0;
+}
+
+static int32_t ble_gatt_cb(gl_ble_gatt_event_t event, gl_ble_gatt_data_t *data)
+{
+	bled_ring_publish(BLED_CLASS_GATT, event, data, sizeof(*data));
+	return 0;
+}
+
+static int write_all(int fd, const char *buf, size_t len)
+{
+	while (len)
+	{
+		ssize_t ret = send(fd, buf, len, MSG_NOSIGNAL);
+		if (ret < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return -1;
+		}
+		buf += ret;
+		len -= ret;
+	}
+	return 0;
+}
+
+/* A client sends command lines, every one is answered by a JSON line. */
+static void *conn_thread(void *arg)
+{
+	conn_slot_t *slot = (conn_slot_t *)arg;
+	bled_conn_t *conn = &slot->conn;
+	char line[BLED_LINE_MAX];
+	char *reply = (char *)malloc(BLED_REPLY_MAX + 1);
+	size_t len = 0;
+
+	// the module a thread drives is not inherited
+	gl_ble_ctx_use(ble_ctx);
+
+	while (reply)
+	{
+		ssize_t ret = recv(conn->fd, line + len, sizeof(line) - 1 - len, 0);
+		if (ret < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if (ret <= 0)
+		{
+			break;
+		}
+		len += ret;
+		line[len] = '\0';
+
+		char *start = line;
+		char *end;
+		while ((end = strchr(start, '\n')))
+		{
+			*end = '\0';
+			bled_cmd_run(conn, start, reply, BLED_REPLY_MAX);
+			strcat(reply, "\n");
+			if (write_all(conn->fd, reply, strlen(reply)) != 0)
+			{
+				goto done;
+			}
+			start = end + 1;
+		}
+
+		// keep the part of a line, a line which fills the buffer is dropped
+		len -= start - line;
+		memmove(line, start, len);
+		if (len == sizeof(line) - 1)
+		{
+			len = 0;
+		}
+	}
+
+done:
+	free(reply);
+	bled_cmd_release(conn);
+
+	// the slot is free once fd is -1, the descriptor is closed after so that it is not shut down again
+	pthread_mutex_lock(&conn_mutex);
+	int fd = conn->fd;
+	conn->fd = -1;
+	pthread_mutex_unlock(&conn_mutex);
+	close(fd);
+	return NULL;
+}
+
+static int listen_open(const char *path)
+{
+	struct sockaddr_un addr;
+
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0)
+	{
+		return -1;
+	}
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", path);
+	unlink(path);
+	if ((bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) || (listen(fd, 8) != 0))
+	{
+		fprintf(stderr, "Error listening on %s - %s(%d).\n", path, strerror(errno), errno);
+		close(fd);
+		return -1;
+	}
+	chmod(path, 0660);
+
+	return fd;
+}
+
+static void conn_accept(int listen_fd)
+{
+	struct ucred cred;
+	socklen_t cred_len = sizeof(cred);
+	int i;
+
+	int fd = accept4(listen_fd, NULL, NULL, SOCK_CLOEXEC);
+	if (fd < 0)
+	{
+		return;
+	}
+
+	pthread_mutex_lock(&conn_mutex);
+	for (i = 0; i < BLED_CONN_MAX; i++)
+	{
+		conn_slot_t *slot = &conn_list[i];
+		if (slot->used && (slot->conn.fd == -1))
+		{
+			// the connection of a client which went away, its thread is done
+			pthread_join(slot->tid, NULL);
+			slot->used = 0;
+		}
+		if (slot->used)
+		{
+			continue;
+		}
+
+		memset(&slot->conn, 0, sizeof(slot->conn));
+		slot->conn.fd = fd;
+		slot->conn.consumer = -1;
+		if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &cred_len) == 0)
+		{
+			slot->conn.pid = cred.pid;
+		}
+		if (pthread_create(&slot->tid, NULL, conn_thread, slot) == 0)
+		{
+			slot->used = 1;
+			pthread_mutex_unlock(&conn_mutex);
+			return;
+		}
+		break;
+	}
+	pthread_mutex_unlock(&conn_mutex);
+
+	close(fd);
+}
+
+static void conn_close_all(void)
+{
+	int i;
+
+	pthread_mutex_lock(&conn_mutex);
+	for (i = 0; i < BLED_CONN_MAX; i++)
+	{
+		if (conn_list[i].used && (conn_list[i].conn.fd != -1))
+		{
+			shutdown(conn_list[i].conn.fd, SHUT_RDWR);
+		}
+	}
+	pthread_mutex_unlock(&conn_mutex);
+
+	for (i = 0; i < BLED_CONN_MAX; i++)
+	{
+		if (conn_list[i].used)
+		{
+			pthread_join(conn_list[i].tid, NULL);
+			conn_list[i].used = 0;
+		}
+	}
+}
+
+static void sigal_hander(int sig)
+{
+	hold_loop = 0;
+}
+
+int main(int argc, char *argv[])
+{
+	char path[sizeof(((struct sockaddr_un *)0)->sun_path)];
+	struct sigaction sa;
+	int index = 0;
+	int i;
+
+	for (i = 1; i < argc; i++)
+	{
+		// -a: keep the module running and take over the connections of the last process
+		if (0 == strcmp(argv[i], "-a"))
+		{
+			gl_ble_set_init_mode(BLE_INIT_ATTACH);
+		}
+		// -r <index>: own another module, such as a USB dongle described by gl_ble.hw1
+		else if ((0 == strcmp(argv[i], "-r")) && (i + 1 < argc))
+		{
+			index = atoi(argv[++i]);
+			if (gl_ble_ctx_use(gl_ble_ctx_get(index)) != GL_SUCCESS)
+			{
+				printf("invalid module index\n");
+				return -1;
+			}
+		}
+		else
+		{
+			printf("Usage: %s [-a] [-r index]\n", argv[0]);
+			return -1;
+		}
+	}
+
+	ble_ctx = gl_ble_ctx_current();
+	if (bled_ring_open(index) != 0)
+	{
+		return -1;
+	}
+
+	gl_ble_cbs ble_cb;
+	memset(&ble_cb, 0, sizeof(gl_ble_cbs));
+	ble_cb.ble_gap_event = ble_gap_cb;
+	ble_cb.ble_gatt_event = ble_gatt_cb;
+	ble_cb.ble_module_event = ble_module_cb;
+
+	if ((gl_ble_init() != GL_SUCCESS) || (gl_ble_subscribe(&ble_cb) != GL_SUCCESS))
+	{
+		printf("init module %d failed\n", index);
+		gl_ble_destroy();
+		bled_ring_close();
+		return -1;
+	}
+
+	snprintf(path, sizeof(path), BLED_SOCK_PATH, index);
+	int listen_fd = listen_open(path);
+	if (listen_fd < 0)
+	{
+		gl_ble_unsubscribe();
+		gl_ble_destroy();
+		bled_ring_close();
+		return -1;
+	}
+
+	// no SA_RESTART, poll returns on a signal
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = sigal_hander;
+	sigaction(SIGTERM, &sa, NULL);
+	sigaction(SIGINT, &sa, NULL);
+	sigaction(SIGQUIT, &sa, NULL);
+	signal(SIGPIPE, SIG_IGN);
+
+	struct pollfd pfd = {.fd = listen_fd, .events = POLLIN};
+	while (hold_loop)
+	{
+		if (poll(&pfd, 1, ACCEPT_TIMEOUT) > 0)
+		{
+			conn_accept(listen_fd);
+		}
+	}
+
+	close(listen_fd);
+	unlink(path);
+	conn_close_all();
+
+	gl_ble_unsubscribe();
+	gl_ble_destroy();
+	bled_ring_close();
+
+	return 0;
+}
@@ -0,0 +1,75 @@
+/*****************************************************************************
+ * @file  bled.h
+ * @brief BLE daemon, shares one module between several processes
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#ifndef _BLED_H_
+#define _BLED_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+#include "bled_shm.h"
+
+// connections on the socket, subscribed or not
+#define BLED_CONN_MAX 32
+
+typedef struct
+{
+	int fd;
+	pid_t pid;
+	int consumer; // index in the ring, -1 if not subscribed
+	int scanning; // the client holds a reference on the scanner
+} bled_conn_t;
+
+/*
+ * Create the ring of module index, a ring left by a daemon which died is replaced.
+ * Return 0 on success, -1 on failure.
+ */
+int bled_ring_open(int index);
+
+void bled_ring_close(void);
+
+/*
+ * Write an event to the ring and wake the clients whose filter takes it.
+ * Called by the watcher thread of the module only.
+ */
+void bled_ring_publish(uint32_t class, uint32_t event, const void *data, size_t len);
+
+/*
+ * Take a free consumer, its cursor starts at the next event. Return its index or -1 if all are taken.
+ */
+int bled_ring_attach(const bled_filter_t *filter, pid_t pid);
+
+void bled_ring_detach(int consumer);
+
+/*
+ * The ring, for the counters of its consumers.
+ */
+const bled_shm_t *bled_ring_get(void);
+
+/*
+ * Run a command line of a client and write its JSON reply, without the newline, to reply.
+ */
+void bled_cmd_run(bled_conn_t *conn, char *line, char *reply, size_t len);
+
+/*
+ * Release what a client which went away held.
+ */
+void bled_cmd_release(bled_conn_t *conn);
+
+#endif
@@ -0,0 +1,551 @@
+/*****************************************************************************
+ * @file  bled_cmd.c
+ * @brief Commands the clients send to the BLE daemon
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <json-c/json.h>
+
+#include "gl_bleapi.h"
+#include "gl_errno.h"
+#include "gl_type.h"
+#include "bled.h"
+
+// words of a command line
+#define ARG_MAX 16
+
+typedef struct
+{
+	char *name;
+	GL_RET (*func)(bled_conn_t *conn, int argc, char **argv, json_object *o);
+	char *usage;
+} bled_cmd_t;
+
+// clients which started the scanner, it runs until the last one stops it
+static int scan_refs = 0;
+static pthread_mutex_t scan_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static int str2addr(const char *str, BLE_MAC address)
+{
+	int mac[6] = {0};
+	int i;
+
+	if ((strlen(str) != BLE_MAC_LEN - 1) || (sscanf(str, "%02x:%02x:%02x:%02x:%02x:%02x", &mac[5], &mac[4], &mac[3], &mac[2], &mac[1], &mac[0]) != 6))
+	{
+		return -1;
+	}
+
+	for (i = 0; i < 6; i++)
+	{
+		address[i] = mac[i];
+	}
+	return 0;
+}
+
+static void addr2str(const BLE_MAC adr, char *str)
+{
+	sprintf(str, "%02x:%02x:%02x:%02x:%02x:%02x", adr[5], adr[4], adr[3], adr[2], adr[1], adr[0]);
+}
+
+/* Subscriptions */
+static GL_RET cmd_subscribe(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	bled_filter_t filter = {
+		.module = ~0U,
+		.gap = ~0U,
+		.gatt = ~0U,
+		.rssi_min = BLED_RSSI_ANY,
+	};
+
+	if ((argc != 1) && (argc != 4) && (argc != 5))
+	{
+		return GL_ERR_PARAM;
+	}
+	if (argc >= 4)
+	{
+		filter.module = strtoul(argv[1], NULL, 0);
+		filter.gap = strtoul(argv[2], NULL, 0);
+		filter.gatt = strtoul(argv[3], NULL, 0);
+	}
+	if (argc == 5)
+	{
+		filter.rssi_min = atoi(argv[4]);
+	}
+
+	// a second subscribe replaces the filter, the events of the old one are not read again
+	bled_ring_detach(conn->consumer);
+	conn->consumer = bled_ring_attach(&filter, conn->pid);
+	if (conn->consumer < 0)
+	{
+		return GL_ERR_NO_SLOT;
+	}
+
+	json_object_object_add(o, "consumer", json_object_new_int(conn->consumer));
+	return GL_SUCCESS;
+}
+
+static GL_RET cmd_unsubscribe(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	bled_ring_detach(conn->consumer);
+	conn->consumer = -1;
+	return GL_SUCCESS;
+}
+
+static GL_RET cmd_get_clients(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	const bled_shm_t *shm = bled_ring_get();
+	json_object *array = json_object_new_array();
+	int i;
+
+	json_object_object_add(o, "clients", array);
+	uint32_t head = __atomic_load_n(&shm->head, __ATOMIC_ACQUIRE);
+	for (i = 0; i < BLED_CONSUMER_MAX; i++)
+	{
+		const bled_consumer_t *consumer = &shm->consumers[i];
+		if (!__atomic_load_n(&consumer->active, __ATOMIC_ACQUIRE))
+		{
+			continue;
+		}
+
+		json_object *c = json_object_new_object();
+		json_object_object_add(c, "consumer", json_object_new_int(i));
+		json_object_object_add(c, "pid", json_object_new_int(consumer->pid));
+		json_object_object_add(c, "pending", json_object_new_int64((uint32_t)(head - __atomic_load_n(&consumer->cursor, __ATOMIC_RELAXED))));
+		json_object_object_add(c, "lost", json_object_new_int64(__atomic_load_n(&consumer->lost, __ATOMIC_RELAXED)));
+		json_object_array_add(array, c);
+	}
+	json_object_object_add(o, "events", json_object_new_int64(head));
+
+	return GL_SUCCESS;
+}
+
+/* System functions */
+static GL_RET cmd_local_address(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	BLE_MAC address;
+	char str_addr[BLE_MAC_LEN] = {0};
+
+	GL_RET ret = gl_ble_get_mac(address);
+	if (ret == GL_SUCCESS)
+	{
+		addr2str(address, str_addr);
+		json_object_object_add(o, "mac", json_object_new_string(str_addr));
+	}
+	return ret;
+}
+
+static GL_RET cmd_set_power(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	int current_p = 0;
+
+	if (argc != 2)
+	{
+		return GL_ERR_PARAM_MISSING;
+	}
+
+	GL_RET ret = gl_ble_set_power(atoi(argv[1]), &current_p);
+	if (ret == GL_SUCCESS)
+	{
+		json_object_object_add(o, "current_power", json_object_new_int(current_p));
+	}
+	return ret;
+}
+
+static GL_RET cmd_get_stats(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	gl_ble_stats_t stats;
+
+	GL_RET ret = gl_ble_get_stats(&stats);
+	if (ret == GL_SUCCESS)
+	{
+		json_object_object_add(o, "rx_evt_frames", json_object_new_int64(stats.rx_evt_frames));
+		json_object_object_add(o, "tx_cmd_frames", json_object_new_int64(stats.tx_cmd_frames));
+		json_object_object_add(o, "watcher_queue_drops", json_object_new_int64(stats.watcher_queue_drops));
+		json_object_object_add(o, "cmd_timeouts", json_object_new_int64(stats.cmd_timeouts));
+		json_object_object_add(o, "dev_num", json_object_new_int(stats.dev_num));
+	}
+	return ret;
+}
+
+/* BLE slave functions */
+static GL_RET cmd_adv_data(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	if (argc != 3)
+	{
+		return GL_ERR_PARAM_MISSING;
+	}
+
+	return gl_ble_adv_data(atoi(argv[1]), argv[2]);
+}
+
+static GL_RET cmd_adv(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	int phys = 1, interval_min = 160, interval_max = 320, discover = 2, adv_conn = 2;
+
+	if ((argc != 1) && (argc != 6))
+	{
+		return GL_ERR_PARAM;
+	}
+	if (argc == 6)
+	{
+		phys = atoi(argv[1]);
+		interval_min = atoi(argv[2]);
+		interval_max = atoi(argv[3]);
+		discover = atoi(argv[4]);
+		adv_conn = atoi(argv[5]);
+	}
+	if (interval_max < interval_min)
+	{
+		interval_max = interval_min;
+	}
+
+	return gl_ble_adv(phys, interval_min, interval_max, discover, adv_conn);
+}
+
+static GL_RET cmd_adv_stop(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	return gl_ble_stop_adv();
+}
+
+static GL_RET cmd_send_notify(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	BLE_MAC address;
+
+	if (argc != 4)
+	{
+		return GL_ERR_PARAM_MISSING;
+	}
+	if (str2addr(argv[1], address) != 0)
+	{
+		return GL_ERR_PARAM;
+	}
+
+	return gl_ble_send_notify(address, atoi(argv[2]), argv[3]);
+}
+
+/* BLE master functions */
+static GL_RET cmd_discovery(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	int phys = 1, interval = 16, window = 16, type = 0, mode = 1;
+	GL_RET ret = GL_SUCCESS;
+
+	if ((argc != 1) && (argc != 6))
+	{
+		return GL_ERR_PARAM;
+	}
+	if (argc == 6)
+	{
+		phys = atoi(argv[1]);
+		interval = atoi(argv[2]);
+		window = atoi(argv[3]);
+		type = atoi(argv[4]);
+		mode = atoi(argv[5]);
+	}
+
+	// the scanner is shared, the parameters of the client which started it stay in effect
+	pthread_mutex_lock(&scan_mutex);
+	if (!conn->scanning)
+	{
+		if (!scan_refs)
+		{
+			ret = gl_ble_discovery(phys, interval, window, type, mode);
+		}
+		if (ret == GL_SUCCESS)
+		{
+			conn->scanning = 1;
+			scan_refs++;
+		}
+	}
+	json_object_object_add(o, "scan_clients", json_object_new_int(scan_refs));
+	pthread_mutex_unlock(&scan_mutex);
+
+	return ret;
+}
+
+static GL_RET cmd_stop_discovery(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	GL_RET ret = GL_SUCCESS;
+
+	pthread_mutex_lock(&scan_mutex);
+	if (conn->scanning)
+	{
+		conn->scanning = 0;
+		if (!--scan_refs)
+		{
+			ret = gl_ble_stop_discovery();
+		}
+	}
+	json_object_object_add(o, "scan_clients", json_object_new_int(scan_refs));
+	pthread_mutex_unlock(&scan_mutex);
+
+	return ret;
+}
+
+static GL_RET cmd_connect(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	BLE_MAC address;
+
+	if (argc != 4)
+	{
+		return GL_ERR_PARAM_MISSING;
+	}
+	if (str2addr(argv[3], address) != 0)
+	{
+		return GL_ERR_PARAM;
+	}
+
+	return gl_ble_connect(address, atoi(argv[2]), atoi(argv[1]));
+}
+
+static GL_RET cmd_disconnect(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	BLE_MAC address;
+
+	if (argc != 2)
+	{
+		return GL_ERR_PARAM_MISSING;
+	}
+	if (str2addr(argv[1], address) != 0)
+	{
+		return GL_ERR_PARAM;
+	}
+
+	return gl_ble_disconnect(address);
+}
+
+static GL_RET cmd_get_rssi(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	BLE_MAC address;
+	int32_t rssi = 0;
+
+	if (argc != 2)
+	{
+		return GL_ERR_PARAM_MISSING;
+	}
+	if (str2addr(argv[1], address) != 0)
+	{
+		return GL_ERR_PARAM;
+	}
+
+	GL_RET ret = gl_ble_get_rssi(address, &rssi);
+	if (ret == GL_SUCCESS)
+	{
+		json_object_object_add(o, "rssi", json_object_new_int(rssi));
+	}
+	return ret;
+}
+
+static GL_RET cmd_get_service(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	BLE_MAC address;
+	gl_ble_service_list_t service_list;
+	int i;
+
+	if (argc != 2)
+	{
+		return GL_ERR_PARAM_MISSING;
+	}
+	if (str2addr(argv[1], address) != 0)
+	{
+		return GL_ERR_PARAM;
+	}
+
+	memset(&service_list, 0, sizeof(gl_ble_service_list_t));
+	GL_RET ret = gl_ble_get_service(&service_list, address);
+
+	json_object *array = json_object_new_array();
+	json_object_object_add(o, "service_list", array);
+	for (i = 0; (ret == GL_SUCCESS) && (i < service_list.list_len); i++)
+	{
+		json_object *s = json_object_new_object();
+		json_object_object_add(s, "service_handle", json_object_new_int(service_list.list[i].handle));
+		json_object_object_add(s, "service_uuid", json_object_new_string(service_list.list[i].uuid));
+		json_object_array_add(array, s);
+	}
+	return ret;
+}
+
+static GL_RET cmd_get_char(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	BLE_MAC address;
+	gl_ble_char_list_t char_list;
+	int i;
+
+	if (argc != 3)
+	{
+		return GL_ERR_PARAM_MISSING;
+	}
+	if ((str2addr(argv[1], address) != 0) || (atoi(argv[2]) < 0))
+	{
+		return GL_ERR_PARAM;
+	}
+
+	memset(&char_list, 0, sizeof(gl_ble_char_list_t));
+	GL_RET ret = gl_ble_get_char(&char_list, address, atoi(argv[2]));
+
+	json_object *array = json_object_new_array();
+	json_object_object_add(o, "characteristic_list", array);
+	for (i = 0; (ret == GL_SUCCESS) && (i < char_list.list_len); i++)
+	{
+		json_object *c = json_object_new_object();
+		json_object_object_add(c, "characteristic_handle", json_object_new_int(char_list.list[i].handle));
+		json_object_object_add(c, "properties", json_object_new_int(char_list.list[i].properties));
+		json_object_object_add(c, "characteristic_uuid", json_object_new_string(char_list.list[i].uuid));
+		json_object_array_add(array, c);
+	}
+	return ret;
+}
+
+static GL_RET cmd_set_notify(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	BLE_MAC address;
+
+	if (argc != 4)
+	{
+		return GL_ERR_PARAM_MISSING;
+	}
+	if ((str2addr(argv[1], address) != 0) || (atoi(argv[2]) < 0) || (atoi(argv[3]) < 0))
+	{
+		return GL_ERR_PARAM;
+	}
+
+	return gl_ble_set_notify(address, atoi(argv[2]), atoi(argv[3]));
+}
+
+static GL_RET cmd_read_value(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	BLE_MAC address;
+
+	if (argc != 3)
+	{
+		return GL_ERR_PARAM_MISSING;
+	}
+	if ((str2addr(argv[1], address) != 0) || (atoi(argv[2]) < 0))
+	{
+		return GL_ERR_PARAM;
+	}
+
+	return gl_ble_read_char(address, atoi(argv[2]));
+}
+
+static GL_RET cmd_write_value(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	BLE_MAC address;
+
+	if (argc != 5)
+	{
+		return GL_ERR_PARAM_MISSING;
+	}
+	if ((str2addr(argv[1], address) != 0) || (atoi(argv[2]) < 0))
+	{
+		return GL_ERR_PARAM;
+	}
+
+	return gl_ble_write_char(address, atoi(argv[2]), argv[4], atoi(argv[3]));
+}
+
+static GL_RET cmd_help(bled_conn_t *conn, int argc, char **argv, json_object *o);
+
+static bled_cmd_t command_list[] = {
+	{"help", cmd_help, ""},
+	{"subscribe", cmd_subscribe, "[module_mask gap_mask gatt_mask [rssi_min]]"},
+	{"unsubscribe", cmd_unsubscribe, ""},
+	{"get_clients", cmd_get_clients, ""},
+	{"local_address", cmd_local_address, ""},
+	{"set_power", cmd_set_power, "power"},
+	{"get_stats", cmd_get_stats, ""},
+	{"adv_data", cmd_adv_data, "flag data"},
+	{"adv", cmd_adv, "[phys interval_min interval_max discover adv_conn]"},
+	{"adv_stop", cmd_adv_stop, ""},
+	{"send_notify", cmd_send_notify, "address char_handle value"},
+	{"discovery", cmd_discovery, "[phys interval window type mode]"},
+	{"stop_discovery", cmd_stop_discovery, ""},
+	{"connect", cmd_connect, "phy address_type address"},
+	{"disconnect", cmd_disconnect, "address"},
+	{"get_rssi", cmd_get_rssi, "address"},
+	{"get_service", cmd_get_service, "address"},
+	{"get_char", cmd_get_char, "address service_handle"},
+	{"set_notify", cmd_set_notify, "address char_handle flag"},
+	{"read_value", cmd_read_value, "address char_handle"},
+	{"write_value", cmd_write_value, "address char_handle res value"},
+	{NULL, NULL, NULL},
+};
+
+static GL_RET cmd_help(bled_conn_t *conn, int argc, char **argv, json_object *o)
+{
+	json_object *commands = json_object_new_object();
+	int i;
+
+	json_object_object_add(o, "commands", commands);
+	for (i = 0; command_list[i].name; i++)
+	{
+		json_object_object_add(commands, command_list[i].name, json_object_new_string(command_list[i].usage));
+	}
+	return GL_SUCCESS;
+}
+
+void bled_cmd_run(bled_conn_t *conn, char *line, char *reply, size_t len)
+{
+	char *argv[ARG_MAX];
+	char *save = NULL;
+	int argc = 0;
+	int i;
+	GL_RET ret = GL_ERR_MSG;
+
+	char *token = strtok_r(line, " \t\r", &save);
+	while (token && (argc < ARG_MAX))
+	{
+		argv[argc++] = token;
+		token = strtok_r(NULL, " \t\r", &save);
+	}
+
+	json_object *o = json_object_new_object();
+	if (argc)
+	{
+		for (i = 0; command_list[i].name; i++)
+		{
+			if (0 == strcmp(command_list[i].name, argv[0]))
+			{
+				ret = command_list[i].func(conn, argc, argv, o);
+				break;
+			}
+		}
+	}
+	json_object_object_add(o, "code", json_object_new_int(ret));
+
+	snprintf(reply, len, "%s", json_object_to_json_string_ext(o, JSON_C_TO_STRING_PLAIN));
+	json_object_put(o);
+}
+
+void bled_cmd_release(bled_conn_t *conn)
+{
+	bled_ring_detach(conn->consumer);
+	conn->consumer = -1;
+
+	pthread_mutex_lock(&scan_mutex);
+	if (conn->scanning)
+	{
+		conn->scanning = 0;
+		if (!--scan_refs)
+		{
+			gl_ble_stop_discovery();
+		}
+	}
+	pthread_mutex_unlock(&scan_mutex);
+}
@@ -0,0 +1,185 @@
+/*****************************************************************************
+ * @file  bled_ring.c
+ * @brief Producer side of the shared memory event ring
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "bled.h"
+
+static bled_shm_t *shm = NULL;
+static size_t shm_len = 0;
+static char shm_name[32];
+
+// consumers are taken and released by the connection threads
+static pthread_mutex_t consumer_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+int bled_ring_open(int index)
+{
+	snprintf(shm_name, sizeof(shm_name), BLED_SHM_NAME, index);
+	shm_len = sizeof(bled_shm_t) + BLED_RING_SIZE * sizeof(bled_record_t);
+
+	// clients of a daemon which died still map the old ring, they see their connection closed
+	shm_unlink(shm_name);
+	int fd = shm_open(shm_name, O_RDWR | O_CREAT | O_EXCL, 0660);
+	if (fd < 0)
+	{
+		fprintf(stderr, "Error creating %s - %s(%d).\n", shm_name, strerror(errno), errno);
+		return -1;
+	}
+	// the clients write their cursor, the mode is not left to the umask
+	if ((fchmod(fd, 0660) != 0) || (ftruncate(fd, shm_len) != 0))
+	{
+		close(fd);
+		shm_unlink(shm_name);
+		return -1;
+	}
+
+	shm = (bled_shm_t *)mmap(NULL, shm_len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (shm == MAP_FAILED)
+	{
+		shm = NULL;
+		shm_unlink(shm_name);
+		return -1;
+	}
+
+	// the pages are zero, a record whose seq is 0 was never written
+	shm->version = BLED_VERSION;
+	shm->ring_size = BLED_RING_SIZE;
+	shm->record_size = sizeof(bled_record_t);
+	shm->pid = getpid();
+	__atomic_store_n(&shm->magic, BLED_MAGIC, __ATOMIC_RELEASE);
+
+	return 0;
+}
+
+void bled_ring_close(void)
+{
+	if (!shm)
+	{
+		return;
+	}
+
+	munmap(shm, shm_len);
+	shm = NULL;
+	shm_unlink(shm_name);
+}
+
+void bled_ring_publish(uint32_t class, uint32_t event, const void *data, size_t len)
+{
+	int i;
+
+	if (!shm)
+	{
+		return;
+	}
+
+	uint32_t seq = shm->head;
+	bled_record_t *record = &shm->ring[seq & (BLED_RING_SIZE - 1)];
+
+	// a client reading the old record sees seq change and drops what it copied,
+	// no cursor of this slot expects seq itself, also once the sequence numbers wrap
+	__atomic_store_n(&record->seq, seq, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	record->class = class;
+	record->event = event;
+	memcpy(&record->data, data, (len < sizeof(record->data)) ? len : sizeof(record->data));
+	__atomic_store_n(&record->seq, seq + 1, __ATOMIC_RELEASE);
+	__atomic_store_n(&shm->head, seq + 1, __ATOMIC_RELEASE);
+
+	// pairs with the fence of a client between setting waiting and checking head
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	for (i = 0; i < BLED_CONSUMER_MAX; i++)
+	{
+		bled_consumer_t *consumer = &shm->consumers[i];
+		if (!__atomic_load_n(&consumer->active, __ATOMIC_ACQUIRE) || !__atomic_load_n(&consumer->waiting, __ATOMIC_RELAXED))
+		{
+			continue;
+		}
+
+		// a client is not woken up for events it skips
+		if (!bled_filter_match(&consumer->filter, record))
+		{
+			continue;
+		}
+
+		__atomic_store_n(&consumer->waiting, 0, __ATOMIC_RELAXED);
+		__atomic_add_fetch(&consumer->wake, 1, __ATOMIC_RELEASE);
+		syscall(SYS_futex, &consumer->wake, FUTEX_WAKE, 1, NULL, NULL, 0);
+	}
+}
+
+int bled_ring_attach(const bled_filter_t *filter, pid_t pid)
+{
+	int i;
+
+	if (!shm)
+	{
+		return -1;
+	}
+
+	pthread_mutex_lock(&consumer_mutex);
+	for (i = 0; i < BLED_CONSUMER_MAX; i++)
+	{
+		bled_consumer_t *consumer = &shm->consumers[i];
+		if (consumer->active)
+		{
+			continue;
+		}
+
+		consumer->filter = *filter;
+		consumer->pid = pid;
+		consumer->waiting = 0;
+		consumer->lost = 0;
+		consumer->cursor = __atomic_load_n(&shm->head, __ATOMIC_ACQUIRE);
+		__atomic_store_n(&consumer->active, 1, __ATOMIC_RELEASE);
+		pthread_mutex_unlock(&consumer_mutex);
+		return i;
+	}
+	pthread_mutex_unlock(&consumer_mutex);
+
+	return -1;
+}
+
+void bled_ring_detach(int consumer)
+{
+	if ((!shm) || (consumer < 0) || (consumer >= BLED_CONSUMER_MAX))
+	{
+		return;
+	}
+
+	pthread_mutex_lock(&consumer_mutex);
+	__atomic_store_n(&shm->consumers[consumer].active, 0, __ATOMIC_RELEASE);
+	// a client still asleep wakes up and finds itself detached
+	__atomic_add_fetch(&shm->consumers[consumer].wake, 1, __ATOMIC_RELEASE);
+	syscall(SYS_futex, &shm->consumers[consumer].wake, FUTEX_WAKE, 1, NULL, NULL, 0);
+	pthread_mutex_unlock(&consumer_mutex);
+}
+
+const bled_shm_t *bled_ring_get(void)
+{
+	return shm;
+}
@@ -0,0 +1,344 @@
+/*****************************************************************************
+ * @file  bled_client.c
+ * @brief Client of the BLE daemon, commands over its socket and events from its ring
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <poll.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/un.h>
+#include <linux/futex.h>
+
+#include "bled_client.h"
+
+struct bled_client
+{
+	int fd;
+	bled_shm_t *shm;
+	size_t shm_len;
+	int consumer;
+	// a command and its reply are not mixed with those of another thread
+	pthread_mutex_t mutex;
+};
+
+static uint64_t now_ms(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static bled_shm_t *shm_map(int index, size_t *len)
+{
+	char name[32];
+	struct stat st;
+
+	snprintf(name, sizeof(name), BLED_SHM_NAME, index);
+	int fd = shm_open(name, O_RDWR, 0);
+	if (fd < 0)
+	{
+		return NULL;
+	}
+	if ((fstat(fd, &st) != 0) || (st.st_size < (off_t)sizeof(bled_shm_t)))
+	{
+		close(fd);
+		return NULL;
+	}
+
+	bled_shm_t *shm = (bled_shm_t *)mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (shm == MAP_FAILED)
+	{
+		return NULL;
+	}
+
+	// a daemon built from other headers has other records
+	if ((__atomic_load_n(&shm->magic, __ATOMIC_ACQUIRE) != BLED_MAGIC) || (shm->version != BLED_VERSION) ||
+		(shm->record_size != sizeof(bled_record_t)) ||
+		(st.st_size < (off_t)(sizeof(bled_shm_t) + shm->ring_size * sizeof(bled_record_t))))
+	{
+		munmap(shm, st.st_size);
+		return NULL;
+	}
+
+	*len = st.st_size;
+	return shm;
+}
+
+/* Return 1 if the daemon closed the socket. */
+static int daemon_gone(bled_client_t *client)
+{
+	struct pollfd pfd = {.fd = client->fd, .events = POLLRDHUP};
+
+	return (poll(&pfd, 1, 0) > 0) && (pfd.revents & (POLLRDHUP | POLLHUP | POLLERR));
+}
+
+bled_client_t *bled_client_open(int index)
+{
+	struct sockaddr_un addr;
+
+	bled_client_t *client = (bled_client_t *)calloc(1, sizeof(bled_client_t));
+	if (!client)
+	{
+		return NULL;
+	}
+	client->consumer = -1;
+	pthread_mutex_init(&client->mutex, NULL);
+
+	client->fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	snprintf(addr.sun_path, sizeof(addr.sun_path), BLED_SOCK_PATH, index);
+	if ((client->fd < 0) || (connect(client->fd, (struct sockaddr *)&addr, sizeof(addr)) != 0))
+	{
+		goto error;
+	}
+
+	// the ring is mapped after connecting, it is the one of the daemon which accepted
+	client->shm = shm_map(index, &client->shm_len);
+	if (!client->shm)
+	{
+		goto error;
+	}
+
+	return client;
+
+error:
+	if (client->fd >= 0)
+	{
+		close(client->fd);
+	}
+	pthread_mutex_destroy(&client->mutex);
+	free(client);
+	return NULL;
+}
+
+void bled_client_close(bled_client_t *client)
+{
+	if (!client)
+	{
+		return;
+	}
+
+	// the daemon releases the consumer and the scanner of the client when the socket closes
+	close(client->fd);
+	munmap(client->shm, client->shm_len);
+	pthread_mutex_destroy(&client->mutex);
+	free(client);
+}
+
+int bled_client_command(bled_client_t *client, const char *cmd, char *reply, size_t len)
+{
+	char buf[BLED_REPLY_MAX];
+	size_t pos = 0;
+	int code = -1;
+
+	pthread_mutex_lock(&client->mutex);
+
+	size_t cmd_len = strlen(cmd);
+	if ((cmd_len + 1 >= BLED_LINE_MAX) || (send(client->fd, cmd, cmd_len, MSG_NOSIGNAL) != (ssize_t)cmd_len) ||
+		(send(client->fd, "\n", 1, MSG_NOSIGNAL) != 1))
+	{
+		goto done;
+	}
+
+	while (pos < sizeof(buf) - 1)
+	{
+		ssize_t ret = recv(client->fd, buf + pos, sizeof(buf) - 1 - pos, 0);
+		if ((ret < 0) && (errno == EINTR))
+		{
+			continue;
+		}
+		if (ret <= 0)
+		{
+			goto done;
+		}
+		pos += ret;
+		buf[pos] = '\0';
+
+		char *end = strchr(buf, '\n');
+		if (end)
+		{
+			*end = '\0';
+			char *c = strstr(buf, "\"code\":");
+			code = c ? atoi(c + strlen("\"code\":")) : -1;
+			if (reply && len)
+			{
+				snprintf(reply, len, "%s", buf);
+			}
+			break;
+		}
+	}
+
+done:
+	pthread_mutex_unlock(&client->mutex);
+	return code;
+}
+
+int bled_client_subscribe(bled_client_t *client, const bled_filter_t *filter)
+{
+	char cmd[64];
+	char reply[128];
+
+	snprintf(cmd, sizeof(cmd), "subscribe %u %u %u %d", filter->module, filter->gap, filter->gatt, filter->rssi_min);
+	int code = bled_client_command(client, cmd, reply, sizeof(reply));
+	if (code != 0)
+	{
+		return code;
+	}
+
+	char *c = strstr(reply, "\"consumer\":");
+	if (!c)
+	{
+		return -1;
+	}
+	client->consumer = atoi(c + strlen("\"consumer\":"));
+	if ((client->consumer < 0) || (client->consumer >= BLED_CONSUMER_MAX))
+	{
+		client->consumer = -1;
+		return -1;
+	}
+
+	return 0;
+}
+
+int bled_client_next(bled_client_t *client, bled_record_t *record, int timeout)
+{
+	struct timespec ts;
+	uint64_t deadline = (timeout > 0) ? now_ms() + timeout : 0;
+
+	if (client->consumer < 0)
+	{
+		return -1;
+	}
+
+	bled_shm_t *shm = client->shm;
+	bled_consumer_t *consumer = &shm->consumers[client->consumer];
+	uint32_t size = shm->ring_size;
+
+	while (1)
+	{
+		if (!__atomic_load_n(&consumer->active, __ATOMIC_ACQUIRE))
+		{
+			return -1;
+		}
+
+		// the cursor is written by this client only
+		uint32_t cursor = consumer->cursor;
+		uint32_t head = __atomic_load_n(&shm->head, __ATOMIC_ACQUIRE);
+		if (cursor != head)
+		{
+			uint32_t lost = 0;
+			if (head - cursor > size)
+			{
+				lost = head - size - cursor;
+				cursor = head - size;
+			}
+
+			const bled_record_t *r = &shm->ring[cursor & (size - 1)];
+			uint32_t seq = __atomic_load_n(&r->seq, __ATOMIC_ACQUIRE);
+			int match = 0;
+			if (seq == cursor + 1)
+			{
+				match = bled_filter_match(&consumer->filter, r);
+				if (match)
+				{
+					memcpy(record, r, sizeof(bled_record_t));
+				}
+				// the daemon wrote over the record while it was read
+				__atomic_thread_fence(__ATOMIC_ACQUIRE);
+				if (__atomic_load_n(&r->seq, __ATOMIC_RELAXED) != seq)
+				{
+					seq = cursor;
+				}
+			}
+			if (seq != cursor + 1)
+			{
+				lost++;
+				match = 0;
+			}
+
+			if (lost)
+			{
+				__atomic_store_n(&consumer->lost, consumer->lost + lost, __ATOMIC_RELAXED);
+			}
+			__atomic_store_n(&consumer->cursor, cursor + 1, __ATOMIC_RELEASE);
+			if (match)
+			{
+				return 1;
+			}
+			continue;
+		}
+
+		if (timeout == 0)
+		{
+			return 0;
+		}
+
+		// pairs with the fence of the daemon between writing head and checking waiting
+		uint32_t wake = __atomic_load_n(&consumer->wake, __ATOMIC_ACQUIRE);
+		__atomic_store_n(&consumer->waiting, 1, __ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		if (__atomic_load_n(&shm->head, __ATOMIC_ACQUIRE) != cursor)
+		{
+			__atomic_store_n(&consumer->waiting, 0, __ATOMIC_RELAXED);
+			continue;
+		}
+
+		// a daemon which was killed does not detach its clients
+		if (daemon_gone(client))
+		{
+			__atomic_store_n(&consumer->waiting, 0, __ATOMIC_RELAXED);
+			return -1;
+		}
+
+		struct timespec *tsp = NULL;
+		if (timeout > 0)
+		{
+			uint64_t now = now_ms();
+			if (now >= deadline)
+			{
+				__atomic_store_n(&consumer->waiting, 0, __ATOMIC_RELAXED);
+				return 0;
+			}
+			ts.tv_sec = (deadline - now) / 1000;
+			ts.tv_nsec = ((deadline - now) % 1000) * 1000000;
+			tsp = &ts;
+		}
+		syscall(SYS_futex, &consumer->wake, FUTEX_WAIT, wake, tsp, NULL, 0);
+		__atomic_store_n(&consumer->waiting, 0, __ATOMIC_RELAXED);
+	}
+}
+
+uint32_t bled_client_lost(bled_client_t *client)
+{
+	if (client->consumer < 0)
+	{
+		return 0;
+	}
+
+	return __atomic_load_n(&client->shm->consumers[client->consumer].lost, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,61 @@
+/*****************************************************************************
+ * @file  bled_client.h
+ * @brief Client of the BLE daemon
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#ifndef _BLED_CLIENT_H_
+#define _BLED_CLIENT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "bled_shm.h"
+
+typedef struct bled_client bled_client_t;
+
+/*
+ * Connect to the daemon of module index and map its event ring.
+ * Return NULL if the daemon does not run.
+ */
+bled_client_t *bled_client_open(int index);
+
+void bled_client_close(bled_client_t *client);
+
+/*
+ * Send a command line, such as "discovery" or "connect 1 0 80:e1:26:00:00:01", and wait for its
+ * JSON reply, see the README of the daemon. Return the code of the reply or -1 if the daemon went away.
+ */
+int bled_client_command(bled_client_t *client, const char *cmd, char *reply, size_t len);
+
+/*
+ * Take the events the filter lets through, from the next one the daemon writes on.
+ * Return 0 on success, else the code of the reply or -1.
+ */
+int bled_client_subscribe(bled_client_t *client, const bled_filter_t *filter);
+
+/*
+ * Copy the next event taken by the filter, wait for it up to timeout ms, -1 waits for ever.
+ * The events the filter skips are not copied.
+ * Return 1 on an event, 0 on timeout, -1 if the client is not subscribed or the daemon went away.
+ */
+int bled_client_next(bled_client_t *client, bled_record_t *record, int timeout);
+
+/*
+ * Events the client was too late for, the daemon had written a whole ring over them.
+ */
+uint32_t bled_client_lost(bled_client_t *client);
+
+#endif
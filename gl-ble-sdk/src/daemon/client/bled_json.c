@@ -0,0 +1,137 @@
+/*****************************************************************************
+ * @file  bled_json.c
+ * @brief JSON of the events of the BLE daemon
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#include <stdio.h>
+#include <json-c/json.h>
+
+#include "gl_type.h"
+#include "bled_json.h"
+
+static int addr2str(const BLE_MAC adr, char *str)
+{
+	sprintf(str, "%02x:%02x:%02x:%02x:%02x:%02x", adr[5], adr[4],
+			adr[3], adr[2], adr[1], adr[0]);
+	return 0;
+}
+
+json_object *bled_record_json(const bled_record_t *r)
+{
+	char address[BLE_MAC_LEN] = {0};
+	json_object *o = json_object_new_object();
+
+	if ((r->class == BLED_CLASS_MODULE) && (r->event == MODULE_BLE_SYSTEM_BOOT_EVT))
+	{
+		const gl_ble_module_data_t *data = &r->data.module;
+		json_object_object_add(o, "type", json_object_new_string("module_start"));
+		json_object_object_add(o, "major", json_object_new_int(data->system_boot_data.major));
+		json_object_object_add(o, "minor", json_object_new_int(data->system_boot_data.minor));
+		json_object_object_add(o, "patch", json_object_new_int(data->system_boot_data.patch));
+		json_object_object_add(o, "build", json_object_new_int(data->system_boot_data.build));
+		json_object_object_add(o, "bootloader", json_object_new_int(data->system_boot_data.bootloader));
+		json_object_object_add(o, "hw", json_object_new_int(data->system_boot_data.hw));
+		json_object_object_add(o, "ble_hash", json_object_new_string(data->system_boot_data.ble_hash));
+	}
+	else if (r->class == BLED_CLASS_GAP)
+	{
+		const gl_ble_gap_data_t *data = &r->data.gap;
+		switch (r->event)
+		{
+		case GAP_BLE_SCAN_RESULT_EVT:
+			addr2str(data->scan_rst.address, address);
+			json_object_object_add(o, "type", json_object_new_string("scan_result"));
+			json_object_object_add(o, "mac", json_object_new_string(address));
+			json_object_object_add(o, "address_type", json_object_new_int(data->scan_rst.ble_addr_type));
+			json_object_object_add(o, "rssi", json_object_new_int(data->scan_rst.rssi));
+			json_object_object_add(o, "packet_type", json_object_new_int(data->scan_rst.packet_type));
+			json_object_object_add(o, "bonding", json_object_new_int(data->scan_rst.bonding));
+			json_object_object_add(o, "data", json_object_new_string(data->scan_rst.ble_adv));
+			break;
+		case GAP_BLE_UPDATE_CONN_EVT:
+			addr2str(data->update_conn_data.address, address);
+			json_object_object_add(o, "type", json_object_new_string("connect_update"));
+			json_object_object_add(o, "mac", json_object_new_string(address));
+			json_object_object_add(o, "interval", json_object_new_int(data->update_conn_data.interval));
+			json_object_object_add(o, "latency", json_object_new_int(data->update_conn_data.latency));
+			json_object_object_add(o, "timeout", json_object_new_int(data->update_conn_data.timeout));
+			json_object_object_add(o, "security_mode", json_object_new_int(data->update_conn_data.security_mode));
+			json_object_object_add(o, "txsize", json_object_new_int(data->update_conn_data.txsize));
+			break;
+		case GAP_BLE_CONNECT_EVT:
+			addr2str(data->connect_open_data.address, address);
+			json_object_object_add(o, "type", json_object_new_string("connect_open"));
+			json_object_object_add(o, "mac", json_object_new_string(address));
+			json_object_object_add(o, "address_type", json_object_new_int(data->connect_open_data.ble_addr_type));
+			json_object_object_add(o, "connect_role", json_object_new_int(data->connect_open_data.conn_role));
+			json_object_object_add(o, "bonding", json_object_new_int(data->connect_open_data.bonding));
+			json_object_object_add(o, "advertiser", json_object_new_int(data->connect_open_data.advertiser));
+			break;
+		case GAP_BLE_DISCONNECT_EVT:
+			addr2str(data->disconnect_data.address, address);
+			json_object_object_add(o, "type", json_object_new_string("connect_close"));
+			json_object_object_add(o, "mac", json_object_new_string(address));
+			json_object_object_add(o, "reason", json_object_new_int(data->disconnect_data.reason));
+			break;
+		default:
+			break;
+		}
+	}
+	else if (r->class == BLED_CLASS_GATT)
+	{
+		const gl_ble_gatt_data_t *data = &r->data.gatt;
+		switch (r->event)
+		{
+		case GATT_REMOTE_CHARACTERISTIC_VALUE_EVT:
+			addr2str(data->remote_characteristic_value.address, address);
+			json_object_object_add(o, "type", json_object_new_string("remote_characteristic_value"));
+			json_object_object_add(o, "mac", json_object_new_string(address));
+			json_object_object_add(o, "characteristic", json_object_new_int(data->remote_characteristic_value.characteristic));
+			json_object_object_add(o, "att_opcode", json_object_new_int(data->remote_characteristic_value.att_opcode));
+			json_object_object_add(o, "offset", json_object_new_int(data->remote_characteristic_value.offset));
+			json_object_object_add(o, "value", json_object_new_string(data->remote_characteristic_value.value));
+			break;
+		case GATT_LOCAL_GATT_ATT_EVT:
+			addr2str(data->local_gatt_attribute.address, address);
+			json_object_object_add(o, "type", json_object_new_string("local_gatt_attribute"));
+			json_object_object_add(o, "mac", json_object_new_string(address));
+			json_object_object_add(o, "attribute", json_object_new_int(data->local_gatt_attribute.attribute));
+			json_object_object_add(o, "att_opcode", json_object_new_int(data->local_gatt_attribute.att_opcode));
+			json_object_object_add(o, "offset", json_object_new_int(data->local_gatt_attribute.offset));
+			json_object_object_add(o, "value", json_object_new_string(data->local_gatt_attribute.value));
+			break;
+		case GATT_LOCAL_CHARACTERISTIC_STATUS_EVT:
+			addr2str(data->local_characteristic_status.address, address);
+			json_object_object_add(o, "type", json_object_new_string("remote_set"));
+			json_object_object_add(o, "mac", json_object_new_string(address));
+			json_object_object_add(o, "characteristic", json_object_new_int(data->local_characteristic_status.characteristic));
+			json_object_object_add(o, "status_flags", json_object_new_int(data->local_characteristic_status.status_flags));
+			json_object_object_add(o, "client_config_flags", json_object_new_int(data->local_characteristic_status.client_config_flags));
+			break;
+		default:
+			break;
+		}
+	}
+
+	// an event bletool does not print
+	if (json_object_object_length(o) == 0)
+	{
+		json_object_object_add(o, "class", json_object_new_int(r->class));
+		json_object_object_add(o, "event", json_object_new_int(r->event));
+	}
+
+	return o;
+}
@@ -0,0 +1,32 @@
+/*****************************************************************************
+ * @file  bled_json.h
+ * @brief JSON of the events of the BLE daemon
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#ifndef _BLED_JSON_H_
+#define _BLED_JSON_H_
+
+#include <json-c/json.h>
+
+#include "bled_shm.h"
+
+/*
+ * The event as bletool prints it, such as {"type":"scan_result","mac":...}.
+ * An event bletool does not print has its class and event number only. The caller puts the object.
+ */
+json_object *bled_record_json(const bled_record_t *record);
+
+#endif
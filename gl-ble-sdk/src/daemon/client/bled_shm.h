@@ -0,0 +1,127 @@
+/*****************************************************************************
+ * @file  bled_shm.h
+ * @brief Shared memory event ring of the BLE daemon
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#ifndef _BLED_SHM_H_
+#define _BLED_SHM_H_
+
+#include <stdint.h>
+#include <limits.h>
+
+#include "gl_type.h"
+
+/*
+ * The daemon of module <index> owns the serial port, it writes every event once to a ring in
+ * the shared memory BLED_SHM_NAME and takes commands on the unix socket BLED_SOCK_PATH.
+ * A client subscribes over the socket and gets a consumer of the ring, with its own cursor and
+ * filter. It reads the events in place, the daemon never waits for a client: a client which falls
+ * a whole ring behind loses the oldest events and counts them.
+ * The words shared between the processes are 32 bits, a 32-bit target has no lock free 64-bit
+ * atomics and the locks of libatomic are not shared. The sequence numbers wrap, they are compared
+ * by their difference.
+ */
+#define BLED_SHM_NAME "/gl-bled%d"
+#define BLED_SOCK_PATH "/var/run/gl-bled%d.sock"
+
+#define BLED_MAGIC 0x424c4544
+#define BLED_VERSION 2
+
+// records of the ring, must be a power of 2
+#define BLED_RING_SIZE 1024
+
+// clients subscribed at the same time
+#define BLED_CONSUMER_MAX 16
+
+// longest command line on the socket
+#define BLED_LINE_MAX 1024
+
+// longest reply line on the socket, a list of services or characteristics is long
+#define BLED_REPLY_MAX 8192
+
+// callback of the event
+#define BLED_CLASS_MODULE 0
+#define BLED_CLASS_GAP 1
+#define BLED_CLASS_GATT 2
+
+// rssi_min of a filter which takes the scan results of any strength
+#define BLED_RSSI_ANY INT32_MIN
+
+typedef struct
+{
+	uint32_t module; // bit (1 << event) of the gl_ble_module_event_t taken
+	uint32_t gap;	 // bit (1 << event) of the gl_ble_gap_event_t taken
+	uint32_t gatt;	 // bit (1 << event) of the gl_ble_gatt_event_t taken
+	int32_t rssi_min; // scan results weaker than it are skipped
+} bled_filter_t;
+
+typedef struct
+{
+	uint32_t seq;	// sequence number + 1 once written, the sequence number while the daemon writes it
+	uint32_t class; // BLED_CLASS_*
+	uint32_t event; // event of the callback
+	union
+	{
+		gl_ble_module_data_t module;
+		gl_ble_gap_data_t gap;
+		gl_ble_gatt_data_t gatt;
+	} data;
+} bled_record_t;
+
+typedef struct
+{
+	uint32_t active;  // set by the daemon while the client is connected
+	uint32_t wake;	  // futex the client sleeps on, bumped by the daemon
+	uint32_t waiting; // set by the client before it sleeps
+	uint32_t pid;	  // of the client
+	bled_filter_t filter;
+	uint32_t cursor; // next sequence number the client reads, written by the client
+	uint32_t lost;	 // events the client was too late for, written by the client
+} __attribute__((aligned(64))) bled_consumer_t;
+
+typedef struct
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t ring_size;
+	uint32_t record_size;
+	uint32_t pid; // of the daemon
+	// sequence number of the next record, written by the daemon
+	uint32_t head __attribute__((aligned(64)));
+	bled_consumer_t consumers[BLED_CONSUMER_MAX];
+	bled_record_t ring[];
+} bled_shm_t;
+
+static inline int bled_filter_match(const bled_filter_t *filter, const bled_record_t *record)
+{
+	switch (record->class)
+	{
+	case BLED_CLASS_MODULE:
+		return (filter->module >> record->event) & 1;
+	case BLED_CLASS_GAP:
+		if (!((filter->gap >> record->event) & 1))
+		{
+			return 0;
+		}
+		return (record->event != GAP_BLE_SCAN_RESULT_EVT) || (record->data.gap.scan_rst.rssi >= filter->rssi_min);
+	case BLED_CLASS_GATT:
+		return (filter->gatt >> record->event) & 1;
+	default:
+		return 0;
+	}
+}
+
+#endif
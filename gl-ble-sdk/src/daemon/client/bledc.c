@@ -0,0 +1,147 @@
+/*****************************************************************************
+ * @file  bledc.c
+ * @brief Command line client of the BLE daemon
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <json-c/json.h>
+
+#include "gl_type.h"
+#include "bled_client.h"
+#include "bled_json.h"
+
+// ms between two checks of the stop flag while no event comes
+#define EVENT_TIMEOUT 500
+
+static volatile sig_atomic_t hold_loop = 1;
+
+static void sigal_hander(int sig)
+{
+	hold_loop = 0;
+}
+
+static void print_record(const bled_record_t *r)
+{
+	json_object *o = bled_record_json(r);
+
+	printf("%s\n", json_object_to_json_string(o));
+	fflush(stdout);
+	json_object_put(o);
+}
+
+static int follow(bled_client_t *client, const bled_filter_t *filter)
+{
+	bled_record_t record;
+
+	int code = bled_client_subscribe(client, filter);
+	if (code != 0)
+	{
+		printf("subscribe failed: %d\n", code);
+		return -1;
+	}
+
+	signal(SIGTERM, sigal_hander);
+	signal(SIGINT, sigal_hander);
+
+	while (hold_loop)
+	{
+		int ret = bled_client_next(client, &record, EVENT_TIMEOUT);
+		if (ret < 0)
+		{
+			printf("daemon went away\n");
+			return -1;
+		}
+		if (ret > 0)
+		{
+			print_record(&record);
+		}
+	}
+
+	fprintf(stderr, "lost %u events\n", bled_client_lost(client));
+	return 0;
+}
+
+static void usage(const char *name)
+{
+	printf("Usage: %s [-r index] <command> [args...]\n", name);
+	printf("       %s [-r index] -e [module gap gatt [rssi_min]]\n", name);
+	printf("  <command>: a command of the daemon, \"help\" lists them\n");
+	printf("  -e: print the events, the masks take bit (1 << event) of each callback, all by default\n");
+}
+
+int main(int argc, char *argv[])
+{
+	char line[BLED_LINE_MAX];
+	char reply[BLED_REPLY_MAX];
+	int index = 0;
+	int i = 1;
+
+	if ((i + 1 < argc) && (0 == strcmp(argv[i], "-r")))
+	{
+		index = atoi(argv[i + 1]);
+		i += 2;
+	}
+	if (i >= argc)
+	{
+		usage(argv[0]);
+		return -1;
+	}
+
+	bled_client_t *client = bled_client_open(index);
+	if (!client)
+	{
+		printf("daemon of module %d is not running\n", index);
+		return -1;
+	}
+
+	int ret = 0;
+	if (0 == strcmp(argv[i], "-e"))
+	{
+		bled_filter_t filter = {UINT32_MAX, UINT32_MAX, UINT32_MAX, BLED_RSSI_ANY};
+		if (i + 3 < argc)
+		{
+			filter.module = strtoul(argv[i + 1], NULL, 0);
+			filter.gap = strtoul(argv[i + 2], NULL, 0);
+			filter.gatt = strtoul(argv[i + 3], NULL, 0);
+		}
+		if (i + 4 < argc)
+		{
+			filter.rssi_min = atoi(argv[i + 4]);
+		}
+		ret = follow(client, &filter);
+	}
+	else
+	{
+		// the arguments are joined back into a command line
+		size_t len = 0;
+		line[0] = '\0';
+		for (; (i < argc) && (len < sizeof(line)); i++)
+		{
+			len += snprintf(line + len, sizeof(line) - len, "%s%s", len ? " " : "", argv[i]);
+		}
+		ret = (bled_client_command(client, line, reply, sizeof(reply)) < 0) ? -1 : 0;
+		if (ret == 0)
+		{
+			printf("%s\n", reply);
+		}
+	}
+
+	bled_client_close(client);
+	return ret;
+}
@@ -0,0 +1,361 @@
+/*****************************************************************************
+ * @file  bled_ubus.c
+ * @brief ubus object of the BLE daemon, its commands as methods and its events as notifications
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <json-c/json.h>
+#include <libubox/uloop.h>
+#include <libubox/blobmsg_json.h>
+#include <libubus.h>
+
+#include "gl_type.h"
+#include "bled_client.h"
+#include "bled_json.h"
+
+// arguments of a method
+#define ARG_MAX 16
+
+// scan results of a notification
+#define BATCH_DEFAULT 32
+
+// ms the events wait before they are notified
+#define WINDOW_DEFAULT 100
+
+// ms to the next read of the ring after a full batch, a burst of scan results does not lap the ring
+#define BUSY_INTERVAL 10
+
+typedef struct
+{
+	char *name;
+	struct blobmsg_policy policy[ARG_MAX];
+	int n_policy;
+} ubus_cmd_t;
+
+static bled_client_t *client = NULL;
+static struct ubus_context *ctx = NULL;
+static struct blob_buf b;
+static char line[BLED_LINE_MAX];
+static char reply[BLED_REPLY_MAX];
+
+static ubus_cmd_t *cmd_list = NULL;
+static int cmd_num = 0;
+static struct ubus_method *method_list = NULL;
+static struct ubus_object_type object_type;
+static struct ubus_object object;
+static char object_name[32];
+
+static int batch_max = BATCH_DEFAULT;
+static int window = WINDOW_DEFAULT;
+
+/* A method takes the arguments of its command by name and sends them in their order, up to the first one missing. */
+static int ubus_call(struct ubus_context *ctx, struct ubus_object *obj, struct ubus_request_data *req,
+					 const char *method, struct blob_attr *msg)
+{
+	struct blob_attr *tb[ARG_MAX];
+	ubus_cmd_t *cmd = NULL;
+	int i;
+
+	for (i = 0; i < cmd_num; i++)
+	{
+		if (0 == strcmp(cmd_list[i].name, method))
+		{
+			cmd = &cmd_list[i];
+			break;
+		}
+	}
+	if (!cmd)
+	{
+		return UBUS_STATUS_METHOD_NOT_FOUND;
+	}
+
+	blobmsg_parse(cmd->policy, cmd->n_policy, tb, blob_data(msg), blob_len(msg));
+
+	size_t len = snprintf(line, sizeof(line), "%s", cmd->name);
+	for (i = 0; (i < cmd->n_policy) && tb[i] && (len < sizeof(line)); i++)
+	{
+		switch (blobmsg_type(tb[i]))
+		{
+		case BLOBMSG_TYPE_STRING:
+			// the words of a command line are separated by spaces
+			if (strpbrk(blobmsg_get_string(tb[i]), " \t\r\n"))
+			{
+				return UBUS_STATUS_INVALID_ARGUMENT;
+			}
+			len += snprintf(line + len, sizeof(line) - len, " %s", blobmsg_get_string(tb[i]));
+			break;
+		case BLOBMSG_TYPE_INT64:
+			len += snprintf(line + len, sizeof(line) - len, " %lld", (long long)(int64_t)blobmsg_get_u64(tb[i]));
+			break;
+		case BLOBMSG_TYPE_INT32:
+			len += snprintf(line + len, sizeof(line) - len, " %d", (int32_t)blobmsg_get_u32(tb[i]));
+			break;
+		case BLOBMSG_TYPE_INT16:
+			len += snprintf(line + len, sizeof(line) - len, " %d", (int16_t)blobmsg_get_u16(tb[i]));
+			break;
+		case BLOBMSG_TYPE_INT8:
+			len += snprintf(line + len, sizeof(line) - len, " %d", blobmsg_get_u8(tb[i]));
+			break;
+		default:
+			return UBUS_STATUS_INVALID_ARGUMENT;
+		}
+	}
+	if (len >= sizeof(line))
+	{
+		return UBUS_STATUS_INVALID_ARGUMENT;
+	}
+
+	if (bled_client_command(client, line, reply, sizeof(reply)) < 0)
+	{
+		uloop_end();
+		return UBUS_STATUS_CONNECTION_FAILED;
+	}
+
+	blob_buf_init(&b, 0);
+	blobmsg_add_json_from_string(&b, reply);
+	ubus_send_reply(ctx, req, b.head);
+
+	return UBUS_STATUS_OK;
+}
+
+/* The methods are the commands of the daemon, taken from the reply of "help". */
+static int methods_build(void)
+{
+	json_object *help = NULL;
+	json_object *commands = NULL;
+	int i = 0;
+
+	if ((bled_client_command(client, "help", reply, sizeof(reply)) != 0) ||
+		!(help = json_tokener_parse(reply)) || !json_object_object_get_ex(help, "commands", &commands))
+	{
+		json_object_put(help);
+		return -1;
+	}
+
+	int num = json_object_object_length(commands);
+	cmd_list = (ubus_cmd_t *)calloc(num, sizeof(ubus_cmd_t));
+	method_list = (struct ubus_method *)calloc(num, sizeof(struct ubus_method));
+	if (!cmd_list || !method_list)
+	{
+		json_object_put(help);
+		return -1;
+	}
+
+	json_object_object_foreach(commands, name, usage)
+	{
+		// the events are notifications of the object
+		if ((0 == strcmp(name, "subscribe")) || (0 == strcmp(name, "unsubscribe")))
+		{
+			continue;
+		}
+
+		ubus_cmd_t *cmd = &cmd_list[i];
+		char *words = strdup(json_object_get_string(usage));
+		char *save = NULL;
+		char *word = strtok_r(words, " []", &save);
+		cmd->name = strdup(name);
+		while (word && (cmd->n_policy < ARG_MAX))
+		{
+			cmd->policy[cmd->n_policy].name = strdup(word);
+			cmd->policy[cmd->n_policy].type = BLOBMSG_TYPE_UNSPEC;
+			cmd->n_policy++;
+			word = strtok_r(NULL, " []", &save);
+		}
+		free(words);
+
+		method_list[i].name = cmd->name;
+		method_list[i].handler = ubus_call;
+		method_list[i].policy = cmd->policy;
+		method_list[i].n_policy = cmd->n_policy;
+		i++;
+	}
+	cmd_num = i;
+	json_object_put(help);
+
+	object_type.name = object_name;
+	object_type.methods = method_list;
+	object_type.n_methods = cmd_num;
+	object.name = object_name;
+	object.type = &object_type;
+	object.methods = method_list;
+	object.n_methods = cmd_num;
+
+	return 0;
+}
+
+static void scan_notify(void *array)
+{
+	blobmsg_close_array(&b, array);
+	ubus_notify(ctx, &object, "scan_results", b.head, -1);
+}
+
+/*
+ * The events of a window are notified together, a scan result does not cost a message of ubusd.
+ * The other events keep their order with the scan results, they are notified one by one.
+ */
+static void event_flush(struct uloop_timeout *t)
+{
+	bled_record_t record;
+	void *array = NULL;
+	int scans = 0;
+	int busy = 0;
+	int ret;
+
+	while ((ret = bled_client_next(client, &record, 0)) > 0)
+	{
+		// the ring is read for nothing, its events are not kept for a later subscriber
+		if (!object.has_subscribers)
+		{
+			continue;
+		}
+
+		json_object *o = bled_record_json(&record);
+		if ((record.class == BLED_CLASS_GAP) && (record.event == GAP_BLE_SCAN_RESULT_EVT))
+		{
+			if (!scans)
+			{
+				blob_buf_init(&b, 0);
+				array = blobmsg_open_array(&b, "results");
+			}
+			void *table = blobmsg_open_table(&b, NULL);
+			blobmsg_add_object(&b, o);
+			blobmsg_close_table(&b, table);
+			if (++scans == batch_max)
+			{
+				scan_notify(array);
+				scans = 0;
+				busy = 1;
+			}
+		}
+		else
+		{
+			json_object *type = NULL;
+			if (scans)
+			{
+				scan_notify(array);
+				scans = 0;
+			}
+			blob_buf_init(&b, 0);
+			blobmsg_add_object(&b, o);
+			json_object_object_get_ex(o, "type", &type);
+			ubus_notify(ctx, &object, type ? json_object_get_string(type) : "event", b.head, -1);
+		}
+		json_object_put(o);
+	}
+	if (scans)
+	{
+		scan_notify(array);
+	}
+
+	if (ret < 0)
+	{
+		fprintf(stderr, "BLE daemon went away\n");
+		uloop_end();
+		return;
+	}
+	uloop_timeout_set(t, (busy && (window > BUSY_INTERVAL)) ? BUSY_INTERVAL : window);
+}
+
+static struct uloop_timeout flush_timer = {
+	.cb = event_flush,
+};
+
+int main(int argc, char *argv[])
+{
+	bled_filter_t filter = {UINT32_MAX, UINT32_MAX, UINT32_MAX, BLED_RSSI_ANY};
+	int index = 0;
+	int i;
+
+	for (i = 1; i < argc; i++)
+	{
+		// -r <index>: the daemon of another module
+		if ((0 == strcmp(argv[i], "-r")) && (i + 1 < argc))
+		{
+			index = atoi(argv[++i]);
+		}
+		// -n <num>: scan results of a notification
+		else if ((0 == strcmp(argv[i], "-n")) && (i + 1 < argc) && (atoi(argv[i + 1]) > 0))
+		{
+			batch_max = atoi(argv[++i]);
+		}
+		// -w <ms>: time the events wait before they are notified
+		else if ((0 == strcmp(argv[i], "-w")) && (i + 1 < argc) && (atoi(argv[i + 1]) > 0))
+		{
+			window = atoi(argv[++i]);
+		}
+		// -s <rssi>: scan results weaker than it are not notified
+		else if ((0 == strcmp(argv[i], "-s")) && (i + 1 < argc))
+		{
+			filter.rssi_min = atoi(argv[++i]);
+		}
+		else
+		{
+			printf("Usage: %s [-r index] [-n batch] [-w window_ms] [-s rssi_min]\n", argv[0]);
+			return -1;
+		}
+	}
+
+	if (index)
+	{
+		snprintf(object_name, sizeof(object_name), "gl-ble.%d", index);
+	}
+	else
+	{
+		snprintf(object_name, sizeof(object_name), "gl-ble");
+	}
+
+	client = bled_client_open(index);
+	if (!client)
+	{
+		printf("daemon of module %d is not running\n", index);
+		return -1;
+	}
+	if ((methods_build() != 0) || (bled_client_subscribe(client, &filter) != 0))
+	{
+		printf("daemon of module %d refused the client\n", index);
+		bled_client_close(client);
+		return -1;
+	}
+
+	uloop_init();
+	ctx = ubus_connect(NULL);
+	if (!ctx)
+	{
+		printf("connect to ubus failed\n");
+		bled_client_close(client);
+		return -1;
+	}
+	ubus_add_uloop(ctx);
+	if (ubus_add_object(ctx, &object) != 0)
+	{
+		printf("add object %s failed\n", object_name);
+		ubus_free(ctx);
+		bled_client_close(client);
+		return -1;
+	}
+
+	uloop_timeout_set(&flush_timer, window);
+	uloop_run();
+
+	ubus_free(ctx);
+	uloop_done();
+	blob_buf_free(&b);
+	bled_client_close(client);
+
+	return 0;
+}
@@ -28,10 +28,10 @@
 
 #include "gl_errno.h"
 #include "gl_type.h"
+#include "gl_bleapi.h"
 
 #define MAC2STR(a) (a)[5], (a)[4], (a)[3], (a)[2], (a)[1], (a)[0]
 #define MACSTR "%02X:%02X:%02X:%02X:%02X:%02X"
-static bool module_work = false;
 
 static void sigal_hander(int sig);
 static int str2addr(char *str, BLE_MAC address);
@@ -217,7 +217,6 @@ static int ble_module_cb(gl_ble_module_event_t event, gl_ble_module_data_t *data
 	{
 	case MODULE_BLE_SYSTEM_BOOT_EVT:
 	{
-		module_work = true;
 		json_object *o = NULL;
 		o = json_object_new_object();
 		json_object_object_add(o, "type", json_object_new_string("module_start"));
@@ -300,9 +299,11 @@ int main(int argc, char *argv[])
 	}
 
 	// wait for module reset
-	while (!module_work)
+	ret = gl_ble_wait_boot(3000);
+	if (GL_SUCCESS != ret)
 	{
-		usleep(100000);
+		printf("gl_ble_wait_boot failed: %d\n", ret);
+		exit(-1);
 	}
 
 	// start
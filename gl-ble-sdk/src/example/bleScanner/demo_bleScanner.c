@@ -34,7 +34,6 @@ static int ble_gap_cb(gl_ble_gap_event_t event, gl_ble_gap_data_t *data);
 static int ble_module_cb(gl_ble_module_event_t event, gl_ble_module_data_t *data);
 static int addr2str(BLE_MAC adr, char *str);
 
-static bool module_work = false;
 
 int main(int argc, char *argv[])
 {
@@ -83,9 +82,11 @@ int main(int argc, char *argv[])
 	}
 
 	// wait for module reset
-	while (!module_work)
+	ret = gl_ble_wait_boot(3000);
+	if (GL_SUCCESS != ret)
 	{
-		usleep(100000);
+		printf("gl_ble_wait_boot failed: %d\n", ret);
+		exit(-1);
 	}
 
 	// start scan
@@ -149,7 +150,6 @@ static int ble_module_cb(gl_ble_module_event_t event, gl_ble_module_data_t *data
 	{
 	case MODULE_BLE_SYSTEM_BOOT_EVT:
 	{
-		module_work = true;
 		json_object *o = NULL;
 		o = json_object_new_object();
 		json_object_object_add(o, "type", json_object_new_string("module_start"));
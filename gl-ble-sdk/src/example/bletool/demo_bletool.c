@@ -682,6 +682,126 @@ GL_RET cmd_read_value(int argc, char **argv)
 	return GL_SUCCESS;
 }
 
+static int str2int_list(char *str, int *list, int max)
+{
+	int num = 0;
+	char *token = strtok(str, ",");
+	while (token && (num < max))
+	{
+		list[num++] = atoi(token);
+		token = strtok(NULL, ",");
+	}
+	return num;
+}
+
+static void print_value_list(GL_RET ret, gl_ble_char_value_list_t *value_list)
+{
+	// json format
+	json_object *o = NULL, *l = NULL, *obj = NULL, *array = NULL;
+
+	array = json_object_new_array();
+	obj = json_object_new_object();
+	json_object_object_add(obj, "code", json_object_new_int(ret));
+	json_object_object_add(obj, "value_list", array);
+	int len = value_list->list_len;
+	int i = 0;
+
+	if (ret == GL_SUCCESS)
+	{
+		while (i < len)
+		{
+			o = json_object_new_object();
+			l = json_object_object_get(obj, "value_list");
+			json_object_object_add(o, "characteristic_handle", json_object_new_int(value_list->list[i].handle));
+			json_object_object_add(o, "value", json_object_new_string(value_list->list[i].value));
+			json_object_array_add(l, o);
+			i++;
+		}
+	}
+	const char *temp = json_object_to_json_string(obj);
+	printf("%s\n", temp);
+
+	json_object_put(obj);
+}
+
+GL_RET cmd_read_multiple_value(int argc, char **argv)
+{
+	int char_handle[LIST_LENGTHE_MAX] = {0};
+	int value_len[LIST_LENGTHE_MAX] = {0};
+	int num = 0;
+	char *address = NULL;
+	uint8_t addr_len;
+
+	if ((argc != 3) && (argc != 4))
+	{
+		printf(PARA_MISSING);
+		return GL_ERR_PARAM;
+	}
+	address = argv[1];
+	num = str2int_list(argv[2], char_handle, LIST_LENGTHE_MAX);
+	if (argc == 4)
+	{
+		str2int_list(argv[3], value_len, LIST_LENGTHE_MAX);
+	}
+
+	addr_len = strlen(address);
+
+	if (addr_len < BLE_MAC_LEN - 1 || num < 2)
+	{
+		printf(PARA_ERROR);
+		return GL_ERR_PARAM;
+	}
+
+	BLE_MAC address_u8;
+	str2addr(address, address_u8);
+
+	gl_ble_char_value_list_t value_list;
+	memset(&value_list, 0, sizeof(gl_ble_char_value_list_t));
+
+	GL_RET ret = gl_ble_read_multiple_char(address_u8, char_handle, (argc == 4) ? value_len : NULL, num, &value_list);
+
+	print_value_list(ret, &value_list);
+
+	return GL_SUCCESS;
+}
+
+GL_RET cmd_read_value_by_uuid(int argc, char **argv)
+{
+	int service_handle = -1;
+	char *address = NULL;
+	char *uuid = NULL;
+	uint8_t addr_len;
+
+	if (argc != 4)
+	{
+		printf(PARA_MISSING);
+		return GL_ERR_PARAM;
+	}
+	address = argv[1];
+	service_handle = atoi(argv[2]);
+	uuid = argv[3];
+
+	addr_len = strlen(address);
+
+	if (addr_len < BLE_MAC_LEN - 1 || service_handle < 0)
+	{
+		printf(PARA_ERROR);
+		return GL_ERR_PARAM;
+	}
+
+	BLE_MAC address_u8;
+	str2addr(address, address_u8);
+
+	gl_ble_char_value_list_t value_list;
+	memset(&value_list, 0, sizeof(gl_ble_char_value_list_t));
+
+	GL_RET ret = gl_ble_read_char_by_uuid(address_u8, service_handle, uuid, &value_list);
+
+	print_value_list(ret, &value_list);
+
+	return GL_SUCCESS;
+}
+
 GL_RET cmd_write_value(int argc, char **argv)
 {
 	int char_handle = -1, res = 0;
@@ -689,25 +809,361 @@ GL_RET cmd_write_value(int argc, char **argv)
 	char *address = NULL;
 	uint8_t addr_len;
 
-	if (argc != 5)
+	if (argc != 5)
+	{
+		printf(PARA_MISSING);
+		return GL_ERR_PARAM;
+	}
+	address = argv[1];
+	char_handle = atoi(argv[2]);
+	res = atoi(argv[3]);
+	value = argv[4];
+
+	if (address == NULL)
+	{
+		printf(PARA_MISSING);
+		return GL_ERR_PARAM;
+	}
+
+	addr_len = strlen(address);
+
+	if (addr_len < BLE_MAC_LEN - 1 || char_handle < 0 || !value)
+	{
+		printf(PARA_ERROR);
+		return GL_ERR_PARAM;
+	}
+
+	BLE_MAC address_u8;
+	str2addr(address, address_u8);
+
+	GL_RET ret = gl_ble_write_char(address_u8, char_handle, value, res);
+
+	// json format
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "code", json_object_new_int(ret));
+	const char *temp = json_object_to_json_string(o);
+	printf("%s\n", temp);
+
+	json_object_put(o);
+
+	return GL_SUCCESS;
+}
+
+GL_RET cmd_read_value_sync(int argc, char **argv)
+{
+	int char_handle = -1, timeout = 1000;
+	char *address = NULL;
+	uint8_t addr_len;
+
+	if ((argc != 3) && (argc != 4))
+	{
+		printf(PARA_MISSING);
+		return GL_ERR_PARAM;
+	}
+	address = argv[1];
+	char_handle = atoi(argv[2]);
+	if (argc == 4)
+	{
+		timeout = atoi(argv[3]);
+	}
+
+	if (address == NULL)
+	{
+		printf(PARA_MISSING);
+		return GL_ERR_PARAM;
+	}
+
+	addr_len = strlen(address);
+
+	if (addr_len < BLE_MAC_LEN - 1 || char_handle < 0 || timeout <= 0)
+	{
+		printf(PARA_ERROR);
+		return GL_ERR_PARAM;
+	}
+
+	BLE_MAC address_u8;
+	str2addr(address, address_u8);
+
+	char value[CHAR_VALUE_MAX] = {0};
+	GL_RET ret = gl_ble_read_char_sync(address_u8, char_handle, value, timeout);
+
+	// json format
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "code", json_object_new_int(ret));
+	if (ret == GL_SUCCESS)
+	{
+		json_object_object_add(o, "characteristic", json_object_new_int(char_handle));
+		json_object_object_add(o, "value", json_object_new_string(value));
+	}
+	const char *temp = json_object_to_json_string(o);
+	printf("%s\n", temp);
+
+	json_object_put(o);
+
+	return GL_SUCCESS;
+}
+
+GL_RET cmd_write_value_sync(int argc, char **argv)
+{
+	int char_handle = -1, timeout = 1000;
+	char *value = NULL;
+	char *address = NULL;
+	uint8_t addr_len;
+
+	if ((argc != 4) && (argc != 5))
+	{
+		printf(PARA_MISSING);
+		return GL_ERR_PARAM;
+	}
+	address = argv[1];
+	char_handle = atoi(argv[2]);
+	value = argv[3];
+	if (argc == 5)
+	{
+		timeout = atoi(argv[4]);
+	}
+
+	if (address == NULL)
+	{
+		printf(PARA_MISSING);
+		return GL_ERR_PARAM;
+	}
+
+	addr_len = strlen(address);
+
+	if (addr_len < BLE_MAC_LEN - 1 || char_handle < 0 || !value || timeout <= 0)
+	{
+		printf(PARA_ERROR);
+		return GL_ERR_PARAM;
+	}
+
+	BLE_MAC address_u8;
+	str2addr(address, address_u8);
+
+	GL_RET ret = gl_ble_write_char_sync(address_u8, char_handle, value, timeout);
+
+	// json format
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "code", json_object_new_int(ret));
+	const char *temp = json_object_to_json_string(o);
+	printf("%s\n", temp);
+
+	json_object_put(o);
+
+	return GL_SUCCESS;
+}
+
+static void ble_l2cap_cb(gl_ble_l2cap_event_t event, gl_ble_l2cap_data_t *data, void *arg)
+{
+	char address[BLE_MAC_LEN] = {0};
+	json_object *o = json_object_new_object();
+
+	switch (event)
+	{
+	case L2CAP_CHANNEL_OPEN_EVT:
+	{
+		addr2str(data->channel_open.address, address);
+		json_object_object_add(o, "type", json_object_new_string("l2cap_channel_open"));
+		json_object_object_add(o, "mac", json_object_new_string(address));
+		json_object_object_add(o, "cid", json_object_new_int(data->channel_open.cid));
+		json_object_object_add(o, "le_psm", json_object_new_int(data->channel_open.le_psm));
+		json_object_object_add(o, "mtu", json_object_new_int(data->channel_open.mtu));
+		json_object_object_add(o, "mps", json_object_new_int(data->channel_open.mps));
+		break;
+	}
+	case L2CAP_CHANNEL_CLOSED_EVT:
+	{
+		addr2str(data->channel_closed.address, address);
+		json_object_object_add(o, "type", json_object_new_string("l2cap_channel_closed"));
+		json_object_object_add(o, "mac", json_object_new_string(address));
+		json_object_object_add(o, "cid", json_object_new_int(data->channel_closed.cid));
+		json_object_object_add(o, "reason", json_object_new_int(data->channel_closed.reason));
+		break;
+	}
+	case L2CAP_DATA_EVT:
+	{
+		char value[MAX_VALUE_DATA_LEN * 2 + 1] = {0};
+		int i = 0;
+		while ((i < data->data.len) && (i < MAX_VALUE_DATA_LEN))
+		{
+			sprintf(value + i * 2, "%02x", data->data.data[i]);
+			i++;
+		}
+
+		addr2str(data->data.address, address);
+		json_object_object_add(o, "type", json_object_new_string("l2cap_data"));
+		json_object_object_add(o, "mac", json_object_new_string(address));
+		json_object_object_add(o, "cid", json_object_new_int(data->data.cid));
+		json_object_object_add(o, "value", json_object_new_string(value));
+		break;
+	}
+	default:
+		json_object_put(o);
+		return;
+	}
+
+	const char *temp = json_object_to_json_string(o);
+	printf("L2CAP_CB_MSG >> %s\n", temp);
+
+	json_object_put(o);
+}
+
+GL_RET cmd_l2cap_listen(int argc, char **argv)
+{
+	int le_psm = 0, mtu = 252, mps = 252, credit = 10;
+
+	if ((argc != 2) && (argc != 5))
+	{
+		printf(PARA_MISSING);
+		return GL_ERR_PARAM;
+	}
+	le_psm = atoi(argv[1]);
+	if (argc == 5)
+	{
+		mtu = atoi(argv[2]);
+		mps = atoi(argv[3]);
+		credit = atoi(argv[4]);
+	}
+
+	GL_RET ret = gl_ble_l2cap_listen(le_psm, mtu, mps, credit, ble_l2cap_cb, NULL);
+
+	// json format
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "code", json_object_new_int(ret));
+	const char *temp = json_object_to_json_string(o);
+	printf("%s\n", temp);
+
+	json_object_put(o);
+
+	return GL_SUCCESS;
+}
+
+GL_RET cmd_l2cap_connect(int argc, char **argv)
+{
+	int le_psm = 0, mtu = 252, mps = 252, credit = 10, cid = 0;
+	char *address = NULL;
+	uint8_t addr_len;
+
+	if ((argc != 3) && (argc != 6))
+	{
+		printf(PARA_MISSING);
+		return GL_ERR_PARAM;
+	}
+	address = argv[1];
+	le_psm = atoi(argv[2]);
+	if (argc == 6)
+	{
+		mtu = atoi(argv[3]);
+		mps = atoi(argv[4]);
+		credit = atoi(argv[5]);
+	}
+
+	addr_len = strlen(address);
+
+	if (addr_len < BLE_MAC_LEN - 1)
+	{
+		printf(PARA_ERROR);
+		return GL_ERR_PARAM;
+	}
+
+	BLE_MAC address_u8;
+	str2addr(address, address_u8);
+
+	GL_RET ret = gl_ble_l2cap_connect(address_u8, le_psm, mtu, mps, credit, ble_l2cap_cb, NULL, &cid);
+
+	// json format
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "code", json_object_new_int(ret));
+	if (ret == GL_SUCCESS)
+	{
+		json_object_object_add(o, "cid", json_object_new_int(cid));
+	}
+	const char *temp = json_object_to_json_string(o);
+	printf("%s\n", temp);
+
+	json_object_put(o);
+
+	return GL_SUCCESS;
+}
+
+GL_RET cmd_l2cap_send(int argc, char **argv)
+{
+	int cid = -1, timeout = 1000;
+	char *value = NULL;
+	char *address = NULL;
+	uint8_t addr_len;
+
+	if ((argc != 4) && (argc != 5))
+	{
+		printf(PARA_MISSING);
+		return GL_ERR_PARAM;
+	}
+	address = argv[1];
+	cid = atoi(argv[2]);
+	value = argv[3];
+	if (argc == 5)
+	{
+		timeout = atoi(argv[4]);
+	}
+
+	addr_len = strlen(address);
+
+	if (addr_len < BLE_MAC_LEN - 1 || cid < 0 || (strlen(value) % 2) || strlen(value) > MAX_VALUE_DATA_LEN * 2)
 	{
-		printf(PARA_MISSING);
+		printf(PARA_ERROR);
 		return GL_ERR_PARAM;
 	}
-	address = argv[1];
-	char_handle = atoi(argv[2]);
-	res = atoi(argv[3]);
-	value = argv[4];
 
-	if (address == NULL)
+	uint8_t data[MAX_VALUE_DATA_LEN];
+	int len = strlen(value) / 2;
+	int i = 0;
+	while (i < len)
+	{
+		unsigned int byte = 0;
+		sscanf(value + i * 2, "%2x", &byte);
+		data[i] = (uint8_t)byte;
+		i++;
+	}
+
+	BLE_MAC address_u8;
+	str2addr(address, address_u8);
+
+	GL_RET ret = gl_ble_l2cap_send(address_u8, cid, data, len, timeout);
+
+	// json format
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "code", json_object_new_int(ret));
+	const char *temp = json_object_to_json_string(o);
+	printf("%s\n", temp);
+
+	json_object_put(o);
+
+	return GL_SUCCESS;
+}
+
+GL_RET cmd_l2cap_disconnect(int argc, char **argv)
+{
+	int cid = -1;
+	char *address = NULL;
+	uint8_t addr_len;
+
+	if (argc != 3)
 	{
 		printf(PARA_MISSING);
 		return GL_ERR_PARAM;
 	}
+	address = argv[1];
+	cid = atoi(argv[2]);
 
 	addr_len = strlen(address);
 
-	if (addr_len < BLE_MAC_LEN - 1 || char_handle < 0 || !value)
+	if (addr_len < BLE_MAC_LEN - 1 || cid < 0)
 	{
 		printf(PARA_ERROR);
 		return GL_ERR_PARAM;
@@ -716,7 +1172,7 @@ GL_RET cmd_write_value(int argc, char **argv)
 	BLE_MAC address_u8;
 	str2addr(address, address_u8);
 
-	GL_RET ret = gl_ble_write_char(address_u8, char_handle, value, res);
+	GL_RET ret = gl_ble_l2cap_disconnect(address_u8, cid);
 
 	// json format
 	json_object *o = NULL;
@@ -956,6 +1412,332 @@ GL_RET cmd_test(int argc, char **argv)
 	return GL_SUCCESS;
 }
 
+static json_object *latency_to_json(gl_ble_latency_t *latency)
+{
+	json_object *o = json_object_new_object();
+	json_object_object_add(o, "count", json_object_new_int64(latency->count));
+	json_object_object_add(o, "min", json_object_new_int64(latency->min));
+	json_object_object_add(o, "mean", json_object_new_int64(latency->mean));
+	json_object_object_add(o, "p50", json_object_new_int64(latency->p50));
+	json_object_object_add(o, "p90", json_object_new_int64(latency->p90));
+	json_object_object_add(o, "p99", json_object_new_int64(latency->p99));
+	json_object_object_add(o, "p999", json_object_new_int64(latency->p999));
+	json_object_object_add(o, "max", json_object_new_int64(latency->max));
+	return o;
+}
+
+GL_RET cmd_get_latency(int argc, char **argv)
+{
+	const char *stage_name[LATENCY_STAGE_MAX] = {"uart", "driver", "queue", "callback", "total"};
+	bool clear = false;
+	int i;
+
+	if (argc == 2)
+	{
+		if (strcmp(argv[1], "clear"))
+		{
+			printf(PARA_ERROR);
+			return GL_ERR_PARAM;
+		}
+		clear = true;
+	}
+
+	gl_ble_latency_stats_t stats;
+	GL_RET ret = gl_ble_get_latency(&stats);
+	if (clear)
+	{
+		gl_ble_clear_latency();
+	}
+
+	// json format
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "code", json_object_new_int(ret));
+	if (ret == GL_SUCCESS)
+	{
+		json_object *stage = json_object_new_object();
+		for (i = 0; i < LATENCY_STAGE_MAX; i++)
+		{
+			json_object_object_add(stage, stage_name[i], latency_to_json(&stats.stage[i]));
+		}
+		json_object_object_add(o, "stage", stage);
+
+		json_object *cmd = json_object_new_array();
+		for (i = 0; i < stats.cmd_class_num; i++)
+		{
+			json_object *c = latency_to_json(&stats.cmd[i].latency);
+			json_object_object_add(c, "class", json_object_new_int(stats.cmd[i].class_id));
+			json_object_array_add(cmd, c);
+		}
+		json_object_object_add(o, "cmd", cmd);
+	}
+	const char *temp = json_object_to_json_string(o);
+	printf("%s\n", temp);
+
+	json_object_put(o);
+
+	return GL_SUCCESS;
+}
+
+static void stats_to_json(json_object *o, gl_ble_stats_t *stats)
+{
+	json_object_object_add(o, "rx_evt_frames", json_object_new_int64(stats->rx_evt_frames));
+	json_object_object_add(o, "rx_evt_bytes", json_object_new_int64(stats->rx_evt_bytes));
+	json_object_object_add(o, "rx_rsp_frames", json_object_new_int64(stats->rx_rsp_frames));
+	json_object_object_add(o, "rx_rsp_bytes", json_object_new_int64(stats->rx_rsp_bytes));
+	json_object_object_add(o, "tx_cmd_frames", json_object_new_int64(stats->tx_cmd_frames));
+	json_object_object_add(o, "tx_cmd_bytes", json_object_new_int64(stats->tx_cmd_bytes));
+	json_object_object_add(o, "parse_errors", json_object_new_int64(stats->parse_errors));
+	json_object_object_add(o, "resyncs", json_object_new_int64(stats->resyncs));
+	json_object_object_add(o, "evt_queue_drops", json_object_new_int64(stats->evt_queue_drops));
+	json_object_object_add(o, "watcher_queue_drops", json_object_new_int64(stats->watcher_queue_drops));
+	json_object_object_add(o, "cmd_timeouts", json_object_new_int64(stats->cmd_timeouts));
+	json_object_object_add(o, "stale_rsps", json_object_new_int64(stats->stale_rsps));
+	json_object_object_add(o, "log_drops", json_object_new_int64(stats->log_drops));
+	json_object_object_add(o, "capture_drops", json_object_new_int64(stats->capture_drops));
+	json_object_object_add(o, "evt_queue_high", json_object_new_int(stats->evt_queue_high));
+	json_object_object_add(o, "watcher_queue_high", json_object_new_int(stats->watcher_queue_high));
+	json_object_object_add(o, "dev_num", json_object_new_int(stats->dev_num));
+}
+
+GL_RET cmd_get_stats(int argc, char **argv)
+{
+	gl_ble_stats_t stats;
+	GL_RET ret = gl_ble_get_stats(&stats);
+
+	// json format
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "code", json_object_new_int(ret));
+	if (ret == GL_SUCCESS)
+	{
+		stats_to_json(o, &stats);
+	}
+	const char *temp = json_object_to_json_string(o);
+	printf("%s\n", temp);
+
+	json_object_put(o);
+
+	return GL_SUCCESS;
+}
+
+GL_RET cmd_set_sampler(int argc, char **argv)
+{
+	if (argc != 2)
+	{
+		printf(PARA_MISSING);
+		return GL_ERR_PARAM;
+	}
+
+	GL_RET ret = gl_ble_set_sampler(atoi(argv[1]));
+
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "code", json_object_new_int(ret));
+	const char *temp = json_object_to_json_string(o);
+	printf("%s\n", temp);
+
+	json_object_put(o);
+
+	return GL_SUCCESS;
+}
+
+static json_object *ncp_stats_to_json(gl_ble_ncp_stats_t *ncp)
+{
+	json_object *o = json_object_new_object();
+	json_object_object_add(o, "samples", json_object_new_int64(ncp->samples));
+	json_object_object_add(o, "time_ns", json_object_new_int64(ncp->time_ns));
+	if (ncp->radio_valid)
+	{
+		json_object *radio = json_object_new_object();
+		json_object_object_add(radio, "tx_packets", json_object_new_int64(ncp->tx_packets));
+		json_object_object_add(radio, "rx_packets", json_object_new_int64(ncp->rx_packets));
+		json_object_object_add(radio, "crc_errors", json_object_new_int64(ncp->crc_errors));
+		json_object_object_add(radio, "failures", json_object_new_int64(ncp->radio_failures));
+		json_object_object_add(o, "radio", radio);
+	}
+	if (ncp->coex_valid)
+	{
+		json_object *coex = json_object_new_object();
+		json_object_object_add(coex, "low_requested", json_object_new_int64(ncp->coex_low_requested));
+		json_object_object_add(coex, "high_requested", json_object_new_int64(ncp->coex_high_requested));
+		json_object_object_add(coex, "low_denied", json_object_new_int64(ncp->coex_low_denied));
+		json_object_object_add(coex, "high_denied", json_object_new_int64(ncp->coex_high_denied));
+		json_object_object_add(coex, "low_tx_aborted", json_object_new_int64(ncp->coex_low_tx_aborted));
+		json_object_object_add(coex, "high_tx_aborted", json_object_new_int64(ncp->coex_high_tx_aborted));
+		json_object_object_add(o, "coex", coex);
+	}
+	if (ncp->memory_valid)
+	{
+		json_object *memory = json_object_new_object();
+		json_object_object_add(memory, "heap_bytes_used", json_object_new_int64(ncp->heap_bytes_used));
+		json_object_object_add(memory, "peak_heap_bytes_used", json_object_new_int64(ncp->peak_heap_bytes_used));
+		json_object_object_add(memory, "peak_stack_bytes_used", json_object_new_int64(ncp->peak_stack_bytes_used));
+		json_object_object_add(memory, "live_allocations", json_object_new_int64(ncp->live_allocations));
+		json_object_object_add(memory, "peak_live_allocations", json_object_new_int64(ncp->peak_live_allocations));
+		json_object_object_add(memory, "errors", json_object_new_int64(ncp->memory_errors));
+		json_object_object_add(o, "memory", memory);
+	}
+	return o;
+}
+
+GL_RET cmd_get_snapshot(int argc, char **argv)
+{
+	gl_ble_snapshot_t snapshot;
+	GL_RET ret = gl_ble_get_snapshot(&snapshot);
+
+	// json format
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "code", json_object_new_int(ret));
+	if (ret == GL_SUCCESS)
+	{
+		json_object_object_add(o, "time_ns", json_object_new_int64(snapshot.time_ns));
+		json_object *host = json_object_new_object();
+		stats_to_json(host, &snapshot.host);
+		json_object_object_add(o, "host", host);
+		json_object_object_add(o, "ncp", ncp_stats_to_json(&snapshot.ncp));
+	}
+	const char *temp = json_object_to_json_string(o);
+	printf("%s\n", temp);
+
+	json_object_put(o);
+
+	return GL_SUCCESS;
+}
+
+GL_RET cmd_capture_start(int argc, char **argv)
+{
+	if (argc != 2)
+	{
+		printf(PARA_MISSING);
+		return GL_ERR_PARAM;
+	}
+
+	GL_RET ret = gl_ble_capture_start(argv[1]);
+
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "code", json_object_new_int(ret));
+	const char *temp = json_object_to_json_string(o);
+	printf("%s\n", temp);
+
+	json_object_put(o);
+
+	return GL_SUCCESS;
+}
+
+GL_RET cmd_capture_stop(int argc, char **argv)
+{
+	GL_RET ret = gl_ble_capture_stop();
+
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "code", json_object_new_int(ret));
+	const char *temp = json_object_to_json_string(o);
+	printf("%s\n", temp);
+
+	json_object_put(o);
+
+	return GL_SUCCESS;
+}
+
+GL_RET cmd_get_hw_cfg(int argc, char **argv)
+{
+	gl_ble_hw_cfg_t cfg;
+	GL_RET ret = gl_ble_get_hw_cfg(&cfg);
+
+	// json format
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "code", json_object_new_int(ret));
+	if (ret == GL_SUCCESS)
+	{
+		json_object_object_add(o, "model", json_object_new_string(cfg.model));
+		json_object_object_add(o, "port", json_object_new_string(cfg.port));
+		json_object_object_add(o, "baudrate", json_object_new_int64(cfg.baudRate));
+		json_object_object_add(o, "flowcontrol", json_object_new_int(cfg.flowcontrol));
+		json_object_object_add(o, "rst_trigger", json_object_new_int(cfg.rst_trigger));
+		json_object_object_add(o, "rst_gpio", json_object_new_int(cfg.rst_gpio));
+		json_object_object_add(o, "rst_pulse", json_object_new_int(cfg.rst_pulse));
+	}
+	const char *temp = json_object_to_json_string(o);
+	printf("%s\n", temp);
+
+	json_object_put(o);
+
+	return GL_SUCCESS;
+}
+
+GL_RET cmd_get_balance(int argc, char **argv)
+{
+	gl_ble_balance_t balance;
+	GL_RET ret = gl_ble_get_balance(&balance);
+
+	// json format
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "code", json_object_new_int(ret));
+	if (ret == GL_SUCCESS)
+	{
+		json_object_object_add(o, "enable", json_object_new_boolean(balance.enable));
+		json_object *array = json_object_new_array();
+		json_object_object_add(o, "modules", array);
+		int i;
+		for (i = 0; i < BLE_RADIO_MAX; i++)
+		{
+			if (!balance.radio[i].up)
+			{
+				continue;
+			}
+			json_object *m = json_object_new_object();
+			json_object_object_add(m, "index", json_object_new_int(i));
+			json_object_object_add(m, "max_conn", json_object_new_int(balance.radio[i].max_conn));
+			json_object_object_add(m, "connections", json_object_new_int(balance.radio[i].connections));
+			json_object_object_add(m, "load", json_object_new_int64(balance.radio[i].load));
+			json_object_object_add(m, "scan_phy", json_object_new_int(balance.radio[i].scan_phy));
+			json_object_array_add(array, m);
+		}
+	}
+	const char *temp = json_object_to_json_string(o);
+	printf("%s\n", temp);
+
+	json_object_put(o);
+
+	return GL_SUCCESS;
+}
+
+GL_RET cmd_get_attach_info(int argc, char **argv)
+{
+	gl_ble_attach_info_t info;
+	GL_RET ret = gl_ble_get_attach_info(&info);
+
+	// json format
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "code", json_object_new_int(ret));
+	if (ret == GL_SUCCESS)
+	{
+		json_object_object_add(o, "warm", json_object_new_boolean(info.warm));
+		if (info.warm)
+		{
+			char version[32];
+			sprintf(version, "%d.%d.%d-%d", info.major, info.minor, info.patch, info.build);
+			json_object_object_add(o, "version", json_object_new_string(version));
+			json_object_object_add(o, "adv_set", json_object_new_boolean(info.adv_set));
+			json_object_object_add(o, "connections", json_object_new_int(info.connections));
+			json_object_object_add(o, "unknown_connections", json_object_new_int(info.unknown_connections));
+			json_object_object_add(o, "bondings", json_object_new_int(info.bondings));
+		}
+	}
+	const char *temp = json_object_to_json_string(o);
+	printf("%s\n", temp);
+
+	json_object_put(o);
+
+	return GL_SUCCESS;
+}
+
 GL_RET cmd_sw_reset(int argc, char **argv)
 {
 
@@ -982,15 +1764,41 @@ GL_RET cmd_sw_reset(int argc, char **argv)
 	return GL_SUCCESS;
 }
 
+static void dfu_progress_cb(gl_ble_dfu_progress_t *progress, void *arg)
+{
+	int *percent = (int *)arg;
+	int now = (int)((uint64_t)progress->sent * 100 / progress->total);
+
+	// print once per percent
+	if ((now == *percent) && (progress->sent != progress->total))
+	{
+		return;
+	}
+	*percent = now;
+
+	json_object *o = NULL;
+	o = json_object_new_object();
+	json_object_object_add(o, "type", json_object_new_string("dfu_progress"));
+	json_object_object_add(o, "total", json_object_new_int(progress->total));
+	json_object_object_add(o, "sent", json_object_new_int(progress->sent));
+	json_object_object_add(o, "throughput", json_object_new_int(progress->throughput));
+	json_object_object_add(o, "retries", json_object_new_int(progress->retries));
+	const char *temp = json_object_to_json_string(o);
+	printf("DFU_MSG >> %s\n", temp);
+
+	json_object_put(o);
+}
+
 GL_RET cmd_dfu_uart_flash_upload(int argc, char **argv)
 {
 	uint8_t *file_path = NULL;
+	int percent = -1;
 	if (argc == 2)
 	{
 		file_path = argv[1];
 	}
 
-	GL_RET ret = gl_ble_dfu_uart_flash_upload(file_path);
+	GL_RET ret = gl_ble_dfu_uart_flash_upload_progress(file_path, dfu_progress_cb, &percent);
 
 	json_object *o = NULL;
 	o = json_object_new_object();
@@ -1034,7 +1842,24 @@ command_t command_list[] = {
 	{"get_char", cmd_get_char, "Get supported characteristics in specified service"},
 	{"set_notify", cmd_set_notify, "Enable or disable the notifications and indications"},
 	{"read_value", cmd_read_value, "Read specified characteristic value"},
+	{"read_multiple_value", cmd_read_multiple_value, "Read several characteristic values with one request"},
+	{"read_value_by_uuid", cmd_read_value_by_uuid, "Read characteristic values by UUID in specified service"},
 	{"write_value", cmd_write_value, "Write characteristic value"},
+	{"read_value_sync", cmd_read_value_sync, "Read characteristic value and wait for it"},
+	{"write_value_sync", cmd_write_value_sync, "Write characteristic value with response and wait for the response"},
+	{"l2cap_listen", cmd_l2cap_listen, "Accept L2CAP connection-oriented channels of a LE_PSM"},
+	{"l2cap_connect", cmd_l2cap_connect, "Open a L2CAP connection-oriented channel"},
+	{"l2cap_send", cmd_l2cap_send, "Send data on a L2CAP connection-oriented channel"},
+	{"l2cap_disconnect", cmd_l2cap_disconnect, "Close a L2CAP connection-oriented channel"},
+	{"get_latency", cmd_get_latency, "Get the latency histograms of events and commands"},
+	{"get_stats", cmd_get_stats, "Get the counters of the serial link and the driver"},
+	{"set_sampler", cmd_set_sampler, "Start or stop reading the counters of the ble module"},
+	{"get_snapshot", cmd_get_snapshot, "Get the counters of the SDK and of the ble module"},
+	{"capture_start", cmd_capture_start, "Write the frames on the serial port to a pcapng file"},
+	{"capture_stop", cmd_capture_stop, "Stop writing the frames on the serial port"},
+	{"get_hw_cfg", cmd_get_hw_cfg, "Get the serial port and reset IO of the ble module"},
+	{"get_attach_info", cmd_get_attach_info, "Get what was taken over from a running module"},
+	{"get_balance", cmd_get_balance, "Get the connections of every module started with -b"},
 	{"sw_reset", cmd_sw_reset, "Software reset"},
 	{"dfu_uart_flash_upload", cmd_dfu_uart_flash_upload, "Update the firmware over the serial port"},
 	{"test", cmd_test, "test"},
@@ -1073,7 +1898,35 @@ static char cmdprompt[] = "bletool >> ";
 
 int main(int argc, char *argv[])
 {
-	gl_ble_init();
+	int i;
+	int module_num = 1;
+	for (i = 1; i < argc; i++)
+	{
+		// -a: keep the module running and take over the connections of the last bletool
+		if (0 == strcmp(argv[i], "-a"))
+		{
+			gl_ble_set_init_mode(BLE_INIT_ATTACH);
+		}
+		// -r <index>: drive another module, such as a USB dongle described by gl_ble.hw1
+		else if ((0 == strcmp(argv[i], "-r")) && (i + 1 < argc))
+		{
+			if (gl_ble_ctx_use(gl_ble_ctx_get(atoi(argv[++i]))) != GL_SUCCESS)
+			{
+				printf("invalid module index\n");
+				return -1;
+			}
+		}
+		// -b <num>: drive modules 0 to num - 1 and balance the connections across them
+		else if ((0 == strcmp(argv[i], "-b")) && (i + 1 < argc))
+		{
+			module_num = atoi(argv[++i]);
+			if ((module_num < 1) || (module_num > BLE_RADIO_MAX))
+			{
+				printf("invalid module number\n");
+				return -1;
+			}
+		}
+	}
 
 	gl_ble_cbs ble_cb;
 	memset(&ble_cb, 0, sizeof(gl_ble_cbs));
@@ -1081,7 +1934,23 @@ int main(int argc, char *argv[])
 	ble_cb.ble_gap_event = ble_gap_cb;
 	ble_cb.ble_gatt_event = ble_gatt_cb;
 	ble_cb.ble_module_event = ble_module_cb;
-	gl_ble_subscribe(&ble_cb);
+
+	gl_ble_ctx_t *ctx = gl_ble_ctx_current();
+	for (i = 0; i < module_num; i++)
+	{
+		if (module_num > 1)
+		{
+			gl_ble_ctx_use(gl_ble_ctx_get(i));
+		}
+		gl_ble_init();
+		gl_ble_subscribe(&ble_cb);
+	}
+	gl_ble_ctx_use(ctx);
+
+	if (module_num > 1)
+	{
+		gl_ble_set_balance(1);
+	}
 
 	signal(SIGTERM, sigal_hander);
 	signal(SIGINT, sigal_hander);
@@ -1108,7 +1977,14 @@ int main(int argc, char *argv[])
 		inputstr = NULL;
 	}
 
-	gl_ble_destroy();
+	for (i = 0; i < module_num; i++)
+	{
+		if (module_num > 1)
+		{
+			gl_ble_ctx_use(gl_ble_ctx_get(i));
+		}
+		gl_ble_destroy();
+	}
 
 	return 0;
 }
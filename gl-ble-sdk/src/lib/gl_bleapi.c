@@ -23,6 +23,7 @@
 #include <sys/msg.h>
 #include <unistd.h>
 #include <errno.h>
+#include <pthread.h>
 
 #include "gl_bleapi.h"
 #include "gl_dev_mgr.h"
@@ -31,44 +32,326 @@
 #include "gl_hal.h"
 #include "gl_methods.h"
 #include "gl_thread.h"
+#include "timestamp.h"
+#include "gl_stats.h"
 #include "silabs_msg.h"
 #include "silabs_evt.h"
+#include "gl_radio.h"
+#include "gl_balance.h"
+#include "gl_capture.h"
 
 gl_ble_cbs ble_msg_cb;
 
 /************************************************************************************************************************************/
 
-void *ble_driver_thread_ctx = NULL;
-void *ble_watcher_thread_ctx = NULL;
+struct gl_ble_ctx
+{
+	void *driver_thread_ctx;
+	void *watcher_thread_ctx;
+	int *msqid;
+	driver_param_t *driver_param;
+	watcher_param_t *watcher_param;
+	gl_ble_init_mode_t init_mode;
+	gl_ble_cbs *user_cbs;
+	gl_ble_cbs cbs; // the callbacks of the user with the hooks of the balancer
+};
+
+static gl_ble_ctx_t ctx_list[RADIO_MAX];
+
+// connections and discoveries spread across the radios, see gl_ble_set_balance
+static pthread_mutex_t balance_mutex = PTHREAD_MUTEX_INITIALIZER;
+static bool balance_enable = false;
+static struct
+{
+	int phys; // 0 when no balanced discovery runs
+	int interval;
+	int window;
+	int type;
+	int mode;
+} balance_scan;
+static uint8_t scan_phy[RADIO_MAX]; // the PHY each radio was started to scan
+
+// the context of a radio is its slot in ctx_list
+static gl_ble_ctx_t *ctx_cur(void)
+{
+	return &ctx_list[radio_cur()];
+}
+
+static int ctx_index(gl_ble_ctx_t *ctx)
+{
+	return (int)(ctx - ctx_list);
+}
+
+static void radio_load(gl_ble_radio_load_t *list)
+{
+	int cur = radio_cur();
+	gl_ble_hw_cfg_t cfg;
+
+	memset(list, 0, sizeof(gl_ble_radio_load_t) * RADIO_MAX);
+	for (int i = 0; i < RADIO_MAX; i++)
+	{
+		if (NULL == ctx_list[i].driver_thread_ctx)
+		{
+			continue;
+		}
+
+		radio_bind(i);
+		list[i].up = true;
+		list[i].max_conn = ((hal_get_cfg(&cfg) == GL_SUCCESS) && (cfg.max_conn)) ? cfg.max_conn : BLE_MAX_CONN_DEFAULT;
+		list[i].connections = (uint8_t)ble_dev_mgr_get_load(&list[i].load);
+		list[i].scan_phy = scan_phy[i];
+	}
+	radio_bind(cur);
+}
+
+/*
+ * Start or move the balanced discovery to follow the load of the radios, called with balance_mutex locked.
+ * Only the radios whose PHY changed are restarted.
+ */
+static GL_RET scan_apply(void)
+{
+	gl_ble_radio_load_t list[RADIO_MAX];
+	GL_RET ret = GL_UNKNOW_ERR;
+	int cur = radio_cur();
 
-static int *msqid = NULL;
-static driver_param_t *_driver_param = NULL;
-static watcher_param_t *_watcher_param = NULL;
+	radio_load(list);
+	balance_plan(list, RADIO_MAX, balance_scan.phys);
+
+	for (int i = 0; i < RADIO_MAX; i++)
+	{
+		if (list[i].scan_phy == scan_phy[i])
+		{
+			if (scan_phy[i])
+			{
+				ret = GL_SUCCESS;
+			}
+			continue;
+		}
+
+		radio_bind(i);
+		if (scan_phy[i])
+		{
+			ble_stop_discovery();
+			scan_phy[i] = 0;
+		}
+		if ((list[i].scan_phy) &&
+			(ble_discovery(list[i].scan_phy, balance_scan.interval, balance_scan.window, balance_scan.type, balance_scan.mode) == GL_SUCCESS))
+		{
+			scan_phy[i] = list[i].scan_phy;
+			ret = GL_SUCCESS;
+		}
+	}
+	radio_bind(cur);
+
+	return ret;
+}
+
+/*
+ * Stop the discovery on every radio, called with balance_mutex locked.
+ */
+static void scan_stop_all(void)
+{
+	int cur = radio_cur();
+
+	for (int i = 0; i < RADIO_MAX; i++)
+	{
+		if (scan_phy[i])
+		{
+			radio_bind(i);
+			ble_stop_discovery();
+			scan_phy[i] = 0;
+		}
+	}
+	radio_bind(cur);
+
+	balance_scan.phys = 0;
+}
+
+static void scan_rebalance(void)
+{
+	pthread_mutex_lock(&balance_mutex);
+	if ((balance_enable) && (balance_scan.phys))
+	{
+		scan_apply();
+	}
+	pthread_mutex_unlock(&balance_mutex);
+}
+
+/*
+ * Bind the calling thread to the radio holding the device while the balancer is on.
+ * Return the radio to bind again when the call is done.
+ */
+static int route_begin(BLE_MAC address)
+{
+	int cur = radio_cur();
+
+	if ((!balance_enable) || (NULL == address))
+	{
+		return cur;
+	}
+
+	char address_str[BLE_MAC_LEN] = {0};
+	addr2str(address, address_str);
+	int radio = ble_dev_mgr_find_radio(address_str);
+	if (radio >= 0)
+	{
+		radio_bind(radio);
+	}
+
+	return cur;
+}
+
+static void route_end(int radio)
+{
+	radio_bind(radio);
+}
+
+/*
+ * The L2CAP and async GATT callbacks run in the driver thread, which receives the responses and events
+ * of the module: a call waiting for them there would never get them.
+ */
+#define DRIVER_THREAD_REFUSE()               \
+	do                                       \
+	{                                        \
+		if (ble_in_driver_thread())          \
+		{                                    \
+			return GL_ERR_INVALID_STATE;     \
+		}                                    \
+	} while (0)
+
+// callbacks run in the watcher thread of their radio
+static int32_t hook_module_event(gl_ble_module_event_t event, gl_ble_module_data_t *data)
+{
+	gl_ble_ctx_t *ctx = ctx_cur();
+	int32_t ret = 0;
+
+	if (ctx->user_cbs->ble_module_event)
+	{
+		ret = ctx->user_cbs->ble_module_event(event, data);
+	}
+
+	// a module which booted again scans nothing, it joins the balanced discovery again
+	if (event == MODULE_BLE_SYSTEM_BOOT_EVT)
+	{
+		pthread_mutex_lock(&balance_mutex);
+		scan_phy[ctx_index(ctx)] = 0;
+		pthread_mutex_unlock(&balance_mutex);
+		scan_rebalance();
+	}
+
+	return ret;
+}
+
+static int32_t hook_gap_event(gl_ble_gap_event_t event, gl_ble_gap_data_t *data)
+{
+	gl_ble_ctx_t *ctx = ctx_cur();
+	int32_t ret = 0;
+
+	if (ctx->user_cbs->ble_gap_event)
+	{
+		ret = ctx->user_cbs->ble_gap_event(event, data);
+	}
+
+	// the load of the radio changed
+	if ((event == GAP_BLE_CONNECT_EVT) || (event == GAP_BLE_DISCONNECT_EVT))
+	{
+		scan_rebalance();
+	}
+
+	return ret;
+}
 
 /************************************************************************************************************************************/
+gl_ble_ctx_t *gl_ble_ctx_get(int index)
+{
+	if ((index < 0) || (index >= RADIO_MAX))
+	{
+		return NULL;
+	}
+
+	return &ctx_list[index];
+}
+
+GL_RET gl_ble_ctx_use(gl_ble_ctx_t *ctx)
+{
+	if ((NULL == ctx) || (ctx < ctx_list) || (ctx >= ctx_list + RADIO_MAX))
+	{
+		return GL_ERR_PARAM;
+	}
+
+	radio_bind(ctx_index(ctx));
+	return GL_SUCCESS;
+}
+
+gl_ble_ctx_t *gl_ble_ctx_current(void)
+{
+	return ctx_cur();
+}
+
+int gl_ble_ctx_index(gl_ble_ctx_t *ctx)
+{
+	if ((NULL == ctx) || (ctx < ctx_list) || (ctx >= ctx_list + RADIO_MAX))
+	{
+		return -1;
+	}
+
+	return ctx_index(ctx);
+}
+
+GL_RET gl_ble_set_balance(int enable)
+{
+	pthread_mutex_lock(&balance_mutex);
+	if ((!enable) && (balance_scan.phys))
+	{
+		scan_stop_all();
+	}
+	balance_enable = enable ? true : false;
+	pthread_mutex_unlock(&balance_mutex);
+
+	return GL_SUCCESS;
+}
+
+GL_RET gl_ble_get_balance(gl_ble_balance_t *balance)
+{
+	if (NULL == balance)
+	{
+		return GL_ERR_PARAM;
+	}
+
+	pthread_mutex_lock(&balance_mutex);
+	balance->enable = balance_enable;
+	radio_load(balance->radio);
+	pthread_mutex_unlock(&balance_mutex);
+
+	return GL_SUCCESS;
+}
+
 GL_RET gl_ble_init(void)
 {
+	gl_ble_ctx_t *ctx = ctx_cur();
+
 	// err return if ble driver thread exist
-	if ((NULL != _driver_param) || (NULL != ble_driver_thread_ctx))
+	if ((NULL != ctx->driver_param) || (NULL != ctx->driver_thread_ctx))
 	{
 		return GL_ERR_INVOKE;
 	}
 
 	// init work thread param
-	_driver_param = (driver_param_t *)malloc(sizeof(driver_param_t));
+	ctx->driver_param = (driver_param_t *)malloc(sizeof(driver_param_t));
 
 	// create an event message queue if it not exist
-	if (NULL == msqid)
+	if (NULL == ctx->msqid)
 	{
-		msqid = (int *)malloc(sizeof(int));
-		*msqid = msgget(IPC_PRIVATE, 0666 | IPC_CREAT);
-		if (*msqid == -1)
+		ctx->msqid = (int *)malloc(sizeof(int));
+		*ctx->msqid = msgget(IPC_PRIVATE, 0666 | IPC_CREAT);
+		if (*ctx->msqid == -1)
 		{
 			log_err("create msg queue error!!!\n");
 			return GL_UNKNOW_ERR;
 		}
 	}
-	_driver_param->evt_msgid = *msqid;
+	ctx->driver_param->evt_msgid = *ctx->msqid;
+	ctx->driver_param->radio = ctx_index(ctx);
 
 	/* Init device manage */
 	ble_dev_mgr_init();
@@ -78,14 +361,14 @@ GL_RET gl_ble_init(void)
 
 	// create a thread to recv module message
 	int ret;
-	ret = HAL_ThreadCreate(&ble_driver_thread_ctx, ble_driver, _driver_param, NULL, NULL);
+	ret = HAL_ThreadCreate(&ctx->driver_thread_ctx, ble_driver, ctx->driver_param, NULL, NULL);
 	if (ret != 0)
 	{
 		log_err("pthread_create ble_driver_thread_ctx failed!\n");
 		// free driver_param_t & driver ctx
-		free(_driver_param);
-		_driver_param = NULL;
-		ble_driver_thread_ctx = NULL;
+		free(ctx->driver_param);
+		ctx->driver_param = NULL;
+		ctx->driver_thread_ctx = NULL;
 
 		// close hal fd
 		hal_destroy();
@@ -95,21 +378,70 @@ GL_RET gl_ble_init(void)
 		return GL_UNKNOW_ERR;
 	}
 
+	// a module which answers is already usable
+	if ((ctx->init_mode == BLE_INIT_PROBE) && (ble_probe() == GL_SUCCESS))
+	{
+		return GL_SUCCESS;
+	}
+
+	if ((ctx->init_mode == BLE_INIT_ATTACH) && (ble_attach() == GL_SUCCESS))
+	{
+		return GL_SUCCESS;
+	}
+
 	// reset ble module to make sure it is a usable mode
 	gl_ble_hard_reset();
 
 	return GL_SUCCESS;
 }
 
+GL_RET gl_ble_set_init_mode(gl_ble_init_mode_t mode)
+{
+	if ((mode != BLE_INIT_RESET) && (mode != BLE_INIT_PROBE) && (mode != BLE_INIT_ATTACH))
+	{
+		return GL_ERR_PARAM;
+	}
+
+	ctx_cur()->init_mode = mode;
+	return GL_SUCCESS;
+}
+
+GL_RET gl_ble_get_hw_cfg(gl_ble_hw_cfg_t *cfg)
+{
+	return hal_get_cfg(cfg);
+}
+
+GL_RET gl_ble_set_hw_cfg(const gl_ble_hw_cfg_t *cfg)
+{
+	gl_ble_ctx_t *ctx = ctx_cur();
+
+	// the running driver keeps using the config it was started with
+	if ((NULL != ctx->driver_param) || (NULL != ctx->driver_thread_ctx))
+	{
+		return GL_ERR_INVOKE;
+	}
+
+	return hal_set_cfg(cfg);
+}
+
 GL_RET gl_ble_destroy(void)
 {
+	gl_ble_ctx_t *ctx = ctx_cur();
+
+	// the sampler sends commands until it is stopped
+	ble_set_sampler(0);
+
+	pthread_mutex_lock(&balance_mutex);
+	scan_phy[ctx_index(ctx)] = 0;
+	pthread_mutex_unlock(&balance_mutex);
+
 	// close msg thread
-	HAL_ThreadDelete(ble_driver_thread_ctx);
-	ble_driver_thread_ctx = NULL;
+	HAL_ThreadDelete(ctx->driver_thread_ctx);
+	ctx->driver_thread_ctx = NULL;
 
 	// free driver_param_t
-	free(_driver_param);
-	_driver_param = NULL;
+	free(ctx->driver_param);
+	ctx->driver_param = NULL;
 
 	// close hal fd
 	hal_destroy();
@@ -118,54 +450,62 @@ GL_RET gl_ble_destroy(void)
 	ble_dev_mgr_destroy();
 
 	// destroy evt msg queue
-	if (-1 == msgctl(*msqid, IPC_RMID, NULL))
+	if (-1 == msgctl(*ctx->msqid, IPC_RMID, NULL))
 	{
 		log_err("msgctl error");
 		return GL_UNKNOW_ERR;
 	}
-	free(msqid);
-	msqid = NULL;
+	free(ctx->msqid);
+	ctx->msqid = NULL;
 
 	return GL_SUCCESS;
 }
 
 GL_RET gl_ble_subscribe(gl_ble_cbs *callback)
 {
+	gl_ble_ctx_t *ctx = ctx_cur();
+
 	if (NULL == callback)
 	{
 		return GL_ERR_PARAM;
 	}
 
 	// error return if watcher thread exist
-	if ((NULL != _watcher_param) || (NULL != ble_watcher_thread_ctx))
+	if ((NULL != ctx->watcher_param) || (NULL != ctx->watcher_thread_ctx))
 	{
 		return GL_ERR_INVOKE;
 	}
 
-	_watcher_param = (watcher_param_t *)malloc(sizeof(watcher_param_t));
+	ctx->watcher_param = (watcher_param_t *)malloc(sizeof(watcher_param_t));
 
 	// create an event message queue if it not exist
-	if (NULL == msqid)
+	if (NULL == ctx->msqid)
 	{
-		msqid = (int *)malloc(sizeof(int));
-		*msqid = msgget(IPC_PRIVATE, 0666 | IPC_CREAT);
-		if (*msqid == -1)
+		ctx->msqid = (int *)malloc(sizeof(int));
+		*ctx->msqid = msgget(IPC_PRIVATE, 0666 | IPC_CREAT);
+		if (*ctx->msqid == -1)
 		{
 			log_err("create msg queue error!!!\n");
 			return GL_UNKNOW_ERR;
 		}
 	}
-	_watcher_param->evt_msgid = *msqid;
-	_watcher_param->cbs = callback;
+	ctx->user_cbs = callback;
+	ctx->cbs = *callback;
+	ctx->cbs.ble_module_event = hook_module_event;
+	ctx->cbs.ble_gap_event = hook_gap_event;
+
+	ctx->watcher_param->evt_msgid = *ctx->msqid;
+	ctx->watcher_param->radio = ctx_index(ctx);
+	ctx->watcher_param->cbs = &ctx->cbs;
 
 	int ret;
-	ret = HAL_ThreadCreate(&ble_watcher_thread_ctx, ble_watcher, _watcher_param, NULL, NULL);
+	ret = HAL_ThreadCreate(&ctx->watcher_thread_ctx, ble_watcher, ctx->watcher_param, NULL, NULL);
 	if (ret != 0)
 	{
 		log_err("pthread_create failed!\n");
 		// free watcher_param_t
-		free(_watcher_param);
-		_watcher_param = NULL;
+		free(ctx->watcher_param);
+		ctx->watcher_param = NULL;
 		return GL_UNKNOW_ERR;
 	}
 
@@ -174,112 +514,454 @@ GL_RET gl_ble_subscribe(gl_ble_cbs *callback)
 
 GL_RET gl_ble_unsubscribe(void)
 {
-	HAL_ThreadDelete(ble_watcher_thread_ctx);
-	ble_watcher_thread_ctx = NULL;
+	gl_ble_ctx_t *ctx = ctx_cur();
+
+	HAL_ThreadDelete(ctx->watcher_thread_ctx);
+	ctx->watcher_thread_ctx = NULL;
 
 	// free watcher_param_t
-	free(_watcher_param);
-	_watcher_param = NULL;
+	free(ctx->watcher_param);
+	ctx->watcher_param = NULL;
 
 	return GL_SUCCESS;
 }
 
 GL_RET gl_ble_enable(int32_t enable)
 {
+	DRIVER_THREAD_REFUSE();
+
 	return ble_enable(enable);
 }
 
 GL_RET gl_ble_hard_reset(void)
 {
+	DRIVER_THREAD_REFUSE();
+
 	return ble_hard_reset();
 }
 
+GL_RET gl_ble_wait_boot(uint32_t timeout)
+{
+	DRIVER_THREAD_REFUSE();
+
+	return ble_wait_boot(timeout);
+}
+
+GL_RET gl_ble_probe(void)
+{
+	DRIVER_THREAD_REFUSE();
+
+	return ble_probe();
+}
+
+GL_RET gl_ble_get_attach_info(gl_ble_attach_info_t *info)
+{
+	return ble_get_attach_info(info);
+}
+
 GL_RET gl_ble_get_mac(BLE_MAC mac)
 {
+	DRIVER_THREAD_REFUSE();
+
 	return ble_local_mac(mac);
 }
 
 GL_RET gl_ble_set_power(int power, int *current_power)
 {
+	DRIVER_THREAD_REFUSE();
+
 	return ble_set_power(power, current_power);
 }
 
 GL_RET gl_ble_adv_data(int flag, char *data)
 {
+	DRIVER_THREAD_REFUSE();
+
 	return ble_adv_data(flag, data);
 }
 
 GL_RET gl_ble_adv(int phys, int interval_min, int interval_max, int discover, int adv_conn)
 {
+	DRIVER_THREAD_REFUSE();
+
 	return ble_adv(phys, interval_min, interval_max, discover, adv_conn);
 }
 
 GL_RET gl_ble_stop_adv(void)
 {
+	DRIVER_THREAD_REFUSE();
+
 	return ble_stop_adv();
 }
 
 GL_RET gl_ble_send_notify(BLE_MAC address, int char_handle, char *value)
 {
-	return ble_send_notify(address, char_handle, value);
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_send_notify(address, char_handle, value);
+	route_end(cur);
+	return ret;
 }
 
 GL_RET gl_ble_discovery(int phys, int interval, int window, int type, int mode)
 {
-	return ble_discovery(phys, interval, window, type, mode);
+	DRIVER_THREAD_REFUSE();
+
+	if (!balance_enable)
+	{
+		return ble_discovery(phys, interval, window, type, mode);
+	}
+
+	pthread_mutex_lock(&balance_mutex);
+
+	// new parameters restart every radio
+	scan_stop_all();
+	balance_scan.phys = phys;
+	balance_scan.interval = interval;
+	balance_scan.window = window;
+	balance_scan.type = type;
+	balance_scan.mode = mode;
+
+	GL_RET ret = scan_apply();
+	if (ret != GL_SUCCESS)
+	{
+		balance_scan.phys = 0;
+	}
+	pthread_mutex_unlock(&balance_mutex);
+
+	return ret;
 }
 
 GL_RET gl_ble_stop_discovery(void)
 {
-	return ble_stop_discovery();
+	DRIVER_THREAD_REFUSE();
+
+	if (!balance_enable)
+	{
+		return ble_stop_discovery();
+	}
+
+	pthread_mutex_lock(&balance_mutex);
+	scan_stop_all();
+	pthread_mutex_unlock(&balance_mutex);
+
+	return GL_SUCCESS;
 }
 
 GL_RET gl_ble_connect(BLE_MAC address, int address_type, int phy)
 {
-	return ble_connect(address, address_type, phy);
+	DRIVER_THREAD_REFUSE();
+
+	if (!balance_enable)
+	{
+		return ble_connect(address, address_type, phy);
+	}
+
+	// a device known to a radio stays there
+	int cur = route_begin(address);
+	if (radio_cur() != cur)
+	{
+		GL_RET ret = ble_connect(address, address_type, phy);
+		route_end(cur);
+		return ret;
+	}
+
+	// one connection is placed at a time, so that the next one sees its slot taken
+	pthread_mutex_lock(&balance_mutex);
+
+	gl_ble_radio_load_t list[RADIO_MAX];
+	radio_load(list);
+
+	GL_RET ret = GL_ERR_NO_SLOT;
+	int radio;
+	while ((radio = balance_pick(list, RADIO_MAX)) >= 0)
+	{
+		radio_bind(radio);
+		ret = ble_connect(address, address_type, phy);
+		if (ret == GL_SUCCESS)
+		{
+			break;
+		}
+
+		// the firmware may have fewer slots than configured, try the next radio
+		log_warning("connect on ble module %d failed: %d\n", radio, ret);
+		list[radio].up = false;
+	}
+	radio_bind(cur);
+
+	pthread_mutex_unlock(&balance_mutex);
+
+	return ret;
 }
 
 GL_RET gl_ble_disconnect(BLE_MAC address)
 {
-	return ble_disconnect(address);
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_disconnect(address);
+	route_end(cur);
+	return ret;
 }
 
 GL_RET gl_ble_get_rssi(BLE_MAC address, int32_t *rssi)
 {
-	return ble_get_rssi(address, rssi);
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_get_rssi(address, rssi);
+	route_end(cur);
+	return ret;
 }
 
 GL_RET gl_ble_get_service(gl_ble_service_list_t *service_list, BLE_MAC address)
 {
-	return ble_get_service(service_list, address);
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_get_service(service_list, address);
+	route_end(cur);
+	return ret;
 }
 
 GL_RET gl_ble_get_char(gl_ble_char_list_t *char_list, BLE_MAC address, int service_handle)
 {
-	return ble_get_char(char_list, address, service_handle);
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_get_char(char_list, address, service_handle);
+	route_end(cur);
+	return ret;
 }
 
 GL_RET gl_ble_read_char(BLE_MAC address, int char_handle)
 {
-	return ble_read_char(address, char_handle);
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_read_char(address, char_handle);
+	route_end(cur);
+	return ret;
+}
+
+GL_RET gl_ble_read_multiple_char(BLE_MAC address, int *char_handle, int *value_len, int num, gl_ble_char_value_list_t *value_list)
+{
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_read_multiple_char(address, char_handle, value_len, num, value_list);
+	route_end(cur);
+	return ret;
+}
+
+GL_RET gl_ble_read_char_by_uuid(BLE_MAC address, int service_handle, char *uuid, gl_ble_char_value_list_t *value_list)
+{
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_read_char_by_uuid(address, service_handle, uuid, value_list);
+	route_end(cur);
+	return ret;
 }
 
 GL_RET gl_ble_write_char(BLE_MAC address, int char_handle, char *value, int res)
 {
-	return ble_write_char(address, char_handle, value, res);
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_write_char(address, char_handle, value, res);
+	route_end(cur);
+	return ret;
+}
+
+GL_RET gl_ble_read_char_sync(BLE_MAC address, int char_handle, char *value, int timeout)
+{
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_read_char_sync(address, char_handle, value, timeout);
+	route_end(cur);
+	return ret;
+}
+
+GL_RET gl_ble_write_char_sync(BLE_MAC address, int char_handle, char *value, int timeout)
+{
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_write_char_sync(address, char_handle, value, timeout);
+	route_end(cur);
+	return ret;
+}
+
+GL_RET gl_ble_read_char_async(BLE_MAC address, int char_handle, gl_ble_gatt_rsp_cb_t cb, void *arg)
+{
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_read_char_async(address, char_handle, cb, arg);
+	route_end(cur);
+	return ret;
+}
+
+GL_RET gl_ble_write_char_async(BLE_MAC address, int char_handle, char *value, gl_ble_gatt_rsp_cb_t cb, void *arg)
+{
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_write_char_async(address, char_handle, value, cb, arg);
+	route_end(cur);
+	return ret;
 }
 
 GL_RET gl_ble_set_notify(BLE_MAC address, int char_handle, int flag)
 {
-	return ble_set_notify(address, char_handle, flag);
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_set_notify(address, char_handle, flag);
+	route_end(cur);
+	return ret;
+}
+
+GL_RET gl_ble_l2cap_listen(int le_psm, int mtu, int mps, int initial_credit, gl_ble_l2cap_cb_t cb, void *arg)
+{
+	return ble_l2cap_listen(le_psm, mtu, mps, initial_credit, cb, arg);
+}
+
+GL_RET gl_ble_l2cap_stop_listen(int le_psm)
+{
+	return ble_l2cap_stop_listen(le_psm);
+}
+
+GL_RET gl_ble_l2cap_connect(BLE_MAC address, int le_psm, int mtu, int mps, int initial_credit, gl_ble_l2cap_cb_t cb, void *arg, int *cid)
+{
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_l2cap_connect(address, le_psm, mtu, mps, initial_credit, cb, arg, cid);
+	route_end(cur);
+	return ret;
+}
+
+GL_RET gl_ble_l2cap_send(BLE_MAC address, int cid, const uint8_t *data, int len, int timeout)
+{
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_l2cap_send(address, cid, data, len, timeout);
+	route_end(cur);
+	return ret;
+}
+
+GL_RET gl_ble_l2cap_disconnect(BLE_MAC address, int cid)
+{
+	DRIVER_THREAD_REFUSE();
+
+	int cur = route_begin(address);
+	GL_RET ret = ble_l2cap_disconnect(address, cid);
+	route_end(cur);
+	return ret;
 }
 
 GL_RET gl_ble_sw_reset(uint8_t mode)
 {
+	DRIVER_THREAD_REFUSE();
+
 	return ble_sw_reset(mode);
 }
 
 GL_RET gl_ble_dfu_uart_flash_upload(uint8_t *file_path)
 {
-	return ble_dfu_uart_flash_upload(file_path);
+	DRIVER_THREAD_REFUSE();
+
+	return ble_dfu_uart_flash_upload(file_path, NULL, NULL);
+}
+
+GL_RET gl_ble_dfu_uart_flash_upload_progress(uint8_t *file_path, gl_ble_dfu_progress_cb_t cb, void *arg)
+{
+	DRIVER_THREAD_REFUSE();
+
+	return ble_dfu_uart_flash_upload(file_path, cb, arg);
+}
+
+GL_RET gl_ble_get_time(uint64_t *time_ns)
+{
+	if (!time_ns)
+	{
+		return GL_ERR_PARAM;
+	}
+
+	*time_ns = utils_get_time_ns();
+	return GL_SUCCESS;
+}
+
+GL_RET gl_ble_get_latency(gl_ble_latency_stats_t *stats)
+{
+	if (!stats)
+	{
+		return GL_ERR_PARAM;
+	}
+
+	stats_get_latency(stats);
+	return GL_SUCCESS;
+}
+
+GL_RET gl_ble_clear_latency(void)
+{
+	stats_clear_latency();
+	return GL_SUCCESS;
+}
+
+GL_RET gl_ble_get_stats(gl_ble_stats_t *stats)
+{
+	if (!stats)
+	{
+		return GL_ERR_PARAM;
+	}
+
+	stats_get(stats);
+	stats->log_drops = IOT_GetLogDrops();
+	stats->capture_drops = capture_get_drops();
+	stats->dev_num = ble_dev_mgr_get_list_size();
+	return GL_SUCCESS;
+}
+
+GL_RET gl_ble_set_sampler(uint32_t period)
+{
+	return ble_set_sampler(period);
+}
+
+GL_RET gl_ble_get_snapshot(gl_ble_snapshot_t *snapshot)
+{
+	if (!snapshot)
+	{
+		return GL_ERR_PARAM;
+	}
+
+	snapshot->time_ns = utils_get_time_ns();
+	gl_ble_get_stats(&snapshot->host);
+	ble_get_ncp_stats(&snapshot->ncp);
+	return GL_SUCCESS;
+}
+
+GL_RET gl_ble_capture_start(const char *path)
+{
+	if (!path)
+	{
+		return GL_ERR_PARAM;
+	}
+
+	if (capture_start(path) != 0)
+	{
+		return GL_UNKNOW_ERR;
+	}
+	return GL_SUCCESS;
+}
+
+GL_RET gl_ble_capture_stop(void)
+{
+	capture_stop();
+	return GL_SUCCESS;
 }
@@ -28,6 +28,70 @@
 #include "gl_type.h"
 #include "gl_errno.h"
 
+/**
+ *  @brief  Get the context of a ble module.
+ *
+ *  @param index : Index of the module, from 0 to BLE_RADIO_MAX - 1. Module 0 is used by a thread which never called gl_ble_ctx_use.
+ *
+ *  @note  Every module has its own driver and watcher threads, device list and hardware config, the config
+ *         of module N (N > 0) is read from the "hwN" section of /etc/config/gl_ble.
+ *
+ *  @retval  The context, NULL if the index is out of range.
+ */
+gl_ble_ctx_t *gl_ble_ctx_get(int index);
+
+/**
+ *  @brief  Bind the calling thread to a ble module, all gl_ble_* calls of the thread go to that module.
+ *
+ *  @param ctx : Context from gl_ble_ctx_get.
+ *
+ *  @note  Callbacks are called in the watcher thread of their module, which is bound to it already.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_ctx_use(gl_ble_ctx_t *ctx);
+
+/**
+ *  @brief  Get the context of the module the calling thread is bound to.
+ *
+ *  @retval  The context.
+ */
+gl_ble_ctx_t *gl_ble_ctx_current(void);
+
+/**
+ *  @brief  Get the index of a context.
+ *
+ *  @param ctx : Context from gl_ble_ctx_get.
+ *
+ *  @retval  The index, -1 if the context is invalid.
+ */
+int gl_ble_ctx_index(gl_ble_ctx_t *ctx);
+
+/**
+ *  @brief  Spread connections and discoveries across the ble modules which were initialized.
+ *
+ *  @param enable : 1 turns the balancer on, 0 turns it off and stops a balanced discovery.
+ *
+ *  @note  gl_ble_connect opens the connection on the module with the most free connection slots, then on
+ *         the one with the fewest connection events. gl_ble_discovery scans on every module, a discovery
+ *         of both PHYs scans the 1M PHY and the coded PHY on different modules, and moves them when a
+ *         connection opens or closes. Calls which take an address go to the module holding the device,
+ *         whichever module the calling thread is bound to. Every module must be subscribed to keep its
+ *         device list, the slots of a module are set with the "max_conn" option of its uci section.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_set_balance(int enable);
+
+/**
+ *  @brief  Get the load of every ble module as seen by the balancer.
+ *
+ *  @param balance : Connection slots, connections, connection events and scanning PHY of each module.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_get_balance(gl_ble_balance_t *balance);
+
 /**
  *  @brief  This function will init ble thread.
  *
@@ -35,6 +99,46 @@
  */
 GL_RET gl_ble_init(void);
 
+/**
+ *  @brief  Choose how gl_ble_init brings up the module, call it before gl_ble_init.
+ *
+ *  @param mode : BLE_INIT_RESET resets the module. BLE_INIT_PROBE sends system_hello and only resets
+ *                the module if it does not answer, so a module left running is used as it is.
+ *                BLE_INIT_ATTACH probes the module too and takes over the advertising set and the
+ *                connections which the last process left on it.
+ *
+ *  @note  A probed module does not send "MODULE_BLE_SYSTEM_BOOT_EVT", use gl_ble_wait_boot to know it is ready.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_set_init_mode(gl_ble_init_mode_t mode);
+
+/**
+ *  @brief  Get the hardware config of the ble module.
+ *
+ *  @param cfg : Serial port and reset IO of the board.
+ *
+ *  @note  The model in glconfig.general.model is looked up in the model table of the SDK, and the options
+ *         of the "hw" section in /etc/config/gl_ble override it, a board which is not in the table is
+ *         described there alone. The config is loaded once and kept for the life of the process.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_get_hw_cfg(gl_ble_hw_cfg_t *cfg);
+
+/**
+ *  @brief  Replace the hardware config of the ble module, call it before gl_ble_init.
+ *
+ *  @param cfg : Serial port and reset IO of a custom board, rst_gpio is the final sysfs number and
+ *               the flags are not applied. NULL drops the config, so the next gl_ble_init loads it again.
+ *
+ *  @note  The port may be "pty:<path>", "unix:<path>" or "tcp:<host>:<port>" of a NCP behind a pty or socket,
+ *         it needs no UCI config and no GPIO, the module is reset by command.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_set_hw_cfg(const gl_ble_hw_cfg_t *cfg);
+
 /**
  *  @brief  This function will destroy the ble thread and wait for thread resources to be received.
  *
@@ -84,6 +188,40 @@ GL_RET gl_ble_enable(int enable);
  */
 GL_RET gl_ble_hard_reset(void);
 
+/**
+ *  @brief  Wait until the ble module booted.
+ *
+ *  @param timeout : The most time to wait (ms).
+ *
+ *  @note   Returns at once if the module is running. The driver wakes the caller up when it receives
+ *          the boot event, there is no polling.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_wait_boot(uint32_t timeout);
+
+/**
+ *  @brief  Check that the ble module is running with system_hello.
+ *
+ *  @note   If the module answers before its boot event was received, it is taken as booted.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_probe(void);
+
+/**
+ *  @brief  Get how gl_ble_init found the module.
+ *
+ *  @param info : Firmware version, restored advertising set, connections and bondings of a warm module.
+ *
+ *  @note   The host state is saved to /tmp/gl_ble.state (/tmp/gl_ble.state.N for module N) on every change, BLE_INIT_ATTACH restores
+ *          the connections of it which are still open on the module. Bondings stay in the flash of
+ *          the module and are only counted. "warm" is cleared when the module boots again.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_get_attach_info(gl_ble_attach_info_t *info);
+
 /**
  *  @brief  This command can be used to read the Bluetooth public address used by the device.
  *
@@ -276,12 +414,47 @@ GL_RET gl_ble_get_char(gl_ble_char_list_t *char_list, BLE_MAC address, int servi
  */
 GL_RET gl_ble_read_char(BLE_MAC address, int char_handle);
 
+/**
+ *  @brief  Act as master, Read values of several characteristics in a remote gatt server with one request.
+ *
+ *  @param address : Remote BLE device MAC address. Like “11:22:33:44:55:66”.
+ *  @param char_handle : Array of characteristic handles to read, at least 2 and at most LIST_LENGTHE_MAX.
+ *  @param value_len : Array of the value length (bytes) of each characteristic. The length of the last
+ *                     characteristic is ignored. If NULL, the concatenated value is reported in value_list->list[0].
+ *  @param num : Number of characteristic handles.
+ *  @param value_list : The characteristic values, in the order they were requested.
+ *
+ *  @note : Only use this API for characteristics that have a known fixed size, except the last one.
+ *          The values are returned together when the procedure completed, and will not be
+ *          reported in gatt_event_callback.
+ *          A value of more than 127 bytes does not fit value_list, GL_ERR_MSG is returned.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_read_multiple_char(BLE_MAC address, int *char_handle, int *value_len, int num, gl_ble_char_value_list_t *value_list);
+
+/**
+ *  @brief  Act as master, Read values of all characteristics with the given UUID in a service of a remote gatt server.
+ *
+ *  @param address : Remote BLE device MAC address. Like “11:22:33:44:55:66”.
+ *  @param service_handle : The service handle of connection with remote device.
+ *  @param uuid : Characteristic UUID, the same format as gl_ble_get_char() reports. Like “2a00”.
+ *  @param value_list : The values of the matched characteristics.
+ *
+ *  @note : The values are returned together when the procedure completed, and will not be
+ *          reported in gatt_event_callback.
+ *          A value of more than 127 bytes does not fit value_list, GL_ERR_MSG is returned.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_read_char_by_uuid(BLE_MAC address, int service_handle, char *uuid, gl_ble_char_value_list_t *value_list);
+
 /**
  *  @brief  Act as master, Write value to specified characteristic in a remote gatt server.
  *
  *  @param address : Remote BLE device MAC address. Like “11:22:33:44:55:66”.
  *  @param char_handle : The characteristic handle of connection with remote device.
- *  @param value : Data value to be wrote. Must be hexadecimal ASCII. Like “020106”
+ *  @param value : Data value to be wrote. Must be hexadecimal ASCII. Like “020106”, up to 256 bytes, GL_ERR_PARAM if longer.
  *  @param res : Response flag. \n
  * 					0: Write with no response \n
  * 					1: Write with response
@@ -290,6 +463,64 @@ GL_RET gl_ble_read_char(BLE_MAC address, int char_handle);
  */
 GL_RET gl_ble_write_char(BLE_MAC address, int char_handle, char *value, int res);
 
+/**
+ *  @brief  Act as master, Read value of specified characteristic and wait for it.
+ *
+ *  @param address : Remote BLE device MAC address. Like “11:22:33:44:55:66”.
+ *  @param char_handle : The characteristic handle of connection with remote device.
+ *  @param value : The value read, hexadecimal ASCII. The buffer must hold CHAR_VALUE_MAX bytes.
+ *  @param timeout : Time to wait for the value (ms).
+ *
+ *  @note : The value is returned to the caller only, it will not be reported in gatt_event_callback.
+ *          Requests of different connections can be waited for from several threads at the same time.
+ *
+ *  @retval  GL-RETURN-CODE. GL_ERR_EVENT_MISSING if timeout, GL_ERR_INVOKE if the connection has a request in progress.
+ */
+GL_RET gl_ble_read_char_sync(BLE_MAC address, int char_handle, char *value, int timeout);
+
+/**
+ *  @brief  Act as master, Write value to specified characteristic with response and wait for the response.
+ *
+ *  @param address : Remote BLE device MAC address. Like “11:22:33:44:55:66”.
+ *  @param char_handle : The characteristic handle of connection with remote device.
+ *  @param value : Data value to be wrote. Must be hexadecimal ASCII. Like “020106”, up to 256 bytes, GL_ERR_PARAM if longer.
+ *  @param timeout : Time to wait for the response (ms).
+ *
+ *  @retval  GL-RETURN-CODE. GL_ERR_EVENT_MISSING if timeout, GL_ERR_INVOKE if the connection has a request in progress.
+ */
+GL_RET gl_ble_write_char_sync(BLE_MAC address, int char_handle, char *value, int timeout);
+
+/**
+ *  @brief  Act as master, Read value of specified characteristic, the value is passed to cb.
+ *
+ *  @param address : Remote BLE device MAC address. Like “11:22:33:44:55:66”.
+ *  @param char_handle : The characteristic handle of connection with remote device.
+ *  @param cb : Called once the request completed, failed or the connection closed.
+ *  @param arg : User data passed to cb.
+ *
+ *  @note : cb is called in the driver thread, it must return quickly. The APIs which talk to the module
+ *          can not be called there, they return GL_ERR_INVALID_STATE.
+ *
+ *  @retval  GL-RETURN-CODE. cb is called only if GL_SUCCESS returned.
+ */
+GL_RET gl_ble_read_char_async(BLE_MAC address, int char_handle, gl_ble_gatt_rsp_cb_t cb, void *arg);
+
+/**
+ *  @brief  Act as master, Write value to specified characteristic with response, the result is passed to cb.
+ *
+ *  @param address : Remote BLE device MAC address. Like “11:22:33:44:55:66”.
+ *  @param char_handle : The characteristic handle of connection with remote device.
+ *  @param value : Data value to be wrote. Must be hexadecimal ASCII. Like “020106”, up to 256 bytes, GL_ERR_PARAM if longer.
+ *  @param cb : Called once the request completed, failed or the connection closed.
+ *  @param arg : User data passed to cb.
+ *
+ *  @note : cb is called in the driver thread, it must return quickly. The APIs which talk to the module
+ *          can not be called there, they return GL_ERR_INVALID_STATE.
+ *
+ *  @retval  GL-RETURN-CODE. cb is called only if GL_SUCCESS returned.
+ */
+GL_RET gl_ble_write_char_async(BLE_MAC address, int char_handle, char *value, gl_ble_gatt_rsp_cb_t cb, void *arg);
+
 /**
  *  @brief  Act as master, Enable or disable the notification or indication of a remote gatt server.
  *
@@ -304,6 +535,75 @@ GL_RET gl_ble_write_char(BLE_MAC address, int char_handle, char *value, int res)
  */
 GL_RET gl_ble_set_notify(BLE_MAC address, int char_handle, int flag);
 
+/**
+ *  @brief  Accept L2CAP connection-oriented channels of a LE_PSM opened by remote devices.
+ *
+ *  @param le_psm : LE Protocol/Service Multiplexer, 1 - 255.
+ *  @param mtu : Maximum SDU size the local device can receive, 23 - 252.
+ *  @param mps : Maximum PDU payload size the local device can receive, 23 - 65533.
+ *  @param initial_credit : Number of PDUs the remote device can send before it gets more credits.
+ *  @param cb : Called with the events of the accepted channels.
+ *  @param arg : User data passed to cb.
+ *
+ *  @note : Credits are given back to the remote device automatically when the data callback returned,
+ *          a slow callback slows down the sender.
+ *          cb is called in the driver thread, it must return quickly. The APIs which talk to the module
+ *          can not be called there, they return GL_ERR_INVALID_STATE.
+ *
+ *  @retval  GL-RETURN-CODE. GL_ERR_INVOKE if the LE_PSM is already listened.
+ */
+GL_RET gl_ble_l2cap_listen(int le_psm, int mtu, int mps, int initial_credit, gl_ble_l2cap_cb_t cb, void *arg);
+
+/**
+ *  @brief  Stop accepting L2CAP connection-oriented channels of a LE_PSM. Opened channels are not closed.
+ *
+ *  @param le_psm : LE Protocol/Service Multiplexer.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_l2cap_stop_listen(int le_psm);
+
+/**
+ *  @brief  Open a L2CAP connection-oriented channel to a remote device and wait for the response.
+ *
+ *  @param address : Remote BLE device MAC address. Like “11:22:33:44:55:66”.
+ *  @param le_psm : LE Protocol/Service Multiplexer of the remote service, 1 - 255.
+ *  @param mtu : Maximum SDU size the local device can receive, 23 - 252.
+ *  @param mps : Maximum PDU payload size the local device can receive, 23 - 65533.
+ *  @param initial_credit : Number of PDUs the remote device can send before it gets more credits.
+ *  @param cb : Called with the events of the channel.
+ *  @param arg : User data passed to cb.
+ *  @param cid : The channel id used by the other L2CAP APIs.
+ *
+ *  @note : cb is called in the driver thread, see gl_ble_l2cap_listen.
+ *
+ *  @retval  GL-RETURN-CODE. GL_ERR_EVENT_MISSING if timeout, GL_UNKNOW_ERR if refused.
+ */
+GL_RET gl_ble_l2cap_connect(BLE_MAC address, int le_psm, int mtu, int mps, int initial_credit, gl_ble_l2cap_cb_t cb, void *arg, int *cid);
+
+/**
+ *  @brief  Send a SDU on a L2CAP connection-oriented channel.
+ *
+ *  @param address : Remote BLE device MAC address. Like “11:22:33:44:55:66”.
+ *  @param cid : The channel id.
+ *  @param data : Binary data.
+ *  @param len : Length of data, no more than 252 bytes and the MTU of the remote device.
+ *  @param timeout : Time to wait for credits of the remote device (ms). 0: return at once if no credit.
+ *
+ *  @retval  GL-RETURN-CODE. GL_ERR_EVENT_MISSING if no credit in time.
+ */
+GL_RET gl_ble_l2cap_send(BLE_MAC address, int cid, const uint8_t *data, int len, int timeout);
+
+/**
+ *  @brief  Close a L2CAP connection-oriented channel. L2CAP_CHANNEL_CLOSED_EVT is reported when it is closed.
+ *
+ *  @param address : Remote BLE device MAC address. Like “11:22:33:44:55:66”.
+ *  @param cid : The channel id.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_l2cap_disconnect(BLE_MAC address, int cid);
+
 /**
  *  @brief  Software reset.
  *
@@ -321,8 +621,107 @@ GL_RET gl_ble_sw_reset(uint8_t mode);
  *
  *  @param file_path : Path of the new firmware file. Notice that this interface identifies only. GBL files
  *
+ *  @note  The length and CRC of the file are checked against its GBL end tag first, GL_ERR_PARAM if they don't match.
+ *         An interrupted upload of the same file continues from the last acknowledged offset, each module
+ *         keeps its own in /tmp/gl_ble_dfu.session (/tmp/gl_ble_dfu.session.N for module N).
+ *
  *  @retval  GL-RETURN-CODE
  */
 GL_RET gl_ble_dfu_uart_flash_upload(uint8_t *file_path);
 
+/**
+ *  @brief  Update the firmware over the serial port and report the progress.
+ *
+ *  @param file_path : Path of the new firmware file. Notice that this interface identifies only. GBL files
+ *  @param cb : Called in the calling thread after every chunk acknowledged by the module. Can be NULL.
+ *  @param arg : User data passed to cb.
+ *
+ *  @note  Same as gl_ble_dfu_uart_flash_upload. When resumed, sent starts at the resumed offset.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_dfu_uart_flash_upload_progress(uint8_t *file_path, gl_ble_dfu_progress_cb_t cb, void *arg);
+
+/**
+ *  @brief  Get the time of the clock used by the time_ns of the callback data.
+ *
+ *  @param time_ns : CLOCK_MONOTONIC time (ns). Events are stamped when read from the serial port,
+ *                   so the delay of an event is the difference to its time_ns.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_get_time(uint64_t *time_ns);
+
+/**
+ *  @brief  Get the latency histograms of the SDK.
+ *
+ *  @param stats : Latency of every stage of an event from the serial port to the return of its callback,
+ *                 and the round trip of the commands of every BGAPI class.
+ *
+ *  @note  The histograms are always recorded, they count from the start or the last gl_ble_clear_latency.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_get_latency(gl_ble_latency_stats_t *stats);
+
+/**
+ *  @brief  Clear the latency histograms.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_clear_latency(void);
+
+/**
+ *  @brief  Get the counters of the serial link and the driver.
+ *
+ *  @param stats : Frames and bytes of every message class, errors of the serial link,
+ *                 dropped events, high-water marks of the event queues and command timeouts.
+ *
+ *  @note  The counters are kept per thread and summed when read, they count from the start of the program.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_get_stats(gl_ble_stats_t *stats);
+
+/**
+ *  @brief  Start, change or stop the sampler which reads the counters of the ble module.
+ *
+ *  @param period : Time between two samples (ms), 100 ~ 60000. 0 to stop the sampler.
+ *
+ *  @note  The sampler reads the packet, coexistence and memory counters of the module in its own thread.
+ *         Its commands give way to the commands of the user and are tried again in the next period.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_set_sampler(uint32_t period);
+
+/**
+ *  @brief  Get the counters of the SDK and the last sample of the counters of the ble module.
+ *
+ *  @param snapshot : host is the same as gl_ble_get_stats, ncp is only valid while the sampler runs.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_get_snapshot(gl_ble_snapshot_t *snapshot);
+
+/**
+ *  @brief  Start writing the frames on the serial port of every module to a capture file.
+ *
+ *  @param path : pcapng file, created or truncated. A capture which runs is stopped first.
+ *
+ *  @note  Every module is an interface of link type USER0 (147), a frame is stamped when its header is read
+ *         or before it is written. Frames are queued and written by a thread of their own, they are dropped
+ *         if the queue is full. The port "replay:<path>" plays a capture back to the driver.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_capture_start(const char *path);
+
+/**
+ *  @brief  Write the queued frames and close the capture file.
+ *
+ *  @retval  GL-RETURN-CODE
+ */
+GL_RET gl_ble_capture_stop(void);
+
 #endif
\ No newline at end of file
@@ -91,6 +91,16 @@ typedef enum gl_error {
  */	
 	GL_ERR_INVOKE					= GL_ERR_BASE + 7, 
 
+/**
+ * @brief No ble module has a free connection slot.
+ */
+	GL_ERR_NO_SLOT					= GL_ERR_BASE + 8,
+
+/**
+ * @brief Called in the driver thread, which can not wait for the ble module.
+ */
+	GL_ERR_INVALID_STATE			= GL_ERR_BASE + 9,
+
 }errcode_t;
 
 #endif
\ No newline at end of file
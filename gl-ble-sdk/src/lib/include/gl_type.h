@@ -52,6 +52,49 @@ typedef struct {
     uint8_t properties;
 } ble_characteristic_node_t;
 
+#define BLE_RADIO_MAX               4 ///< ble modules driven by one process
+
+#define HW_CFG_QSDK_GPIO            0x01 ///< add 412 to rst_gpio if the kernel numbers the GPIOs from gpiochip412
+#define HW_CFG_QUIET_PRINTK         0x02 ///< lower the console log level of the kernel
+#define HW_CFG_NO_RST_IO            0x04 ///< the module has no reset IO, such as a USB dongle
+#define HW_CFG_RTS_RST              0x08 ///< the reset of the module is wired to the RTS of its serial port
+
+/**
+ * @brief hardware of the ble module on a board.
+ */
+typedef struct {
+    char model[20]; ///< model name
+    char port[32]; ///< serial port name, or "pty:<path>", "unix:<path>", "tcp:<host>:<port>" of a NCP behind a pty or socket
+    uint32_t baudRate; ///< baud rate (bits/second)
+    uint32_t flowcontrol; ///< true enables RTS/CTS flow control
+    uint8_t rst_trigger; ///< rst trigger: 1 means high, 0 means low
+    uint16_t rst_gpio; ///< sysfs number of the reset IO
+    uint16_t rst_pulse; ///< reset pulse width (ms)
+    uint8_t flags; ///< HW_CFG_*, applied once when the config is loaded
+    uint8_t max_conn; ///< connections the firmware of the module supports, 0 means BLE_MAX_CONN_DEFAULT
+} gl_ble_hw_cfg_t;
+
+#define BLE_MAX_CONN_DEFAULT        4 ///< connections of the NCP firmware built with the default SDK config
+
+/**
+ * @brief load of one ble module, which the connection balancer looks at.
+ */
+typedef struct {
+    bool up; ///< the module was initialized
+    uint8_t max_conn; ///< connections the firmware supports
+    uint8_t connections; ///< open connections and connections being opened
+    uint32_t load; ///< connection events per second of its connections
+    uint8_t scan_phy; ///< PHY it scans in a balanced discovery, 0 if it does not scan
+} gl_ble_radio_load_t;
+
+/**
+ * @brief state of the connection balancer.
+ */
+typedef struct {
+    bool enable; ///< gl_ble_connect and gl_ble_discovery are spread across the modules
+    gl_ble_radio_load_t radio[BLE_RADIO_MAX];
+} gl_ble_balance_t;
+
 /**
  * @brief BLE 48-bit MAC.
  */
@@ -74,6 +117,188 @@ typedef struct {
 } gl_ble_char_list_t;
 
 
+/**
+ * @brief characteristic value node.
+ */
+typedef struct {
+    int32_t handle;
+    char value[CHAR_VALUE_MAX];
+} ble_char_value_node_t;
+
+/**
+ * @brief characteristic value list.
+ */
+typedef struct {
+    uint8_t list_len; ///< length of characteristic value list
+    ble_char_value_node_t list[LIST_LENGTHE_MAX]; ///< array of characteristic value node
+} gl_ble_char_value_list_t;
+
+/**
+ * @brief completion of an asynchronous GATT request.
+ */
+typedef struct {
+    BLE_MAC address; ///< remote device address
+    int32_t char_handle; ///< characteristic handle of the request
+    int32_t result; ///< GL-RETURN-CODE of the request
+    char value[CHAR_VALUE_MAX]; ///< value read, hexadecimal ASCII. Empty for a write
+    uint64_t time_ns; ///< receive time of the response, CLOCK_MONOTONIC (ns)
+} gl_ble_gatt_rsp_t;
+
+/**
+ * @brief callback of an asynchronous GATT request.
+ */
+typedef void (*gl_ble_gatt_rsp_cb_t)(gl_ble_gatt_rsp_t *rsp, void *arg);
+
+
+/**
+ * @brief progress of a firmware upload.
+ */
+typedef struct {
+    uint32_t total; ///< size of the firmware file (bytes)
+    uint32_t sent; ///< bytes acknowledged by the module
+    uint32_t throughput; ///< average upload speed (bytes/s)
+    uint32_t retries; ///< number of chunks sent again
+} gl_ble_dfu_progress_t;
+
+/**
+ * @brief callback of the firmware upload progress, called after every chunk.
+ */
+typedef void (*gl_ble_dfu_progress_cb_t)(gl_ble_dfu_progress_t *progress, void *arg);
+
+/**
+ * @brief context of one ble module, a process drives up to BLE_RADIO_MAX modules.
+ */
+typedef struct gl_ble_ctx gl_ble_ctx_t;
+
+/**
+ * @brief how gl_ble_init brings up the module.
+ */
+typedef enum {
+    BLE_INIT_RESET = 0, ///< hard reset the module (default)
+    BLE_INIT_PROBE, ///< probe the module with system_hello, reset it only if it does not answer
+    BLE_INIT_ATTACH, ///< probe the module and take over the advertising set and connections of the last process
+} gl_ble_init_mode_t;
+
+/**
+ * @brief how gl_ble_init found the module.
+ */
+typedef struct {
+    bool warm; ///< the module was running and was not reset
+    uint16_t major; ///< firmware version of a warm module
+    uint16_t minor;
+    uint16_t patch;
+    uint16_t build;
+    bool adv_set; ///< the advertising set of the last process is used again
+    uint32_t connections; ///< connections of the last process which are still open
+    uint32_t unknown_connections; ///< open connections whose address is unknown, they are left open
+    uint32_t bondings; ///< bondings stored on the module
+} gl_ble_attach_info_t;
+
+/**
+ * @brief stages of an event from the serial port to the application.
+ */
+typedef enum {
+    LATENCY_STAGE_UART = 0, ///< header read to frame complete
+    LATENCY_STAGE_DRIVER, ///< frame complete to queued for the watcher thread
+    LATENCY_STAGE_QUEUE, ///< queued to taken by the watcher thread
+    LATENCY_STAGE_CALLBACK, ///< taken to callback returned
+    LATENCY_STAGE_TOTAL, ///< header read to callback returned
+    LATENCY_STAGE_MAX,
+} gl_ble_latency_stage_t;
+
+#define LATENCY_CMD_CLASS_MAX 32
+
+/**
+ * @brief summary of a latency histogram, all times in us.
+ */
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint32_t mean;
+    uint32_t p50;
+    uint32_t p90;
+    uint32_t p99;
+    uint32_t p999;
+} gl_ble_latency_t;
+
+/**
+ * @brief event stage latencies and command round trips by BGAPI class.
+ */
+typedef struct {
+    gl_ble_latency_t stage[LATENCY_STAGE_MAX];
+    int32_t cmd_class_num; ///< number of classes used so far
+    struct {
+        int32_t class_id; ///< BGAPI command class, such as 0x09 for gatt
+        gl_ble_latency_t latency;
+    } cmd[LATENCY_CMD_CLASS_MAX];
+} gl_ble_latency_stats_t;
+
+/**
+ * @brief counters of the serial link and the driver, since the SDK was loaded.
+ */
+typedef struct {
+    uint64_t rx_evt_frames; ///< events received
+    uint64_t rx_evt_bytes;
+    uint64_t rx_rsp_frames; ///< responses received
+    uint64_t rx_rsp_bytes;
+    uint64_t tx_cmd_frames; ///< commands sent
+    uint64_t tx_cmd_bytes;
+    uint64_t parse_errors; ///< frames with a bad header or a short payload
+    uint64_t resyncs; ///< times bytes were skipped to find the start of a frame
+    uint64_t evt_queue_drops; ///< events dropped because the driver queue was full
+    uint64_t watcher_queue_drops; ///< events which could not be queued for the watcher thread
+    uint64_t cmd_timeouts; ///< commands without response in time
+    uint64_t stale_rsps; ///< responses which came after their command timed out
+    uint64_t log_drops; ///< log messages dropped because the log ring was full
+    uint64_t capture_drops; ///< frames missing in the capture because its ring was full
+    uint32_t evt_queue_high; ///< most events waiting in the driver queue
+    uint32_t watcher_queue_high; ///< most events waiting for the watcher thread
+    uint32_t dev_num; ///< connections in the device table
+} gl_ble_stats_t;
+
+/**
+ * @brief counters of the ble module, read by the sampler.
+ *
+ * The packet and coexistence counters are reset on the module when read, they are summed here.
+ * Each group is only valid if the firmware of the module supports its command.
+ */
+typedef struct {
+    uint32_t samples; ///< times the sampler read the module
+    uint64_t time_ns; ///< CLOCK_MONOTONIC time of the last sample
+
+    bool radio_valid;
+    uint64_t tx_packets; ///< packets transmitted
+    uint64_t rx_packets; ///< packets received
+    uint64_t crc_errors; ///< packets received with CRC errors
+    uint64_t radio_failures; ///< aborted TX/RX packets, scheduling failures
+
+    bool coex_valid;
+    uint64_t coex_low_requested; ///< low priority requests
+    uint64_t coex_high_requested; ///< high priority requests
+    uint64_t coex_low_denied; ///< low priority requests which were not granted
+    uint64_t coex_high_denied; ///< high priority requests which were not granted
+    uint64_t coex_low_tx_aborted; ///< low priority transmissions aborted
+    uint64_t coex_high_tx_aborted; ///< high priority transmissions aborted
+
+    bool memory_valid;
+    uint32_t heap_bytes_used;
+    uint32_t peak_heap_bytes_used;
+    uint32_t peak_stack_bytes_used;
+    uint32_t live_allocations;
+    uint32_t peak_live_allocations;
+    uint32_t memory_errors; ///< error flags of the memory profiler
+} gl_ble_ncp_stats_t;
+
+/**
+ * @brief counters of the SDK and of the ble module at one time.
+ */
+typedef struct {
+    uint64_t time_ns; ///< CLOCK_MONOTONIC time of the snapshot
+    gl_ble_stats_t host;
+    gl_ble_ncp_stats_t ncp;
+} gl_ble_snapshot_t;
+
 /**
  * @brief module callback event type.
  */
@@ -93,6 +318,7 @@ typedef union {
         int32_t bootloader;
         int32_t hw;
         char ble_hash[MAX_HASH_DATA_LEN];
+        uint64_t time_ns; ///< receive time, CLOCK_MONOTONIC (ns)
     } system_boot_data;
 
 } gl_ble_module_data_t;
@@ -128,6 +354,7 @@ typedef union {
         int32_t rssi;  
         char ble_adv[MAX_ADV_DATA_LEN];
         int32_t bonding;
+        uint64_t time_ns; ///< receive time, CLOCK_MONOTONIC (ns)
     } scan_rst;
 
     struct ble_update_conn_evt_data {
@@ -137,6 +364,7 @@ typedef union {
         int32_t timeout;
         int32_t security_mode;
         int32_t txsize;
+        uint64_t time_ns; ///< receive time, CLOCK_MONOTONIC (ns)
     } update_conn_data;
 
     struct ble_connect_open_evt_data {
@@ -145,11 +373,13 @@ typedef union {
         int32_t conn_role;
         int32_t bonding;
         int32_t advertiser;
+        uint64_t time_ns; ///< receive time, CLOCK_MONOTONIC (ns)
     } connect_open_data;
 
     struct ble_disconnect_evt_data {
         BLE_MAC address;
         int32_t reason;
+        uint64_t time_ns; ///< receive time, CLOCK_MONOTONIC (ns)
     } disconnect_data;
 } gl_ble_gap_data_t;
 
@@ -203,7 +433,7 @@ typedef union {
         gl_ble_att_opcode_t att_opcode;
         int32_t offset;
         char value[MAX_VALUE_DATA_LEN];
-
+        uint64_t time_ns; ///< receive time, CLOCK_MONOTONIC (ns)
     } remote_characteristic_value;
     struct ble_local_gatt_att_evt_data {
         BLE_MAC address;
@@ -211,18 +441,61 @@ typedef union {
         gl_ble_att_opcode_t att_opcode;
         int32_t offset;
         char value[MAX_VALUE_DATA_LEN];
-
+        uint64_t time_ns; ///< receive time, CLOCK_MONOTONIC (ns)
     } local_gatt_attribute;
     struct ble_local_characteristic_status_evt_data {
         BLE_MAC address;
         int32_t characteristic;
         gl_ble_local_characteristic_status_flags_t status_flags;
         gl_ble_gatt_client_config_flag_t client_config_flags;
+        uint64_t time_ns; ///< receive time, CLOCK_MONOTONIC (ns)
     } local_characteristic_status;
 
 } gl_ble_gatt_data_t;
 
 
+/**
+ * @brief L2CAP connection-oriented channel callback event type.
+ */
+typedef enum {
+    L2CAP_CHANNEL_OPEN_EVT = 0,
+    L2CAP_CHANNEL_CLOSED_EVT,
+    L2CAP_DATA_EVT,
+    L2CAP_EVT_MAX,
+} gl_ble_l2cap_event_t;
+
+typedef union {
+    struct ble_l2cap_channel_open_evt_data {
+        BLE_MAC address;
+        int32_t cid;
+        int32_t le_psm;
+        int32_t mtu; ///< MTU of the remote device
+        int32_t mps; ///< MPS of the remote device
+        uint64_t time_ns; ///< receive time, CLOCK_MONOTONIC (ns)
+    } channel_open;
+
+    struct ble_l2cap_channel_closed_evt_data {
+        BLE_MAC address;
+        int32_t cid;
+        int32_t reason;
+        uint64_t time_ns; ///< receive time, CLOCK_MONOTONIC (ns)
+    } channel_closed;
+
+    struct ble_l2cap_data_evt_data {
+        BLE_MAC address;
+        int32_t cid;
+        const uint8_t *data; ///< binary data, only valid during the callback
+        int32_t len;
+        uint64_t time_ns; ///< receive time, CLOCK_MONOTONIC (ns)
+    } data;
+} gl_ble_l2cap_data_t;
+
+/**
+ * @brief callback of a L2CAP connection-oriented channel.
+ */
+typedef void (*gl_ble_l2cap_cb_t)(gl_ble_l2cap_event_t event, gl_ble_l2cap_data_t *data, void *arg);
+
+
 /**
  * @brief callback func.
  */
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+#
+# Generate the encoders of the BGAPI commands from the packed structs of the API headers.
+#
+#   cmdgen.py sl_bt_api.h sli_bt_api.h > sl_bt_ncp_encode.h
+#
+# An encoder writes the fixed fields and the header of a command into the packet it is given. The
+# data of a variable length array is not copied, only its length is written: the array is the last
+# field and is sent from the memory of the caller, see sl_bt_host_send(). The length of the payload
+# is left to sizeof, the length byte of the array is part of the struct.
+
+import re
+import sys
+
+# fields which are given by value and assigned
+VALUE_TYPES = {'uint8_t', 'int8_t', 'uint16_t', 'int16_t', 'uint32_t', 'int32_t', 'uint64_t', 'int64_t',
+               'bd_addr', 'uuid_128', 'aes_key_128', 'sl_bt_uuid_16_t'}
+
+# the variable part of a command, its length field
+VAR_TYPES = {'uint8array': 'uint8_t', 'byte_array': 'uint16_t'}
+
+STRUCT_RE = re.compile(r'PACKSTRUCT\(\s*struct\s+sl_bt_cmd_(\w+)_s\s*\{(.*?)\}\s*\);', re.S)
+ID_RE = re.compile(r'#define\s+sl_bt_cmd_(\w+)_id\s+(0x[0-9a-fA-F]+)')
+
+
+def parse(paths):
+    ids = {}
+    structs = {}
+    for path in paths:
+        text = open(path).read()
+        for m in ID_RE.finditer(text):
+            ids[m.group(1)] = int(m.group(2), 16)
+        for m in STRUCT_RE.finditer(text):
+            body = re.sub(r'/\*.*?\*/', '', m.group(2), flags=re.S)
+            body = re.sub(r'//[^\n]*', '', body)
+            fields = []
+            for decl in body.split(';'):
+                decl = decl.split()
+                if not decl:
+                    continue
+                if len(decl) != 2:
+                    sys.exit('unexpected field %s in sl_bt_cmd_%s' % (' '.join(decl), m.group(1)))
+                fields.append((decl[0], decl[1]))
+            structs[m.group(1)] = fields
+    return ids, structs
+
+
+def encoder(name, fields):
+    params = ['struct sl_bt_packet *cmd']
+    body = []
+    length = '0'
+    for i, (ftype, field) in enumerate(fields):
+        if ftype in VAR_TYPES:
+            if i != len(fields) - 1:
+                sys.exit('sl_bt_cmd_%s: %s is not the last field' % (name, field))
+            params.append('size_t %s_len' % field)
+            body.append('cmd->data.cmd_%s.%s.len = (%s)%s_len;' % (name, field, VAR_TYPES[ftype], field))
+            length = 'sizeof(sl_bt_cmd_%s_t) + %s_len' % (name, field)
+        elif ftype in VALUE_TYPES:
+            params.append('%s %s' % (ftype, field))
+            body.append('cmd->data.cmd_%s.%s = %s;' % (name, field, field))
+            length = 'sizeof(sl_bt_cmd_%s_t)' % name
+        else:
+            sys.exit('sl_bt_cmd_%s: unknown type %s' % (name, ftype))
+    body.append('cmd->header = SL_BT_CMD_HEADER(sl_bt_cmd_%s_id, %s);' % (name, length))
+
+    out = 'static inline void sl_bt_encode_%s(%s)\n{\n' % (name, ', '.join(params))
+    for line in body:
+        out += '    %s\n' % line
+    return out + '}\n'
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit('usage: cmdgen.py header...')
+
+    ids, structs = parse(sys.argv[1:])
+
+    out = sys.stdout
+    out.write('/* Generated by tools/cmdgen/cmdgen.py from %s, do not edit. */\n\n' %
+              ' and '.join(p.split('/')[-1] for p in sys.argv[1:]))
+    out.write('#ifndef SL_BT_NCP_ENCODE_H\n#define SL_BT_NCP_ENCODE_H\n\n')
+    out.write('#include "sli_bt_api.h"\n#include "silabs_msg.h"\n')
+    for name in sorted(ids, key=lambda n: ids[n]):
+        out.write('\n' + encoder(name, structs.get(name, [])))
+    out.write('\n#endif\n')
+
+
+if __name__ == '__main__':
+    main()
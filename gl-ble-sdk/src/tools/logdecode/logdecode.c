@@ -0,0 +1,236 @@
+/*****************************************************************************
+ * @file  demo_bleScanner.c
+ * @brief Start the BLE discovery and subscribe the BLE event
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+ 
+ http://www.apache.org/licenses/LICENSE-2.0
+ 
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "gl_log_fmt.h"
+
+typedef struct
+{
+	int level;
+	int line;
+	char file[256];
+	char func[256];
+	char module[256];
+	char *fmt;
+} fmt_t;
+
+static const char *lvl_names[] = {"emerg", "alert", "crit", "err", "warning", "notice", "info", "debug"};
+
+static fmt_t fmts[LOG_BIN_FORMATS];
+static uint8_t *data = NULL;
+static size_t data_len = 0;
+static size_t pos = 0;
+static uint64_t wall_clock = 0;
+
+static int get_le(int n, uint64_t *v)
+{
+	int i;
+
+	if (pos + n > data_len)
+	{
+		return -1;
+	}
+
+	*v = 0;
+	for (i = 0; i < n; i++)
+	{
+		*v |= (uint64_t)data[pos++] << (8 * i);
+	}
+	return 0;
+}
+
+static int get_str(int n, char *str, int size)
+{
+	uint64_t len = 0;
+
+	if ((get_le(n, &len) != 0) || (pos + len > data_len))
+	{
+		return -1;
+	}
+
+	int copy = (len < (uint64_t)size) ? (int)len : size - 1;
+	memcpy(str, data + pos, copy);
+	str[copy] = '\0';
+	pos += len;
+	return 0;
+}
+
+static int read_format(void)
+{
+	uint64_t id = 0, level = 0, line = 0, len = 0;
+
+	if ((get_le(2, &id) != 0) || (id >= LOG_BIN_FORMATS) || (get_le(1, &level) != 0) || (get_le(2, &line) != 0))
+	{
+		return -1;
+	}
+
+	fmt_t *f = &fmts[id];
+	f->level = (int)level;
+	f->line = (int)line;
+	if ((get_str(1, f->file, sizeof(f->file)) != 0) || (get_str(1, f->func, sizeof(f->func)) != 0) ||
+		(get_str(1, f->module, sizeof(f->module)) != 0) || (get_le(2, &len) != 0) || (pos + len > data_len))
+	{
+		return -1;
+	}
+
+	free(f->fmt);
+	f->fmt = (char *)calloc(1, len + 1);
+	if (!f->fmt)
+	{
+		return -1;
+	}
+	memcpy(f->fmt, data + pos, len);
+	pos += len;
+	return 0;
+}
+
+// longest line printed for a record
+#define LINE_MAX_LEN 4096
+
+/*
+ * Print fmt with the arguments in data[pos, end), as printf did when logging.
+ */
+static void print_args(const char *fmt, size_t end)
+{
+	char line[LINE_MAX_LEN];
+
+	log_fmt_format(line, sizeof(line), fmt, data + pos, (int)(end - pos));
+	fputs(line, stdout);
+	pos = end;
+}
+
+static int read_record(void)
+{
+	uint64_t id = 0, time_ns = 0, len = 0;
+
+	if ((get_le(2, &id) != 0) || (id >= LOG_BIN_FORMATS) || (get_le(8, &time_ns) != 0) || (get_le(2, &len) != 0) ||
+		(pos + len > data_len))
+	{
+		return -1;
+	}
+
+	fmt_t *f = &fmts[id];
+	if (!f->fmt)
+	{
+		printf("record of unknown format %d\n", (int)id);
+		pos += len;
+		return 0;
+	}
+
+	char date[32];
+	uint64_t now = time_ns + wall_clock;
+	time_t sec = (time_t)(now / 1000000000);
+	strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", localtime(&sec));
+	printf("%s.%09u %s|", date, (unsigned int)(now % 1000000000), lvl_names[f->level & 7]);
+	if (f->module[0])
+	{
+		printf("%s|", f->module);
+	}
+	printf("%s|%s(%d): ", f->file, f->func, f->line);
+
+	print_args(f->fmt, pos + len);
+
+	// same line ending as the text log
+	size_t n = strlen(f->fmt);
+	if ((n == 0) || (f->fmt[n - 1] != '\n'))
+	{
+		putchar('\n');
+	}
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc != 2)
+	{
+		printf("Usage: %s <binary log file>\n", argv[0]);
+		return -1;
+	}
+
+	FILE *fp = fopen(argv[1], "rb");
+	if (!fp)
+	{
+		printf("open %s failed\n", argv[1]);
+		return -1;
+	}
+
+	size_t size = 0;
+	uint8_t buf[4096];
+	while ((size = fread(buf, 1, sizeof(buf), fp)) > 0)
+	{
+		uint8_t *tmp = (uint8_t *)realloc(data, data_len + size);
+		if (!tmp)
+		{
+			fclose(fp);
+			return -1;
+		}
+		data = tmp;
+		memcpy(data + data_len, buf, size);
+		data_len += size;
+	}
+	fclose(fp);
+
+	size_t magic = strlen(LOG_BIN_MAGIC);
+	if ((data_len < magic + 1) || (memcmp(data, LOG_BIN_MAGIC, magic) != 0) || (data[magic] != LOG_BIN_VERSION))
+	{
+		printf("not a binary log file\n");
+		return -1;
+	}
+	pos = magic + 1;
+	if (get_le(8, &wall_clock) != 0)
+	{
+		printf("not a binary log file\n");
+		return -1;
+	}
+
+	int ret = 0;
+	while ((pos < data_len) && (ret == 0))
+	{
+		uint64_t count = 0;
+		switch (data[pos++])
+		{
+		case LOG_BIN_FORMAT:
+			ret = read_format();
+			break;
+		case LOG_BIN_RECORD:
+			ret = read_record();
+			break;
+		case LOG_BIN_DROPS:
+			ret = get_le(4, &count);
+			printf("--- %u messages dropped ---\n", (unsigned int)count);
+			break;
+		default:
+			ret = -1;
+			break;
+		}
+	}
+
+	// the last record may be cut off if the writer was killed
+	if (ret != 0)
+	{
+		printf("bad data at offset %u\n", (unsigned int)pos);
+	}
+
+	free(data);
+	return 0;
+}
@@ -0,0 +1,783 @@
+/*****************************************************************************
+ * @file  ncpemu.c
+ * @brief Software NCP speaking BGAPI over a pty, for benchmarks and tests without a module
+ *******************************************************************************
+ Copyright 2020 GL-iNet. https://www.gl-inet.com/
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <poll.h>
+#include <time.h>
+#include <signal.h>
+#include <getopt.h>
+#include <endian.h>
+#include <termios.h>
+
+#include "sli_bt_api.h"
+
+// the version of the firmware the driver is written for
+#define NCP_MAJOR 3
+#define NCP_MINOR 2
+#define NCP_PATCH 4
+
+// bytes after the result of a response the emulator does not know, they cover the fixed fields of any response
+#define RSP_PAD 32
+
+// scan reports, connections and notifications written in one wake up, the rest is late
+#define BURST_MAX 64
+
+// a burst of commands or connections, each queues a response or event and up to two events
+#define PENDING_MAX (BURST_MAX * 3)
+#define CONN_MAX 32
+
+#define NS_PER_SEC 1000000000ULL
+
+typedef struct
+{
+	uint64_t period; // ns, 0 disables it
+	uint64_t next;
+} rate_t;
+
+typedef struct
+{
+	uint64_t due;
+	uint16_t len;
+	uint8_t buf[SL_BGAPI_MSG_HEADER_LEN + SL_BGAPI_MAX_PAYLOAD_SIZE];
+} pending_t;
+
+typedef struct
+{
+	bool open;
+	bd_addr address;
+	uint64_t opened;
+} conn_t;
+
+static struct
+{
+	const char *link;
+	uint32_t latency; // us
+	uint32_t boot_delay; // ms
+	uint32_t devices;
+	uint32_t max_conn;
+	uint32_t duration; // s
+	uint8_t adv_len;
+	uint8_t notify_len;
+} cfg = {
+	.link = "/tmp/ncp0",
+	.boot_delay = 10,
+	.devices = 32,
+	.max_conn = 4,
+	.adv_len = 31,
+	.notify_len = 20,
+};
+
+static struct
+{
+	uint64_t commands;
+	uint64_t events;
+	uint64_t scan_reports;
+	uint64_t notifications;
+	uint64_t connections;
+	uint64_t boots;
+	uint64_t rx_bytes;
+	uint64_t tx_bytes;
+	uint64_t late;
+	uint64_t dropped;
+} stats;
+
+static volatile sig_atomic_t running = 1;
+static int master = -1;
+static bool scanning = false;
+static bool booted = false;
+static uint32_t device_next = 0;
+static conn_t conns[CONN_MAX];
+static pending_t pending[PENDING_MAX];
+static int pending_num = 0;
+
+static rate_t scan_rate, notify_rate, conn_rate, boot_rate;
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * NS_PER_SEC + ts.tv_nsec;
+}
+
+static void rate_set(rate_t *rate, double per_sec, uint64_t now)
+{
+	rate->period = (per_sec > 0) ? (uint64_t)(NS_PER_SEC / per_sec) : 0;
+	rate->next = now + rate->period;
+}
+
+/* Number of events due, a writer which cannot keep up skips what is more than a burst behind. */
+static int rate_due(rate_t *rate, uint64_t now)
+{
+	int n = 0;
+
+	if (!rate->period)
+	{
+		return 0;
+	}
+
+	while ((rate->next <= now) && (n < BURST_MAX))
+	{
+		rate->next += rate->period;
+		n++;
+	}
+	if (rate->next <= now)
+	{
+		stats.late += (now - rate->next) / rate->period + 1;
+		rate->next = now + rate->period;
+	}
+
+	return n;
+}
+
+static void link_write(const uint8_t *buf, size_t len)
+{
+	// blocking, a host which does not read fast enough slows the emulator down
+	while (len)
+	{
+		ssize_t ret = write(master, buf, len);
+		if (ret < 0)
+		{
+			if ((errno == EINTR) || (errno == EAGAIN))
+			{
+				continue;
+			}
+			return;
+		}
+		buf += ret;
+		len -= ret;
+		stats.tx_bytes += ret;
+	}
+}
+
+static void packet_header(struct sl_bt_packet *pck, uint32_t id, size_t len)
+{
+	pck->header = htole32(id | ((len & 0xff) << 8) | ((len & 0x700) >> 8));
+}
+
+static void evt_send(struct sl_bt_packet *pck, uint32_t id, size_t len)
+{
+	packet_header(pck, id, len);
+	link_write((uint8_t *)pck, SL_BGAPI_MSG_HEADER_LEN + len);
+	stats.events++;
+}
+
+/* Queue a packet for later, a response after the latency of the command or an event after it. */
+static void pending_add(struct sl_bt_packet *pck, uint32_t id, size_t len, uint64_t due)
+{
+	if (pending_num == PENDING_MAX)
+	{
+		stats.dropped++;
+		return;
+	}
+
+	pending_t *p = &pending[pending_num++];
+	packet_header(pck, id, len);
+	p->due = due;
+	p->len = SL_BGAPI_MSG_HEADER_LEN + len;
+	memcpy(p->buf, pck, p->len);
+}
+
+static void pending_flush(uint64_t now)
+{
+	int i = 0;
+
+	while (i < pending_num)
+	{
+		if (pending[i].due > now)
+		{
+			i++;
+			continue;
+		}
+
+		link_write(pending[i].buf, pending[i].len);
+		if ((pending[i].buf[0] & 0x80) != 0)
+		{
+			stats.events++;
+		}
+
+		uint32_t header;
+		memcpy(&header, pending[i].buf, sizeof(header));
+		if (SL_BGAPI_MSG_ID(le32toh(header)) == sl_bt_evt_system_boot_id)
+		{
+			booted = true;
+			stats.boots++;
+		}
+
+		// keep the order of the queue, it is a few bursts at most
+		memmove(&pending[i], &pending[i + 1], (pending_num - i - 1) * sizeof(pending_t));
+		pending_num--;
+	}
+}
+
+static void device_addr(uint32_t index, bd_addr *addr)
+{
+	addr->addr[0] = index & 0xff;
+	addr->addr[1] = (index >> 8) & 0xff;
+	addr->addr[2] = 0x00;
+	addr->addr[3] = 0xee;
+	addr->addr[4] = 0xee;
+	addr->addr[5] = 0xc0;
+}
+
+static void send_boot(void)
+{
+	struct sl_bt_packet pck;
+	memset(&pck, 0, sizeof(pck));
+
+	pck.data.evt_system_boot.major = htole16(NCP_MAJOR);
+	pck.data.evt_system_boot.minor = htole16(NCP_MINOR);
+	pck.data.evt_system_boot.patch = htole16(NCP_PATCH);
+	evt_send(&pck, sl_bt_evt_system_boot_id, sizeof(sl_bt_evt_system_boot_t));
+
+	booted = true;
+	stats.boots++;
+}
+
+/* Everything is lost on a reset, the boot event follows after the boot delay. */
+static void reset(uint64_t now)
+{
+	struct sl_bt_packet pck;
+
+	booted = false;
+	scanning = false;
+	pending_num = 0;
+	memset(conns, 0, sizeof(conns));
+
+	memset(&pck, 0, sizeof(pck));
+	pck.data.evt_system_boot.major = htole16(NCP_MAJOR);
+	pck.data.evt_system_boot.minor = htole16(NCP_MINOR);
+	pck.data.evt_system_boot.patch = htole16(NCP_PATCH);
+	pending_add(&pck, sl_bt_evt_system_boot_id, sizeof(sl_bt_evt_system_boot_t), now + cfg.boot_delay * 1000000ULL);
+}
+
+static void send_scan_report(void)
+{
+	struct sl_bt_packet pck;
+	bd_addr addr;
+	uint8_t i;
+
+	memset(&pck, 0, sizeof(pck));
+	device_addr(device_next, &addr);
+	device_next = (device_next + 1) % cfg.devices;
+
+	sl_bt_evt_scanner_scan_report_t *report = &pck.data.evt_scanner_scan_report;
+	report->packet_type = 0x00;
+	report->address = addr;
+	report->bonding = 0xff;
+	report->primary_phy = 1;
+	report->rssi = -40 - (int8_t)(addr.addr[0] % 50);
+	report->tx_power = 127;
+	report->data.len = cfg.adv_len;
+	for (i = 0; i < cfg.adv_len; i++)
+	{
+		report->data.data[i] = i;
+	}
+
+	evt_send(&pck, sl_bt_evt_scanner_scan_report_id, offsetof(sl_bt_evt_scanner_scan_report_t, data.data) + cfg.adv_len);
+	stats.scan_reports++;
+}
+
+static int conn_alloc(void)
+{
+	uint32_t i;
+
+	for (i = 0; i < cfg.max_conn; i++)
+	{
+		if (!conns[i].open)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+/* The opened and parameters events of a new connection, the handle is the index + 1. */
+static void conn_open(int index, const bd_addr *addr, uint8_t master_role, uint64_t due)
+{
+	struct sl_bt_packet pck;
+
+	conns[index].open = true;
+	conns[index].address = *addr;
+	conns[index].opened = due;
+
+	memset(&pck, 0, sizeof(pck));
+	pck.data.evt_connection_opened.address = *addr;
+	pck.data.evt_connection_opened.master = master_role;
+	pck.data.evt_connection_opened.connection = index + 1;
+	pck.data.evt_connection_opened.bonding = 0xff;
+	pck.data.evt_connection_opened.advertiser = 0xff;
+	pending_add(&pck, sl_bt_evt_connection_opened_id, sizeof(sl_bt_evt_connection_opened_t), due);
+
+	memset(&pck, 0, sizeof(pck));
+	pck.data.evt_connection_parameters.connection = index + 1;
+	pck.data.evt_connection_parameters.interval = htole16(40);
+	pck.data.evt_connection_parameters.timeout = htole16(100);
+	pck.data.evt_connection_parameters.txsize = htole16(27);
+	pending_add(&pck, sl_bt_evt_connection_parameters_id, sizeof(sl_bt_evt_connection_parameters_t), due);
+
+	stats.connections++;
+}
+
+static void conn_close(int index, uint64_t due)
+{
+	struct sl_bt_packet pck;
+
+	conns[index].open = false;
+
+	memset(&pck, 0, sizeof(pck));
+	pck.data.evt_connection_closed.reason = htole16(0x0216);
+	pck.data.evt_connection_closed.connection = index + 1;
+	pending_add(&pck, sl_bt_evt_connection_closed_id, sizeof(sl_bt_evt_connection_closed_t), due);
+}
+
+/* A peripheral connects while there is a free handle, then the oldest connection goes away. */
+static void churn(uint64_t now)
+{
+	int index = conn_alloc();
+	if (index >= 0)
+	{
+		bd_addr addr;
+		device_addr(0x8000 | device_next, &addr);
+		device_next = (device_next + 1) % cfg.devices;
+		conn_open(index, &addr, 0, now);
+		return;
+	}
+
+	uint32_t i, oldest = 0;
+	for (i = 1; i < cfg.max_conn; i++)
+	{
+		if (conns[i].opened < conns[oldest].opened)
+		{
+			oldest = i;
+		}
+	}
+	conn_close(oldest, now);
+}
+
+static void send_notification(void)
+{
+	static uint32_t next = 0;
+	struct sl_bt_packet pck;
+	uint32_t i;
+	uint8_t j;
+
+	for (i = 0; i < cfg.max_conn; i++)
+	{
+		uint32_t index = (next + i) % cfg.max_conn;
+		if (!conns[index].open)
+		{
+			continue;
+		}
+		next = index + 1;
+
+		memset(&pck, 0, sizeof(pck));
+		sl_bt_evt_gatt_characteristic_value_t *value = &pck.data.evt_gatt_characteristic_value;
+		value->connection = index + 1;
+		value->characteristic = htole16(0x0010);
+		value->att_opcode = sl_bt_gatt_handle_value_notification;
+		value->value.len = cfg.notify_len;
+		for (j = 0; j < cfg.notify_len; j++)
+		{
+			value->value.data[j] = (uint8_t)stats.notifications + j;
+		}
+
+		evt_send(&pck, sl_bt_evt_gatt_characteristic_value_id, offsetof(sl_bt_evt_gatt_characteristic_value_t, value.data) + cfg.notify_len);
+		stats.notifications++;
+		return;
+	}
+}
+
+/* Answer a command after the latency, the commands of the driver which lead to events are played along. */
+static void handle_cmd(struct sl_bt_packet *cmd, uint64_t now)
+{
+	struct sl_bt_packet rsp;
+	uint32_t id = SL_BGAPI_MSG_ID(le32toh(cmd->header));
+	uint64_t due = now + cfg.latency * 1000ULL;
+	size_t len = sizeof(uint16_t) + RSP_PAD;
+
+	stats.commands++;
+	memset(&rsp, 0, sizeof(rsp));
+
+	switch (id)
+	{
+	case sl_bt_cmd_system_reset_id:
+		// no response, the module boots
+		reset(now);
+		return;
+
+	case sl_bt_cmd_system_get_version_id:
+		rsp.data.rsp_system_get_version.major = htole16(NCP_MAJOR);
+		rsp.data.rsp_system_get_version.minor = htole16(NCP_MINOR);
+		rsp.data.rsp_system_get_version.patch = htole16(NCP_PATCH);
+		len = sizeof(sl_bt_rsp_system_get_version_t);
+		break;
+
+	case sl_bt_cmd_system_get_identity_address_id:
+		device_addr(0xffff, &rsp.data.rsp_system_get_identity_address.address);
+		len = sizeof(sl_bt_rsp_system_get_identity_address_t);
+		break;
+
+	case sl_bt_cmd_scanner_start_id:
+		scanning = true;
+		break;
+
+	case sl_bt_cmd_scanner_stop_id:
+		scanning = false;
+		break;
+
+	case sl_bt_cmd_connection_open_id:
+	{
+		int index = conn_alloc();
+		if (index < 0)
+		{
+			rsp.data.rsp_connection_open.result = htole16(SL_STATUS_NO_MORE_RESOURCE);
+			break;
+		}
+		rsp.data.rsp_connection_open.connection = index + 1;
+		pending_add(&rsp, id, len, due);
+		conn_open(index, &cmd->data.cmd_connection_open.address, 1, due);
+		return;
+	}
+
+	case sl_bt_cmd_connection_close_id:
+	{
+		uint8_t connection = cmd->data.cmd_connection_close.connection;
+		if ((connection == 0) || (connection > cfg.max_conn) || (!conns[connection - 1].open))
+		{
+			rsp.data.rsp_connection_close.result = htole16(SL_STATUS_INVALID_HANDLE);
+			break;
+		}
+		pending_add(&rsp, id, len, due);
+		conn_close(connection - 1, due);
+		return;
+	}
+
+	case sl_bt_cmd_gatt_read_characteristic_value_id:
+	{
+		pending_add(&rsp, id, len, due);
+
+		struct sl_bt_packet evt;
+		memset(&evt, 0, sizeof(evt));
+		evt.data.evt_gatt_characteristic_value.connection = cmd->data.cmd_gatt_read_characteristic_value.connection;
+		evt.data.evt_gatt_characteristic_value.characteristic = cmd->data.cmd_gatt_read_characteristic_value.characteristic;
+		evt.data.evt_gatt_characteristic_value.att_opcode = sl_bt_gatt_read_response;
+		evt.data.evt_gatt_characteristic_value.value.len = cfg.notify_len;
+		pending_add(&evt, sl_bt_evt_gatt_characteristic_value_id, offsetof(sl_bt_evt_gatt_characteristic_value_t, value.data) + cfg.notify_len, due);
+
+		memset(&evt, 0, sizeof(evt));
+		evt.data.evt_gatt_procedure_completed.connection = cmd->data.cmd_gatt_read_characteristic_value.connection;
+		pending_add(&evt, sl_bt_evt_gatt_procedure_completed_id, sizeof(sl_bt_evt_gatt_procedure_completed_t), due);
+		return;
+	}
+
+	case sl_bt_cmd_gatt_write_characteristic_value_id:
+	case sl_bt_cmd_gatt_set_characteristic_notification_id:
+	case sl_bt_cmd_gatt_write_descriptor_value_id:
+	{
+		pending_add(&rsp, id, len, due);
+
+		// the connection is the first parameter of these commands
+		struct sl_bt_packet evt;
+		memset(&evt, 0, sizeof(evt));
+		evt.data.evt_gatt_procedure_completed.connection = cmd->data.payload[0];
+		pending_add(&evt, sl_bt_evt_gatt_procedure_completed_id, sizeof(sl_bt_evt_gatt_procedure_completed_t), due);
+		return;
+	}
+
+	default:
+		// success, and zero in every field
+		break;
+	}
+
+	pending_add(&rsp, id, len, due);
+}
+
+/* Commands are 4 bytes of header and the payload, bytes which are not a command header are skipped. */
+static void link_read(uint64_t now)
+{
+	static uint8_t buf[sizeof(struct sl_bt_packet) * 4];
+	static size_t buf_len = 0;
+
+	ssize_t ret = read(master, buf + buf_len, sizeof(buf) - buf_len);
+	if (ret <= 0)
+	{
+		return;
+	}
+	buf_len += ret;
+	stats.rx_bytes += ret;
+
+	size_t pos = 0;
+	while (buf_len - pos >= SL_BGAPI_MSG_HEADER_LEN)
+	{
+		if ((buf[pos] & 0xf8) != sl_bgapi_dev_type_bt)
+		{
+			pos++;
+			continue;
+		}
+
+		uint32_t header = buf[pos] | (buf[pos + 1] << 8) | (buf[pos + 2] << 16) | ((uint32_t)buf[pos + 3] << 24);
+		size_t len = SL_BGAPI_MSG_LEN(header);
+		if (len > SL_BGAPI_MAX_PAYLOAD_SIZE)
+		{
+			pos++;
+			continue;
+		}
+		if (buf_len - pos < SL_BGAPI_MSG_HEADER_LEN + len)
+		{
+			break;
+		}
+
+		struct sl_bt_packet cmd;
+		memset(&cmd, 0, sizeof(cmd));
+		memcpy(&cmd, buf + pos, SL_BGAPI_MSG_HEADER_LEN + len);
+		handle_cmd(&cmd, now);
+		pos += SL_BGAPI_MSG_HEADER_LEN + len;
+	}
+
+	memmove(buf, buf + pos, buf_len - pos);
+	buf_len -= pos;
+}
+
+static int link_open(void)
+{
+	master = posix_openpt(O_RDWR | O_NOCTTY);
+	if ((master < 0) || (grantpt(master) != 0) || (unlockpt(master) != 0))
+	{
+		printf("open pty failed: %s\n", strerror(errno));
+		return -1;
+	}
+
+	const char *slave = ptsname(master);
+
+	// the packets pass the line discipline untouched
+	struct termios attrs;
+	if (tcgetattr(master, &attrs) == 0)
+	{
+		cfmakeraw(&attrs);
+		tcsetattr(master, TCSANOW, &attrs);
+	}
+
+	// keep the slave open, so that the master does not hang up while the host reconnects
+	if (open(slave, O_RDWR | O_NOCTTY) < 0)
+	{
+		printf("open %s failed: %s\n", slave, strerror(errno));
+		return -1;
+	}
+
+	unlink(cfg.link);
+	if (symlink(slave, cfg.link) != 0)
+	{
+		printf("link %s to %s failed: %s\n", cfg.link, slave, strerror(errno));
+		return -1;
+	}
+
+	printf("ncp on %s (port pty:%s)\n", slave, cfg.link);
+	return 0;
+}
+
+static void print_stats(uint64_t elapsed)
+{
+	double sec = (double)elapsed / NS_PER_SEC;
+	if (sec <= 0)
+	{
+		sec = 1;
+	}
+
+	printf("time %.3f s, commands %llu (%.0f/s), events %llu (%.0f/s), late %llu, dropped %llu\n", sec,
+		   (unsigned long long)stats.commands, stats.commands / sec,
+		   (unsigned long long)stats.events, stats.events / sec, (unsigned long long)stats.late,
+		   (unsigned long long)stats.dropped);
+	printf("scan reports %llu, notifications %llu, connections %llu, boots %llu, rx %llu bytes, tx %llu bytes\n",
+		   (unsigned long long)stats.scan_reports, (unsigned long long)stats.notifications,
+		   (unsigned long long)stats.connections, (unsigned long long)stats.boots,
+		   (unsigned long long)stats.rx_bytes, (unsigned long long)stats.tx_bytes);
+}
+
+static void sigal_hander(int sig)
+{
+	running = 0;
+}
+
+static void usage(const char *name)
+{
+	printf("Usage: %s [options]\n", name);
+	printf("  -p <path>   link to the pty slave, default /tmp/ncp0\n");
+	printf("  -l <us>     latency of a response, default 0\n");
+	printf("  -s <rate>   scan reports per second while scanning, default 0\n");
+	printf("  -n <rate>   notifications per second on the open connections, default 0\n");
+	printf("  -c <rate>   peripherals connecting or disconnecting per second, default 0\n");
+	printf("  -b <rate>   module resets per second, default 0\n");
+	printf("  -B <ms>     time from a reset to the boot event, default 10\n");
+	printf("  -d <num>    advertisers of the scan reports, default 32\n");
+	printf("  -m <num>    connections of the module, default 4\n");
+	printf("  -a <len>    advertising data length, default 31\n");
+	printf("  -v <len>    notification value length, default 20\n");
+	printf("  -t <s>      run time, default until interrupted\n");
+}
+
+int main(int argc, char *argv[])
+{
+	double scan = 0, notify = 0, conn = 0, boot = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "p:l:s:n:c:b:B:d:m:a:v:t:h")) != -1)
+	{
+		switch (opt)
+		{
+		case 'p':
+			cfg.link = optarg;
+			break;
+		case 'l':
+			cfg.latency = strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			scan = atof(optarg);
+			break;
+		case 'n':
+			notify = atof(optarg);
+			break;
+		case 'c':
+			conn = atof(optarg);
+			break;
+		case 'b':
+			boot = atof(optarg);
+			break;
+		case 'B':
+			cfg.boot_delay = strtoul(optarg, NULL, 0);
+			break;
+		case 'd':
+			cfg.devices = strtoul(optarg, NULL, 0);
+			break;
+		case 'm':
+			cfg.max_conn = strtoul(optarg, NULL, 0);
+			break;
+		case 'a':
+			cfg.adv_len = (uint8_t)strtoul(optarg, NULL, 0);
+			break;
+		case 'v':
+			cfg.notify_len = (uint8_t)strtoul(optarg, NULL, 0);
+			break;
+		case 't':
+			cfg.duration = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage(argv[0]);
+			return -1;
+		}
+	}
+
+	if ((cfg.devices == 0) || (cfg.max_conn == 0) || (cfg.max_conn > CONN_MAX) || (cfg.adv_len > 251) || (cfg.notify_len > 250))
+	{
+		usage(argv[0]);
+		return -1;
+	}
+
+	if (link_open() != 0)
+	{
+		return -1;
+	}
+
+	signal(SIGTERM, sigal_hander);
+	signal(SIGINT, sigal_hander);
+	signal(SIGQUIT, sigal_hander);
+
+	uint64_t start = now_ns();
+	rate_set(&scan_rate, scan, start);
+	rate_set(&notify_rate, notify, start);
+	rate_set(&conn_rate, conn, start);
+	rate_set(&boot_rate, boot, start);
+
+	// a module which was just powered on
+	send_boot();
+
+	while (running)
+	{
+		uint64_t now = now_ns();
+		if ((cfg.duration) && (now - start >= cfg.duration * NS_PER_SEC))
+		{
+			break;
+		}
+
+		// sleep until the next event which is due
+		uint64_t next = now + 100000000ULL;
+		rate_t *rates[] = {&scan_rate, &notify_rate, &conn_rate, &boot_rate};
+		int i;
+		for (i = 0; i < 4; i++)
+		{
+			if ((rates[i]->period) && (rates[i]->next < next))
+			{
+				next = rates[i]->next;
+			}
+		}
+		for (i = 0; i < pending_num; i++)
+		{
+			if (pending[i].due < next)
+			{
+				next = pending[i].due;
+			}
+		}
+
+		struct pollfd pfd = {.fd = master, .events = POLLIN};
+		struct timespec ts = {.tv_sec = 0, .tv_nsec = (next > now) ? (long)(next - now) : 0};
+		if (ppoll(&pfd, 1, &ts, NULL) > 0)
+		{
+			link_read(now_ns());
+		}
+
+		now = now_ns();
+		pending_flush(now);
+
+		int n = rate_due(&boot_rate, now);
+		if (n)
+		{
+			reset(now);
+		}
+
+		n = rate_due(&scan_rate, now);
+		while ((n--) && (booted) && (scanning))
+		{
+			send_scan_report();
+		}
+
+		n = rate_due(&conn_rate, now);
+		while ((n--) && (booted))
+		{
+			churn(now);
+		}
+		pending_flush(now);
+
+		n = rate_due(&notify_rate, now);
+		while ((n--) && (booted))
+		{
+			send_notification();
+		}
+	}
+
+	print_stats(now_ns() - start);
+	unlink(cfg.link);
+
+	return 0;
+}
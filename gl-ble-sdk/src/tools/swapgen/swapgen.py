@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+#
+# Generate the byte swap table of the BGAPI messages from the packed structs of the API headers.
+#
+#   swapgen.py sl_bt_api.h sli_bt_api.h > silabs_swap_table.h
+#
+# Every command, response and event gets the multi-byte fields of its struct, the offsets and widths
+# are left to offsetof and sizeof. A command has the id of its response, so the commands have a list
+# of their own. Both are sorted by id for a binary search.
+
+import re
+import sys
+
+# fields which are swapped, the members of a struct type are given by their path
+SWAP_TYPES = {
+    'uint16_t': [''],
+    'int16_t': [''],
+    'uint32_t': [''],
+    'int32_t': [''],
+    'uint64_t': [''],
+    'int64_t': [''],
+    'byte_array': ['.len'],
+}
+
+# fields which are left as they are
+KEEP_TYPES = {'uint8_t', 'int8_t', 'uint8array', 'bd_addr', 'uuid_128', 'aes_key_128', 'sl_bt_uuid_16_t'}
+
+# the variable part of a message is the last field
+VAR_TYPES = {'uint8array', 'byte_array'}
+
+STRUCT_RE = re.compile(r'PACKSTRUCT\(\s*struct\s+sl_bt_(evt|cmd|rsp)_(\w+)_s\s*\{(.*?)\}\s*\);', re.S)
+ID_RE = re.compile(r'#define\s+sl_bt_(evt|cmd|rsp)_(\w+)_id\s+(0x[0-9a-fA-F]+)')
+
+
+def parse(paths):
+    ids = {}
+    structs = {}
+    for path in paths:
+        text = open(path).read()
+        for m in ID_RE.finditer(text):
+            ids[(m.group(1), m.group(2))] = int(m.group(3), 16)
+        for m in STRUCT_RE.finditer(text):
+            body = re.sub(r'/\*.*?\*/', '', m.group(3), flags=re.S)
+            body = re.sub(r'//[^\n]*', '', body)
+            fields = []
+            for decl in body.split(';'):
+                decl = decl.split()
+                if not decl:
+                    continue
+                if len(decl) != 2:
+                    sys.exit('unexpected field %s in sl_bt_%s_%s' % (' '.join(decl), m.group(1), m.group(2)))
+                fields.append((decl[0], decl[1]))
+            structs[(m.group(1), m.group(2))] = fields
+    return ids, structs
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit('usage: swapgen.py header...')
+
+    ids, structs = parse(sys.argv[1:])
+    msgs = {'cmd': [], 'rx': []}
+    for key, fields in structs.items():
+        if key not in ids:
+            continue
+        swap = []
+        for i, (ftype, name) in enumerate(fields):
+            if ftype in VAR_TYPES and i != len(fields) - 1:
+                sys.exit('sl_bt_%s_%s: %s is not the last field' % (key[0], key[1], name))
+            if ftype in SWAP_TYPES:
+                swap += [name + member for member in SWAP_TYPES[ftype]]
+            elif ftype not in KEEP_TYPES:
+                sys.exit('sl_bt_%s_%s: unknown type %s' % (key[0], key[1], ftype))
+        if swap:
+            msgs['cmd' if key[0] == 'cmd' else 'rx'].append((ids[key], 'sl_bt_%s_%s' % key, swap))
+
+    out = sys.stdout
+    out.write('/* Generated by tools/swapgen/swapgen.py from %s, do not edit. */\n\n' %
+              ' and '.join(p.split('/')[-1] for p in sys.argv[1:]))
+    out.write('static const swap_field_t swap_fields[] = {\n')
+    first = 0
+    index = {}
+    for kind in ('cmd', 'rx'):
+        index[kind] = []
+        for msg_id, name, swap in sorted(msgs[kind]):
+            for field in swap:
+                out.write('    SWAP_FIELD(%s_t, %s),\n' % (name, field))
+            index[kind].append((name, first, len(swap)))
+            first += len(swap)
+    out.write('};\n')
+    for kind in ('cmd', 'rx'):
+        out.write('\nstatic const swap_msg_t swap_%s_msgs[] = {\n' % kind)
+        for name, first, num in index[kind]:
+            out.write('    { %s_id, %d, %d },\n' % (name, first, num))
+        out.write('};\n')
+
+
+if __name__ == '__main__':
+    main()